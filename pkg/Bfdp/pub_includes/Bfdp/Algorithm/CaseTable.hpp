@@ -0,0 +1,174 @@
+/**
+    BFDP Algorithm Case Table Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Algorithm_CaseTable
+#define Bfdp_Algorithm_CaseTable
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/ByteBuffer.hpp"
+#include "Bfdp/Macros.hpp"
+
+namespace Bfdp
+{
+
+    namespace Algorithm
+    {
+
+        //! Case Table
+        //!
+        //! Maps a set of unique tag values to case numbers in constant time.  When the tags span
+        //! a small range, the table is a dense jump table indexed by the tag.  Otherwise a
+        //! two-level perfect hash is built, so a lookup is two hashes and two table reads,
+        //! regardless of the number of cases.
+        class CaseTable BFDP_FINAL
+        {
+        public:
+            //! Returned by Find() when a tag has no case
+            static size_t const NoCase = static_cast< size_t >( -1 );
+
+            //! Largest range of tags that always uses a dense table
+            static uint64_t const MinDenseRange = 256U;
+
+            //! Largest ratio of the range of tags to the number of cases for a dense table
+            static uint64_t const MaxDenseRatio = 4U;
+
+            CaseTable();
+
+            //! Build the table; the case number of aTags[i] is i
+            //!
+            //! @return true if successful, false if a tag is repeated or the table could not be
+            //!     built.
+            bool Build
+                (
+                uint64_t const* const aTags,
+                size_t const aCount
+                );
+
+            //! @return The case number of aTag, or NoCase if aTag has no case.
+            inline size_t Find
+                (
+                uint64_t const aTag
+                ) const
+            {
+                if( mDense )
+                {
+                    uint64_t const offset = aTag - mBase;
+                    return ( offset < mNumSlots ) ? GetSlots()[static_cast< size_t >( offset )].caseNum : NoCase;
+                }
+                else if( mNumSlots == 0U )
+                {
+                    return NoCase;
+                }
+
+                uint64_t const hash = Mix( aTag );
+                size_t const bucket = static_cast< size_t >( hash >> 32 ) & mBucketMask;
+                Slot const& slot = GetSlots()[static_cast< size_t >( Mix( hash + mSeeds.GetConstPtrT< uint64_t >()[bucket] ) ) & mSlotMask];
+                return ( slot.tag == aTag ) ? slot.caseNum : NoCase;
+            }
+
+            //! @return Number of cases in the table
+            size_t GetNumCases() const;
+
+            //! @return Whether lookups index a dense table (true) or a perfect hash (false)
+            bool IsDense() const;
+
+        private:
+            struct Slot
+            {
+                uint64_t tag;
+                size_t caseNum;
+            };
+
+            //! @return aValue with all bits mixed (the MurmurHash3 finalizer)
+            static inline uint64_t Mix
+                (
+                uint64_t aValue
+                )
+            {
+                aValue ^= aValue >> 33;
+                aValue *= 0xFF51AFD7ED558CCDULL;
+                aValue ^= aValue >> 33;
+                aValue *= 0xC4CEB9FE1A85EC53ULL;
+                aValue ^= aValue >> 33;
+                return aValue;
+            }
+
+            //! Allocate aNumSlots slots, all without a case
+            //!
+            //! @return true if successful, false otherwise.
+            bool AllocateSlots
+                (
+                size_t const aNumSlots
+                );
+
+            bool BuildHash
+                (
+                uint64_t const* const aTags,
+                size_t const aCount,
+                size_t const aNumSlots
+                );
+
+            inline Slot const* GetSlots() const
+            {
+                return mSlots.GetConstPtrT< Slot >();
+            }
+
+            void Reset();
+
+            //! Lowest tag, for a dense table
+            uint64_t mBase;
+
+            //! Mask of a hash value to a bucket, for a perfect hash
+            size_t mBucketMask;
+
+            size_t mCount;
+
+            bool mDense;
+
+            size_t mNumSlots;
+
+            //! Per-bucket seeds that place each tag in its own slot, for a perfect hash
+            Data::ByteBuffer mSeeds;
+
+            //! Mask of a hash value to a slot, for a perfect hash
+            size_t mSlotMask;
+
+            //! Case of each tag (as Slot), indexed by offset from mBase (dense) or by hash
+            Data::ByteBuffer mSlots;
+        };
+
+    } // namespace Algorithm
+
+} // namespace Bfdp
+
+#endif // Bfdp_Algorithm_CaseTable
@@ -0,0 +1,84 @@
+/**
+    BFDP Algorithm Search Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Algorithm_Search
+#define Bfdp_Algorithm_Search
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/String.hpp"
+
+namespace Bfdp
+{
+
+    namespace Algorithm
+    {
+
+        //! Count occurrences of a byte value
+        //!
+        //! @note This examines a machine word at a time, so it is much faster than a byte loop
+        //!     for large buffers.
+        //! @return The number of bytes in aData equal to aValue.
+        size_t CountByte
+            (
+            Byte const* const aData,
+            size_t const aSize,
+            Byte const aValue
+            );
+
+        //! Find the first occurrence of either of two byte values
+        //!
+        //! @return Index of the first byte in aData equal to aValue1 or aValue2, or aSize if
+        //!     not found.
+        size_t FindFirstByteOf
+            (
+            Byte const* const aData,
+            size_t const aSize,
+            Byte const aValue1,
+            Byte const aValue2
+            );
+
+        //! Find the last occurrence of a byte value
+        //!
+        //! @return Index of the last byte in aData equal to aValue, or aSize if not found.
+        size_t FindLastByte
+            (
+            Byte const* const aData,
+            size_t const aSize,
+            Byte const aValue
+            );
+
+    } // namespace Algorithm
+
+} // namespace Bfdp
+
+#endif // Bfdp_Algorithm_Search
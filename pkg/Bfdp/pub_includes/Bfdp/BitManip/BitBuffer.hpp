@@ -72,6 +72,9 @@ namespace Bfdp
         //! This class does NOT provide any concept of "current position" in
         //! the buffer; see GenericBitStream for use cases when the buffer
         //! needs to be read or written.
+        //!
+        //! Small buffers are held inline (see Data::ByteBuffer::InlineSize),
+        //! so they are cheap to create, copy and move.
         class BitBuffer BFDP_FINAL
         {
         public:
@@ -81,6 +84,13 @@ namespace Bfdp
                 size_t const aInitialCapacity = 0
                 );
 
+            //! Construct a buffer whose memory comes from aAllocator, which must outlive it
+            BitBuffer
+                (
+                size_t const aInitialCapacity,
+                Data::IAllocator& aAllocator
+                );
+
             //! Construct a buffer from existing data
             //!
             //! @note This performs a COPY; does not use the provided buffer
@@ -92,11 +102,21 @@ namespace Bfdp
                 );
 
             //! Copy Constructor
+            //!
+            //! The copy uses the same allocator as aOther.
             BitBuffer
                 (
                 BitBuffer const& aOther
                 );
 
+            //! Move Constructor
+            //!
+            //! Takes the memory (and allocator) of aOther, which is left empty.
+            BitBuffer
+                (
+                BitBuffer&& aOther
+                );
+
             //! Destructor
             ~BitBuffer();
 
@@ -106,6 +126,17 @@ namespace Bfdp
                 BitBuffer const& aOther
                 );
 
+            //! Move Assignment operator
+            //!
+            //! Takes the memory (and allocator) of aOther, which is left empty.
+            BitBuffer& operator=
+                (
+                BitBuffer&& aOther
+                );
+
+            //! @return The allocator that the memory of the buffer comes from
+            Data::IAllocator& GetAllocator() const;
+
             //! Get capacity in bits
             //!
             //! If the buffer is initialized or resized to a capacity including
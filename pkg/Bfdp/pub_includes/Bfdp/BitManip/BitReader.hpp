@@ -0,0 +1,191 @@
+/**
+    BFDP Bit Reader Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_BitManip_BitReader
+#define Bfdp_BitManip_BitReader
+
+// External Includes
+#include <cstring>
+
+// Internal Includes
+#include "Bfdp/BitManip/BitView.hpp"
+#include "Bfdp/BitManip/Endian.hpp"
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Compiler.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/String.hpp"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        //! Sequential Bit Reader
+        //!
+        //! Reads consecutive values from a BitView, in the same bit order as GenericBitStream (the
+        //! first bit read is the least significant bit of the value).  Bits are buffered in a
+        //! 64-bit register that is refilled with one unaligned 8-byte load, so Peek(), Consume()
+        //! and Read() come down to a shift and a mask.  Only the last few bytes of the view are
+        //! loaded one at a time.
+        //!
+        //! The hot methods do not check bounds; callers check GetBitsLeft() first, typically once
+        //! per record rather than once per value.
+        class BitReader BFDP_FINAL
+        {
+        public:
+            //! Widest value that Peek() and Consume() support
+            static size_t const MaxPeekBits = 56;
+
+            //! Widest value that Read() supports
+            static size_t const MaxReadBits = 64;
+
+            explicit BitReader
+                (
+                BitView const& aView
+                );
+
+            //! Drop aNumBits from the front of the reader
+            //!
+            //! @pre aNumBits <= MaxPeekBits, and aNumBits <= GetBitsLeft().
+            inline void Consume
+                (
+                size_t const aNumBits
+                );
+
+            size_t GetBitsLeft() const;
+
+            //! Read aNumBits from the front of the reader without consuming them
+            //!
+            //! @pre aNumBits <= MaxPeekBits, and aNumBits <= GetBitsLeft().
+            //! @return The value, in the least significant aNumBits.
+            inline uint64_t Peek
+                (
+                size_t const aNumBits
+                );
+
+            //! Read aNumBits from the front of the reader and consume them
+            //!
+            //! @pre aNumBits <= MaxReadBits, and aNumBits <= GetBitsLeft().
+            //! @return The value, in the least significant aNumBits.
+            inline uint64_t Read
+                (
+                size_t const aNumBits
+                );
+
+        private:
+            //! Top up the register to at least MaxPeekBits, or to the end of the data
+            inline void Refill();
+
+            //! Refill near the end of the data, where an 8-byte load would overrun
+            void RefillSlow();
+
+            Byte const* mNext;
+            Byte const* mEnd;
+            uint64_t mBits;
+            size_t mNumBits;
+            size_t mBitsLeft;
+        };
+
+        inline void BitReader::Consume
+            (
+            size_t const aNumBits
+            )
+        {
+            if( mNumBits < aNumBits )
+            {
+                Refill();
+            }
+            mBits >>= aNumBits;
+            mNumBits -= aNumBits;
+            mBitsLeft -= aNumBits;
+        }
+
+        inline uint64_t BitReader::Peek
+            (
+            size_t const aNumBits
+            )
+        {
+            if( mNumBits < aNumBits )
+            {
+                Refill();
+            }
+            return mBits & ( ( static_cast< uint64_t >( 1U ) << aNumBits ) - 1U );
+        }
+
+        inline uint64_t BitReader::Read
+            (
+            size_t const aNumBits
+            )
+        {
+            if( aNumBits <= MaxPeekBits )
+            {
+                uint64_t const value = Peek( aNumBits );
+                Consume( aNumBits );
+                return value;
+            }
+
+            // Too wide for one refill; take the low half first
+            static size_t const HalfBits = MaxReadBits / 2;
+            uint64_t const low = Peek( HalfBits );
+            Consume( HalfBits );
+            uint64_t const high = Peek( aNumBits - HalfBits );
+            Consume( aNumBits - HalfBits );
+            return low | ( high << HalfBits );
+        }
+
+        inline void BitReader::Refill()
+        {
+            if( static_cast< size_t >( mEnd - mNext ) < sizeof( uint64_t ) )
+            {
+                RefillSlow();
+                return;
+            }
+
+            uint64_t word;
+            std::memcpy( &word, mNext, sizeof( word ) );
+        #if( !BFDP_HOST_ENDIAN_LE() )
+            word = ByteSwap64( word );
+        #endif
+
+            // Keep whole bytes only: advance by the bytes that fit above the buffered bits, which
+            // leaves 56 to 63 bits in the register.
+            mBits |= word << mNumBits;
+            mNext += ( 63U - mNumBits ) >> 3U;
+            mNumBits |= 56U;
+        }
+
+    } // namespace BitManip
+
+} // namespace Bfdp
+
+#endif // Bfdp_BitManip_BitReader
@@ -0,0 +1,159 @@
+/**
+    BFDP Bit View Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_BitManip_BitView
+#define Bfdp_BitManip_BitView
+
+// External Includes
+#include <limits>
+
+// Internal Includes
+#include "Bfdp/BitManip/Conversion.hpp"
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/String.hpp"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        //! Bit View
+        //!
+        //! A read-only window onto bits held in memory owned elsewhere.  A view is a pointer, a bit
+        //! offset and a bit length, so it is cheap to copy and never allocates.  Bits are numbered
+        //! the same way as GenericBitStream: bytes in ascending order, with the least significant
+        //! bit of each byte first.
+        //!
+        //! @note The view does not keep the underlying memory alive; it must not outlive the
+        //!     buffer it was created from.
+        class BitView BFDP_FINAL
+        {
+        public:
+            //! Create an empty view
+            BitView();
+
+            BitView
+                (
+                Byte const* const aData,
+                size_t const aOffsetBits,
+                size_t const aSizeBits
+                );
+
+            //! Get the bytes covered by the view without copying
+            //!
+            //! @note Only whole bytes are reported; any trailing partial byte is excluded.
+            //! @return true on success, or false if the view does not begin on a byte boundary.
+            bool GetAlignedBytes
+                (
+                Byte const*& aOutData,
+                size_t& aOutNumBytes
+                ) const;
+
+            //! @return Pointer to the byte containing the first bit of the view
+            Byte const* GetDataPtr() const;
+
+            //! @return Offset of the first bit of the view within the byte at GetDataPtr()
+            size_t GetOffsetBits() const;
+
+            size_t GetSizeBits() const;
+
+            //! @return true if the view begins on a byte boundary, or false otherwise.
+            bool IsByteAligned() const;
+
+            bool IsEmpty() const;
+
+            //! Read aNumBits from the front of the view without consuming them
+            //!
+            //! @note The first bit of the view becomes the least significant bit of aOutValue.
+            //! @return true on success, or false if aNumBits exceeds the view or the type.
+            template< class T >
+            bool Peek
+                (
+                size_t const aNumBits,
+                T& aOutValue
+                ) const;
+
+            //! Drop aNumBits from the front of the view
+            //!
+            //! @return true on success, or false if aNumBits exceeds the view.
+            bool Skip
+                (
+                size_t const aNumBits
+                );
+
+            //! Get a view of aSizeBits starting aOffsetBits into this view
+            //!
+            //! @return true on success, or false if the range exceeds the view.
+            bool SubView
+                (
+                size_t const aOffsetBits,
+                size_t const aSizeBits,
+                BitView& aOutView
+                ) const;
+
+        private:
+            bool PeekBits
+                (
+                size_t const aNumBits,
+                uint64_t& aOutValue
+                ) const;
+
+            Byte const* mData;
+            size_t mOffsetBits;
+            size_t mSizeBits;
+        };
+
+        template< class T >
+        bool BitView::Peek
+            (
+            size_t const aNumBits,
+            T& aOutValue
+            ) const
+        {
+            BFDP_CTIME_ASSERT( std::numeric_limits< T >::is_integer, "Unsupported Type" );
+            BFDP_CTIME_ASSERT( !std::numeric_limits< T >::is_signed, "Unsupported Type" );
+            BFDP_CTIME_ASSERT( sizeof( T ) <= sizeof( uint64_t ), "Unsupported Type" );
+
+            uint64_t value;
+            BFDP_RETURNIF_V( aNumBits > BytesToBits( sizeof( T ) ), false );
+            BFDP_RETURNIF_V( !PeekBits( aNumBits, value ), false );
+            aOutValue = static_cast< T >( value );
+            return true;
+        }
+
+    } // namespace BitManip
+
+} // namespace Bfdp
+
+#endif // Bfdp_BitManip_BitView
@@ -0,0 +1,202 @@
+/**
+    BFDP Bit Writer Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_BitManip_BitWriter
+#define Bfdp_BitManip_BitWriter
+
+// External Includes
+#include <cstring>
+#include <streambuf>
+
+// Internal Includes
+#include "Bfdp/BitManip/Endian.hpp"
+#include "Bfdp/BitManip/Mask.hpp"
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Compiler.hpp"
+#include "Bfdp/Data/ByteBuffer.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+#include "Bfdp/String.hpp"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        //! Buffered Bit Writer
+        //!
+        //! Writes unsigned values of up to 64 bits to a stream buffer according to a bit order and
+        //! a byte order, laid out exactly as EndianBitReader reads them back.  Bits collect in a
+        //! 64-bit accumulator that is stored to an output buffer one whole word at a time, and the
+        //! buffer is handed to the stream buffer when full.
+        //!
+        //! Write errors are sticky: once the stream buffer refuses data, further output is dropped
+        //! and Finish() (and IsOk()) report the failure.
+        class BitWriter BFDP_FINAL
+            : private NonAssignable
+            , private NonCopyable
+        {
+        public:
+            //! Widest value that Write() supports
+            static size_t const MaxWriteBits = 64;
+
+            //! Size of the output buffer
+            static size_t const DefaultBufferBytes = 64U * 1024U;
+
+            //! Construct a writer to aOut, which must outlive it
+            BitWriter
+                (
+                std::streambuf& aOut,
+                Endianness::Type const aBitOrder,
+                Endianness::Type const aByteOrder
+                );
+
+            //! Write any partial byte (zero-padded) and buffered data to the stream buffer
+            //!
+            //! @note Further writes start a new byte.
+            //! @return Whether all data has been written successfully.
+            bool Finish();
+
+            //! @return The number of bits written so far
+            uint64_t GetPosBits() const;
+
+            //! @return Whether all data has been written successfully so far
+            bool IsOk() const;
+
+            //! Write the least significant aNumBits of aValue
+            //!
+            //! Higher bits of aValue are ignored, so sign-extended values may be written directly.
+            //!
+            //! @pre aNumBits <= MaxWriteBits.
+            inline void Write
+                (
+                uint64_t const aValue,
+                size_t const aNumBits
+                );
+
+        private:
+            static size_t const WordBits = 64;
+
+            //! Hand the buffered bytes to the stream buffer
+            void Spill();
+
+            //! Append a full accumulator word to the buffer
+            inline void Store
+                (
+                uint64_t const aWord
+                );
+
+            std::streambuf& mOut;
+            Endianness::Type const mBitOrder;
+            bool const mSwapBytes;
+            Data::ByteBuffer mBuffer;
+            size_t mBufferUsed;
+            uint64_t mSpilledBytes;
+            uint64_t mBits;
+            size_t mNumBits;
+            bool mOk;
+        };
+
+        inline void BitWriter::Store
+            (
+            uint64_t const aWord
+            )
+        {
+            if( ( mBufferUsed + sizeof( aWord ) ) > mBuffer.GetSize() )
+            {
+                Spill();
+                BFDP_RETURNIF( !mOk );
+            }
+
+            // The first bit written is in the low byte (Little) or high byte (Big)
+            uint64_t word = aWord;
+        #if( BFDP_HOST_ENDIAN_LE() )
+            if( mBitOrder == Endianness::Big )
+        #else
+            if( mBitOrder == Endianness::Little )
+        #endif
+            {
+                word = ByteSwap64( word );
+            }
+            std::memcpy( mBuffer.GetPtr() + mBufferUsed, &word, sizeof( word ) );
+            mBufferUsed += sizeof( word );
+        }
+
+        inline void BitWriter::Write
+            (
+            uint64_t const aValue,
+            size_t const aNumBits
+            )
+        {
+            BFDP_RETURNIF( aNumBits == 0 );
+
+            uint64_t value = aValue & CreateMask< uint64_t >( aNumBits );
+            if( mSwapBytes && ( ( aNumBits % 8U ) == 0 ) )
+            {
+                value = ByteSwapN( value, aNumBits / 8U );
+            }
+
+            size_t const totalBits = mNumBits + aNumBits;
+            if( mBitOrder == Endianness::Little )
+            {
+                // First bit in bit 0 of the accumulator
+                mBits |= value << mNumBits;
+                if( totalBits < WordBits )
+                {
+                    mNumBits = totalBits;
+                    return;
+                }
+                Store( mBits );
+                mBits = ( value >> 1U ) >> ( WordBits - 1U - mNumBits );
+            }
+            else
+            {
+                // First bit in bit 63 of the accumulator
+                mBits |= ( value << ( WordBits - aNumBits ) ) >> mNumBits;
+                if( totalBits < WordBits )
+                {
+                    mNumBits = totalBits;
+                    return;
+                }
+                Store( mBits );
+                mBits = ( value << 1U ) << ( ( WordBits - 1U ) - ( totalBits - WordBits ) );
+            }
+            mNumBits = totalBits - WordBits;
+        }
+
+    } // namespace BitManip
+
+} // namespace Bfdp
+
+#endif // Bfdp_BitManip_BitWriter
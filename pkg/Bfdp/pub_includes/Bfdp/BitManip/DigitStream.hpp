@@ -39,6 +39,7 @@
 // Internal Includes
 #include "Bfdp/BitManip/BitBuffer.hpp"
 #include "Bfdp/BitManip/GenericBitStream.hpp"
+#include "Bfdp/Data/BigUint.hpp"
 #include "Bfdp/Data/Radix.hpp"
 
 namespace Bfdp
@@ -60,24 +61,53 @@ namespace Bfdp
         private:
             friend class DigitStream;
 
+            //! Iterate over digits stored in a bit buffer
             Digiterator
                 (
                 BitBuffer& aBuffer,
                 size_t const aBitsPerDigit
                 );
 
+            //! Iterate over the digits of a value
+            Digiterator
+                (
+                BitBuffer& aBuffer,
+                uint64_t const aValue,
+                size_t const aNumDigits,
+                Data::RadixType const aRadix
+                );
+
             size_t mBitsPerDigit;
             GenericBitStream mStream;
+
+            // Used when iterating over the digits of a value
+            bool mUseValue;
+            Data::RadixType mRadix;
+            mutable uint64_t mValue;
+            mutable uint64_t mDivisor;
+            mutable size_t mDigitsLeft;
+            size_t mSignificantDigits;
         };
 
         //! Digit Stream
         //!
-        //! This class encapsulates a bitstream of numeric digits
+        //! This class encapsulates a bitstream of numeric digits.
+        //!
+        //! @note Values which fit in 64 bits are stored directly; only wider values are stored
+        //!     digit-by-digit in a bit buffer.
         class DigitStream BFDP_FINAL
         {
         public:
             DigitStream();
 
+            //! Get the value of the digits as an arbitrary-precision integer
+            //!
+            //! @return true if the value was converted, false otherwise.
+            bool GetBigUint
+                (
+                Data::BigUint& aOut
+                ) const;
+
             Digiterator GetIterator() const;
 
             size_t GetNumDigits() const;
@@ -110,8 +140,15 @@ namespace Bfdp
                 );
 
         private:
+            //! @return Whether the digits are stored in mBuffer
+            bool IsWide() const;
+
+            //! Digits of values which do not fit in mValue
             BitBuffer mBuffer;
+
+            size_t mNumDigits;
             Data::RadixType mRadix;
+            uint64_t mValue;
         };
 
     } // namespace BitManip
@@ -0,0 +1,127 @@
+/**
+    BFDP BitManip Endian Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_BitManip_Endian
+#define Bfdp_BitManip_Endian
+
+// External includes
+#if defined( _MSC_VER )
+    #include <stdlib.h>
+#endif
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Macros.hpp"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        //! Order of bits within a byte, or bytes within a multi-byte value
+        struct Endianness
+        {
+            enum Type
+            {
+                Little = 0, //!< Least significant first
+                Big = 1,    //!< Most significant first
+
+                Default = Little
+            };
+        };
+
+        //! @return aValue with the byte order reversed
+        inline uint16_t ByteSwap16
+            (
+            uint16_t const aValue
+            )
+        {
+        #if defined( __GNUC__ )
+            return __builtin_bswap16( aValue );
+        #elif defined( _MSC_VER )
+            return _byteswap_ushort( aValue );
+        #else
+            return static_cast< uint16_t >( ( aValue >> 8 ) | ( aValue << 8 ) );
+        #endif
+        }
+
+        //! @return aValue with the byte order reversed
+        inline uint32_t ByteSwap32
+            (
+            uint32_t const aValue
+            )
+        {
+        #if defined( __GNUC__ )
+            return __builtin_bswap32( aValue );
+        #elif defined( _MSC_VER )
+            return _byteswap_ulong( aValue );
+        #else
+            return ( aValue >> 24 ) |
+                ( ( aValue >> 8 ) & 0x0000FF00UL ) |
+                ( ( aValue << 8 ) & 0x00FF0000UL ) |
+                ( aValue << 24 );
+        #endif
+        }
+
+        //! @return aValue with the byte order reversed
+        inline uint64_t ByteSwap64
+            (
+            uint64_t const aValue
+            )
+        {
+        #if defined( __GNUC__ )
+            return __builtin_bswap64( aValue );
+        #elif defined( _MSC_VER )
+            return _byteswap_uint64( aValue );
+        #else
+            return ( static_cast< uint64_t >( ByteSwap32( static_cast< uint32_t >( aValue ) ) ) << 32 ) |
+                ByteSwap32( static_cast< uint32_t >( aValue >> 32 ) );
+        #endif
+        }
+
+        //! @pre aNumBytes is 1 to 8
+        //! @return The low aNumBytes of aValue with their order reversed
+        inline uint64_t ByteSwapN
+            (
+            uint64_t const aValue,
+            size_t const aNumBytes
+            )
+        {
+            return ByteSwap64( aValue ) >> ( 64U - ( aNumBytes * 8U ) );
+        }
+
+    } // namespace BitManip
+
+} // namespace Bfdp
+
+#endif // Bfdp_BitManip_Endian
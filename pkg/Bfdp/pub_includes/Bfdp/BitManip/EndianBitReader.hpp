@@ -0,0 +1,122 @@
+/**
+    BFDP BitManip Endian Bit Reader Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_BitManip_EndianBitReader
+#define Bfdp_BitManip_EndianBitReader
+
+// Internal Includes
+#include "Bfdp/BitManip/Endian.hpp"
+#include "Bfdp/BitManip/GenericBitStream.hpp"
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Macros.hpp"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        //! Endianness-aware Bit Reader
+        //!
+        //! Reads unsigned values of up to 64 bits from a byte buffer according to a bit order and
+        //! a byte order:
+        //! * Bit order sets which bit of each byte is consumed first (Little := bit 0, Big :=
+        //!   bit 7), and that the first bit consumed is the least (Little) or most (Big)
+        //!   significant bit of the value.
+        //! * Byte order applies to values that are a whole number of bytes wide, and sets which
+        //!   byte of the value comes first.  Values of other widths are read as one contiguous
+        //!   run of bits in bit order.
+        //!
+        //! Byte-aligned values are loaded directly and byte-swapped if needed; values within a
+        //! single byte take one shift and mask.  ReadArray() unpacks runs of equal-width values
+        //! with one word load per value (or per group of values, using PDEP where available).
+        class EndianBitReader BFDP_FINAL
+        {
+        public:
+            EndianBitReader
+                (
+                Endianness::Type const aBitOrder,
+                Endianness::Type const aByteOrder
+                );
+
+            Endianness::Type GetBitOrder() const;
+
+            Endianness::Type GetByteOrder() const;
+
+            //! Read a value from a buffer
+            //!
+            //! @pre aNumBits is 1 to 64.
+            //! @pre aData holds at least BitsToBytes( aBitPos + aNumBits ) bytes.
+            //! @return The value, in the least significant aNumBits.
+            uint64_t Read
+                (
+                Byte const* const aData,
+                size_t const aBitPos,
+                size_t const aNumBits
+                ) const;
+
+            //! Read consecutive values of the same width from a buffer
+            //!
+            //! Equivalent to calling Read() for each value, without the per-value setup.
+            //!
+            //! @pre aNumBits is 1 to 64.
+            //! @pre aData holds at least BitsToBytes( aBitPos + ( aNumBits * aCount ) ) bytes.
+            //! @pre aOut holds at least aCount values.
+            void ReadArray
+                (
+                Byte const* const aData,
+                size_t const aBitPos,
+                size_t const aNumBits,
+                size_t const aCount,
+                uint64_t* const aOut
+                ) const;
+
+            //! Read a value from a bitstream, and advance the bitstream past it
+            //!
+            //! @return true on success, or false if aNumBits is invalid or not available.
+            bool ReadBits
+                (
+                GenericBitStream& aIn,
+                size_t const aNumBits,
+                uint64_t& aOut
+                ) const;
+
+        private:
+            Endianness::Type mBitOrder;
+            Endianness::Type mByteOrder;
+        };
+
+    } // namespace BitManip
+
+} // namespace Bfdp
+
+#endif // Bfdp_BitManip_EndianBitReader
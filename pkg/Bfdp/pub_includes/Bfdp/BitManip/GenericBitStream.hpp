@@ -38,6 +38,7 @@
 
 // Internal Includes
 #include "Bfdp/BitManip/BitBuffer.hpp"
+#include "Bfdp/BitManip/BitView.hpp"
 #include "Bfdp/BitManip/Conversion.hpp"
 #include "Bfdp/Common.hpp"
 #include "Bfdp/Macros.hpp"
@@ -71,8 +72,14 @@ namespace Bfdp
 
             size_t GetBitsTillEnd() const;
 
+            //! @return Pointer to the beginning of the underlying data
+            Byte const* GetDataPtr() const;
+
             size_t GetPosBits() const;
 
+            //! @return Read-only view of the bits from the current position to the end of data
+            BitView GetView() const;
+
             //! Read aNumBits into aOutData
             //!
             //! @note The bytes in aOutData are read to offset 0 in ascending order, with the
@@ -0,0 +1,145 @@
+/**
+    BFDP Data Arena Allocator Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_ArenaAllocator
+#define Bfdp_Data_ArenaAllocator
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/IAllocator.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+#include "Bfdp/String.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Monotonic allocator that hands out memory from large blocks
+        //!
+        //! Allocation moves a pointer through the current block, and Free() does nothing; all of
+        //! the memory is released at once by Reset() or destruction.  This suits a group of objects
+        //! that share a lifetime, such as those built while loading a spec.
+        //!
+        //! @note Not thread-safe.
+        class ArenaAllocator BFDP_FINAL
+            : public IAllocator
+            , private NonAssignable
+            , private NonCopyable
+        {
+        public:
+            static size_t BFDP_CONSTEXPR DefaultBlockSize = 64U * 1024U;
+
+            //! Constructor
+            //!
+            //! @param[in] aBlockSize Size of the blocks taken from aUpstream; an allocation larger
+            //!     than a block gets a block of its own.
+            //! @param[in] aUpstream Source of the blocks
+            ArenaAllocator
+                (
+                size_t const aBlockSize,
+                IAllocator& aUpstream
+                );
+
+            ~ArenaAllocator();
+
+            BFDP_OVERRIDE( void* Allocate
+                (
+                size_t const aSize
+                ) );
+
+            //! Does nothing; memory is released by Reset()
+            BFDP_OVERRIDE( void Free
+                (
+                void* const aPtr,
+                size_t const aSize
+                ) );
+
+            //! @return The number of bytes allocated since construction or the last Reset()
+            size_t GetBytesAllocated() const;
+
+            //! @return The number of bytes of the blocks held, including their overhead
+            size_t GetBytesReserved() const;
+
+            //! Release everything allocated from the arena
+            //!
+            //! The first block is kept for reuse, and the rest are returned to the upstream
+            //! allocator.
+            void Reset();
+
+        private:
+            //! Header at the beginning of each block
+            struct Block
+            {
+                Block* next;
+                size_t size;
+            };
+
+            //! Size of the header, rounded up to keep allocations aligned
+            static size_t BFDP_CONSTEXPR HeaderSize = ( ( sizeof( Block ) + Alignment - 1 ) / Alignment ) * Alignment;
+
+            //! Make a block of at least aSize usable bytes the current block
+            //!
+            //! @return true if successful, false otherwise.
+            bool AddBlock
+                (
+                size_t const aSize
+                );
+
+            //! Return blocks from aBlock on to the upstream allocator
+            void FreeBlocks
+                (
+                Block* const aBlock
+                );
+
+            size_t const mBlockSize;
+            IAllocator& mUpstream;
+
+            //! Blocks, most recent first
+            Block* mBlocks;
+
+            //! Unused part of the current block
+            Byte* mNext;
+            size_t mBytesLeft;
+
+            size_t mBytesAllocated;
+            size_t mBytesReserved;
+        };
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_ArenaAllocator
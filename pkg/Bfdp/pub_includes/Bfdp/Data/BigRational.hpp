@@ -0,0 +1,115 @@
+/**
+    BFDP Data Big Rational Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_BigRational
+#define Bfdp_Data_BigRational
+
+// External Includes
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Data/BigUint.hpp"
+#include "Bfdp/Data/Sign.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Exact rational number with arbitrary-precision numerator and denominator
+        //!
+        //! @note Methods which may allocate return false on failure.
+        struct BigRational BFDP_FINAL
+            : private NonAssignable
+            , private NonCopyable
+        {
+            //! Initializes to 0/1
+            BigRational();
+
+            bool CopyFrom
+                (
+                BigRational const& aOther
+                );
+
+            //! Get the value as an unsigned fixed-point number, rounded towards zero
+            //!
+            //! @note The sign is ignored.
+            //! @return The magnitude scaled by 2^aFractionalBits
+            bool GetFixedPoint
+                (
+                size_t const aFractionalBits,
+                BigUint& aOut
+                ) const;
+
+            //! @return The value as "[-]numerator/denominator" in aRadix, or an empty string on
+            //!     error.
+            std::string GetStr
+                (
+                RadixType const aRadix = 10
+                ) const;
+
+            //! Replace the value with its reciprocal
+            //!
+            //! @return false if the value is zero.
+            bool Invert();
+
+            bool IsZero() const;
+
+            //! Multiply by aOther
+            bool Multiply
+                (
+                BigRational const& aOther
+                );
+
+            //! Raise to a non-negative integer power
+            bool Power
+                (
+                uint64_t const aExponent
+                );
+
+            //! Divide the numerator and denominator by their greatest common divisor
+            bool Reduce();
+
+            Sign sign;
+            BigUint numerator;
+            BigUint denominator;
+        };
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_BigRational
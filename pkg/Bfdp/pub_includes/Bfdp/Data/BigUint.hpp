@@ -0,0 +1,211 @@
+/**
+    BFDP Data Big Unsigned Integer Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_BigUint
+#define Bfdp_Data_BigUint
+
+// External Includes
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/ByteBuffer.hpp"
+#include "Bfdp/Data/Radix.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Arbitrary-precision unsigned integer
+        //!
+        //! The value is stored as a little-endian array of 64-bit limbs.  Multiplication switches
+        //! from the schoolbook method to Karatsuba for large operands, and conversion from
+        //! non-power-of-2 radices is divide-and-conquer, so neither is quadratic in the number of
+        //! digits.
+        //!
+        //! @note Methods which may allocate return false on failure; the value is unspecified
+        //!     afterwards.
+        class BigUint BFDP_FINAL
+            : private NonAssignable
+            , private NonCopyable
+        {
+        public:
+            typedef uint64_t Limb;
+
+            static size_t const LimbBits = 64;
+
+            BigUint();
+
+            //! Add aOther to this value
+            bool Add
+                (
+                BigUint const& aOther
+                );
+
+            //! @return <0, 0, or >0 if this is less than, equal to, or greater than aOther
+            int Compare
+                (
+                BigUint const& aOther
+                ) const;
+
+            bool CopyFrom
+                (
+                BigUint const& aOther
+                );
+
+            //! Divide this value by aDivisor
+            //!
+            //! @note aQuotient and aRemainder must not refer to this or aDivisor.
+            //! @return false if aDivisor is zero or memory could not be allocated.
+            bool Divide
+                (
+                BigUint const& aDivisor,
+                BigUint& aQuotient,
+                BigUint& aRemainder
+                ) const;
+
+            //! @return The number of significant bits (0 for zero)
+            size_t GetBitWidth() const;
+
+            //! @return The limb at aIndex, or 0 if it is beyond the most significant limb
+            Limb GetLimb
+                (
+                size_t const aIndex
+                ) const;
+
+            //! @return The number of significant limbs (0 for zero)
+            size_t GetNumLimbs() const;
+
+            //! @return The value as digits of aRadix, or an empty string on error.
+            std::string GetStr
+                (
+                RadixType const aRadix = 10
+                ) const;
+
+            //! @return The number of least significant zero bits (0 for zero)
+            size_t GetTrailingZeroBits() const;
+
+            //! @return true if the value fits in 64 bits, false otherwise.
+            bool GetUint64
+                (
+                uint64_t& aOut
+                ) const;
+
+            bool IsZero() const;
+
+            //! Multiply this value by aOther
+            bool Multiply
+                (
+                BigUint const& aOther
+                );
+
+            //! Replace this value with this * aMultiplier + aAddend
+            bool MulAddSmall
+                (
+                Limb const aMultiplier,
+                Limb const aAddend
+                );
+
+            //! Raise this value to aExponent
+            bool Power
+                (
+                uint64_t const aExponent
+                );
+
+            bool Set
+                (
+                uint64_t const aValue
+                );
+
+            //! Set the value from an array of digit values, most significant first
+            //!
+            //! @return false if any digit is out of range for aRadix, or on allocation failure.
+            bool SetDigits
+                (
+                RadixType const aRadix,
+                uint8_t const* const aDigits,
+                size_t const aNumDigits
+                );
+
+            bool ShiftLeft
+                (
+                size_t const aBits
+                );
+
+            void ShiftRight
+                (
+                size_t const aBits
+                );
+
+            //! Subtract aOther from this value
+            //!
+            //! @return false if aOther is greater than this value.
+            bool Subtract
+                (
+                BigUint const& aOther
+                );
+
+            void Swap
+                (
+                BigUint& aOther
+                );
+
+        private:
+            Limb const* GetConstLimbs() const;
+
+            Limb* GetLimbs();
+
+            //! Ensure capacity for aNumLimbs limbs, preserving the value
+            //!
+            //! @post Limbs beyond the current value are zero.
+            bool Reserve
+                (
+                size_t const aNumLimbs
+                );
+
+            //! Drop most significant limbs which are zero
+            void Trim();
+
+            ByteBuffer mBuffer;
+            size_t mNumLimbs;
+        };
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_BigUint
@@ -0,0 +1,148 @@
+/**
+    BFDP Data Buffer Pool Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_BufferPool
+#define Bfdp_Data_BufferPool
+
+// External Includes
+#include <mutex>
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/ByteBuffer.hpp"
+#include "Bfdp/Data/IAllocator.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Thread-safe allocator that keeps freed buffers for reuse
+        //!
+        //! Suits large I/O buffers (e.g., Stream::StreamBase chunk buffers) that are repeatedly
+        //! allocated and freed at the same sizes, such as by short-lived streams.  Sizes are rounded
+        //! up to whole pages, and memory comes from the OS rather than the heap, page aligned.
+        //! Buffers of HugePageSize or more are backed by huge pages where the OS supports it.
+        //!
+        //! Freed buffers are cached, up to a limit, and handed out again to requests of the same
+        //! (rounded) size; the rest are returned to the OS.
+        class BufferPool BFDP_FINAL
+            : public IAllocator
+            , private NonAssignable
+            , private NonCopyable
+        {
+        public:
+            //! Granularity (and alignment) of buffers
+            static size_t BFDP_CONSTEXPR PageSize = 4096U;
+
+            //! Smallest buffer that is backed by huge pages
+            static size_t BFDP_CONSTEXPR HugePageSize = 2U * 1024U * 1024U;
+
+            //! Number of free buffers that the shared pool keeps
+            static size_t BFDP_CONSTEXPR DefaultMaxCached = 16U;
+
+            //! @return The pool shared by all streams
+            static BufferPool& GetShared();
+
+            explicit BufferPool
+                (
+                size_t const aMaxCached
+                );
+
+            ~BufferPool();
+
+            BFDP_OVERRIDE( void* Allocate
+                (
+                size_t const aSize
+                ) );
+
+            BFDP_OVERRIDE( void Free
+                (
+                void* const aPtr,
+                size_t const aSize
+                ) );
+
+            //! @return The number of allocations served from a cached buffer
+            size_t GetHits() const;
+
+            //! @return The number of allocations that had to go to the OS
+            size_t GetMisses() const;
+
+            //! @return The number of free buffers held
+            size_t GetNumCached() const;
+
+            //! Return all cached buffers to the OS
+            void Trim();
+
+        private:
+            struct Buffer
+            {
+                void* ptr;
+                size_t size;
+            };
+
+            //! @return aSize rounded up to the size of buffer that holds it
+            static size_t GetBufferSize
+                (
+                size_t const aSize
+                );
+
+            //! @return A new buffer of aSize (a whole number of pages) from the OS, or NULL
+            static void* MapBuffer
+                (
+                size_t const aSize
+                );
+
+            static void UnmapBuffer
+                (
+                void* const aPtr,
+                size_t const aSize
+                );
+
+            //! Free buffers (as Buffer), room for the most that are kept
+            ByteBuffer mCached;
+
+            size_t mHits;
+            size_t mMisses;
+            size_t mNumCached;
+            mutable std::mutex mMutex;
+        };
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_BufferPool
@@ -33,8 +33,12 @@
 #ifndef Bfdp_Data_ByteBuffer
 #define Bfdp_Data_ByteBuffer
 
+// External includes
+#include <type_traits>
+
 // Internal includes
 #include "Bfdp/Common.hpp"
+#include "Bfdp/Data/IAllocator.hpp"
 #include "Bfdp/Macros.hpp"
 #include "Bfdp/NonAssignable.hpp"
 #include "Bfdp/NonCopyable.hpp"
@@ -49,16 +53,41 @@ namespace Bfdp
         //! Encapsulates a dynamic buffer of bytes
         //!
         //! This class is only intended to help with memory buffer options (resource cleanup,
-        //! type casting, etc...).
+        //! type casting, etc...).  Memory comes from the heap, or from an allocator given on
+        //! construction.  Buffers of up to InlineSize bytes are stored within the object itself,
+        //! and never touch the allocator.
+        //!
+        //! @note Buffers cannot be copied, but can be moved; a moved-from buffer is empty.
         class ByteBuffer BFDP_FINAL
             : private NonAssignable
             , private NonCopyable
         {
         public:
+            //! Largest buffer that is stored inline
+            static size_t BFDP_CONSTEXPR InlineSize = 32U;
+
             ByteBuffer();
 
+            //! Construct a buffer whose memory comes from aAllocator, which must outlive it
+            explicit ByteBuffer
+                (
+                IAllocator& aAllocator
+                );
+
+            //! Move constructor; takes the memory (and allocator) of aOther
+            ByteBuffer
+                (
+                ByteBuffer&& aOther
+                );
+
             ~ByteBuffer();
 
+            //! Move assignment; releases the current memory, then takes that of aOther
+            ByteBuffer& operator=
+                (
+                ByteBuffer&& aOther
+                );
+
             //! (Re)allocate a buffer of aSize
             //!
             //! @note Does not preserve existing content.
@@ -81,6 +110,9 @@ namespace Bfdp
 
             void Delete();
 
+            //! @return The allocator that the memory of the buffer comes from
+            IAllocator& GetAllocator() const;
+
             Byte const* GetConstPtr() const;
 
             template< class T >
@@ -111,7 +143,12 @@ namespace Bfdp
                 Byte const aValue
                 );
 
-            //! Swap the contents of the two buffers
+            //! @return Whether the buffer is stored inline (rather than drawn from the allocator)
+            bool IsInline() const;
+
+            //! Swap the contents (and allocators) of the two buffers
+            //!
+            //! @note Inline buffers are copied, so pointers into them do not follow the swap.
             void Swap
                 (
                 ByteBuffer& aOther
@@ -128,8 +165,16 @@ namespace Bfdp
                 ) const;
 
         private:
+            //! Take the memory of aOther, leaving it empty; the buffer must be empty
+            void Take
+                (
+                ByteBuffer& aOther
+                );
+
+            IAllocator* mAllocator;
             Byte* mPtr;
             size_t mSize;
+            std::aligned_storage< InlineSize, IAllocator::Alignment >::type mInline;
         };
 
     } // namespace Data
@@ -98,6 +98,18 @@ namespace Bfdp
                 size_t const aSize
                 );
 
+            //! Skips over data that would be pushed into the window
+            //!
+            //! This has the same effect on the counters as pushing aSize bytes, without needing
+            //! the data.
+            //!
+            //! @post If aSize > 0, the window is empty
+            //! @post Begin and End counters are updated
+            void SkipData
+                (
+                size_t const aSize
+                );
+
         private:
             //! Copy aSize bytes from aData into the circular buffer
             //!
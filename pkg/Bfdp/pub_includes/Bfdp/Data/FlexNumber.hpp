@@ -40,6 +40,8 @@
 #include "Bfdp/BitManip/BitBuffer.hpp"
 #include "Bfdp/BitManip/Conversion.hpp"
 #include "Bfdp/BitManip/DigitStream.hpp"
+#include "Bfdp/Data/BigRational.hpp"
+#include "Bfdp/Data/BigUint.hpp"
 #include "Bfdp/Data/Sign.hpp"
 
 namespace Bfdp
@@ -75,12 +77,26 @@ namespace Bfdp
         //!
         //! These components all use DigitStream, so each may have its own radix.  For sanity
         //! purposes, it is recommended to use the same radix for all three components.
+        //!
+        //! Values of any width can be evaluated exactly with GetRational(), or to a fixed number
+        //! of fractional bits with GetFixedPoint().
         struct FlexNumber BFDP_FINAL
         {
+            //! Limit on the size of an evaluated Base ^ Exponent, to bound memory use
+            static size_t const MaxEvaluationBits = 1048576;
+
             struct Component
             {
                 bool IsDefined() const;
 
+                //! Get the exact value of the component
+                //!
+                //! @return true if the value was evaluated, false otherwise.
+                bool GetRational
+                    (
+                    BigRational& aOut
+                    ) const;
+
                 std::string GetStr
                     (
                     bool const aVerbose = false
@@ -109,6 +125,25 @@ namespace Bfdp
 
             bool IsIntegral() const;
 
+            //! Get the value as a fixed-point number, rounded towards zero
+            //!
+            //! @return true if the value was evaluated, false otherwise.
+            bool GetFixedPoint
+                (
+                size_t const aFractionalBits,
+                Sign& aSign, //!< [out] Sign of the value
+                BigUint& aMagnitude //!< [out] Magnitude scaled by 2^aFractionalBits
+                ) const;
+
+            //! Get the exact value of Significand * (Base ^ Exponent)
+            //!
+            //! @note The exponent must be an integer, and a missing significand is treated as 1.
+            //! @return true if the value was evaluated, false otherwise.
+            bool GetRational
+                (
+                BigRational& aOut
+                ) const;
+
             std::string GetStr
                 (
                 bool const aVerbose = false
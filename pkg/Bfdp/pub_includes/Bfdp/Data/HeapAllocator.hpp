@@ -0,0 +1,71 @@
+/**
+    BFDP Data Heap Allocator Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_HeapAllocator
+#define Bfdp_Data_HeapAllocator
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/IAllocator.hpp"
+#include "Bfdp/Macros.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Allocator that uses the heap (new and delete); the default for buffers
+        class HeapAllocator BFDP_FINAL
+            : public IAllocator
+        {
+        public:
+            //! @return The shared instance, which is stateless and thread-safe
+            static IAllocator& GetInstance();
+
+            BFDP_OVERRIDE( void* Allocate
+                (
+                size_t const aSize
+                ) );
+
+            BFDP_OVERRIDE( void Free
+                (
+                void* const aPtr,
+                size_t const aSize
+                ) );
+        };
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_HeapAllocator
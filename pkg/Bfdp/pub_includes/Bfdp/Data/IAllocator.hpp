@@ -0,0 +1,88 @@
+/**
+    BFDP Data Allocator Interface
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_IAllocator
+#define Bfdp_Data_IAllocator
+
+// External Includes
+#include <cstddef>
+#include <memory>
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Macros.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Abstract interface for a source of memory
+        //!
+        //! Lets buffers (e.g., ByteBuffer, BitManip::BitBuffer) draw their memory from an arena or
+        //! pool that outlives them, instead of from the heap.
+        class IAllocator
+        {
+        public:
+            //! Alignment of all allocated memory; suits any fundamental type
+            static size_t BFDP_CONSTEXPR Alignment = alignof( std::max_align_t );
+
+            virtual ~IAllocator()
+            {
+            }
+
+            //! Allocate aSize bytes
+            //!
+            //! @return Pointer to the memory, or NULL on failure.
+            virtual void* Allocate
+                (
+                size_t const aSize
+                ) = 0;
+
+            //! Release memory returned by Allocate()
+            //!
+            //! @note aPtr may be NULL, in which case nothing is done.
+            virtual void Free
+                (
+                void* const aPtr,   //!< [in] Memory to release
+                size_t const aSize  //!< [in] Size given to Allocate() for aPtr
+                ) = 0;
+        };
+
+        typedef std::shared_ptr< IAllocator > IAllocatorPtr;
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_IAllocator
@@ -0,0 +1,153 @@
+/**
+    BFDP Data IEEE 754 Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_Ieee754
+#define Bfdp_Data_Ieee754
+
+// External Includes
+#include <cstring>
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Functions to decode IEEE 754 binary interchange formats from their raw bits, and to
+        //! encode values back to them
+        //!
+        //! binary32 and binary64 are bit-cast directly to and from the host's float and double,
+        //! which are assumed to be IEEE 754 types.
+        namespace Ieee754
+        {
+
+            //! @return Whether DecodeBinary16() uses the F16C instruction set
+            bool HasHardwareBinary16();
+
+            //! Decode a half-precision value
+            //!
+            //! @note Every binary16 value is exactly representable as a binary32.
+            float DecodeBinary16
+                (
+                uint16_t const aBits
+                );
+
+            //! Decode a half-precision value without F16C
+            //!
+            //! @note DecodeBinary16() uses this when the host lacks F16C support.
+            float DecodeBinary16Software
+                (
+                uint16_t const aBits
+                );
+
+            //! Decode a single-precision value
+            inline float DecodeBinary32
+                (
+                uint32_t const aBits
+                )
+            {
+                float value;
+                std::memcpy( &value, &aBits, sizeof( value ) );
+                return value;
+            }
+
+            //! Decode a double-precision value
+            inline double DecodeBinary64
+                (
+                uint64_t const aBits
+                )
+            {
+                double value;
+                std::memcpy( &value, &aBits, sizeof( value ) );
+                return value;
+            }
+
+            //! Decode a quadruple-precision value, rounded to nearest (ties to even) binary64
+            //!
+            //! @note There is no portable host type for binary128, so this is done in software.
+            double DecodeBinary128
+                (
+                uint64_t const aHigh, //!< [in] Sign, exponent and upper 48 bits of the significand
+                uint64_t const aLow   //!< [in] Lower 64 bits of the significand
+                );
+
+            //! Encode a value as half precision, rounded to nearest (ties to even)
+            //!
+            //! @note Values too large for binary16 become infinity; NaN keeps its sign and the
+            //!     upper bits of its payload.
+            uint16_t EncodeBinary16
+                (
+                double const aValue
+                );
+
+            //! Encode a single-precision value
+            inline uint32_t EncodeBinary32
+                (
+                float const aValue
+                )
+            {
+                uint32_t bits;
+                std::memcpy( &bits, &aValue, sizeof( bits ) );
+                return bits;
+            }
+
+            //! Encode a double-precision value
+            inline uint64_t EncodeBinary64
+                (
+                double const aValue
+                )
+            {
+                uint64_t bits;
+                std::memcpy( &bits, &aValue, sizeof( bits ) );
+                return bits;
+            }
+
+            //! Encode a value as quadruple precision
+            //!
+            //! @note Every binary64 value is exactly representable as a binary128.
+            void EncodeBinary128
+                (
+                double const aValue,
+                uint64_t& aHigh, //!< [out] Sign, exponent and upper 48 bits of the significand
+                uint64_t& aLow   //!< [out] Lower 64 bits of the significand
+                );
+
+        } // namespace Ieee754
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_Ieee754
@@ -0,0 +1,108 @@
+/**
+    BFDP Data Mapped File Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_MappedFile
+#define Bfdp_Data_MappedFile
+
+// External includes
+#include <string>
+
+// Internal includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+#include "Bfdp/String.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Encapsulates a read-only memory mapping of a file
+        //!
+        //! This allows the contents of a file to be accessed as a contiguous block of memory
+        //! without copying it into a buffer first.
+        class MappedFile BFDP_FINAL
+            : private NonAssignable
+            , private NonCopyable
+        {
+        public:
+            MappedFile();
+
+            ~MappedFile();
+
+            //! Unmap the file, if one is open
+            void Close();
+
+            //! @note This is NULL if no file is open, or if the file is empty.
+            //! @return Pointer to the file contents
+            Byte const* GetConstPtr() const;
+
+            //! @return Number of bytes in the file
+            size_t GetSize() const;
+
+            //! @return Whether a file is open
+            bool IsOpen() const;
+
+            //! Map the contents of a file into memory
+            //!
+            //! @note Any previously open file is closed first.  Only regular files can be mapped;
+            //!     pipes, devices and the like must be read as streams instead.
+            //! @return Whether the file was mapped successfully.
+            bool Open
+                (
+                std::string const& aFileName
+                );
+
+        private:
+#if defined( _WIN32 )
+            //! OS handle for the file
+            void* mFileHandle;
+
+            //! OS handle for the mapping object
+            void* mMapHandle;
+#else
+            //! File descriptor, or -1 if no file is open
+            int mFd;
+#endif
+
+            Byte const* mPtr;
+            size_t mSize;
+        };
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_MappedFile
@@ -0,0 +1,134 @@
+/**
+    BFDP Data Pool Allocator Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_PoolAllocator
+#define Bfdp_Data_PoolAllocator
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/IAllocator.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Allocator that recycles memory in size classes
+        //!
+        //! Sizes up to MaxClassSize are rounded up to a power of two, and served from a free list
+        //! of chunks of that size.  Chunks are carved from slabs taken from the upstream allocator,
+        //! and freed chunks are reused rather than returned; slabs are returned on destruction.
+        //! Larger sizes are passed on to the upstream allocator.  This suits buffers that are
+        //! repeatedly freed and allocated again at similar sizes, such as while decoding.
+        //!
+        //! @note Not thread-safe.
+        class PoolAllocator BFDP_FINAL
+            : public IAllocator
+            , private NonAssignable
+            , private NonCopyable
+        {
+        public:
+            //! Smallest and largest size classes
+            static size_t BFDP_CONSTEXPR MinClassSize = 16U;
+            static size_t BFDP_CONSTEXPR MaxClassSize = 4096U;
+
+            //! Size of the slabs that chunks are carved from
+            static size_t BFDP_CONSTEXPR SlabSize = 64U * 1024U;
+
+            explicit PoolAllocator
+                (
+                IAllocator& aUpstream
+                );
+
+            ~PoolAllocator();
+
+            BFDP_OVERRIDE( void* Allocate
+                (
+                size_t const aSize
+                ) );
+
+            BFDP_OVERRIDE( void Free
+                (
+                void* const aPtr,
+                size_t const aSize
+                ) );
+
+            //! @return The number of bytes of the slabs held
+            size_t GetBytesReserved() const;
+
+        private:
+            static size_t BFDP_CONSTEXPR NumClasses = 9U;
+
+            //! A free chunk, linked into the free list of its class
+            struct Chunk
+            {
+                Chunk* next;
+            };
+
+            //! Header at the beginning of each slab
+            struct Slab
+            {
+                Slab* next;
+            };
+
+            //! Size of the slab header, rounded up to keep chunks aligned
+            static size_t BFDP_CONSTEXPR HeaderSize = ( ( sizeof( Slab ) + Alignment - 1 ) / Alignment ) * Alignment;
+
+            //! @return The size class that holds aSize bytes, or NumClasses if it is too large
+            static size_t GetClass
+                (
+                size_t const aSize
+                );
+
+            //! Carve a new slab into chunks of class aClass
+            //!
+            //! @return true if successful, false otherwise.
+            bool AddSlab
+                (
+                size_t const aClass
+                );
+
+            IAllocator& mUpstream;
+            Chunk* mFreeLists[NumClasses];
+            Slab* mSlabs;
+            size_t mBytesReserved;
+        };
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_PoolAllocator
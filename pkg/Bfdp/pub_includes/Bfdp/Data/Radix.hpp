@@ -69,6 +69,19 @@ namespace Bfdp
             char& aSymbol
             );
 
+        //! Convert a string of digits with the specified radix to an unsigned 64-bit value
+        //!
+        //! @note aValue may be modified even on failure.
+        //! @return true if all characters are valid digits and the value fits in 64 bits,
+        //!     false otherwise.
+        bool ConvertDigits
+            (
+            RadixType const aRadix,
+            char const* const aDigits,
+            size_t const aNumDigits,
+            uint64_t& aValue
+            );
+
         //! @return The number of bits needed to store a digit in the given radix, or 0 on error.
         size_t GetRadixBits
             (
@@ -0,0 +1,152 @@
+/**
+    BFDP Data Standard Library Allocator Adapter
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Data_StlAllocator
+#define Bfdp_Data_StlAllocator
+
+// External Includes
+#include <cstddef>
+#include <limits>
+#include <new>
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/HeapAllocator.hpp"
+#include "Bfdp/Data/IAllocator.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        //! Standard library allocator that draws memory from an IAllocator
+        //!
+        //! Holds a shared reference to the IAllocator, so that whatever is allocated through it
+        //! (e.g., objects made with std::allocate_shared, or the nodes of a container) keeps the
+        //! IAllocator alive.  Without an IAllocator, memory comes from the heap.
+        //!
+        //! Objects can outlive the Database whose arena they came from (e.g., the classes of a
+        //! library merged into a spec), so a raw pointer would not be safe, and the reference
+        //! count costs nothing measurable when loading specs.
+        template< class T >
+        class StlAllocator
+        {
+        public:
+            typedef T value_type;
+
+            StlAllocator()
+            {
+            }
+
+            explicit StlAllocator
+                (
+                IAllocatorPtr const& aAllocator
+                )
+                : mAllocator( aAllocator )
+            {
+            }
+
+            template< class U >
+            StlAllocator
+                (
+                StlAllocator< U > const& aOther
+                )
+                : mAllocator( aOther.GetAllocator() )
+            {
+            }
+
+            T* allocate
+                (
+                size_t const aCount
+                )
+            {
+                if( aCount > ( std::numeric_limits< size_t >::max() / sizeof( T ) ) )
+                {
+                    throw std::bad_alloc();
+                }
+
+                void* const ptr = GetSource().Allocate( aCount * sizeof( T ) );
+                if( ptr == NULL )
+                {
+                    throw std::bad_alloc();
+                }
+                return static_cast< T* >( ptr );
+            }
+
+            void deallocate
+                (
+                T* const aPtr,
+                size_t const aCount
+                )
+            {
+                GetSource().Free( aPtr, aCount * sizeof( T ) );
+            }
+
+            //! @return The IAllocator that memory comes from, or NULL for the heap
+            IAllocatorPtr const& GetAllocator() const
+            {
+                return mAllocator;
+            }
+
+            template< class U >
+            bool operator ==
+                (
+                StlAllocator< U > const& aOther
+                ) const
+            {
+                return mAllocator == aOther.GetAllocator();
+            }
+
+            template< class U >
+            bool operator !=
+                (
+                StlAllocator< U > const& aOther
+                ) const
+            {
+                return mAllocator != aOther.GetAllocator();
+            }
+
+        private:
+            IAllocator& GetSource() const
+            {
+                return mAllocator ? *mAllocator : HeapAllocator::GetInstance();
+            }
+
+            IAllocatorPtr mAllocator;
+        };
+
+    } // namespace Data
+
+} // namespace Bfdp
+
+#endif // Bfdp_Data_StlAllocator
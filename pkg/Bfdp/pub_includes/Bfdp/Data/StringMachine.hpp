@@ -34,7 +34,7 @@
 #define Bfdp_Data_StringMachine
 
 // External Includes
-#include <sstream>
+#include <string>
 
 // Internal Includes
 #include "Bfdp/Macros.hpp"
@@ -50,6 +50,9 @@ namespace Bfdp
         //!
         //! This class encapsulates a string, which can be modified dynamically and perform output
         //! conversion.
+        //!
+        //! @note The UTF8 value is appended in place, so interleaved appends and reads are linear
+        //!     overall.  Short values are held inline by std::string.
         class StringMachine BFDP_FINAL
         {
         public:
@@ -112,21 +115,11 @@ namespace Bfdp
             void SetDefined();
 
         private:
-            char GetHex
-                (
-                char const aNibble
-                ) const;
-
-            void Pack() const;
-
             //! Whether a value has been added
             bool mDefined;
 
-            // Internal cache for read optimization; UTF8 format
-            mutable std::string mCache;
-
-            // Buffer used to build the string; UTF8 format.
-            mutable std::ostringstream mBuffer;
+            //! The string value; UTF8 format
+            std::string mValue;
         };
 
     } // namespace Data
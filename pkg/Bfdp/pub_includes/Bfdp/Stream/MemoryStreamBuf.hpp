@@ -0,0 +1,87 @@
+/**
+    BFDP Stream Memory Stream Buffer Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Stream_MemoryStreamBuf
+#define Bfdp_Stream_MemoryStreamBuf
+
+// External Includes
+#include <streambuf>
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+#include "Bfdp/String.hpp"
+
+namespace Bfdp
+{
+
+    namespace Stream
+    {
+
+        //! Read-only, seekable std::streambuf over a block of memory
+        //!
+        //! Lets a StreamBase read from memory (e.g., part of a MappedFile) through a std::istream
+        //! without copying the block first.  The memory must outlive the buffer.
+        class MemoryStreamBuf BFDP_FINAL
+            : public std::streambuf
+            , private NonAssignable
+            , private NonCopyable
+        {
+        public:
+            MemoryStreamBuf
+                (
+                Byte const* const aData,
+                size_t const aSize
+                );
+
+        protected:
+            BFDP_OVERRIDE( pos_type seekoff
+                (
+                off_type aOffset,
+                std::ios_base::seekdir aDir,
+                std::ios_base::openmode aMode
+                ) );
+
+            BFDP_OVERRIDE( pos_type seekpos
+                (
+                pos_type aPos,
+                std::ios_base::openmode aMode
+                ) );
+        };
+
+    } // namespace Stream
+
+} // namespace Bfdp
+
+#endif // Bfdp_Stream_MemoryStreamBuf
@@ -0,0 +1,152 @@
+/**
+    BFDP Stream Record Index Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Stream_RecordIndex
+#define Bfdp_Stream_RecordIndex
+
+// External Includes
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/ByteBuffer.hpp"
+
+namespace Bfdp
+{
+
+    namespace Stream
+    {
+
+        //! Sparse index of the records in a data stream
+        //!
+        //! Holds the bit offset of every Nth record (N being the interval), so that decoding can
+        //! begin close to any record without decoding everything before it.  The index records
+        //! the size of the data and a key for the layout of the records (e.g., a hash of the
+        //! spec) so that a stale index can be detected.
+        //!
+        //! An index file is text: a "BFDP-RECORD-INDEX 1" line, then "interval", "data-bytes",
+        //! "key" and "records" lines of the form "<name> <value>", then the bit offset of each
+        //! indexed record, one per line.
+        class RecordIndex
+        {
+        public:
+            static uint64_t const DefaultInterval = 1024U;
+
+            RecordIndex();
+
+            //! Add the offset of the next indexed record
+            //!
+            //! @return true if successful, false if aRecord is not the next record to index.
+            bool Add
+                (
+                uint64_t const aRecord,
+                uint64_t const aPosBits
+                );
+
+            //! Mark the index complete
+            void Complete
+                (
+                uint64_t const aNumRecords
+                );
+
+            //! Find the closest indexed record at or before aRecord
+            //!
+            //! @return true if successful, false if the index holds no such record.
+            bool Find
+                (
+                uint64_t const aRecord,
+                uint64_t& aOutRecord,
+                uint64_t& aOutPosBits
+                ) const;
+
+            uint64_t GetDataBytes() const;
+
+            uint64_t GetInterval() const;
+
+            uint64_t GetKey() const;
+
+            //! @return The number of records in the data; valid when complete.
+            uint64_t GetNumRecords() const;
+
+            //! @return Whether every record in the data has been counted
+            bool IsComplete() const;
+
+            //! @return Whether the index is complete, and describes the given data and layout
+            bool IsMatch
+                (
+                uint64_t const aDataBytes,
+                uint64_t const aKey
+                ) const;
+
+            //! Load an index file, replacing the contents of the index
+            //!
+            //! @return true if successful, false otherwise (the index is left empty).
+            bool Load
+                (
+                std::string const& aFileName
+                );
+
+            //! Empty the index, and describe the data and layout it will index
+            void Reset
+                (
+                uint64_t const aInterval,
+                uint64_t const aDataBytes,
+                uint64_t const aKey
+                );
+
+            //! Save a complete index to a file
+            //!
+            //! @return true if successful, false otherwise.
+            bool Save
+                (
+                std::string const& aFileName
+                ) const;
+
+        private:
+            uint64_t const* GetOffsets() const;
+
+            bool mComplete;
+            uint64_t mDataBytes;
+            uint64_t mInterval;
+            uint64_t mKey;
+            size_t mNumOffsets;
+            uint64_t mNumRecords;
+
+            //! Bit offset of record (i * mInterval) at index i, as uint64_t
+            Data::ByteBuffer mOffsets;
+        };
+
+    } // namespace Stream
+
+} // namespace Bfdp
+
+#endif // Bfdp_Stream_RecordIndex
@@ -66,6 +66,10 @@ namespace Bfdp
         //!
         //! This base class lets concrete classes specialize behavior using
         //! the Template Method pattern.
+        //!
+        //! The read buffer is borrowed from Data::BufferPool::GetShared() on
+        //! the first read, and returned to it on destruction, so streams that
+        //! come and go do not each allocate a new buffer.
         class StreamBase
             : private NonAssignable
             , private NonCopyable
@@ -107,6 +111,18 @@ namespace Bfdp
             //! @return True if the sequence was started successfully
             bool ReadStream();
 
+            //! Move to a position in the input stream before reading from it
+            //!
+            //! Totals of processed data count from the new position.
+            //!
+            //! @pre No data has been read yet.
+            //! @return true if successful, false if the input stream cannot seek (the position
+            //!     is unchanged).
+            bool Seek
+                (
+                uint64_t const aPosBits
+                );
+
             //! @return Whether the stream object is ready to be used
             bool IsValid() const;
 
@@ -165,6 +181,9 @@ namespace Bfdp
             //! Interface for processing data
             IStreamObserver& mObserver;
 
+            //! Bits to skip in the first byte read after a seek
+            size_t mSkipBits;
+
             //! Byte-wise portion of total amount of data ever processed (may wrap!)
             size_t mTotalProcessedBytes;
 
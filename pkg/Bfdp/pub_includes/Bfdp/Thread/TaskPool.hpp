@@ -0,0 +1,153 @@
+/**
+    BFDP Thread Task Pool Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef Bfdp_Thread_TaskPool
+#define Bfdp_Thread_TaskPool
+
+// Base Includes
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+
+// External Includes
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Macros.hpp"
+
+namespace Bfdp
+{
+
+    namespace Thread
+    {
+
+        //! Task Pool
+        //!
+        //! Runs submitted tasks on a fixed set of worker threads.  A task that no worker has
+        //! started yet is run by the thread that waits for it, so tasks may wait for other tasks
+        //! without starving the pool.
+        class TaskPool BFDP_FINAL
+            : private Bfdp::NonAssignable
+            , private Bfdp::NonCopyable
+        {
+        public:
+            typedef std::function< void() > Work;
+
+            class Task;
+
+            typedef std::shared_ptr< Task > TaskPtr;
+
+            //! @return The number of threads the hardware can run at once, or 1 if unknown
+            static size_t GetDefaultNumThreads();
+
+            //! Start the worker threads
+            //!
+            //! @note With no worker threads, each task is run by the thread that waits for it.
+            explicit TaskPool
+                (
+                size_t const aNumThreads
+                );
+
+            //! Stop the worker threads once the queued tasks are done
+            ~TaskPool();
+
+            size_t GetNumThreads() const;
+
+            //! Queue work to be run
+            //!
+            //! @return The task, to pass to Wait().
+            TaskPtr Submit
+                (
+                Work const& aWork
+                );
+
+            //! Wait for a task to finish, running it in the calling thread if it has not started
+            void Wait
+                (
+                TaskPtr const& aTask
+                );
+
+        private:
+            typedef std::deque< TaskPtr > TaskQueue;
+            typedef std::list< std::thread > WorkerList;
+
+            //! Run a task unless another thread has already started it
+            static void Run
+                (
+                Task& aTask
+                );
+
+            void WorkerMain();
+
+            bool mStopping;
+            TaskQueue mQueue;
+            std::mutex mQueueMutex;
+            std::condition_variable mQueueSignal;
+            WorkerList mWorkers;
+        };
+
+        //! A unit of work submitted to a TaskPool
+        class TaskPool::Task BFDP_FINAL
+            : private Bfdp::NonAssignable
+            , private Bfdp::NonCopyable
+        {
+        public:
+            explicit Task
+                (
+                Work const& aWork
+                );
+
+            //! @return Whether the task has finished
+            bool IsDone();
+
+        private:
+            friend class TaskPool;
+
+            Work mWork;
+            std::atomic< bool > mClaimed;
+            bool mDone;
+            std::mutex mDoneMutex;
+            std::condition_variable mDoneSignal;
+        };
+
+    } // namespace Thread
+
+} // namespace Bfdp
+
+#endif // Bfdp_Thread_TaskPool
@@ -0,0 +1,291 @@
+/**
+    BFDP Algorithm Case Table Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Algorithm/CaseTable.hpp"
+
+// External Includes
+#include <algorithm>
+#include <numeric>
+
+namespace Bfdp
+{
+
+    namespace Algorithm
+    {
+
+        // Use internal namespace to avoid ODR violations
+        namespace CaseTableInternal
+        {
+
+            //! Average number of tags per bucket of a perfect hash
+            static size_t const TagsPerBucket = 4U;
+
+            //! Number of seeds tried for each bucket before trying a larger table
+            static uint64_t const MaxSeedSearch = 1U << 16;
+
+            //! Number of times the table size is doubled before giving up
+            static size_t const MaxHashAttempts = 4U;
+
+            //! Orders bucket numbers by decreasing number of tags
+            struct LargerBucket
+            {
+                //! @param[in] aStarts Index of the first tag of each bucket, and one past the last
+                LargerBucket
+                    (
+                    size_t const* const aStarts
+                    )
+                    : mStarts( aStarts )
+                {
+                }
+
+                bool operator()
+                    (
+                    size_t const aLhs,
+                    size_t const aRhs
+                    ) const
+                {
+                    return ( mStarts[aLhs + 1] - mStarts[aLhs] ) > ( mStarts[aRhs + 1] - mStarts[aRhs] );
+                }
+
+                size_t const* mStarts;
+            };
+
+        } // namespace CaseTableInternal
+
+        using namespace CaseTableInternal;
+
+        CaseTable::CaseTable()
+            : mBase( 0U )
+            , mBucketMask( 0U )
+            , mCount( 0U )
+            , mDense( false )
+            , mNumSlots( 0U )
+            , mSlotMask( 0U )
+        {
+        }
+
+        bool CaseTable::Build
+            (
+            uint64_t const* const aTags,
+            size_t const aCount
+            )
+        {
+            Reset();
+            if( aCount == 0 )
+            {
+                return true;
+            }
+
+            Data::ByteBuffer sortedBuf;
+            BFDP_RETURNIF_V( !sortedBuf.Allocate( aCount * sizeof( uint64_t ) ), false );
+            BFDP_UNUSED_RETURN( sortedBuf.CopyFrom( aTags, aCount * sizeof( uint64_t ) ) );
+            uint64_t* const sorted = sortedBuf.GetPtrT< uint64_t >();
+            std::sort( sorted, sorted + aCount );
+            if( std::adjacent_find( sorted, sorted + aCount ) != ( sorted + aCount ) )
+            {
+                return false;
+            }
+
+            // Compare the span of the tags (less one, so it cannot overflow)
+            uint64_t const span = sorted[aCount - 1] - sorted[0];
+            if( ( span < MinDenseRange ) || ( span < ( MaxDenseRatio * aCount ) ) )
+            {
+                BFDP_RETURNIF_V( !AllocateSlots( static_cast< size_t >( span ) + 1U ), false );
+                mBase = sorted[0];
+                Slot* const slots = mSlots.GetPtrT< Slot >();
+                for( size_t i = 0; i < aCount; ++i )
+                {
+                    Slot& slot = slots[static_cast< size_t >( aTags[i] - mBase )];
+                    slot.tag = aTags[i];
+                    slot.caseNum = i;
+                }
+                mCount = aCount;
+                mDense = true;
+                return true;
+            }
+
+            // At least twice as many slots as tags keeps the seed search short
+            size_t numSlots = 2U;
+            while( numSlots < ( 2U * aCount ) )
+            {
+                numSlots <<= 1;
+            }
+            for( size_t attempt = 0; attempt < MaxHashAttempts; ++attempt, numSlots <<= 1 )
+            {
+                if( BuildHash( aTags, aCount, numSlots ) )
+                {
+                    mCount = aCount;
+                    return true;
+                }
+            }
+
+            Reset();
+            return false;
+        }
+
+        size_t CaseTable::GetNumCases() const
+        {
+            return mCount;
+        }
+
+        bool CaseTable::IsDense() const
+        {
+            return mDense;
+        }
+
+        bool CaseTable::AllocateSlots
+            (
+            size_t const aNumSlots
+            )
+        {
+            if( !mSlots.Allocate( aNumSlots * sizeof( Slot ) ) )
+            {
+                mNumSlots = 0U;
+                return false;
+            }
+
+            Slot* const slots = mSlots.GetPtrT< Slot >();
+            Slot const unused = { 0U, NoCase };
+            std::fill( slots, slots + aNumSlots, unused );
+            mNumSlots = aNumSlots;
+            return true;
+        }
+
+        bool CaseTable::BuildHash
+            (
+            uint64_t const* const aTags,
+            size_t const aCount,
+            size_t const aNumSlots
+            )
+        {
+            size_t numBuckets = 1U;
+            while( ( numBuckets * TagsPerBucket ) < aCount )
+            {
+                numBuckets <<= 1;
+            }
+            mBucketMask = numBuckets - 1U;
+            mSlotMask = aNumSlots - 1U;
+            BFDP_RETURNIF_V( !mSeeds.Allocate( numBuckets * sizeof( uint64_t ) ), false );
+            mSeeds.Clear();
+            BFDP_RETURNIF_V( !AllocateSlots( aNumSlots ), false );
+            uint64_t* const seeds = mSeeds.GetPtrT< uint64_t >();
+            Slot* const slots = mSlots.GetPtrT< Slot >();
+
+            // Scratch space: the first tag of each bucket (and one past the last), the tags
+            // grouped by bucket, the order to place the buckets in, and the slots being tried
+            Data::ByteBuffer scratch;
+            BFDP_RETURNIF_V( !scratch.Allocate( ( ( 2U * numBuckets ) + 1U + ( 2U * aCount ) ) * sizeof( size_t ) ), false );
+            size_t* const starts = scratch.GetPtrT< size_t >();
+            size_t* const members = starts + numBuckets + 1U;
+            size_t* const order = members + aCount;
+            size_t* const placed = order + numBuckets;
+
+            // Group the tags by bucket with a counting sort; filling each bucket from its end,
+            // in reverse, leaves the tags of a bucket in order and starts[] at their first tag
+            std::fill( starts, starts + numBuckets, 0U );
+            starts[numBuckets] = aCount;
+            for( size_t i = 0; i < aCount; ++i )
+            {
+                ++starts[static_cast< size_t >( Mix( aTags[i] ) >> 32 ) & mBucketMask];
+            }
+            std::partial_sum( starts, starts + numBuckets, starts );
+            for( size_t i = aCount; i > 0; --i )
+            {
+                members[--starts[static_cast< size_t >( Mix( aTags[i - 1] ) >> 32 ) & mBucketMask]] = i - 1;
+            }
+
+            // Place the largest buckets first, while the most slots are free
+            std::iota( order, order + numBuckets, 0U );
+            std::stable_sort( order, order + numBuckets, LargerBucket( starts ) );
+
+            for( size_t i = 0; i < numBuckets; ++i )
+            {
+                size_t const* const first = members + starts[order[i]];
+                size_t const numMembers = starts[order[i] + 1] - starts[order[i]];
+                if( numMembers == 0 )
+                {
+                    break;
+                }
+
+                // Find a seed that puts every tag of the bucket in a free slot of its own
+                bool found = false;
+                for( uint64_t seed = 0; !found && ( seed < MaxSeedSearch ); ++seed )
+                {
+                    size_t numPlaced = 0;
+                    for( ; numPlaced < numMembers; ++numPlaced )
+                    {
+                        size_t const slot = static_cast< size_t >( Mix( Mix( aTags[first[numPlaced]] ) + seed ) ) & mSlotMask;
+                        if( ( slots[slot].caseNum != NoCase ) ||
+                            ( std::find( placed, placed + numPlaced, slot ) != ( placed + numPlaced ) ) )
+                        {
+                            break;
+                        }
+                        placed[numPlaced] = slot;
+                    }
+
+                    if( numPlaced == numMembers )
+                    {
+                        found = true;
+                        seeds[order[i]] = seed;
+                        for( size_t m = 0; m < numMembers; ++m )
+                        {
+                            slots[placed[m]].tag = aTags[first[m]];
+                            slots[placed[m]].caseNum = first[m];
+                        }
+                    }
+                }
+
+                if( !found )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void CaseTable::Reset()
+        {
+            mBase = 0U;
+            mBucketMask = 0U;
+            mCount = 0U;
+            mDense = false;
+            mNumSlots = 0U;
+            mSeeds.Delete();
+            mSlotMask = 0U;
+            mSlots.Delete();
+        }
+
+    } // namespace Algorithm
+
+} // namespace Bfdp
@@ -0,0 +1,194 @@
+/**
+    BFDP Algorithm Search Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Algorithm/Search.hpp"
+
+// External Includes
+#include <cstring>
+
+namespace Bfdp
+{
+
+    namespace Algorithm
+    {
+
+        // Use internal namespace to avoid ODR violations
+        namespace SearchInternal
+        {
+            //! Word type used for SWAR (SIMD Within A Register) operations
+            typedef uint64_t Word;
+
+            static Word const LowBits = 0x0101010101010101ULL;
+            static Word const HighBits = 0x8080808080808080ULL;
+            static Word const LowMask = 0x7f7f7f7f7f7f7f7fULL;
+
+            //! @return aValue repeated in every byte of a Word
+            static inline Word Broadcast
+                (
+                Byte const aValue
+                )
+            {
+                return LowBits * aValue;
+            }
+
+            //! @return Word loaded from unaligned memory
+            static inline Word LoadWord
+                (
+                Byte const* const aData
+                )
+            {
+                Word w;
+                std::memcpy( &w, aData, sizeof( w ) );
+                return w;
+            }
+
+            //! @return Word with the high bit set in each byte where aWord was zero, and all
+            //!     other bits clear.
+            //!
+            //! @note Unlike the common "haszero" trick, this does not produce false positives
+            //!     from borrows, so the result can be counted.
+            static inline Word ZeroBytes
+                (
+                Word const aWord
+                )
+            {
+                return ~( ( ( aWord & LowMask ) + LowMask ) | aWord | LowMask );
+            }
+
+            //! @return The number of bytes in aMarks with the high bit set
+            static inline size_t CountMarks
+                (
+                Word const aMarks
+                )
+            {
+                // Each byte becomes 0 or 1; the multiply sums them into the top byte
+                return static_cast< size_t >( ( ( aMarks >> 7 ) * LowBits ) >> 56 );
+            }
+        }
+        using namespace SearchInternal;
+
+        size_t CountByte
+            (
+            Byte const* const aData,
+            size_t const aSize,
+            Byte const aValue
+            )
+        {
+            Word const pattern = Broadcast( aValue );
+            size_t count = 0;
+            size_t i = 0;
+
+            for( ; i + sizeof( Word ) <= aSize; i += sizeof( Word ) )
+            {
+                count += CountMarks( ZeroBytes( LoadWord( &aData[i] ) ^ pattern ) );
+            }
+
+            for( ; i < aSize; ++i )
+            {
+                if( aData[i] == aValue )
+                {
+                    ++count;
+                }
+            }
+
+            return count;
+        }
+
+        size_t FindFirstByteOf
+            (
+            Byte const* const aData,
+            size_t const aSize,
+            Byte const aValue1,
+            Byte const aValue2
+            )
+        {
+            Word const pattern1 = Broadcast( aValue1 );
+            Word const pattern2 = Broadcast( aValue2 );
+            size_t i = 0;
+
+            for( ; i + sizeof( Word ) <= aSize; i += sizeof( Word ) )
+            {
+                Word const w = LoadWord( &aData[i] );
+                if( ( ZeroBytes( w ^ pattern1 ) | ZeroBytes( w ^ pattern2 ) ) != 0 )
+                {
+                    // Found in this word; let the byte loop below locate it
+                    break;
+                }
+            }
+
+            for( ; i < aSize; ++i )
+            {
+                if( ( aData[i] == aValue1 ) || ( aData[i] == aValue2 ) )
+                {
+                    return i;
+                }
+            }
+
+            return aSize;
+        }
+
+        size_t FindLastByte
+            (
+            Byte const* const aData,
+            size_t const aSize,
+            Byte const aValue
+            )
+        {
+            Word const pattern = Broadcast( aValue );
+            size_t end = aSize;
+
+            while( end >= sizeof( Word ) )
+            {
+                if( ZeroBytes( LoadWord( &aData[end - sizeof( Word )] ) ^ pattern ) != 0 )
+                {
+                    // Found in this word; let the byte loop below locate it
+                    break;
+                }
+                end -= sizeof( Word );
+            }
+
+            while( end > 0 )
+            {
+                --end;
+                if( aData[end] == aValue )
+                {
+                    return end;
+                }
+            }
+
+            return aSize;
+        }
+
+    } // namespace Algorithm
+
+} // namespace Bfdp
@@ -35,6 +35,7 @@
 
 //! External Includes
 #include <string>
+#include <utility>
 
 //! Internal Includes
 #include "Bfdp/Common.hpp"
@@ -58,6 +59,18 @@ namespace Bfdp
             BFDP_UNUSED_RETURN( CreateBuffer( aInitialCapacity ) );
         }
 
+        BitBuffer::BitBuffer
+            (
+            size_t const aInitialCapacity,
+            Data::IAllocator& aAllocator
+            )
+            : mBuffer( aAllocator )
+            , mCapacityBits( 0 )
+            , mDataBits( 0 )
+        {
+            BFDP_UNUSED_RETURN( CreateBuffer( aInitialCapacity ) );
+        }
+
         BitBuffer::BitBuffer
             (
             Byte const* const aBytes,
@@ -81,12 +94,25 @@ namespace Bfdp
             (
             BitBuffer const& aOther
             )
-            : mCapacityBits( 0 )
+            : mBuffer( aOther.GetAllocator() )
+            , mCapacityBits( 0 )
             , mDataBits( 0 )
         {
             Copy( aOther );
         }
 
+        BitBuffer::BitBuffer
+            (
+            BitBuffer&& aOther
+            )
+            : mBuffer( std::move( aOther.mBuffer ) )
+            , mCapacityBits( aOther.mCapacityBits )
+            , mDataBits( aOther.mDataBits )
+        {
+            aOther.mCapacityBits = 0;
+            aOther.mDataBits = 0;
+        }
+
         BitBuffer::~BitBuffer()
         {
             DeleteBuffer();
@@ -101,6 +127,27 @@ namespace Bfdp
             return *this;
         }
 
+        BitBuffer& BitBuffer::operator=
+            (
+            BitBuffer&& aOther
+            )
+        {
+            if( this != &aOther )
+            {
+                mBuffer = std::move( aOther.mBuffer );
+                mCapacityBits = aOther.mCapacityBits;
+                mDataBits = aOther.mDataBits;
+                aOther.mCapacityBits = 0;
+                aOther.mDataBits = 0;
+            }
+            return *this;
+        }
+
+        Data::IAllocator& BitBuffer::GetAllocator() const
+        {
+            return mBuffer.GetAllocator();
+        }
+
         size_t BitBuffer::GetCapacityBits() const
         {
             return mCapacityBits;
@@ -168,7 +215,7 @@ namespace Bfdp
                 return true;
             }
 
-            Data::ByteBuffer newBuffer;
+            Data::ByteBuffer newBuffer( mBuffer.GetAllocator() );
             if( !AllocateBits( aNumBits, newBuffer ) )
             {
                 return false;
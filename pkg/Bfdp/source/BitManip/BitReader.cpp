@@ -0,0 +1,81 @@
+/**
+    BFDP Bit Reader Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/BitManip/BitReader.hpp"
+
+// Internal Includes
+#include "Bfdp/BitManip/Conversion.hpp"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        BitReader::BitReader
+            (
+            BitView const& aView
+            )
+            : mNext( aView.GetDataPtr() )
+            , mEnd( aView.GetDataPtr() + BitsToBytes( aView.GetOffsetBits() + aView.GetSizeBits() ) )
+            , mBits( 0U )
+            , mNumBits( 0U )
+            , mBitsLeft( aView.GetSizeBits() )
+        {
+            if( aView.GetOffsetBits() != 0 )
+            {
+                // Drop the bits of the first byte that precede the view
+                Refill();
+                mBits >>= aView.GetOffsetBits();
+                mNumBits -= aView.GetOffsetBits();
+            }
+        }
+
+        size_t BitReader::GetBitsLeft() const
+        {
+            return mBitsLeft;
+        }
+
+        void BitReader::RefillSlow()
+        {
+            while( ( mNumBits <= ( MaxReadBits - BitsPerByte ) ) && ( mNext != mEnd ) )
+            {
+                mBits |= static_cast< uint64_t >( *mNext ) << mNumBits;
+                mNumBits += BitsPerByte;
+                ++mNext;
+            }
+        }
+
+    } // namespace BitManip
+
+} // namespace Bfdp
@@ -0,0 +1,162 @@
+/**
+    BFDP Bit View Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/BitManip/BitView.hpp"
+
+// External Includes
+#include <algorithm>
+
+// Internal Includes
+#include "Bfdp/BitManip/Mask.hpp"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        BitView::BitView()
+            : mData( NULL )
+            , mOffsetBits( 0 )
+            , mSizeBits( 0 )
+        {
+        }
+
+        BitView::BitView
+            (
+            Byte const* const aData,
+            size_t const aOffsetBits,
+            size_t const aSizeBits
+            )
+            : mData( aData + ( aOffsetBits / BitsPerByte ) )
+            , mOffsetBits( aOffsetBits % BitsPerByte )
+            , mSizeBits( aSizeBits )
+        {
+        }
+
+        bool BitView::GetAlignedBytes
+            (
+            Byte const*& aOutData,
+            size_t& aOutNumBytes
+            ) const
+        {
+            BFDP_RETURNIF_V( !IsByteAligned(), false );
+
+            aOutData = mData;
+            aOutNumBytes = mSizeBits / BitsPerByte;
+            return true;
+        }
+
+        Byte const* BitView::GetDataPtr() const
+        {
+            return mData;
+        }
+
+        size_t BitView::GetOffsetBits() const
+        {
+            return mOffsetBits;
+        }
+
+        size_t BitView::GetSizeBits() const
+        {
+            return mSizeBits;
+        }
+
+        bool BitView::IsByteAligned() const
+        {
+            return mOffsetBits == 0;
+        }
+
+        bool BitView::IsEmpty() const
+        {
+            return mSizeBits == 0;
+        }
+
+        bool BitView::Skip
+            (
+            size_t const aNumBits
+            )
+        {
+            BFDP_RETURNIF_V( aNumBits > mSizeBits, false );
+
+            size_t const bitPos = mOffsetBits + aNumBits;
+            mData += bitPos / BitsPerByte;
+            mOffsetBits = bitPos % BitsPerByte;
+            mSizeBits -= aNumBits;
+            return true;
+        }
+
+        bool BitView::SubView
+            (
+            size_t const aOffsetBits,
+            size_t const aSizeBits,
+            BitView& aOutView
+            ) const
+        {
+            // Detect overrun in such a way as to avoid overflows
+            BFDP_RETURNIF_V( aOffsetBits > mSizeBits, false );
+            BFDP_RETURNIF_V( aSizeBits > ( mSizeBits - aOffsetBits ), false );
+
+            aOutView = BitView( mData, mOffsetBits + aOffsetBits, aSizeBits );
+            return true;
+        }
+
+        bool BitView::PeekBits
+            (
+            size_t const aNumBits,
+            uint64_t& aOutValue
+            ) const
+        {
+            BFDP_RETURNIF_V( aNumBits > mSizeBits, false );
+
+            // Copy up to a byte at a time, least significant bits first
+            uint64_t value = 0;
+            size_t outBits = 0;
+            size_t byteIdx = 0;
+            size_t bitIdx = mOffsetBits;
+            while( outBits < aNumBits )
+            {
+                size_t const numBits = std::min( BitsPerByte - bitIdx, aNumBits - outBits );
+                value |= static_cast< uint64_t >( ExtractBits< Byte >( mData[byteIdx], numBits, bitIdx ) ) << outBits;
+                outBits += numBits;
+                bitIdx = 0;
+                ++byteIdx;
+            }
+
+            aOutValue = value;
+            return true;
+        }
+
+    } // namespace BitManip
+
+} // namespace Bfdp
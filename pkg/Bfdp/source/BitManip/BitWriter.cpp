@@ -0,0 +1,131 @@
+/**
+    BFDP Bit Writer Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/BitManip/BitWriter.hpp"
+
+// Internal Includes
+#include "Bfdp/BitManip/Conversion.hpp"
+#include "Bfdp/Data/BufferPool.hpp"
+#include "Bfdp/ErrorReporter/Functions.hpp"
+
+#define BFDP_MODULE "BitManip::BitWriter"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        BitWriter::BitWriter
+            (
+            std::streambuf& aOut,
+            Endianness::Type const aBitOrder,
+            Endianness::Type const aByteOrder
+            )
+            : mOut( aOut )
+            , mBitOrder( aBitOrder )
+            , mSwapBytes( aBitOrder != aByteOrder )
+            , mBuffer( Data::BufferPool::GetShared() )
+            , mBufferUsed( 0U )
+            , mSpilledBytes( 0U )
+            , mBits( 0U )
+            , mNumBits( 0U )
+            , mOk( true )
+        {
+            if( !mBuffer.Allocate( DefaultBufferBytes ) )
+            {
+                BFDP_RUNTIME_ERROR( "Failed to allocate output buffer" );
+                mOk = false;
+            }
+        }
+
+        bool BitWriter::Finish()
+        {
+            size_t const numBytes = BitsToBytes( mNumBits );
+            if( numBytes > 0 )
+            {
+                // Lay the accumulator out as Store() would, then keep the leading bytes
+                Byte bytes[sizeof( mBits )];
+                for( size_t i = 0; i < numBytes; ++i )
+                {
+                    size_t const shift = ( mBitOrder == Endianness::Little )
+                        ? ( i * BitsPerByte )
+                        : ( WordBits - BitsPerByte - ( i * BitsPerByte ) );
+                    bytes[i] = static_cast< Byte >( mBits >> shift );
+                }
+
+                if( ( mBufferUsed + numBytes ) > mBuffer.GetSize() )
+                {
+                    Spill();
+                }
+                if( mOk )
+                {
+                    std::memcpy( mBuffer.GetPtr() + mBufferUsed, bytes, numBytes );
+                    mBufferUsed += numBytes;
+                }
+                mBits = 0U;
+                mNumBits = 0U;
+            }
+
+            Spill();
+            return mOk;
+        }
+
+        uint64_t BitWriter::GetPosBits() const
+        {
+            return ( ( mSpilledBytes + mBufferUsed ) * BitsPerByte ) + mNumBits;
+        }
+
+        bool BitWriter::IsOk() const
+        {
+            return mOk;
+        }
+
+        void BitWriter::Spill()
+        {
+            if( mOk && ( mBufferUsed > 0 ) )
+            {
+                std::streamsize const size = static_cast< std::streamsize >( mBufferUsed );
+                if( mOut.sputn( mBuffer.GetConstPtrT< char >(), size ) != size )
+                {
+                    BFDP_RUNTIME_ERROR( "Failed to write output" );
+                    mOk = false;
+                }
+            }
+            mSpilledBytes += mBufferUsed;
+            mBufferUsed = 0U;
+        }
+
+    } // namespace BitManip
+
+} // namespace Bfdp
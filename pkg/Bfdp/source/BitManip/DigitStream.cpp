@@ -34,8 +34,10 @@
 #include "Bfdp/BitManip/DigitStream.hpp"
 
 // Internal Includes
+#include "Bfdp/BitManip/BitReader.hpp"
 #include "Bfdp/BitManip/Conversion.hpp"
 #include "Bfdp/BitManip/GenericBitStream.hpp"
+#include "Bfdp/Data/ByteBuffer.hpp"
 #include "Bfdp/Macros.hpp"
 
 #define BFDP_MODULE "BitManip::DigitStream"
@@ -48,11 +50,28 @@ namespace Bfdp
 
         bool Digiterator::IsDone() const
         {
+            if( mUseValue )
+            {
+                return mDigitsLeft == 0;
+            }
             return ( mBitsPerDigit == 0 ) || ( mStream.GetBitsTillEnd() < mBitsPerDigit );
         }
 
         unsigned int Digiterator::ReadDigit() const
         {
+            if( mUseValue )
+            {
+                BFDP_RETURNIF_V( mDigitsLeft == 0, 0U );
+                --mDigitsLeft;
+                // Leading zeros come before any significant digits
+                BFDP_RETURNIF_V( mDigitsLeft >= mSignificantDigits, 0U );
+
+                unsigned int const digit = static_cast< unsigned int >( mValue / mDivisor );
+                mValue %= mDivisor;
+                mDivisor /= mRadix;
+                return digit;
+            }
+
             unsigned int out = 0U;
             Byte* outBuf = reinterpret_cast< Byte* >( &out );
 
@@ -72,6 +91,12 @@ namespace Bfdp
             )
             : mBitsPerDigit( aBitsPerDigit )
             , mStream( aBuffer )
+            , mUseValue( false )
+            , mRadix( Data::InvalidRadix )
+            , mValue( 0U )
+            , mDivisor( 1U )
+            , mDigitsLeft( 0U )
+            , mSignificantDigits( 0U )
         {
             if( BitsToBytes( aBitsPerDigit ) > sizeof( unsigned int ) )
             {
@@ -82,21 +107,74 @@ namespace Bfdp
             }
         }
 
+        Digiterator::Digiterator
+            (
+            BitBuffer& aBuffer,
+            uint64_t const aValue,
+            size_t const aNumDigits,
+            Data::RadixType const aRadix
+            )
+            : mBitsPerDigit( Data::GetRadixBits( aRadix ) )
+            , mStream( aBuffer )
+            , mUseValue( true )
+            , mRadix( aRadix )
+            , mValue( aValue )
+            , mDivisor( 1U )
+            , mDigitsLeft( ( mBitsPerDigit == 0 ) ? 0U : aNumDigits )
+            , mSignificantDigits( 0U )
+        {
+            if( aValue != 0U )
+            {
+                // Find the place value of the most significant digit; this cannot overflow
+                // since it is never greater than the value.
+                mSignificantDigits = 1U;
+                while( ( aValue / mDivisor ) >= aRadix )
+                {
+                    mDivisor *= aRadix;
+                    ++mSignificantDigits;
+                }
+            }
+        }
+
         DigitStream::DigitStream()
-            : mRadix( Data::InvalidRadix )
+            : mNumDigits( 0U )
+            , mRadix( Data::InvalidRadix )
+            , mValue( 0U )
         {
         }
 
+        bool DigitStream::GetBigUint
+            (
+            Data::BigUint& aOut
+            ) const
+        {
+            BFDP_RETURNIF_V( !IsWide(), aOut.Set( mValue ) );
+
+            Data::ByteBuffer digits;
+            BFDP_RETURNIF_V( !digits.Allocate( mNumDigits ), false );
+
+            Digiterator iter = GetIterator();
+            for( size_t i = 0; i < mNumDigits; ++i )
+            {
+                digits[i] = static_cast< Byte >( iter.ReadDigit() );
+            }
+
+            return aOut.SetDigits( mRadix, digits.GetConstPtr(), mNumDigits );
+        }
+
         Digiterator DigitStream::GetIterator() const
         {
-            return Digiterator( const_cast< BitBuffer& >( mBuffer ), Data::GetRadixBits( mRadix ) );
+            if( IsWide() )
+            {
+                return Digiterator( const_cast< BitBuffer& >( mBuffer ), Data::GetRadixBits( mRadix ) );
+            }
+            return Digiterator( const_cast< BitBuffer& >( mBuffer ), mValue, mNumDigits, mRadix );
         }
 
         size_t DigitStream::GetNumDigits() const
         {
             BFDP_RETURNIF_V( mRadix == Data::InvalidRadix, 0U );
-            size_t bitsPerDigit = Data::GetRadixBits( mRadix );
-            return mBuffer.GetDataBits() / bitsPerDigit;
+            return mNumDigits;
         }
 
         Data::RadixType DigitStream::GetRadix() const
@@ -109,41 +187,9 @@ namespace Bfdp
             uint64_t& aOut
             ) const
         {
-            aOut = 0;
-            Digiterator iter = GetIterator();
-
-            if( Data::IsRadixPowerOf2( mRadix ) )
-            {
-                // Optimization for powers of 2: use simple operations
-                BFDP_RETURNIF_V( mBuffer.GetDataBits() > 64U, false );
-
-                size_t const shift = Data::GetRadixBits( mRadix );
-                while( !iter.IsDone() )
-                {
-                    aOut <<= shift;
-                    aOut += iter.ReadDigit();
-                }
-            }
-            else
-            {
-                // For others: use the REALLY SLOW method...
-                while( !iter.IsDone() )
-                {
-                    uint64_t temp = aOut;
-                    unsigned int digit = iter.ReadDigit();
-
-                    temp *= mRadix;
-                    if( ( ( temp / mRadix ) != aOut ) ||
-                        ( ( UINT64_MAX - temp ) < digit ) )
-                    {
-                        // Overflow
-                        return false;
-                    }
-                    aOut = temp + digit;
-                }
-            }
-
-            return true;
+            // Digits are only stored in the buffer if the value is too wide.
+            aOut = mValue;
+            return !IsWide();
         }
 
         bool DigitStream::IsDefined() const
@@ -155,6 +201,30 @@ namespace Bfdp
         {
             size_t bitsPerDigit = Data::GetRadixBits( mRadix );
             BFDP_RETURNIF_V( bitsPerDigit == 0, std::string() );
+
+            // Return "0" if no digits present
+            BFDP_RETURNIF_V( mNumDigits == 0, "0" );
+
+            // Need enough characters for one digit per symbol
+            std::string digits( mNumDigits, '0' );
+
+            if( !IsWide() )
+            {
+                // Fill in digits from least significant; the remainder are leading zeros
+                uint64_t value = mValue;
+                size_t i = mNumDigits;
+                while( ( value != 0U ) && ( i > 0 ) )
+                {
+                    --i;
+                    if( !Data::ConvertBase( mRadix, static_cast< uint8_t >( value % mRadix ), digits[i] ) )
+                    {
+                        return std::string();
+                    }
+                    value /= mRadix;
+                }
+                return digits;
+            }
+
             BFDP_RETURNIF_VA
                 (
                 0 != ( mBuffer.GetDataBits() % bitsPerDigit ),
@@ -162,16 +232,14 @@ namespace Bfdp
                 "Short buffer"
                 );
 
-            // Need enough characters for one digit per symbol
-            std::string digits( mBuffer.GetDataBits() / bitsPerDigit, '\0' );
             BitManip::GenericBitStream bs( const_cast< BitBuffer& >( mBuffer ) );
+            BitReader reader( bs.GetView() );
 
-            Byte value = 0;
             size_t i = 0;
-            while( bs.ReadBits( &value, bitsPerDigit ) )
+            while( ( reader.GetBitsLeft() >= bitsPerDigit ) && ( i < digits.length() ) )
             {
                 char symbol;
-                if( !Data::ConvertBase( mRadix, value, symbol ) )
+                if( !Data::ConvertBase( mRadix, static_cast< uint8_t >( reader.Read( bitsPerDigit ) ), symbol ) )
                 {
                     return std::string();
                 }
@@ -186,17 +254,14 @@ namespace Bfdp
                 return std::string();
             }
 
-            // Return "0" if no digits present
-            if( digits.empty() )
-            {
-                digits = "0";
-            }
             return digits;
         }
 
         void DigitStream::Reset()
         {
+            mNumDigits = 0U;
             mRadix = Data::InvalidRadix;
+            mValue = 0U;
             BFDP_UNUSED_RETURN( mBuffer.ResizeNoPreserve( 0 ) );
         }
 
@@ -209,6 +274,19 @@ namespace Bfdp
             size_t bitsPerDigit = Data::GetRadixBits( aRadix );
             BFDP_RETURNIF_V( bitsPerDigit == 0, false );
 
+            // Fast path: the value fits in 64 bits
+            uint64_t value;
+            if( Data::ConvertDigits( aRadix, aDigits.data(), aDigits.length(), value ) )
+            {
+                BFDP_RETURNIF_V( !mBuffer.ResizeNoPreserve( 0 ), false );
+                mNumDigits = aDigits.length();
+                mRadix = aRadix;
+                mValue = value;
+                return true;
+            }
+
+            // Either the value is too wide, or the digits are not valid
+
             BitBuffer buffer;
 
             // Need enough bits for one symbol per digit
@@ -219,14 +297,14 @@ namespace Bfdp
             std::string::const_iterator iter = aDigits.begin();
             for( ; iter != aDigits.end(); ++iter )
             {
-                uint8_t value;
-                ok = Data::ConvertBase( aRadix, *iter, value );
+                uint8_t digit;
+                ok = Data::ConvertBase( aRadix, *iter, digit );
                 if( !ok )
                 {
                     break;
                 }
 
-                ok = bs.WriteBits( &value, bitsPerDigit );
+                ok = bs.WriteBits( &digit, bitsPerDigit );
                 if( !ok )
                 {
                     BFDP_INTERNAL_ERROR( "Failed to write bits" );
@@ -242,12 +320,19 @@ namespace Bfdp
 
             if( ok )
             {
+                mNumDigits = aDigits.length();
                 mRadix = aRadix;
+                mValue = 0U;
                 mBuffer = buffer;
             }
             return ok;
         }
 
+        bool DigitStream::IsWide() const
+        {
+            return mBuffer.GetDataBits() != 0U;
+        }
+
     } // namespace BitManip
 
 } // namespace Bfdp
@@ -0,0 +1,391 @@
+/**
+    BFDP BitManip Endian Bit Reader Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/BitManip/EndianBitReader.hpp"
+
+// External Includes
+#include <algorithm>
+#include <cstring>
+#if defined( __BMI2__ )
+    #define BFDP_BITREADER_PDEP_STATIC 1
+    #include <immintrin.h>
+#elif defined( __GNUC__ ) && defined( __x86_64__ )
+    #define BFDP_BITREADER_PDEP_DISPATCH 1
+    #include <immintrin.h>
+#endif
+
+// Internal Includes
+#include "Bfdp/BitManip/Conversion.hpp"
+#include "Bfdp/BitManip/Mask.hpp"
+#include "Bfdp/Compiler.hpp"
+#include "Bfdp/ErrorReporter/Functions.hpp"
+
+#define BFDP_MODULE "BitManip::EndianBitReader"
+
+namespace Bfdp
+{
+
+    namespace BitManip
+    {
+
+        namespace EndianBitReaderInternal
+        {
+
+            static size_t const MaxValueBits = 64;
+            static size_t const MaxValueBytes = MaxValueBits / BitsPerByte;
+
+            //! @pre aNumBytes is 1 to 8
+            //! @return aNumBytes from aData as a little-endian value
+            static inline uint64_t LoadLe
+                (
+                Byte const* const aData,
+                size_t const aNumBytes
+                )
+            {
+                uint64_t value = 0U;
+            #if( BFDP_HOST_ENDIAN_LE() )
+                std::memcpy( &value, aData, aNumBytes );
+            #else
+                for( size_t i = aNumBytes; i != 0; --i )
+                {
+                    value = ( value << BitsPerByte ) | aData[i - 1];
+                }
+            #endif
+                return value;
+            }
+
+            //! Widest value that a single unaligned 64-bit load always covers
+            static size_t const MaxWordReadBits = MaxValueBits - BitsPerByte + 1;
+
+            typedef size_t (*UnpackFunc)
+                (
+                Byte const* const aData,
+                size_t const aBitPos,
+                size_t const aNumBits,
+                size_t const aCount,
+                uint64_t* const aOut
+                );
+
+            //! @return How many leading values of an array can be read with a 64-bit load
+            //!     without reading past BitsToBytes( aBitPos + ( aNumBits * aCount ) ) bytes.
+            static size_t GetNumWordReads
+                (
+                size_t const aBitPos,
+                size_t const aNumBits,
+                size_t const aCount
+                )
+            {
+                size_t const endBytes = BitsToBytes( aBitPos + ( aNumBits * aCount ) );
+                if( endBytes < MaxValueBytes )
+                {
+                    return 0U;
+                }
+                // Value k may be loaded while ( aBitPos + k * aNumBits ) / 8 <= endBytes - 8
+                size_t const limitBits = BytesToBits( endBytes - MaxValueBytes + 1U );
+                return ( limitBits <= aBitPos )
+                    ? 0U
+                    : std::min( aCount, ( ( limitBits - aBitPos - 1U ) / aNumBits ) + 1U );
+            }
+
+            //! Unpack little-endian bit order values with one load, shift and mask each
+            //!
+            //! @pre aNumBits <= MaxWordReadBits, and aCount <= GetNumWordReads().
+            //! @return aCount
+            static size_t UnpackLeWords
+                (
+                Byte const* const aData,
+                size_t const aBitPos,
+                size_t const aNumBits,
+                size_t const aCount,
+                uint64_t* const aOut
+                )
+            {
+                uint64_t const mask = CreateMask< uint64_t >( aNumBits );
+                size_t pos = aBitPos;
+                for( size_t i = 0; i < aCount; ++i, pos += aNumBits )
+                {
+                    aOut[i] = ( LoadLe( &aData[pos / BitsPerByte], MaxValueBytes ) >> ( pos % BitsPerByte ) ) & mask;
+                }
+                return aCount;
+            }
+
+            //! Unpack big-endian bit order values with one load, swap and shift each
+            //!
+            //! @pre aNumBits <= MaxWordReadBits, and aCount <= GetNumWordReads().
+            static void UnpackBeWords
+                (
+                Byte const* const aData,
+                size_t const aBitPos,
+                size_t const aNumBits,
+                size_t const aCount,
+                uint64_t* const aOut
+                )
+            {
+                size_t const shift = MaxValueBits - aNumBits;
+                size_t pos = aBitPos;
+                for( size_t i = 0; i < aCount; ++i, pos += aNumBits )
+                {
+                    aOut[i] = ( ByteSwap64( LoadLe( &aData[pos / BitsPerByte], MaxValueBytes ) ) << ( pos % BitsPerByte ) ) >> shift;
+                }
+            }
+
+        #if( BFDP_BITREADER_PDEP_STATIC || BFDP_BITREADER_PDEP_DISPATCH )
+            //! Unpack little-endian bit order values in groups that fit in one 64-bit load,
+            //! depositing each value into its own LaneT-wide lane with PDEP.
+            //!
+            //! @pre aNumBits * ( 64 / bits in LaneT ) <= MaxWordReadBits
+            //! @return Number of values unpacked, a multiple of the values per group.
+            template< typename LaneT >
+            #if( BFDP_BITREADER_PDEP_DISPATCH )
+                __attribute__(( target( "bmi2" ) ))
+            #endif
+            static size_t UnpackLePdepT
+                (
+                Byte const* const aData,
+                size_t const aBitPos,
+                size_t const aNumBits,
+                size_t const aCount,
+                uint64_t* const aOut
+                )
+            {
+                static size_t const LaneBits = BytesToBits( sizeof( LaneT ) );
+                static size_t const LanesPerWord = MaxValueBits / LaneBits;
+                static uint64_t const LaneMask = CreateMask< uint64_t >( LaneBits );
+
+                // Repeat the value mask in the low bits of each lane
+                uint64_t depositMask = 0U;
+                for( size_t lane = 0; lane < LanesPerWord; ++lane )
+                {
+                    depositMask |= CreateMask< uint64_t >( aNumBits ) << ( lane * LaneBits );
+                }
+
+                size_t const groupBits = aNumBits * LanesPerWord;
+                size_t pos = aBitPos;
+                size_t i = 0;
+                for( ; ( i + LanesPerWord ) <= aCount; i += LanesPerWord, pos += groupBits )
+                {
+                    uint64_t const word = LoadLe( &aData[pos / BitsPerByte], MaxValueBytes ) >> ( pos % BitsPerByte );
+                    uint64_t const lanes = _pdep_u64( word, depositMask );
+                    for( size_t lane = 0; lane < LanesPerWord; ++lane )
+                    {
+                        aOut[i + lane] = ( lanes >> ( lane * LaneBits ) ) & LaneMask;
+                    }
+                }
+                return i;
+            }
+
+            //! @pre aCount <= GetNumWordReads()
+            //! @return aCount
+            #if( BFDP_BITREADER_PDEP_DISPATCH )
+                __attribute__(( target( "bmi2" ) ))
+            #endif
+            static size_t UnpackLePdep
+                (
+                Byte const* const aData,
+                size_t const aBitPos,
+                size_t const aNumBits,
+                size_t const aCount,
+                uint64_t* const aOut
+                )
+            {
+                size_t done = 0;
+                if( aNumBits <= ( MaxWordReadBits / 8U ) )
+                {
+                    done = UnpackLePdepT< uint8_t >( aData, aBitPos, aNumBits, aCount, aOut );
+                }
+                else if( aNumBits <= ( MaxWordReadBits / 4U ) )
+                {
+                    done = UnpackLePdepT< uint16_t >( aData, aBitPos, aNumBits, aCount, aOut );
+                }
+                return done + UnpackLeWords( aData, aBitPos + ( done * aNumBits ), aNumBits, aCount - done, &aOut[done] );
+            }
+        #endif
+
+            static UnpackFunc SelectUnpackLe()
+            {
+            #if( BFDP_BITREADER_PDEP_STATIC )
+                return &UnpackLePdep;
+            #elif( BFDP_BITREADER_PDEP_DISPATCH )
+                __builtin_cpu_init();
+                return __builtin_cpu_supports( "bmi2" )
+                    ? &UnpackLePdep
+                    : &UnpackLeWords;
+            #else
+                return &UnpackLeWords;
+            #endif
+            }
+
+            //! Chosen once at startup so that each array costs a single indirect call
+            static UnpackFunc const sUnpackLe = SelectUnpackLe();
+
+        } // namespace EndianBitReaderInternal
+
+        using namespace EndianBitReaderInternal;
+
+        EndianBitReader::EndianBitReader
+            (
+            Endianness::Type const aBitOrder,
+            Endianness::Type const aByteOrder
+            )
+            : mBitOrder( aBitOrder )
+            , mByteOrder( aByteOrder )
+        {
+        }
+
+        Endianness::Type EndianBitReader::GetBitOrder() const
+        {
+            return mBitOrder;
+        }
+
+        Endianness::Type EndianBitReader::GetByteOrder() const
+        {
+            return mByteOrder;
+        }
+
+        uint64_t EndianBitReader::Read
+            (
+            Byte const* const aData,
+            size_t const aBitPos,
+            size_t const aNumBits
+            ) const
+        {
+            Byte const* const data = &aData[aBitPos / BitsPerByte];
+            size_t const offset = aBitPos % BitsPerByte;
+
+            if( ( offset + aNumBits ) <= BitsPerByte )
+            {
+                // Within one byte
+                size_t const shift = ( mBitOrder == Endianness::Little )
+                    ? offset
+                    : ( BitsPerByte - offset - aNumBits );
+                return ( data[0] >> shift ) & CreateMask< uint64_t >( aNumBits );
+            }
+
+            bool const isWholeBytes = ( ( aNumBits % BitsPerByte ) == 0 );
+            if( ( offset == 0 ) && isWholeBytes )
+            {
+                // Byte-aligned; only the byte order matters
+                size_t const numBytes = aNumBits / BitsPerByte;
+                uint64_t const value = LoadLe( data, numBytes );
+                return ( mByteOrder == Endianness::Big ) ? ByteSwapN( value, numBytes ) : value;
+            }
+
+            // Unaligned; load the spanned bytes, then shift the value into place.  A 64-bit value
+            // with a non-zero offset spans a 9th byte.
+            size_t const spanBytes = BitsToBytes( offset + aNumBits );
+            uint64_t const word = LoadLe( data, std::min( spanBytes, MaxValueBytes ) );
+            uint64_t value;
+            if( mBitOrder == Endianness::Little )
+            {
+                value = word >> offset;
+                if( spanBytes > MaxValueBytes )
+                {
+                    value |= static_cast< uint64_t >( data[MaxValueBytes] ) << ( MaxValueBits - offset );
+                }
+                value &= CreateMask< uint64_t >( aNumBits );
+            }
+            else
+            {
+                value = ByteSwap64( word ) << offset;
+                if( spanBytes > MaxValueBytes )
+                {
+                    value |= static_cast< uint64_t >( data[MaxValueBytes] >> ( BitsPerByte - offset ) );
+                }
+                value >>= ( MaxValueBits - aNumBits );
+            }
+
+            if( isWholeBytes && ( mBitOrder != mByteOrder ) )
+            {
+                value = ByteSwapN( value, aNumBits / BitsPerByte );
+            }
+            return value;
+        }
+
+        void EndianBitReader::ReadArray
+            (
+            Byte const* const aData,
+            size_t const aBitPos,
+            size_t const aNumBits,
+            size_t const aCount,
+            uint64_t* const aOut
+            ) const
+        {
+            size_t i = 0;
+            if( aNumBits <= MaxWordReadBits )
+            {
+                // Every value but those near the end of the data can be read with an unaligned
+                // 64-bit load, with no branching on the alignment of each value.
+                i = GetNumWordReads( aBitPos, aNumBits, aCount );
+                if( mBitOrder == Endianness::Little )
+                {
+                    sUnpackLe( aData, aBitPos, aNumBits, i, aOut );
+                }
+                else
+                {
+                    UnpackBeWords( aData, aBitPos, aNumBits, i, aOut );
+                }
+
+                if( ( ( aNumBits % BitsPerByte ) == 0 ) && ( mBitOrder != mByteOrder ) )
+                {
+                    size_t const numBytes = aNumBits / BitsPerByte;
+                    for( size_t j = 0; j < i; ++j )
+                    {
+                        aOut[j] = ByteSwapN( aOut[j], numBytes );
+                    }
+                }
+            }
+
+            for( ; i < aCount; ++i )
+            {
+                aOut[i] = Read( aData, aBitPos + ( i * aNumBits ), aNumBits );
+            }
+        }
+
+        bool EndianBitReader::ReadBits
+            (
+            GenericBitStream& aIn,
+            size_t const aNumBits,
+            uint64_t& aOut
+            ) const
+        {
+            BFDP_RETURNIF_VA( !IsWithinRange< size_t >( 1U, aNumBits, MaxValueBits ), false, "Invalid bit count" );
+            BFDP_RETURNIF_V( aIn.GetBitsTillEnd() < aNumBits, false );
+
+            size_t const pos = aIn.GetPosBits();
+            aOut = Read( aIn.GetDataPtr(), pos, aNumBits );
+            return aIn.SeekBits( pos + aNumBits );
+        }
+
+    } // namespace BitManip
+
+} // namespace Bfdp
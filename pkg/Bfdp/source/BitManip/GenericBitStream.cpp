@@ -61,11 +61,21 @@ namespace Bfdp
             return mBuffer.GetDataBits() - GetPosBits();
         }
 
+        Byte const* GenericBitStream::GetDataPtr() const
+        {
+            return mBuffer.GetDataPtr();
+        }
+
         size_t GenericBitStream::GetPosBits() const
         {
             return BytesToBits( mCurByte ) + mCurBit;
         }
 
+        BitView GenericBitStream::GetView() const
+        {
+            return BitView( mBuffer.GetDataPtr(), GetPosBits(), GetBitsTillEnd() );
+        }
+
         bool GenericBitStream::ReadBits
             (
             Byte* const aOutData,
@@ -150,7 +160,7 @@ namespace Bfdp
             while( bitsRemain )
             {
                 // Determine how many bits can be copied at once.
-                size_t numBitsToCopy = BitsPerByte - std::max( aInBitCtr, mCurBit );
+                size_t numBitsToCopy = BitsPerByte - std::max( aInBitCtr, aOutBitCtr );
                 numBitsToCopy = std::min( numBitsToCopy, bitsRemain );
 
                 // Extract and replace the relevant bits
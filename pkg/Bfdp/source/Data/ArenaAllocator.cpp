@@ -0,0 +1,160 @@
+/**
+    BFDP Data Arena Allocator Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Data/ArenaAllocator.hpp"
+
+// External Includes
+#include <algorithm>
+#include <limits>
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        ArenaAllocator::ArenaAllocator
+            (
+            size_t const aBlockSize,
+            IAllocator& aUpstream
+            )
+            : mBlockSize( aBlockSize )
+            , mUpstream( aUpstream )
+            , mBlocks( NULL )
+            , mNext( NULL )
+            , mBytesLeft( 0U )
+            , mBytesAllocated( 0U )
+            , mBytesReserved( 0U )
+        {
+        }
+
+        ArenaAllocator::~ArenaAllocator()
+        {
+            FreeBlocks( mBlocks );
+        }
+
+        void* ArenaAllocator::Allocate
+            (
+            size_t const aSize
+            )
+        {
+            // Every allocation is distinct, even of 0 bytes
+            size_t const maxSize = std::numeric_limits< size_t >::max() - HeaderSize - Alignment;
+            BFDP_RETURNIF_V( aSize > maxSize, NULL );
+            size_t const size = ( ( std::max< size_t >( aSize, 1U ) + Alignment - 1 ) / Alignment ) * Alignment;
+
+            if( ( size > mBytesLeft ) && !AddBlock( size ) )
+            {
+                return NULL;
+            }
+
+            void* const ptr = mNext;
+            mNext += size;
+            mBytesLeft -= size;
+            mBytesAllocated += size;
+            return ptr;
+        }
+
+        void ArenaAllocator::Free
+            (
+            void* const /* aPtr */,
+            size_t const /* aSize */
+            )
+        {
+        }
+
+        size_t ArenaAllocator::GetBytesAllocated() const
+        {
+            return mBytesAllocated;
+        }
+
+        size_t ArenaAllocator::GetBytesReserved() const
+        {
+            return mBytesReserved;
+        }
+
+        void ArenaAllocator::Reset()
+        {
+            mBytesAllocated = 0U;
+            BFDP_RETURNIF( mBlocks == NULL );
+
+            // The first block is the last in the list
+            Block* block = mBlocks;
+            while( block->next != NULL )
+            {
+                Block* const next = block->next;
+                mUpstream.Free( block, block->size );
+                block = next;
+            }
+            mBlocks = block;
+
+            mNext = reinterpret_cast< Byte* >( block ) + HeaderSize;
+            mBytesLeft = block->size - HeaderSize;
+            mBytesReserved = block->size;
+        }
+
+        bool ArenaAllocator::AddBlock
+            (
+            size_t const aSize
+            )
+        {
+            size_t const blockSize = std::max( mBlockSize, aSize + HeaderSize );
+            Block* const block = static_cast< Block* >( mUpstream.Allocate( blockSize ) );
+            BFDP_RETURNIF_V( block == NULL, false );
+
+            block->next = mBlocks;
+            block->size = blockSize;
+            mBlocks = block;
+            mNext = reinterpret_cast< Byte* >( block ) + HeaderSize;
+            mBytesLeft = blockSize - HeaderSize;
+            mBytesReserved += blockSize;
+            return true;
+        }
+
+        void ArenaAllocator::FreeBlocks
+            (
+            Block* const aBlock
+            )
+        {
+            Block* block = aBlock;
+            while( block != NULL )
+            {
+                Block* const next = block->next;
+                mUpstream.Free( block, block->size );
+                block = next;
+            }
+        }
+
+    } // namespace Data
+
+} // namespace Bfdp
@@ -0,0 +1,175 @@
+/**
+    BFDP Data Big Rational Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Data/BigRational.hpp"
+
+// External Includes
+#include <algorithm>
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        BigRational::BigRational()
+            : sign( Sign::Positive )
+        {
+            BFDP_UNUSED_RETURN( denominator.Set( 1U ) );
+        }
+
+        bool BigRational::CopyFrom
+            (
+            BigRational const& aOther
+            )
+        {
+            sign = aOther.sign;
+            return numerator.CopyFrom( aOther.numerator )
+                && denominator.CopyFrom( aOther.denominator );
+        }
+
+        bool BigRational::GetFixedPoint
+            (
+            size_t const aFractionalBits,
+            BigUint& aOut
+            ) const
+        {
+            BFDP_RETURNIF_V( denominator.IsZero(), false );
+
+            BigUint scaled;
+            BigUint remainder;
+            return scaled.CopyFrom( numerator )
+                && scaled.ShiftLeft( aFractionalBits )
+                && scaled.Divide( denominator, aOut, remainder );
+        }
+
+        std::string BigRational::GetStr
+            (
+            RadixType const aRadix
+            ) const
+        {
+            std::string const num = numerator.GetStr( aRadix );
+            std::string const den = denominator.GetStr( aRadix );
+            BFDP_RETURNIF_V( num.empty() || den.empty(), std::string() );
+
+            return ( ( ( sign == Sign::Negative ) && !IsZero() ) ? "-" : "" ) + num + "/" + den;
+        }
+
+        bool BigRational::Invert()
+        {
+            BFDP_RETURNIF_V( IsZero(), false );
+
+            numerator.Swap( denominator );
+            return true;
+        }
+
+        bool BigRational::IsZero() const
+        {
+            return numerator.IsZero();
+        }
+
+        bool BigRational::Multiply
+            (
+            BigRational const& aOther
+            )
+        {
+            sign = ( sign == aOther.sign ) ? Sign::Positive : Sign::Negative;
+            return numerator.Multiply( aOther.numerator )
+                && denominator.Multiply( aOther.denominator );
+        }
+
+        bool BigRational::Power
+            (
+            uint64_t const aExponent
+            )
+        {
+            if( ( aExponent % 2 ) == 0 )
+            {
+                sign = Sign::Positive;
+            }
+            return numerator.Power( aExponent )
+                && denominator.Power( aExponent );
+        }
+
+        bool BigRational::Reduce()
+        {
+            if( IsZero() )
+            {
+                return denominator.Set( 1U );
+            }
+
+            BFDP_RETURNIF_V( denominator.IsZero(), false );
+
+            // Stein's binary GCD, which only shifts and subtracts in place rather than dividing
+            // at every step.  The common power of 2 is removed from both terms by shifting.
+            size_t const commonZeros = std::min( numerator.GetTrailingZeroBits(), denominator.GetTrailingZeroBits() );
+            numerator.ShiftRight( commonZeros );
+            denominator.ShiftRight( commonZeros );
+
+            BigUint a;
+            BigUint b;
+            BFDP_RETURNIF_V( !a.CopyFrom( numerator ) || !b.CopyFrom( denominator ), false );
+            a.ShiftRight( a.GetTrailingZeroBits() );
+            b.ShiftRight( b.GetTrailingZeroBits() );
+
+            // Both terms are odd, so their difference is even
+            for( ;; )
+            {
+                if( a.Compare( b ) > 0 )
+                {
+                    a.Swap( b );
+                }
+                BFDP_RETURNIF_V( !b.Subtract( a ), false );
+                if( b.IsZero() )
+                {
+                    break;
+                }
+                b.ShiftRight( b.GetTrailingZeroBits() );
+            }
+
+            // The remaining odd factor is usually 1, in which case nothing is left to divide
+            if( ( a.GetNumLimbs() != 1U ) || ( a.GetLimb( 0 ) != 1U ) )
+            {
+                BigUint quotient;
+                BigUint remainder;
+                BFDP_RETURNIF_V( !numerator.Divide( a, quotient, remainder ), false );
+                numerator.Swap( quotient );
+                BFDP_RETURNIF_V( !denominator.Divide( a, quotient, remainder ), false );
+                denominator.Swap( quotient );
+            }
+            return true;
+        }
+
+    } // namespace Data
+
+} // namespace Bfdp
@@ -0,0 +1,1019 @@
+/**
+    BFDP Data Big Unsigned Integer Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Data/BigUint.hpp"
+
+// External Includes
+#include <algorithm>
+#include <cstring>
+#if defined( _MSC_VER ) && defined( _M_X64 )
+    #include <intrin.h>
+#endif
+
+// Internal Includes
+#include "Bfdp/ErrorReporter/Functions.hpp"
+
+#define BFDP_MODULE "Data::BigUint"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        namespace BigUintInternal
+        {
+
+            typedef BigUint::Limb Limb;
+
+            //! Operands with fewer limbs than this use schoolbook multiplication
+            static size_t const KaratsubaThreshold = 32;
+
+            //! Chunk counts up to this are converted by simple accumulation
+            static size_t const LinearConversionThreshold = 16;
+
+            //! Enough powers for any chunk count which can be addressed
+            static size_t const MaxPowerLevels = BigUint::LimbBits;
+
+            //! @return The low 64 bits of aA * aB; the high 64 bits are saved to aHigh.
+            inline Limb MulWide
+                (
+                Limb const aA,
+                Limb const aB,
+                Limb& aHigh
+                )
+            {
+            #if defined( __SIZEOF_INT128__ )
+                unsigned __int128 const product = static_cast< unsigned __int128 >( aA ) * aB;
+                aHigh = static_cast< Limb >( product >> 64 );
+                return static_cast< Limb >( product );
+            #elif defined( _MSC_VER ) && defined( _M_X64 )
+                return _umul128( aA, aB, &aHigh );
+            #else
+                uint64_t const aLo = aA & 0xFFFFFFFFU;
+                uint64_t const aHi = aA >> 32;
+                uint64_t const bLo = aB & 0xFFFFFFFFU;
+                uint64_t const bHi = aB >> 32;
+
+                uint64_t const ll = aLo * bLo;
+                uint64_t const lh = aLo * bHi;
+                uint64_t const hl = aHi * bLo;
+                uint64_t const hh = aHi * bHi;
+
+                uint64_t const mid = ( ll >> 32 ) + ( lh & 0xFFFFFFFFU ) + ( hl & 0xFFFFFFFFU );
+                aHigh = hh + ( lh >> 32 ) + ( hl >> 32 ) + ( mid >> 32 );
+                return ( mid << 32 ) | ( ll & 0xFFFFFFFFU );
+            #endif
+            }
+
+            //! aResult[0..aNumA) = aA + aB
+            //!
+            //! @pre aNumA >= aNumB
+            //! @return The carry out
+            Limb AddLimbs
+                (
+                Limb* const aResult,
+                Limb const* const aA,
+                size_t const aNumA,
+                Limb const* const aB,
+                size_t const aNumB
+                )
+            {
+                Limb carry = 0U;
+                for( size_t i = 0; i < aNumA; ++i )
+                {
+                    Limb const b = ( i < aNumB ) ? aB[i] : 0U;
+                    Limb sum = aA[i] + carry;
+                    carry = ( sum < carry ) ? 1U : 0U;
+                    sum += b;
+                    carry += ( sum < b ) ? 1U : 0U;
+                    aResult[i] = sum;
+                }
+                return carry;
+            }
+
+            //! aTarget[0..aNumTarget) += aA[0..aNumA)
+            //!
+            //! @pre aNumTarget >= aNumA
+            //! @return The carry out
+            Limb AddInto
+                (
+                Limb* const aTarget,
+                size_t const aNumTarget,
+                Limb const* const aA,
+                size_t const aNumA
+                )
+            {
+                Limb carry = 0U;
+                size_t i = 0;
+                for( ; i < aNumA; ++i )
+                {
+                    Limb sum = aTarget[i] + carry;
+                    carry = ( sum < carry ) ? 1U : 0U;
+                    sum += aA[i];
+                    carry += ( sum < aA[i] ) ? 1U : 0U;
+                    aTarget[i] = sum;
+                }
+                for( ; ( carry != 0U ) && ( i < aNumTarget ); ++i )
+                {
+                    ++aTarget[i];
+                    carry = ( aTarget[i] == 0U ) ? 1U : 0U;
+                }
+                return carry;
+            }
+
+            //! aTarget[0..aNumTarget) -= aA[0..aNumA)
+            //!
+            //! @pre aNumTarget >= aNumA
+            //! @return The borrow out
+            Limb SubtractFrom
+                (
+                Limb* const aTarget,
+                size_t const aNumTarget,
+                Limb const* const aA,
+                size_t const aNumA
+                )
+            {
+                Limb borrow = 0U;
+                size_t i = 0;
+                for( ; i < aNumA; ++i )
+                {
+                    Limb const t = aTarget[i];
+                    Limb diff = t - aA[i];
+                    Limb nextBorrow = ( t < aA[i] ) ? 1U : 0U;
+                    nextBorrow += ( diff < borrow ) ? 1U : 0U;
+                    aTarget[i] = diff - borrow;
+                    borrow = nextBorrow;
+                }
+                for( ; ( borrow != 0U ) && ( i < aNumTarget ); ++i )
+                {
+                    borrow = ( aTarget[i] == 0U ) ? 1U : 0U;
+                    --aTarget[i];
+                }
+                return borrow;
+            }
+
+            //! aResult[0..aNumA+aNumB) += aA * aB
+            void MultiplySchoolbook
+                (
+                Limb* const aResult,
+                Limb const* const aA,
+                size_t const aNumA,
+                Limb const* const aB,
+                size_t const aNumB
+                )
+            {
+                for( size_t i = 0; i < aNumA; ++i )
+                {
+                    Limb carry = 0U;
+                    for( size_t j = 0; j < aNumB; ++j )
+                    {
+                        Limb high;
+                        Limb low = MulWide( aA[i], aB[j], high );
+                        low += carry;
+                        high += ( low < carry ) ? 1U : 0U;
+                        low += aResult[i + j];
+                        high += ( low < aResult[i + j] ) ? 1U : 0U;
+                        aResult[i + j] = low;
+                        carry = high;
+                    }
+                    aResult[i + aNumB] = carry;
+                }
+            }
+
+            //! @return The number of scratch limbs needed by MultiplyKaratsuba for aNum limbs
+            size_t GetKaratsubaScratch
+                (
+                size_t const aNum
+                )
+            {
+                size_t total = 0;
+                size_t n = aNum;
+                while( n >= KaratsubaThreshold )
+                {
+                    size_t const m = ( n - ( n / 2 ) ) + 1;
+                    total += 4 * m;
+                    n = m;
+                }
+                return total;
+            }
+
+            //! aResult[0..2*aNum) = aA * aB, where both operands have aNum limbs
+            void MultiplyKaratsuba
+                (
+                Limb* const aResult,
+                Limb const* const aA,
+                Limb const* const aB,
+                size_t const aNum,
+                Limb* const aScratch
+                )
+            {
+                if( aNum < KaratsubaThreshold )
+                {
+                    std::fill( aResult, aResult + ( 2 * aNum ), 0U );
+                    MultiplySchoolbook( aResult, aA, aNum, aB, aNum );
+                    return;
+                }
+
+                // a = a1 * B^h + a0, b = b1 * B^h + b0
+                size_t const h = aNum / 2;
+                size_t const hn = aNum - h;
+                size_t const m = hn + 1;
+                Limb* const sumA = aScratch;
+                Limb* const sumB = sumA + m;
+                Limb* const mid = sumB + m;
+                Limb* const next = mid + ( 2 * m );
+
+                sumA[hn] = AddLimbs( sumA, aA + h, hn, aA, h );
+                sumB[hn] = AddLimbs( sumB, aB + h, hn, aB, h );
+
+                // z0 = a0 * b0 and z2 = a1 * b1 fill the result exactly
+                MultiplyKaratsuba( aResult, aA, aB, h, next );
+                MultiplyKaratsuba( aResult + ( 2 * h ), aA + h, aB + h, hn, next );
+
+                // z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+                MultiplyKaratsuba( mid, sumA, sumB, m, next );
+                SubtractFrom( mid, 2 * m, aResult, 2 * h );
+                SubtractFrom( mid, 2 * m, aResult + ( 2 * h ), 2 * hn );
+
+                AddInto( aResult + h, ( 2 * aNum ) - h, mid, std::min( 2 * m, ( 2 * aNum ) - h ) );
+            }
+
+            //! aResult[0..aNumA+aNumB) = aA * aB
+            //!
+            //! @pre aResult is zero, and does not overlap either operand.
+            bool MultiplyLimbs
+                (
+                Limb* const aResult,
+                Limb const* const aA,
+                size_t const aNumA,
+                Limb const* const aB,
+                size_t const aNumB
+                )
+            {
+                if( aNumA < aNumB )
+                {
+                    return MultiplyLimbs( aResult, aB, aNumB, aA, aNumA );
+                }
+
+                if( aNumB < KaratsubaThreshold )
+                {
+                    MultiplySchoolbook( aResult, aA, aNumA, aB, aNumB );
+                    return true;
+                }
+
+                // Multiply aB by aNumB-sized slices of aA, and accumulate the results
+                ByteBuffer buf;
+                size_t const numScratch = GetKaratsubaScratch( aNumB );
+                BFDP_RETURNIF_V( !buf.Allocate( ( ( 2 * aNumB ) + numScratch ) * sizeof( Limb ) ), false );
+                Limb* const product = buf.GetPtrT< Limb >();
+                Limb* const scratch = product + ( 2 * aNumB );
+
+                size_t const numResult = aNumA + aNumB;
+                for( size_t offset = 0; offset < aNumA; offset += aNumB )
+                {
+                    size_t const numSlice = std::min( aNumB, aNumA - offset );
+                    if( numSlice == aNumB )
+                    {
+                        MultiplyKaratsuba( product, aA + offset, aB, aNumB, scratch );
+                    }
+                    else
+                    {
+                        std::fill( product, product + ( numSlice + aNumB ), 0U );
+                        BFDP_RETURNIF_V( !MultiplyLimbs( product, aB, aNumB, aA + offset, numSlice ), false );
+                    }
+                    AddInto( aResult + offset, numResult - offset, product, numSlice + aNumB );
+                }
+
+                return true;
+            }
+
+            //! Convert chunks of digits (in base aPowers[0], most significant first) to a value
+            bool ConvertChunks
+                (
+                Limb const* const aChunks,
+                size_t const aCount,
+                BigUint const* const aPowers,
+                BigUint& aOut
+                )
+            {
+                if( aCount <= LinearConversionThreshold )
+                {
+                    Limb const chunkBase = aPowers[0].GetLimb( 0 );
+                    BFDP_RETURNIF_V( !aOut.Set( 0U ), false );
+                    for( size_t i = 0; i < aCount; ++i )
+                    {
+                        BFDP_RETURNIF_V( !aOut.MulAddSmall( chunkBase, aChunks[i] ), false );
+                    }
+                    return true;
+                }
+
+                // Split so that the low part is a power of 2 chunks, which has a precomputed
+                // place value.
+                size_t level = 0;
+                while( ( static_cast< size_t >( 2 ) << level ) < aCount )
+                {
+                    ++level;
+                }
+                size_t const numLow = static_cast< size_t >( 1 ) << level;
+
+                BigUint low;
+                BFDP_RETURNIF_V( !ConvertChunks( aChunks + ( aCount - numLow ), numLow, aPowers, low ), false );
+                BFDP_RETURNIF_V( !ConvertChunks( aChunks, aCount - numLow, aPowers, aOut ), false );
+                return aOut.Multiply( aPowers[level] ) && aOut.Add( low );
+            }
+
+            //! @return Number of leading zero bits in a non-zero 32-bit value
+            inline unsigned int CountLeadingZeros32
+                (
+                uint32_t const aValue
+                )
+            {
+                unsigned int count = 0;
+                uint32_t value = aValue;
+                while( ( value & 0x80000000U ) == 0U )
+                {
+                    value <<= 1;
+                    ++count;
+                }
+                return count;
+            }
+
+            //! @return The number of 32-bit digits needed to hold the value
+            inline size_t GetNumHalves
+                (
+                BigUint const& aValue
+                )
+            {
+                size_t const numLimbs = aValue.GetNumLimbs();
+                BFDP_RETURNIF_V( numLimbs == 0, 0U );
+                return ( ( aValue.GetLimb( numLimbs - 1 ) >> 32 ) != 0U )
+                    ? ( 2 * numLimbs )
+                    : ( ( 2 * numLimbs ) - 1 );
+            }
+
+            inline uint32_t GetHalf
+                (
+                BigUint const& aValue,
+                size_t const aIndex
+                )
+            {
+                return static_cast< uint32_t >( aValue.GetLimb( aIndex / 2 ) >> ( 32 * ( aIndex % 2 ) ) );
+            }
+
+        } // namespace BigUintInternal
+
+        using namespace BigUintInternal;
+
+        BigUint::BigUint()
+            : mNumLimbs( 0U )
+        {
+        }
+
+        bool BigUint::Add
+            (
+            BigUint const& aOther
+            )
+        {
+            size_t const numOther = aOther.mNumLimbs;
+            size_t const numResult = std::max( mNumLimbs, numOther ) + 1;
+            BFDP_RETURNIF_V( !Reserve( numResult ), false );
+
+            // Safe if aOther is this, since each limb is read before it is written
+            AddInto( GetLimbs(), numResult, aOther.GetConstLimbs(), numOther );
+            mNumLimbs = numResult;
+            Trim();
+            return true;
+        }
+
+        int BigUint::Compare
+            (
+            BigUint const& aOther
+            ) const
+        {
+            if( mNumLimbs != aOther.mNumLimbs )
+            {
+                return ( mNumLimbs < aOther.mNumLimbs ) ? -1 : 1;
+            }
+
+            Limb const* const limbs = GetConstLimbs();
+            Limb const* const otherLimbs = aOther.GetConstLimbs();
+            for( size_t i = mNumLimbs; i > 0; --i )
+            {
+                if( limbs[i - 1] != otherLimbs[i - 1] )
+                {
+                    return ( limbs[i - 1] < otherLimbs[i - 1] ) ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        bool BigUint::CopyFrom
+            (
+            BigUint const& aOther
+            )
+        {
+            BFDP_RETURNIF_V( &aOther == this, true );
+
+            mNumLimbs = 0;
+            BFDP_RETURNIF_V( !Reserve( aOther.mNumLimbs ), false );
+            if( aOther.mNumLimbs > 0 )
+            {
+                std::memcpy( GetLimbs(), aOther.GetConstLimbs(), aOther.mNumLimbs * sizeof( Limb ) );
+            }
+            mNumLimbs = aOther.mNumLimbs;
+            return true;
+        }
+
+        bool BigUint::Divide
+            (
+            BigUint const& aDivisor,
+            BigUint& aQuotient,
+            BigUint& aRemainder
+            ) const
+        {
+            BFDP_RETURNIF_VA( aDivisor.IsZero(), false, "Division by zero" );
+
+            if( Compare( aDivisor ) < 0 )
+            {
+                return aQuotient.Set( 0U ) && aRemainder.CopyFrom( *this );
+            }
+
+            // Knuth's Algorithm D, using 32-bit digits so that all intermediate values fit
+            // in 64 bits.
+            size_t const n = GetNumHalves( aDivisor );
+            size_t const m = GetNumHalves( *this ) - n;
+
+            ByteBuffer buf;
+            BFDP_RETURNIF_V( !buf.Allocate( ( ( m + n + 1 ) + n + ( m + 1 ) ) * sizeof( uint32_t ) ), false );
+            uint32_t* const u = buf.GetPtrT< uint32_t >();
+            uint32_t* const v = u + ( m + n + 1 );
+            uint32_t* const q = v + n;
+
+            // Normalize so the divisor's top digit has its high bit set
+            unsigned int const shift = CountLeadingZeros32( GetHalf( aDivisor, n - 1 ) );
+            for( size_t i = n; i > 0; --i )
+            {
+                uint64_t const pair = ( static_cast< uint64_t >( GetHalf( aDivisor, i - 1 ) ) << 32 )
+                    | ( ( i > 1 ) ? GetHalf( aDivisor, i - 2 ) : 0U );
+                v[i - 1] = static_cast< uint32_t >( ( pair << shift ) >> 32 );
+            }
+            for( size_t i = m + n + 1; i > 0; --i )
+            {
+                uint64_t const pair = ( static_cast< uint64_t >( GetHalf( *this, i - 1 ) ) << 32 )
+                    | ( ( i > 1 ) ? GetHalf( *this, i - 2 ) : 0U );
+                u[i - 1] = static_cast< uint32_t >( ( pair << shift ) >> 32 );
+            }
+
+            uint64_t const base = static_cast< uint64_t >( 1 ) << 32;
+            for( size_t j = m + 1; j > 0; --j )
+            {
+                size_t const k = j - 1;
+
+                // Estimate the quotient digit from the top two digits
+                uint64_t const top = ( static_cast< uint64_t >( u[k + n] ) << 32 ) | u[k + n - 1];
+                uint64_t qhat = top / v[n - 1];
+                uint64_t rhat = top % v[n - 1];
+                while( ( qhat >= base ) ||
+                    ( ( n > 1 ) && ( ( qhat * v[n - 2] ) > ( ( rhat << 32 ) | u[k + n - 2] ) ) ) )
+                {
+                    --qhat;
+                    rhat += v[n - 1];
+                    if( rhat >= base )
+                    {
+                        break;
+                    }
+                }
+
+                // Multiply and subtract
+                int64_t borrow = 0;
+                uint64_t carry = 0;
+                for( size_t i = 0; i < n; ++i )
+                {
+                    uint64_t const product = ( qhat * v[i] ) + carry;
+                    carry = product >> 32;
+                    int64_t const diff = static_cast< int64_t >( u[i + k] ) - borrow
+                        - static_cast< int64_t >( product & 0xFFFFFFFFU );
+                    u[i + k] = static_cast< uint32_t >( diff );
+                    borrow = ( diff < 0 ) ? 1 : 0;
+                }
+                int64_t const diff = static_cast< int64_t >( u[k + n] ) - borrow - static_cast< int64_t >( carry );
+                u[k + n] = static_cast< uint32_t >( diff );
+
+                if( diff < 0 )
+                {
+                    // The estimate was one too large; add back
+                    --qhat;
+                    uint64_t addCarry = 0;
+                    for( size_t i = 0; i < n; ++i )
+                    {
+                        uint64_t const sum = static_cast< uint64_t >( u[i + k] ) + v[i] + addCarry;
+                        u[i + k] = static_cast< uint32_t >( sum );
+                        addCarry = sum >> 32;
+                    }
+                    u[k + n] = static_cast< uint32_t >( u[k + n] + addCarry );
+                }
+                q[k] = static_cast< uint32_t >( qhat );
+            }
+
+            // Save the quotient
+            size_t const numQuotientLimbs = ( m + 2 ) / 2;
+            aQuotient.mNumLimbs = 0;
+            BFDP_RETURNIF_V( !aQuotient.Reserve( numQuotientLimbs ), false );
+            Limb* const quotient = aQuotient.GetLimbs();
+            for( size_t i = 0; i <= m; ++i )
+            {
+                quotient[i / 2] |= static_cast< Limb >( q[i] ) << ( 32 * ( i % 2 ) );
+            }
+            aQuotient.mNumLimbs = numQuotientLimbs;
+            aQuotient.Trim();
+
+            // Save the remainder, undoing the normalization
+            size_t const numRemainderLimbs = ( n + 1 ) / 2;
+            aRemainder.mNumLimbs = 0;
+            BFDP_RETURNIF_V( !aRemainder.Reserve( numRemainderLimbs ), false );
+            Limb* const remainder = aRemainder.GetLimbs();
+            for( size_t i = 0; i < n; ++i )
+            {
+                uint64_t const pair = ( static_cast< uint64_t >( ( i + 1 < n ) ? u[i + 1] : 0U ) << 32 ) | u[i];
+                uint32_t const digit = static_cast< uint32_t >( pair >> shift );
+                remainder[i / 2] |= static_cast< Limb >( digit ) << ( 32 * ( i % 2 ) );
+            }
+            aRemainder.mNumLimbs = numRemainderLimbs;
+            aRemainder.Trim();
+
+            return true;
+        }
+
+        size_t BigUint::GetBitWidth() const
+        {
+            BFDP_RETURNIF_V( mNumLimbs == 0, 0U );
+
+            size_t width = ( mNumLimbs - 1 ) * LimbBits;
+            Limb top = GetConstLimbs()[mNumLimbs - 1];
+            while( top != 0U )
+            {
+                top >>= 1;
+                ++width;
+            }
+            return width;
+        }
+
+        BigUint::Limb BigUint::GetLimb
+            (
+            size_t const aIndex
+            ) const
+        {
+            return ( aIndex < mNumLimbs ) ? GetConstLimbs()[aIndex] : 0U;
+        }
+
+        size_t BigUint::GetNumLimbs() const
+        {
+            return mNumLimbs;
+        }
+
+        std::string BigUint::GetStr
+            (
+            RadixType const aRadix
+            ) const
+        {
+            BFDP_RETURNIF_V( !IsValidRadix( aRadix ), std::string() );
+            BFDP_RETURNIF_V( IsZero(), "0" );
+
+            std::string digits;
+            char symbol;
+
+            if( IsRadixPowerOf2( aRadix ) )
+            {
+                size_t const bitsPerDigit = GetRadixBits( aRadix );
+                size_t const numDigits = ( GetBitWidth() + bitsPerDigit - 1 ) / bitsPerDigit;
+                digits.resize( numDigits );
+                for( size_t i = 0; i < numDigits; ++i )
+                {
+                    size_t const bitPos = i * bitsPerDigit;
+                    Limb value = GetLimb( bitPos / LimbBits ) >> ( bitPos % LimbBits );
+                    if( ( ( bitPos % LimbBits ) + bitsPerDigit ) > LimbBits )
+                    {
+                        value |= GetLimb( ( bitPos / LimbBits ) + 1 ) << ( LimbBits - ( bitPos % LimbBits ) );
+                    }
+                    BFDP_RETURNIF_V( !ConvertBase( aRadix, static_cast< uint8_t >( value & ( aRadix - 1 ) ), symbol ), std::string() );
+                    digits[numDigits - 1 - i] = symbol;
+                }
+                return digits;
+            }
+
+            // Peel off as many digits at once as fit in 32 bits.  This is quadratic, but is
+            // intended for diagnostics rather than bulk conversion.
+            uint32_t chunkBase = aRadix;
+            size_t chunkDigits = 1;
+            while( chunkBase <= ( UINT32_MAX / aRadix ) )
+            {
+                chunkBase *= aRadix;
+                ++chunkDigits;
+            }
+
+            size_t const numLimbs = mNumLimbs;
+            ByteBuffer buf;
+            BFDP_RETURNIF_V( !buf.Allocate( numLimbs * sizeof( Limb ) ), std::string() );
+            Limb* const work = buf.GetPtrT< Limb >();
+            std::memcpy( work, GetConstLimbs(), numLimbs * sizeof( Limb ) );
+
+            size_t numWork = numLimbs;
+            while( numWork > 0 )
+            {
+                // Divide by chunkBase one 32-bit half at a time
+                uint64_t rem = 0;
+                for( size_t i = numWork; i > 0; --i )
+                {
+                    uint64_t const hiPart = ( rem << 32 ) | ( work[i - 1] >> 32 );
+                    uint64_t const hiQuot = hiPart / chunkBase;
+                    rem = hiPart % chunkBase;
+                    uint64_t const loPart = ( rem << 32 ) | ( work[i - 1] & 0xFFFFFFFFU );
+                    uint64_t const loQuot = loPart / chunkBase;
+                    rem = loPart % chunkBase;
+                    work[i - 1] = ( hiQuot << 32 ) | loQuot;
+                }
+                while( ( numWork > 0 ) && ( work[numWork - 1] == 0U ) )
+                {
+                    --numWork;
+                }
+
+                // Digits are produced least significant first
+                for( size_t i = 0; i < chunkDigits; ++i )
+                {
+                    BFDP_RETURNIF_V( !ConvertBase( aRadix, static_cast< uint8_t >( rem % aRadix ), symbol ), std::string() );
+                    digits += symbol;
+                    rem /= aRadix;
+                }
+            }
+
+            // Strip leading zeros and put the most significant digit first
+            size_t const lastNonZero = digits.find_last_not_of( '0' );
+            digits.erase( lastNonZero + 1 );
+            std::reverse( digits.begin(), digits.end() );
+            return digits;
+        }
+
+        size_t BigUint::GetTrailingZeroBits() const
+        {
+            Limb const* const limbs = GetConstLimbs();
+            for( size_t i = 0; i < mNumLimbs; ++i )
+            {
+                Limb value = limbs[i];
+                if( value != 0U )
+                {
+                    size_t count = i * LimbBits;
+                    while( ( value & 1U ) == 0U )
+                    {
+                        value >>= 1;
+                        ++count;
+                    }
+                    return count;
+                }
+            }
+            return 0U;
+        }
+
+        bool BigUint::GetUint64
+            (
+            uint64_t& aOut
+            ) const
+        {
+            BFDP_RETURNIF_V( mNumLimbs > 1, false );
+            aOut = GetLimb( 0 );
+            return true;
+        }
+
+        bool BigUint::IsZero() const
+        {
+            return mNumLimbs == 0;
+        }
+
+        bool BigUint::Multiply
+            (
+            BigUint const& aOther
+            )
+        {
+            if( IsZero() || aOther.IsZero() )
+            {
+                return Set( 0U );
+            }
+
+            BigUint result;
+            size_t const numResult = mNumLimbs + aOther.mNumLimbs;
+            BFDP_RETURNIF_V( !result.Reserve( numResult ), false );
+            BFDP_RETURNIF_V
+                (
+                !MultiplyLimbs( result.GetLimbs(), GetConstLimbs(), mNumLimbs, aOther.GetConstLimbs(), aOther.mNumLimbs ),
+                false
+                );
+            result.mNumLimbs = numResult;
+            result.Trim();
+
+            Swap( result );
+            return true;
+        }
+
+        bool BigUint::MulAddSmall
+            (
+            Limb const aMultiplier,
+            Limb const aAddend
+            )
+        {
+            BFDP_RETURNIF_V( !Reserve( mNumLimbs + 1 ), false );
+
+            Limb* const limbs = GetLimbs();
+            Limb carry = aAddend;
+            for( size_t i = 0; i < mNumLimbs; ++i )
+            {
+                Limb high;
+                Limb low = MulWide( limbs[i], aMultiplier, high );
+                low += carry;
+                high += ( low < carry ) ? 1U : 0U;
+                limbs[i] = low;
+                carry = high;
+            }
+            limbs[mNumLimbs] = carry;
+            ++mNumLimbs;
+            Trim();
+            return true;
+        }
+
+        bool BigUint::Power
+            (
+            uint64_t const aExponent
+            )
+        {
+            // Square and multiply, most significant exponent bit first
+            BigUint base;
+            BFDP_RETURNIF_V( !base.CopyFrom( *this ), false );
+            BFDP_RETURNIF_V( !Set( 1U ), false );
+
+            uint64_t bit = static_cast< uint64_t >( 1 ) << 63;
+            while( ( bit != 0U ) && ( ( aExponent & bit ) == 0U ) )
+            {
+                bit >>= 1;
+            }
+            for( ; bit != 0U; bit >>= 1 )
+            {
+                BFDP_RETURNIF_V( !Multiply( *this ), false );
+                if( ( aExponent & bit ) != 0U )
+                {
+                    BFDP_RETURNIF_V( !Multiply( base ), false );
+                }
+            }
+            return true;
+        }
+
+        bool BigUint::Set
+            (
+            uint64_t const aValue
+            )
+        {
+            mNumLimbs = 0;
+            BFDP_RETURNIF_V( aValue == 0U, true );
+            BFDP_RETURNIF_V( !Reserve( 1 ), false );
+            GetLimbs()[0] = aValue;
+            mNumLimbs = 1;
+            return true;
+        }
+
+        bool BigUint::SetDigits
+            (
+            RadixType const aRadix,
+            uint8_t const* const aDigits,
+            size_t const aNumDigits
+            )
+        {
+            BFDP_RETURNIF_V( !IsValidRadix( aRadix ), false );
+            for( size_t i = 0; i < aNumDigits; ++i )
+            {
+                BFDP_RETURNIF_V( aDigits[i] >= aRadix, false );
+            }
+
+            mNumLimbs = 0;
+            BFDP_RETURNIF_V( aNumDigits == 0, true );
+
+            if( IsRadixPowerOf2( aRadix ) )
+            {
+                // Digits map directly to bits
+                size_t const bitsPerDigit = GetRadixBits( aRadix );
+                size_t const numLimbs = ( ( aNumDigits * bitsPerDigit ) + LimbBits - 1 ) / LimbBits;
+                BFDP_RETURNIF_V( !Reserve( numLimbs ), false );
+
+                Limb* const limbs = GetLimbs();
+                for( size_t i = 0; i < aNumDigits; ++i )
+                {
+                    size_t const bitPos = i * bitsPerDigit;
+                    Limb const digit = aDigits[aNumDigits - 1 - i];
+                    limbs[bitPos / LimbBits] |= digit << ( bitPos % LimbBits );
+                    if( ( ( bitPos % LimbBits ) + bitsPerDigit ) > LimbBits )
+                    {
+                        limbs[( bitPos / LimbBits ) + 1] |= digit >> ( LimbBits - ( bitPos % LimbBits ) );
+                    }
+                }
+                mNumLimbs = numLimbs;
+                Trim();
+                return true;
+            }
+
+            // Group digits into chunks with base aRadix^chunkDigits that fit in a limb
+            Limb chunkBase = aRadix;
+            size_t chunkDigits = 1;
+            while( chunkBase <= ( UINT64_MAX / aRadix ) )
+            {
+                chunkBase *= aRadix;
+                ++chunkDigits;
+            }
+
+            size_t const numChunks = ( aNumDigits + chunkDigits - 1 ) / chunkDigits;
+            ByteBuffer buf;
+            BFDP_RETURNIF_V( !buf.Allocate( numChunks * sizeof( Limb ) ), false );
+            Limb* const chunks = buf.GetPtrT< Limb >();
+
+            // The first (most significant) chunk takes the leftover digits
+            size_t pos = 0;
+            for( size_t c = 0; c < numChunks; ++c )
+            {
+                size_t const numInChunk = ( c == 0 )
+                    ? ( aNumDigits - ( ( numChunks - 1 ) * chunkDigits ) )
+                    : chunkDigits;
+                Limb value = 0;
+                for( size_t i = 0; i < numInChunk; ++i )
+                {
+                    value = ( value * aRadix ) + aDigits[pos];
+                    ++pos;
+                }
+                chunks[c] = value;
+            }
+
+            // Place values for power-of-2 runs of chunks: powers[i] = chunkBase^(2^i)
+            BigUint powers[MaxPowerLevels];
+            BFDP_RETURNIF_V( !powers[0].Set( chunkBase ), false );
+            for( size_t i = 1; ( i < MaxPowerLevels ) && ( ( static_cast< size_t >( 1 ) << i ) < numChunks ); ++i )
+            {
+                BFDP_RETURNIF_V( !powers[i].CopyFrom( powers[i - 1] ), false );
+                BFDP_RETURNIF_V( !powers[i].Multiply( powers[i - 1] ), false );
+            }
+
+            return ConvertChunks( chunks, numChunks, powers, *this );
+        }
+
+        bool BigUint::ShiftLeft
+            (
+            size_t const aBits
+            )
+        {
+            BFDP_RETURNIF_V( IsZero() || ( aBits == 0 ), true );
+
+            size_t const limbShift = aBits / LimbBits;
+            size_t const bitShift = aBits % LimbBits;
+            size_t const numResult = mNumLimbs + limbShift + 1;
+            BFDP_RETURNIF_V( !Reserve( numResult ), false );
+
+            Limb* const limbs = GetLimbs();
+            for( size_t i = numResult; i > limbShift; --i )
+            {
+                size_t const src = i - 1 - limbShift;
+                Limb value = ( src < mNumLimbs ) ? ( limbs[src] << bitShift ) : 0U;
+                if( ( bitShift != 0 ) && ( src > 0 ) && ( src - 1 < mNumLimbs ) )
+                {
+                    value |= limbs[src - 1] >> ( LimbBits - bitShift );
+                }
+                limbs[i - 1] = value;
+            }
+            std::fill( limbs, limbs + limbShift, 0U );
+
+            mNumLimbs = numResult;
+            Trim();
+            return true;
+        }
+
+        void BigUint::ShiftRight
+            (
+            size_t const aBits
+            )
+        {
+            size_t const limbShift = aBits / LimbBits;
+            size_t const bitShift = aBits % LimbBits;
+            if( limbShift >= mNumLimbs )
+            {
+                mNumLimbs = 0;
+                return;
+            }
+
+            Limb* const limbs = GetLimbs();
+            size_t const numResult = mNumLimbs - limbShift;
+            for( size_t i = 0; i < numResult; ++i )
+            {
+                Limb value = limbs[i + limbShift] >> bitShift;
+                if( ( bitShift != 0 ) && ( ( i + limbShift + 1 ) < mNumLimbs ) )
+                {
+                    value |= limbs[i + limbShift + 1] << ( LimbBits - bitShift );
+                }
+                limbs[i] = value;
+            }
+
+            mNumLimbs = numResult;
+            Trim();
+        }
+
+        bool BigUint::Subtract
+            (
+            BigUint const& aOther
+            )
+        {
+            BFDP_RETURNIF_V( Compare( aOther ) < 0, false );
+
+            SubtractFrom( GetLimbs(), mNumLimbs, aOther.GetConstLimbs(), aOther.mNumLimbs );
+            Trim();
+            return true;
+        }
+
+        void BigUint::Swap
+            (
+            BigUint& aOther
+            )
+        {
+            mBuffer.Swap( aOther.mBuffer );
+            std::swap( mNumLimbs, aOther.mNumLimbs );
+        }
+
+        BigUint::Limb const* BigUint::GetConstLimbs() const
+        {
+            return mBuffer.GetConstPtrT< Limb >();
+        }
+
+        BigUint::Limb* BigUint::GetLimbs()
+        {
+            return mBuffer.GetPtrT< Limb >();
+        }
+
+        bool BigUint::Reserve
+            (
+            size_t const aNumLimbs
+            )
+        {
+            size_t const capacity = mBuffer.GetSize() / sizeof( Limb );
+            if( aNumLimbs > capacity )
+            {
+                // Grow geometrically to amortize repeated small increases
+                size_t const newCapacity = std::max( aNumLimbs, 2 * capacity );
+                ByteBuffer newBuffer;
+                BFDP_RETURNIF_V( !newBuffer.Allocate( newCapacity * sizeof( Limb ) ), false );
+                if( mNumLimbs > 0 )
+                {
+                    std::memcpy( newBuffer.GetPtr(), mBuffer.GetConstPtr(), mNumLimbs * sizeof( Limb ) );
+                }
+                mBuffer.Swap( newBuffer );
+            }
+
+            if( aNumLimbs > mNumLimbs )
+            {
+                std::fill( GetLimbs() + mNumLimbs, GetLimbs() + aNumLimbs, 0U );
+            }
+            return true;
+        }
+
+        void BigUint::Trim()
+        {
+            Limb const* const limbs = GetConstLimbs();
+            while( ( mNumLimbs > 0 ) && ( limbs[mNumLimbs - 1] == 0U ) )
+            {
+                --mNumLimbs;
+            }
+        }
+
+    } // namespace Data
+
+} // namespace Bfdp
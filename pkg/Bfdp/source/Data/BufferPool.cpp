@@ -0,0 +1,238 @@
+/**
+    BFDP Data Buffer Pool Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Data/BufferPool.hpp"
+
+// External Includes
+#if defined( _WIN32 )
+    // System headers are not warning-free at the project's warning level
+    #pragma warning( push, 0 )
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #pragma warning( pop )
+#else
+    #include <sys/mman.h>
+#endif
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        BFDP_CTIME_ASSERT( ( BufferPool::PageSize % IAllocator::Alignment ) == 0, "Page size must keep alignment" );
+
+        /* static */ BufferPool& BufferPool::GetShared()
+        {
+            static BufferPool sInstance( DefaultMaxCached );
+            return sInstance;
+        }
+
+        BufferPool::BufferPool
+            (
+            size_t const aMaxCached
+            )
+            : mHits( 0U )
+            , mMisses( 0U )
+            , mNumCached( 0U )
+        {
+            // Without room to cache buffers, every freed buffer goes back to the OS
+            BFDP_UNUSED_RETURN( mCached.Allocate( aMaxCached * sizeof( Buffer ) ) );
+        }
+
+        BufferPool::~BufferPool()
+        {
+            Trim();
+        }
+
+        void* BufferPool::Allocate
+            (
+            size_t const aSize
+            )
+        {
+            size_t const size = GetBufferSize( aSize );
+            BFDP_RETURNIF_V( size < aSize, NULL );
+
+            {
+                std::lock_guard< std::mutex > lock( mMutex );
+                Buffer* const cached = mCached.GetPtrT< Buffer >();
+                for( size_t i = 0; i < mNumCached; ++i )
+                {
+                    if( cached[i].size == size )
+                    {
+                        void* const ptr = cached[i].ptr;
+                        cached[i] = cached[--mNumCached];
+                        ++mHits;
+                        return ptr;
+                    }
+                }
+                ++mMisses;
+            }
+
+            // Map outside the lock; it can be slow
+            return MapBuffer( size );
+        }
+
+        void BufferPool::Free
+            (
+            void* const aPtr,
+            size_t const aSize
+            )
+        {
+            BFDP_RETURNIF( aPtr == NULL );
+
+            Buffer buffer;
+            buffer.ptr = aPtr;
+            buffer.size = GetBufferSize( aSize );
+            {
+                std::lock_guard< std::mutex > lock( mMutex );
+                if( mNumCached < ( mCached.GetSize() / sizeof( Buffer ) ) )
+                {
+                    mCached.GetPtrT< Buffer >()[mNumCached++] = buffer;
+                    return;
+                }
+            }
+
+            UnmapBuffer( buffer.ptr, buffer.size );
+        }
+
+        size_t BufferPool::GetHits() const
+        {
+            std::lock_guard< std::mutex > lock( mMutex );
+            return mHits;
+        }
+
+        size_t BufferPool::GetMisses() const
+        {
+            std::lock_guard< std::mutex > lock( mMutex );
+            return mMisses;
+        }
+
+        size_t BufferPool::GetNumCached() const
+        {
+            std::lock_guard< std::mutex > lock( mMutex );
+            return mNumCached;
+        }
+
+        void BufferPool::Trim()
+        {
+            // Unmap outside the lock, one buffer at a time
+            for( ;; )
+            {
+                Buffer buffer;
+                {
+                    std::lock_guard< std::mutex > lock( mMutex );
+                    BFDP_RETURNIF( mNumCached == 0U );
+                    buffer = mCached.GetPtrT< Buffer >()[--mNumCached];
+                }
+                UnmapBuffer( buffer.ptr, buffer.size );
+            }
+        }
+
+        /* static */ size_t BufferPool::GetBufferSize
+            (
+            size_t const aSize
+            )
+        {
+            BFDP_RETURNIF_V( aSize == 0U, PageSize );
+
+            size_t const granularity = ( aSize >= HugePageSize ) ? HugePageSize : PageSize;
+            return ( ( aSize - 1U ) / granularity + 1U ) * granularity;
+        }
+
+#if defined( _WIN32 )
+
+        /* static */ void* BufferPool::MapBuffer
+            (
+            size_t const aSize
+            )
+        {
+            // Large pages need a privilege that processes rarely hold, so use normal pages
+            return ::VirtualAlloc( NULL, aSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE );
+        }
+
+        /* static */ void BufferPool::UnmapBuffer
+            (
+            void* const aPtr,
+            size_t const /* aSize */
+            )
+        {
+            ::VirtualFree( aPtr, 0, MEM_RELEASE );
+        }
+
+#else
+
+        /* static */ void* BufferPool::MapBuffer
+            (
+            size_t const aSize
+            )
+        {
+            int const prot = PROT_READ | PROT_WRITE;
+            int const flags = MAP_PRIVATE | MAP_ANONYMOUS;
+            void* ptr = MAP_FAILED;
+#if defined( MAP_HUGETLB )
+            if( aSize >= HugePageSize )
+            {
+                // Only succeeds if huge pages have been reserved
+                ptr = ::mmap( NULL, aSize, prot, flags | MAP_HUGETLB, -1, 0 );
+            }
+#endif
+            if( ptr == MAP_FAILED )
+            {
+                ptr = ::mmap( NULL, aSize, prot, flags, -1, 0 );
+                BFDP_RETURNIF_V( ptr == MAP_FAILED, NULL );
+#if defined( MADV_HUGEPAGE )
+                if( aSize >= HugePageSize )
+                {
+                    // Fall back to transparent huge pages; only a hint
+                    ::madvise( ptr, aSize, MADV_HUGEPAGE );
+                }
+#endif
+            }
+            return ptr;
+        }
+
+        /* static */ void BufferPool::UnmapBuffer
+            (
+            void* const aPtr,
+            size_t const aSize
+            )
+        {
+            ::munmap( aPtr, aSize );
+        }
+
+#endif
+
+    } // namespace Data
+
+} // namespace Bfdp
@@ -36,6 +36,10 @@
 // External includes
 #include <algorithm>
 #include <cstring>
+#include <utility>
+
+// Internal includes
+#include "Bfdp/Data/HeapAllocator.hpp"
 
 namespace Bfdp
 {
@@ -44,22 +48,66 @@ namespace Bfdp
     {
 
         ByteBuffer::ByteBuffer()
-            : mPtr( NULL )
+            : mAllocator( &HeapAllocator::GetInstance() )
+            , mPtr( NULL )
             , mSize( 0U )
         {
         };
 
+        ByteBuffer::ByteBuffer
+            (
+            IAllocator& aAllocator
+            )
+            : mAllocator( &aAllocator )
+            , mPtr( NULL )
+            , mSize( 0U )
+        {
+        }
+
+        ByteBuffer::ByteBuffer
+            (
+            ByteBuffer&& aOther
+            )
+            : mAllocator( aOther.mAllocator )
+            , mPtr( NULL )
+            , mSize( 0U )
+        {
+            Take( aOther );
+        }
+
         ByteBuffer::~ByteBuffer()
         {
             Delete();
         }
 
+        ByteBuffer& ByteBuffer::operator=
+            (
+            ByteBuffer&& aOther
+            )
+        {
+            if( this != &aOther )
+            {
+                Delete();
+                mAllocator = aOther.mAllocator;
+                Take( aOther );
+            }
+            return *this;
+        }
+
         bool ByteBuffer::Allocate
             (
             size_t const aSize
             )
         {
-            Byte* newBuffer = new(std::nothrow)Byte[aSize];
+            if( aSize <= InlineSize )
+            {
+                Delete();
+                mPtr = reinterpret_cast< Byte* >( &mInline );
+                mSize = aSize;
+                return true;
+            }
+
+            Byte* newBuffer = static_cast< Byte* >( mAllocator->Allocate( aSize ) );
             BFDP_RETURNIF_V( NULL == newBuffer, false );
 
             Delete();
@@ -90,11 +138,19 @@ namespace Bfdp
 
         void ByteBuffer::Delete()
         {
-            delete [] mPtr;
+            if( !IsInline() )
+            {
+                mAllocator->Free( mPtr, mSize );
+            }
             mPtr = NULL;
             mSize = 0U;
         }
 
+        IAllocator& ByteBuffer::GetAllocator() const
+        {
+            return *mAllocator;
+        }
+
         Byte const* ByteBuffer::GetConstPtr() const
         {
             return mPtr;
@@ -129,6 +185,11 @@ namespace Bfdp
             return std::string( GetConstPtrT< char >(), numBytes );
         }
 
+        bool ByteBuffer::IsInline() const
+        {
+            return mPtr == reinterpret_cast< Byte const* >( &mInline );
+        }
+
         void ByteBuffer::MemSet
             (
             Byte const aValue
@@ -145,8 +206,9 @@ namespace Bfdp
             ByteBuffer& aOther
             )
         {
-            std::swap( mPtr, aOther.mPtr );
-            std::swap( mSize, aOther.mSize );
+            ByteBuffer temp( std::move( aOther ) );
+            aOther = std::move( *this );
+            *this = std::move( temp );
         }
 
         Byte& ByteBuffer::operator []
@@ -165,6 +227,26 @@ namespace Bfdp
             return mPtr[aIndex];
         }
 
+        void ByteBuffer::Take
+            (
+            ByteBuffer& aOther
+            )
+        {
+            if( aOther.IsInline() )
+            {
+                std::memcpy( &mInline, &aOther.mInline, aOther.mSize );
+                mPtr = reinterpret_cast< Byte* >( &mInline );
+            }
+            else
+            {
+                mPtr = aOther.mPtr;
+            }
+            mSize = aOther.mSize;
+
+            aOther.mPtr = NULL;
+            aOther.mSize = 0U;
+        }
+
     } // namespace Data
 
 } // namespace Bfdp
@@ -156,6 +156,22 @@ namespace Bfdp
             mHead = 0U;
         }
 
+        void ByteWindow::SkipData
+            (
+            size_t const aSize
+            )
+        {
+            if( aSize == 0 )
+            {
+                // No change without any data
+                return;
+            }
+
+            mEndCounter += aSize;
+            mBeginCounter = mEndCounter;
+            mHead = 0;
+        }
+
         void ByteWindow::CopyCirc
             (
             size_t const aBufIndex,
@@ -34,6 +34,7 @@
 #include "Bfdp/Data/FlexNumber.hpp"
 
 // External Includes
+#include <algorithm>
 #include <sstream>
 
 // Internal Includes
@@ -52,6 +53,38 @@ namespace Bfdp
             return sign.IsSpecified() && ( integral.IsDefined() || fractional.IsDefined() );
         }
 
+        bool FlexNumber::Component::GetRational
+            (
+            BigRational& aOut
+            ) const
+        {
+            BFDP_RETURNIF_V( !IsDefined(), false );
+
+            aOut.sign = ( sign == Sign::Negative ) ? Sign::Negative : Sign::Positive;
+            BFDP_RETURNIF_V( !aOut.denominator.Set( 1U ), false );
+            if( integral.IsDefined() )
+            {
+                BFDP_RETURNIF_V( !integral.GetBigUint( aOut.numerator ), false );
+            }
+            else
+            {
+                BFDP_RETURNIF_V( !aOut.numerator.Set( 0U ), false );
+            }
+
+            if( fractional.GetNumDigits() > 0 )
+            {
+                // integral + fractional / radix^digits
+                BigUint fraction;
+                BFDP_RETURNIF_V( !fractional.GetBigUint( fraction ), false );
+                BFDP_RETURNIF_V( !aOut.denominator.Set( fractional.GetRadix() ), false );
+                BFDP_RETURNIF_V( !aOut.denominator.Power( fractional.GetNumDigits() ), false );
+                BFDP_RETURNIF_V( !aOut.numerator.Multiply( aOut.denominator ), false );
+                BFDP_RETURNIF_V( !aOut.numerator.Add( fraction ), false );
+            }
+
+            return aOut.Reduce();
+        }
+
         std::string FlexNumber::Component::GetStr
             (
             bool const aVerbose
@@ -105,6 +138,60 @@ namespace Bfdp
             fractional.Reset();
         }
 
+        bool FlexNumber::GetFixedPoint
+            (
+            size_t const aFractionalBits,
+            Sign& aSign,
+            BigUint& aMagnitude
+            ) const
+        {
+            BigRational value;
+            BFDP_RETURNIF_V( !GetRational( value ), false );
+
+            aSign = value.sign;
+            return value.GetFixedPoint( aFractionalBits, aMagnitude );
+        }
+
+        bool FlexNumber::GetRational
+            (
+            BigRational& aOut
+            ) const
+        {
+            BFDP_RETURNIF_V( !IsDefined(), false );
+
+            if( HasSignificand() )
+            {
+                BFDP_RETURNIF_V( !significand.GetRational( aOut ), false );
+            }
+            else
+            {
+                aOut.sign = Sign::Positive;
+                BFDP_RETURNIF_V( !aOut.numerator.Set( 1U ) || !aOut.denominator.Set( 1U ), false );
+            }
+
+            if( HasExponent() )
+            {
+                BFDP_RETURNIF_V( !exponent.IsIntegral(), false );
+                uint64_t power;
+                BFDP_RETURNIF_V( !exponent.integral.GetUint64( power ), false );
+
+                BigRational order;
+                BFDP_RETURNIF_V( !base.GetRational( order ), false );
+
+                size_t const width = std::max( order.numerator.GetBitWidth(), order.denominator.GetBitWidth() );
+                BFDP_RETURNIF_V( ( width > 1 ) && ( power > ( MaxEvaluationBits / width ) ), false );
+                BFDP_RETURNIF_V( !order.Power( power ), false );
+                if( exponent.sign == Sign::Negative )
+                {
+                    BFDP_RETURNIF_V( !order.Invert(), false );
+                }
+
+                BFDP_RETURNIF_V( !aOut.Multiply( order ), false );
+            }
+
+            return aOut.Reduce();
+        }
+
         std::string FlexNumber::GetStr
             (
             bool const aVerbose
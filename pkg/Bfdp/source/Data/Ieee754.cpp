@@ -0,0 +1,321 @@
+/**
+    BFDP Data IEEE 754 Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Data/Ieee754.hpp"
+
+// External Includes
+#include <algorithm>
+#if defined( __F16C__ )
+    #define BFDP_IEEE754_F16C_STATIC 1
+    #include <immintrin.h>
+#elif defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+    #define BFDP_IEEE754_F16C_DISPATCH 1
+    #include <immintrin.h>
+#endif
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        namespace Ieee754
+        {
+
+            namespace Ieee754Internal
+            {
+
+                typedef float (*DecodeBinary16Func)( uint16_t const aBits );
+
+                static inline uint32_t SingleBits
+                    (
+                    float const aValue
+                    )
+                {
+                    uint32_t bits;
+                    std::memcpy( &bits, &aValue, sizeof( bits ) );
+                    return bits;
+                }
+
+            #if( BFDP_IEEE754_F16C_STATIC )
+                static inline float DecodeBinary16F16c
+                    (
+                    uint16_t const aBits
+                    )
+                {
+                    return _cvtsh_ss( aBits );
+                }
+            #elif( BFDP_IEEE754_F16C_DISPATCH )
+                __attribute__(( target( "f16c" ) ))
+                static float DecodeBinary16F16c
+                    (
+                    uint16_t const aBits
+                    )
+                {
+                    return _cvtsh_ss( aBits );
+                }
+            #endif
+
+                static DecodeBinary16Func SelectDecodeBinary16()
+                {
+                #if( BFDP_IEEE754_F16C_STATIC )
+                    return &DecodeBinary16F16c;
+                #elif( BFDP_IEEE754_F16C_DISPATCH )
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports( "f16c" )
+                        ? &DecodeBinary16F16c
+                        : &DecodeBinary16Software;
+                #else
+                    return &DecodeBinary16Software;
+                #endif
+                }
+
+                //! Chosen once at startup so that each decode is a single indirect call
+                static DecodeBinary16Func const sDecodeBinary16 = SelectDecodeBinary16();
+
+            } // namespace Ieee754Internal
+
+            using namespace Ieee754Internal;
+
+            bool HasHardwareBinary16()
+            {
+                return sDecodeBinary16 != &DecodeBinary16Software;
+            }
+
+            float DecodeBinary16
+                (
+                uint16_t const aBits
+                )
+            {
+            #if( BFDP_IEEE754_F16C_STATIC )
+                return DecodeBinary16F16c( aBits );
+            #else
+                return sDecodeBinary16( aBits );
+            #endif
+            }
+
+            // Rebias the exponent by adding to the shifted bits, then fix up Inf/NaN and
+            // subnormals with masks rather than branches.  Subnormals are normalized by
+            // the FPU: the value is built with an extra implicit bit at the minimum
+            // exponent, which is then subtracted back out.
+            float DecodeBinary16Software
+                (
+                uint16_t const aBits
+                )
+            {
+                static uint32_t const ExpMask = 0x7C00U << 13;
+                static uint32_t const ExpAdjust = ( 127U - 15U ) << 23;
+                static uint32_t const SubnormalMagic = 113U << 23; // 2^-14
+
+                uint32_t bits = ( aBits & 0x7FFFU ) << 13;
+                uint32_t const exp = bits & ExpMask;
+                uint32_t const infNanMask = 0U - static_cast< uint32_t >( exp == ExpMask );
+                uint32_t const subnormalMask = 0U - static_cast< uint32_t >( exp == 0U );
+
+                bits += ExpAdjust;
+                bits += infNanMask & ExpAdjust;
+                bits += subnormalMask & ( 1U << 23 );
+
+                // Subtracting 0.0f leaves every value other than subnormals unchanged
+                float const value = DecodeBinary32( bits ) - DecodeBinary32( subnormalMask & SubnormalMagic );
+                return DecodeBinary32( SingleBits( value ) | ( static_cast< uint32_t >( aBits & 0x8000U ) << 16 ) );
+            }
+
+            double DecodeBinary128
+                (
+                uint64_t const aHigh,
+                uint64_t const aLow
+                )
+            {
+                static int const Binary128Bias = 16383;
+                static int const Binary64Bias = 1023;
+                static int const Binary64MaxExp = 0x7FF;
+                static uint64_t const Binary64FracMask = ( 1ULL << 52 ) - 1U;
+
+                // The 112-bit fraction splits into the 52 bits kept by binary64 and 60 rounding bits
+                static unsigned int const RoundBits = 60U;
+                static uint64_t const RoundMask = ( 1ULL << RoundBits ) - 1U;
+                static uint64_t const RoundHalf = 1ULL << ( RoundBits - 1U );
+
+                uint64_t const sign = aHigh & ( 1ULL << 63 );
+                int const exp = static_cast< int >( ( aHigh >> 48 ) & 0x7FFFU );
+                uint64_t const fracHigh = aHigh & ( ( 1ULL << 48 ) - 1U );
+                uint64_t frac = ( fracHigh << 4 ) | ( aLow >> RoundBits );
+                uint64_t rest = aLow & RoundMask;
+
+                if( exp == 0x7FFF )
+                {
+                    // Infinity, or NaN with the upper payload bits and the quiet bit preserved
+                    bool const isNan = ( fracHigh | aLow ) != 0;
+                    uint64_t const nanBits = isNan ? ( frac | ( 1ULL << 51 ) ) : 0U;
+                    return DecodeBinary64( sign | ( static_cast< uint64_t >( Binary64MaxExp ) << 52 ) | nanBits );
+                }
+
+                int outExp = exp - Binary128Bias + Binary64Bias;
+                if( ( exp == 0 ) || ( outExp < -52 ) )
+                {
+                    // Zero, or too small to round up to the smallest binary64 subnormal
+                    return DecodeBinary64( sign );
+                }
+                if( outExp >= Binary64MaxExp )
+                {
+                    return DecodeBinary64( sign | ( static_cast< uint64_t >( Binary64MaxExp ) << 52 ) );
+                }
+
+                if( outExp <= 0 )
+                {
+                    // Binary64 subnormal: shift the significand, including its implicit bit,
+                    // right and fold what falls off into the rounding bits
+                    unsigned int const shift = static_cast< unsigned int >( 1 - outExp );
+                    uint64_t const significand = frac | ( 1ULL << 52 );
+                    uint64_t const shiftedOut = significand & ( ( 1ULL << shift ) - 1U );
+                    frac = significand >> shift;
+                    rest = ( shiftedOut << ( RoundBits - shift ) ) | ( ( rest != 0 ) ? 1U : 0U );
+                    outExp = 0;
+                }
+
+                // Round to nearest, ties to even; a carry out of the fraction correctly bumps
+                // the exponent, up to and including infinity
+                uint64_t bits = ( static_cast< uint64_t >( outExp ) << 52 ) + ( frac & Binary64FracMask );
+                if( ( rest > RoundHalf ) || ( ( rest == RoundHalf ) && ( ( bits & 1U ) != 0 ) ) )
+                {
+                    ++bits;
+                }
+                return DecodeBinary64( sign | bits );
+            }
+
+            uint16_t EncodeBinary16
+                (
+                double const aValue
+                )
+            {
+                static int const Binary64Bias = 1023;
+                static int const Binary16Bias = 15;
+                static uint16_t const Binary16Inf = 0x7C00U;
+                static uint64_t const Binary64FracMask = ( 1ULL << 52 ) - 1U;
+
+                // binary64 keeps 42 more fraction bits than binary16
+                static unsigned int const DropBits = 42U;
+
+                uint64_t const bits = EncodeBinary64( aValue );
+                uint16_t const sign = static_cast< uint16_t >( ( bits >> 48 ) & 0x8000U );
+                int const exp = static_cast< int >( ( bits >> 52 ) & 0x7FFU );
+                uint64_t const frac = bits & Binary64FracMask;
+
+                if( exp == 0x7FF )
+                {
+                    // Infinity, or NaN with the upper payload bits and the quiet bit set
+                    uint16_t const nanBits = ( frac != 0 ) ? static_cast< uint16_t >( 0x200U | ( frac >> DropBits ) ) : 0U;
+                    return static_cast< uint16_t >( sign | Binary16Inf | nanBits );
+                }
+                else if( exp == 0 )
+                {
+                    // Zero, or a binary64 subnormal, which is far below the binary16 range
+                    return sign;
+                }
+
+                // Binary16 subnormals drop one more bit for each step below the minimum exponent
+                int const outExp = exp - Binary64Bias + Binary16Bias;
+                unsigned int const shift = DropBits + static_cast< unsigned int >( ( outExp < 1 ) ? ( 1 - outExp ) : 0 );
+                if( shift > 53U )
+                {
+                    // Less than half of the smallest subnormal
+                    return sign;
+                }
+
+                // Round to nearest, ties to even.  The significand keeps its implicit bit, so
+                // adding it to the biased exponent less one gives the encoding; a carry out of
+                // the fraction bumps the exponent, up to and including infinity.
+                uint64_t const significand = frac | ( 1ULL << 52 );
+                uint64_t const rest = significand & ( ( 1ULL << shift ) - 1U );
+                uint64_t const half = 1ULL << ( shift - 1U );
+                uint64_t rounded = significand >> shift;
+                if( ( rest > half ) || ( ( rest == half ) && ( ( rounded & 1U ) != 0 ) ) )
+                {
+                    ++rounded;
+                }
+                uint64_t const out = ( static_cast< uint64_t >( std::max( outExp, 1 ) - 1 ) << 10 ) + rounded;
+                return static_cast< uint16_t >( sign | std::min< uint64_t >( out, Binary16Inf ) );
+            }
+
+            void EncodeBinary128
+                (
+                double const aValue,
+                uint64_t& aHigh,
+                uint64_t& aLow
+                )
+            {
+                static int const Binary128Bias = 16383;
+                static int const Binary64Bias = 1023;
+                static uint64_t const Binary64FracMask = ( 1ULL << 52 ) - 1U;
+
+                // The 52-bit fraction is the top of the 112-bit fraction: 48 bits in the high
+                // word, and the other 4 at the top of the low word
+                static unsigned int const LowShift = 60U;
+
+                uint64_t const bits = EncodeBinary64( aValue );
+                uint64_t const sign = bits & ( 1ULL << 63 );
+                int exp = static_cast< int >( ( bits >> 52 ) & 0x7FFU );
+                uint64_t frac = bits & Binary64FracMask;
+
+                if( exp == 0x7FF )
+                {
+                    exp = 0x7FFF;
+                }
+                else if( exp != 0 )
+                {
+                    exp = exp - Binary64Bias + Binary128Bias;
+                }
+                else if( frac != 0 )
+                {
+                    // Binary64 subnormals are normal in binary128; shift the leading bit up to the
+                    // implicit bit position, lowering the exponent to match
+                    int shift = 0;
+                    while( ( frac & ( 1ULL << 52 ) ) == 0 )
+                    {
+                        frac <<= 1;
+                        ++shift;
+                    }
+                    frac &= Binary64FracMask;
+                    exp = 1 - Binary64Bias - shift + Binary128Bias;
+                }
+
+                aHigh = sign | ( static_cast< uint64_t >( exp ) << 48 ) | ( frac >> ( 64U - LowShift ) );
+                aLow = frac << LowShift;
+            }
+
+        } // namespace Ieee754
+
+    } // namespace Data
+
+} // namespace Bfdp
@@ -0,0 +1,227 @@
+/**
+    BFDP Data Mapped File Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base includes
+#include "Bfdp/Data/MappedFile.hpp"
+
+// External includes
+#if defined( _WIN32 )
+    // System headers are not warning-free at the project's warning level
+    #pragma warning( push, 0 )
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #pragma warning( pop )
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// Internal includes
+#include "Bfdp/ErrorReporter/Functions.hpp"
+
+#define BFDP_MODULE "Data::MappedFile"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        MappedFile::MappedFile()
+#if defined( _WIN32 )
+            : mFileHandle( NULL )
+            , mMapHandle( NULL )
+#else
+            : mFd( -1 )
+#endif
+            , mPtr( NULL )
+            , mSize( 0U )
+        {
+        }
+
+        MappedFile::~MappedFile()
+        {
+            Close();
+        }
+
+#if defined( _WIN32 )
+
+        void MappedFile::Close()
+        {
+            if( mPtr != NULL )
+            {
+                ::UnmapViewOfFile( mPtr );
+            }
+            if( mMapHandle != NULL )
+            {
+                ::CloseHandle( mMapHandle );
+            }
+            if( mFileHandle != NULL )
+            {
+                ::CloseHandle( mFileHandle );
+            }
+
+            mFileHandle = NULL;
+            mMapHandle = NULL;
+            mPtr = NULL;
+            mSize = 0U;
+        }
+
+        bool MappedFile::Open
+            (
+            std::string const& aFileName
+            )
+        {
+            Close();
+
+            HANDLE file = ::CreateFileA( aFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+            BFDP_RETURNIF_V( file == INVALID_HANDLE_VALUE, false );
+            mFileHandle = file;
+            if( ::GetFileType( file ) != FILE_TYPE_DISK )
+            {
+                // Pipes and devices have no size to map
+                Close();
+                return false;
+            }
+
+            LARGE_INTEGER fileSize;
+            if( !::GetFileSizeEx( file, &fileSize ) ||
+                ( static_cast< unsigned long long >( fileSize.QuadPart ) > SIZE_MAX ) )
+            {
+                BFDP_RUNTIME_ERROR( "Cannot get file size" );
+                Close();
+                return false;
+            }
+
+            mSize = static_cast< size_t >( fileSize.QuadPart );
+            BFDP_RETURNIF_V( mSize == 0, true ); // Empty files cannot be mapped
+
+            mMapHandle = ::CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+            if( mMapHandle != NULL )
+            {
+                mPtr = static_cast< Byte const* >( ::MapViewOfFile( mMapHandle, FILE_MAP_READ, 0, 0, 0 ) );
+            }
+            if( mPtr == NULL )
+            {
+                BFDP_RUNTIME_ERROR( "Failed to map file" );
+                Close();
+                return false;
+            }
+
+            return true;
+        }
+
+#else
+
+        void MappedFile::Close()
+        {
+            if( mPtr != NULL )
+            {
+                ::munmap( const_cast< Byte* >( mPtr ), mSize );
+            }
+            if( mFd >= 0 )
+            {
+                ::close( mFd );
+            }
+
+            mFd = -1;
+            mPtr = NULL;
+            mSize = 0U;
+        }
+
+        bool MappedFile::Open
+            (
+            std::string const& aFileName
+            )
+        {
+            Close();
+
+            mFd = ::open( aFileName.c_str(), O_RDONLY );
+            BFDP_RETURNIF_V( mFd < 0, false );
+
+            struct stat fileStat;
+            if( ( ::fstat( mFd, &fileStat ) != 0 ) ||
+                ( static_cast< unsigned long long >( fileStat.st_size ) > SIZE_MAX ) )
+            {
+                BFDP_RUNTIME_ERROR( "Cannot get file size" );
+                Close();
+                return false;
+            }
+            if( !S_ISREG( fileStat.st_mode ) )
+            {
+                // Pipes and devices have no size to map
+                Close();
+                return false;
+            }
+
+            mSize = static_cast< size_t >( fileStat.st_size );
+            BFDP_RETURNIF_V( mSize == 0, true ); // Empty files cannot be mapped
+
+            void* ptr = ::mmap( NULL, mSize, PROT_READ, MAP_PRIVATE, mFd, 0 );
+            if( ptr == MAP_FAILED )
+            {
+                BFDP_RUNTIME_ERROR( "Failed to map file" );
+                Close();
+                return false;
+            }
+
+            mPtr = static_cast< Byte const* >( ptr );
+            return true;
+        }
+
+#endif
+
+        Byte const* MappedFile::GetConstPtr() const
+        {
+            return mPtr;
+        }
+
+        size_t MappedFile::GetSize() const
+        {
+            return mSize;
+        }
+
+        bool MappedFile::IsOpen() const
+        {
+#if defined( _WIN32 )
+            return mFileHandle != NULL;
+#else
+            return mFd >= 0;
+#endif
+        }
+
+    } // namespace Data
+
+} // namespace Bfdp
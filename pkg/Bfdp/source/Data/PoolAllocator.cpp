@@ -0,0 +1,160 @@
+/**
+    BFDP Data Pool Allocator Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Data/PoolAllocator.hpp"
+
+// Internal Includes
+#include "Bfdp/String.hpp"
+
+namespace Bfdp
+{
+
+    namespace Data
+    {
+
+        PoolAllocator::PoolAllocator
+            (
+            IAllocator& aUpstream
+            )
+            : mUpstream( aUpstream )
+            , mSlabs( NULL )
+            , mBytesReserved( 0U )
+        {
+            // The classes run from MinClassSize to MaxClassSize in powers of two
+            BFDP_CTIME_ASSERT( ( MinClassSize << ( NumClasses - 1U ) ) == MaxClassSize, "Size class count mismatch" );
+
+            for( size_t i = 0; i < NumClasses; ++i )
+            {
+                mFreeLists[i] = NULL;
+            }
+        }
+
+        PoolAllocator::~PoolAllocator()
+        {
+            Slab* slab = mSlabs;
+            while( slab != NULL )
+            {
+                Slab* const next = slab->next;
+                mUpstream.Free( slab, SlabSize );
+                slab = next;
+            }
+        }
+
+        void* PoolAllocator::Allocate
+            (
+            size_t const aSize
+            )
+        {
+            size_t const sizeClass = GetClass( aSize );
+            if( sizeClass == NumClasses )
+            {
+                return mUpstream.Allocate( aSize );
+            }
+            else if( ( mFreeLists[sizeClass] == NULL ) && !AddSlab( sizeClass ) )
+            {
+                return NULL;
+            }
+
+            Chunk* const chunk = mFreeLists[sizeClass];
+            mFreeLists[sizeClass] = chunk->next;
+            return chunk;
+        }
+
+        void PoolAllocator::Free
+            (
+            void* const aPtr,
+            size_t const aSize
+            )
+        {
+            BFDP_RETURNIF( aPtr == NULL );
+
+            size_t const sizeClass = GetClass( aSize );
+            if( sizeClass == NumClasses )
+            {
+                mUpstream.Free( aPtr, aSize );
+                return;
+            }
+
+            Chunk* const chunk = static_cast< Chunk* >( aPtr );
+            chunk->next = mFreeLists[sizeClass];
+            mFreeLists[sizeClass] = chunk;
+        }
+
+        size_t PoolAllocator::GetBytesReserved() const
+        {
+            return mBytesReserved;
+        }
+
+        /* static */ size_t PoolAllocator::GetClass
+            (
+            size_t const aSize
+            )
+        {
+            size_t sizeClass = 0;
+            for( size_t classSize = MinClassSize; classSize < aSize; classSize <<= 1 )
+            {
+                if( ++sizeClass == NumClasses )
+                {
+                    break;
+                }
+            }
+            return sizeClass;
+        }
+
+        bool PoolAllocator::AddSlab
+            (
+            size_t const aClass
+            )
+        {
+            Slab* const slab = static_cast< Slab* >( mUpstream.Allocate( SlabSize ) );
+            BFDP_RETURNIF_V( slab == NULL, false );
+
+            slab->next = mSlabs;
+            mSlabs = slab;
+            mBytesReserved += SlabSize;
+
+            size_t const chunkSize = MinClassSize << aClass;
+            Byte* const begin = reinterpret_cast< Byte* >( slab ) + HeaderSize;
+            size_t const numChunks = ( SlabSize - HeaderSize ) / chunkSize;
+            for( size_t i = numChunks; i > 0; --i )
+            {
+                Chunk* const chunk = reinterpret_cast< Chunk* >( begin + ( ( i - 1 ) * chunkSize ) );
+                chunk->next = mFreeLists[aClass];
+                mFreeLists[aClass] = chunk;
+            }
+            return true;
+        }
+
+    } // namespace Data
+
+} // namespace Bfdp
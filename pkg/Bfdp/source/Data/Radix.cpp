@@ -33,7 +33,14 @@
 // Base Includes
 #include "Bfdp/Data/Radix.hpp"
 
+// External Includes
+#include <cstring>
+#if defined( _MSC_VER ) && defined( _M_X64 )
+    #include <intrin.h>
+#endif
+
 // Internal Includes
+#include "Bfdp/Compiler.hpp"
 #include "Bfdp/Macros.hpp"
 
 namespace Bfdp
@@ -42,6 +49,121 @@ namespace Bfdp
     namespace Data
     {
 
+        namespace RadixInternal
+        {
+
+            static uint64_t const SwarOnes = 0x0101010101010101ULL;
+            static uint64_t const SwarHighBits = 0x8080808080808080ULL;
+            static size_t const SwarDigits = sizeof( uint64_t );
+
+            //! Replace aValue with aValue * aMultiplier + aAddend
+            //!
+            //! @return false if the result overflows, true otherwise.
+            inline bool MulAdd
+                (
+                uint64_t& aValue,
+                uint64_t const aMultiplier,
+                uint64_t const aAddend
+                )
+            {
+            #if defined( __GNUC__ )
+                uint64_t product;
+                BFDP_RETURNIF_V( __builtin_mul_overflow( aValue, aMultiplier, &product ), false );
+                BFDP_RETURNIF_V( __builtin_add_overflow( product, aAddend, &aValue ), false );
+            #elif defined( _MSC_VER ) && defined( _M_X64 )
+                uint64_t productHigh;
+                uint64_t const product = _umul128( aValue, aMultiplier, &productHigh );
+                BFDP_RETURNIF_V( productHigh != 0U, false );
+                BFDP_RETURNIF_V( product > ( UINT64_MAX - aAddend ), false );
+                aValue = product + aAddend;
+            #else
+                BFDP_RETURNIF_V( ( aMultiplier != 0U ) && ( aValue > ( UINT64_MAX / aMultiplier ) ), false );
+                uint64_t const product = aValue * aMultiplier;
+                BFDP_RETURNIF_V( product > ( UINT64_MAX - aAddend ), false );
+                aValue = product + aAddend;
+            #endif
+                return true;
+            }
+
+            //! @pre No byte of aWord has the high bit set.
+            //! @return The high bit of each byte is set if that byte of aWord is within
+            //!     [aLow, aHigh], and all other bits are clear.
+            inline uint64_t BytesInRange
+                (
+                uint64_t const aWord,
+                uint8_t const aLow,
+                uint8_t const aHigh
+                )
+            {
+                uint64_t const atLeastLow = aWord + ( SwarOnes * ( 0x80U - aLow ) );
+                uint64_t const aboveHigh = aWord + ( SwarOnes * ( 0x7FU - aHigh ) );
+                return atLeastLow & ~aboveHigh & SwarHighBits;
+            }
+
+            //! Load 8 characters so that the first one is in the least significant byte
+            inline uint64_t LoadDigits
+                (
+                char const* const aDigits
+                )
+            {
+                uint64_t word;
+                std::memcpy( &word, aDigits, sizeof( word ) );
+                return word;
+            }
+
+            //! Convert 8 decimal digit characters at once
+            //!
+            //! @return Whether all characters are decimal digits
+            inline bool ConvertDecimalDigits
+                (
+                uint64_t const aWord,
+                uint64_t& aValue
+                )
+            {
+                BFDP_RETURNIF_V( ( aWord & SwarHighBits ) != 0U, false );
+                BFDP_RETURNIF_V( BytesInRange( aWord, '0', '9' ) != SwarHighBits, false );
+
+                // Combine adjacent digits, then pairs, then quads.  The first digit is the most
+                // significant, and is in the least significant byte.
+                uint64_t value = aWord & 0x0F0F0F0F0F0F0F0FULL;
+                value = ( value * ( ( 10U << 8 ) + 1U ) ) >> 8;
+                value = ( ( value & 0x00FF00FF00FF00FFULL ) * ( ( 100U << 16 ) + 1U ) ) >> 16;
+                value = ( ( value & 0x0000FFFF0000FFFFULL ) * ( ( 10000ULL << 32 ) + 1U ) ) >> 32;
+                aValue = value;
+                return true;
+            }
+
+            //! Convert 8 hexadecimal digit characters at once
+            //!
+            //! @return Whether all characters are hexadecimal digits
+            inline bool ConvertHexDigits
+                (
+                uint64_t const aWord,
+                uint64_t& aValue
+                )
+            {
+                BFDP_RETURNIF_V( ( aWord & SwarHighBits ) != 0U, false );
+
+                // Setting 0x20 maps 'A'-'F' to 'a'-'f'
+                uint64_t const letters = BytesInRange( aWord | ( SwarOnes * 0x20U ), 'a', 'f' );
+                uint64_t const digits = BytesInRange( aWord, '0', '9' );
+                BFDP_RETURNIF_V( ( letters | digits ) != SwarHighBits, false );
+
+                // Letters have a low nibble of 1-6
+                uint64_t value = ( aWord & 0x0F0F0F0F0F0F0F0FULL ) + ( ( letters >> 7 ) * 9U );
+
+                // Pack nibbles, most significant first
+                value = ( ( value << 4 ) | ( value >> 8 ) ) & 0x00FF00FF00FF00FFULL;
+                value = ( ( value << 8 ) | ( value >> 16 ) ) & 0x0000FFFF0000FFFFULL;
+                value = ( ( value << 16 ) | ( value >> 32 ) ) & 0x00000000FFFFFFFFULL;
+                aValue = value;
+                return true;
+            }
+
+        } // namespace RadixInternal
+
+        using namespace RadixInternal;
+
         bool ConvertBase
             (
             RadixType const aRadix,
@@ -105,6 +227,54 @@ namespace Bfdp
             return true;
         }
 
+        bool ConvertDigits
+            (
+            RadixType const aRadix,
+            char const* const aDigits,
+            size_t const aNumDigits,
+            uint64_t& aValue
+            )
+        {
+            BFDP_RETURNIF_V( !IsValidRadix( aRadix ), false );
+
+            aValue = 0U;
+            size_t i = 0;
+
+        #if( BFDP_HOST_ENDIAN_LE() )
+            // Common radices: convert 8 characters at a time.  If any character is not valid,
+            // stop and let the loop below find it.
+            uint64_t chunk;
+            if( aRadix == 10 )
+            {
+                while( ( ( aNumDigits - i ) >= SwarDigits ) &&
+                    ConvertDecimalDigits( LoadDigits( &aDigits[i] ), chunk ) )
+                {
+                    BFDP_RETURNIF_V( !MulAdd( aValue, 100000000U, chunk ), false );
+                    i += SwarDigits;
+                }
+            }
+            else if( aRadix == 16 )
+            {
+                while( ( ( aNumDigits - i ) >= SwarDigits ) &&
+                    ConvertHexDigits( LoadDigits( &aDigits[i] ), chunk ) )
+                {
+                    BFDP_RETURNIF_V( ( aValue >> 32 ) != 0U, false );
+                    aValue = ( aValue << 32 ) | chunk;
+                    i += SwarDigits;
+                }
+            }
+        #endif
+
+            for( ; i < aNumDigits; ++i )
+            {
+                uint8_t digit;
+                BFDP_RETURNIF_V( !ConvertBase( aRadix, aDigits[i], digit ), false );
+                BFDP_RETURNIF_V( !MulAdd( aValue, aRadix, digit ), false );
+            }
+
+            return true;
+        }
+
         size_t GetRadixBits
             (
             RadixType const aRadix
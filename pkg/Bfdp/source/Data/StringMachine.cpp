@@ -34,11 +34,11 @@
 #include "Bfdp/Data/StringMachine.hpp"
 
 // External Includes
-#include <ios>
+#include <cstring>
 
 // Internal Includes
 #include "Bfdp/Common.hpp"
-#include "Bfdp/Data/ByteBuffer.hpp"
+#include "Bfdp/Compiler.hpp"
 #include "Bfdp/ErrorReporter/Functions.hpp"
 #include "Bfdp/Unicode/Utf8Converter.hpp"
 
@@ -52,8 +52,54 @@ namespace Bfdp
 
         namespace StringMachineInternal
         {
-            static std::streampos const POS_BEGIN = std::streampos( 0 );
-        }
+
+            static char const HexDigits[] = "0123456789abcdef";
+
+            //! Size of the per-symbol conversion buffers; UTF8 symbols may take up to 6 bytes
+            static size_t const MaxSymbolBytes = 8;
+
+            //! Write two lowercase hex digits per input byte to aOut
+            //!
+            //! Four bytes are converted at a time: each byte is spread into its own 16-bit lane,
+            //! split into nibbles, and offset to '0' or 'a' without branching.
+            static void EncodeHex
+                (
+                Byte const* const aIn,
+                size_t const aSize,
+                char* const aOut
+                )
+            {
+                static uint64_t const LaneMask = 0x000F000F000F000FULL;
+                static uint64_t const ByteOnes = 0x0101010101010101ULL;
+
+                size_t i = 0;
+                if( BFDP_HOST_ENDIAN_LE() )
+                {
+                    for( ; ( i + 4 ) <= aSize; i += 4 )
+                    {
+                        uint32_t in32;
+                        std::memcpy( &in32, &aIn[i], sizeof( in32 ) );
+
+                        uint64_t x = in32;
+                        x = ( x | ( x << 16 ) ) & 0x0000FFFF0000FFFFULL;
+                        x = ( x | ( x << 8 ) ) & 0x00FF00FF00FF00FFULL;
+
+                        // High nibble first in memory, then the low nibble
+                        uint64_t const nibbles = ( ( x >> 4 ) & LaneMask ) | ( ( x & LaneMask ) << 8 );
+                        uint64_t const letters = ( ( nibbles + ( 0x76 * ByteOnes ) ) >> 7 ) & ByteOnes;
+                        uint64_t const out64 = nibbles + ( '0' * ByteOnes ) + ( letters * ( 'a' - '0' - 10 ) );
+                        std::memcpy( &aOut[i * 2], &out64, sizeof( out64 ) );
+                    }
+                }
+
+                for( ; i < aSize; ++i )
+                {
+                    aOut[i * 2] = HexDigits[aIn[i] >> 4];
+                    aOut[( i * 2 ) + 1] = HexDigits[aIn[i] & 0xF];
+                }
+            }
+
+        } // namespace StringMachineInternal
 
         using namespace StringMachineInternal;
 
@@ -69,17 +115,14 @@ namespace Bfdp
             )
         {
             Unicode::Utf8Converter utf8Converter;
-            ByteBuffer utf8Buffer;
-            if( !utf8Buffer.Allocate( utf8Converter.GetMaxBytes() ) )
-            {
-                BFDP_RUNTIME_ERROR( "Out of memory while converting bytes" );
-                return false;
-            }
+            Byte utf8Buffer[MaxSymbolBytes];
 
             Byte const* inPtr = reinterpret_cast< Byte const* >( aIn.c_str() );
             size_t inBytesLeft = aIn.length();
 
-            std::ostringstream oss;
+            // Convert into a local string so a failure leaves the value unchanged
+            std::string converted;
+            converted.reserve( aIn.length() );
             Unicode::CodePoint cp;
             while( inBytesLeft )
             {
@@ -93,15 +136,15 @@ namespace Bfdp
                 }
 
                 // Convert Unicode -> UTF8
-                bytesConverted = utf8Converter.ConvertSymbol( cp, utf8Buffer.GetPtr(), utf8Buffer.GetSize() );
+                bytesConverted = utf8Converter.ConvertSymbol( cp, utf8Buffer, sizeof( utf8Buffer ) );
                 if( 0 == bytesConverted )
                 {
                     return false;
                 }
-                oss << utf8Buffer.GetString( bytesConverted );
+                converted.append( reinterpret_cast< char const* >( utf8Buffer ), bytesConverted );
             }
 
-            AppendUtf8( oss.str() );
+            AppendUtf8( converted );
 
             return true;
         }
@@ -112,21 +155,17 @@ namespace Bfdp
             )
         {
             Unicode::Utf8Converter utf8Converter;
-            ByteBuffer utf8Buffer;
-            if( !utf8Buffer.Allocate( utf8Converter.GetMaxBytes() ) )
-            {
-                BFDP_RUNTIME_ERROR( "Out of memory while converting bytes" );
-                return false;
-            }
+            Byte utf8Buffer[MaxSymbolBytes];
 
             // Convert Unicode -> output format
-            size_t bytesConverted = utf8Converter.ConvertSymbol( aCodePoint, utf8Buffer.GetPtr(), utf8Buffer.GetSize() );
+            size_t bytesConverted = utf8Converter.ConvertSymbol( aCodePoint, utf8Buffer, sizeof( utf8Buffer ) );
             if( 0 == bytesConverted )
             {
                 return false;
             }
 
-            AppendUtf8( utf8Buffer.GetString( bytesConverted ) );
+            mValue.append( reinterpret_cast< char const* >( utf8Buffer ), bytesConverted );
+            SetDefined();
 
             return true;
         }
@@ -136,7 +175,7 @@ namespace Bfdp
             std::string const& aValue
             )
         {
-            mBuffer << aValue;
+            mValue += aValue;
             SetDefined();
         }
 
@@ -147,21 +186,18 @@ namespace Bfdp
             ) const
         {
             Unicode::Utf8Converter utf8Converter;
-            ByteBuffer utf8Buffer;
-            ByteBuffer outBuffer;
-            if( ( !utf8Buffer.Allocate( utf8Converter.GetMaxBytes() ) ) ||
-                ( !outBuffer.Allocate( aConverter.GetMaxBytes() ) ) )
+            Byte outBuffer[MaxSymbolBytes];
+            if( aConverter.GetMaxBytes() > sizeof( outBuffer ) )
             {
-                BFDP_RUNTIME_ERROR( "Out of memory while converting bytes" );
+                BFDP_MISUSE_ERROR( "Converter exceeds maximum bytes per symbol" );
                 return false;
             }
 
-            Pack();
-
-            Byte const* inPtr = reinterpret_cast< Byte const* >( mCache.c_str() );
-            size_t inBytesLeft = mCache.length();
+            Byte const* inPtr = reinterpret_cast< Byte const* >( mValue.c_str() );
+            size_t inBytesLeft = mValue.length();
 
-            std::ostringstream oss;
+            std::string out;
+            out.reserve( mValue.length() );
             Unicode::CodePoint cp;
             while( inBytesLeft )
             {
@@ -175,15 +211,15 @@ namespace Bfdp
                 }
 
                 // Convert Unicode -> output format
-                bytesConverted = aConverter.ConvertSymbol( cp, outBuffer.GetPtr(), outBuffer.GetSize() );
+                bytesConverted = aConverter.ConvertSymbol( cp, outBuffer, sizeof( outBuffer ) );
                 if( 0 == bytesConverted )
                 {
                     return false;
                 }
-                oss << outBuffer.GetString( bytesConverted );
+                out.append( reinterpret_cast< char const* >( outBuffer ), bytesConverted );
             }
 
-            aOut = oss.str();
+            aOut.swap( out );
             return true;
         }
 
@@ -193,28 +229,39 @@ namespace Bfdp
             std::string const& aPrefix
             ) const
         {
-            std::ostringstream oss;
-            char digit[3];
-            std::string sep;
+            size_t const numBytes = mValue.length();
+            std::string hex( numBytes * 2, '\0' );
+            if( numBytes > 0 )
+            {
+                EncodeHex( reinterpret_cast< Byte const* >( mValue.data() ), numBytes, &hex[0] );
+            }
 
-            Pack();
-            digit[2] = '\0';
-            for( std::string::const_iterator iter = mCache.begin(); iter != mCache.end(); ++iter )
+            if( aSeparator.empty() && aPrefix.empty() )
             {
-                char c = *iter;
-                digit[0] = GetHex( ( c >> 4 ) & 0xF );
-                digit[1] = GetHex( c & 0xF );
-                oss << sep << aPrefix << digit;
-                sep = aSeparator;
+                return hex;
             }
 
-            return oss.str();
+            std::string out;
+            if( numBytes > 0 )
+            {
+                out.reserve( ( numBytes * ( 2 + aPrefix.length() ) ) + ( ( numBytes - 1 ) * aSeparator.length() ) );
+            }
+            for( size_t i = 0; i < numBytes; ++i )
+            {
+                if( i > 0 )
+                {
+                    out += aSeparator;
+                }
+                out += aPrefix;
+                out.append( &hex[i * 2], 2 );
+            }
+
+            return out;
         }
 
         std::string const& StringMachine::GetUtf8String() const
         {
-            Pack();
-            return mCache;
+            return mValue;
         }
 
         bool StringMachine::IsDefined() const
@@ -224,14 +271,13 @@ namespace Bfdp
 
         bool StringMachine::IsEmpty() const
         {
-            return mCache.empty() && ( mBuffer.tellp() == POS_BEGIN );
+            return mValue.empty();
         }
 
         void StringMachine::Reset()
         {
             mDefined = false;
-            mCache.clear();
-            mBuffer.str() = std::string();
+            mValue.clear();
         }
 
         void StringMachine::SetDefined()
@@ -239,32 +285,6 @@ namespace Bfdp
             mDefined = true;
         }
 
-        char StringMachine::GetHex
-            (
-            char const aNibble
-            ) const
-        {
-            if( IsWithinRange< char >( 0, aNibble, 9 ) )
-            {
-                return aNibble + '0';
-            }
-            else if( IsWithinRange< char >( 10, aNibble, 16 ) )
-            {
-                return aNibble - 10 + 'a';
-            }
-            return '?';
-        }
-
-        void StringMachine::Pack() const
-        {
-            if( mBuffer.tellp() != POS_BEGIN )
-            {
-                mCache = mCache + mBuffer.str();
-                mBuffer.clear();
-                mBuffer.str( "" );
-            }
-        }
-
     } // namespace Data
 
 } // namespace Bfdp
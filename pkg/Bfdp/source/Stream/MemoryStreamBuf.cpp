@@ -0,0 +1,90 @@
+/**
+    BFDP Stream Memory Stream Buffer Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base includes
+#include "Bfdp/Stream/MemoryStreamBuf.hpp"
+
+namespace Bfdp
+{
+
+    namespace Stream
+    {
+
+        MemoryStreamBuf::MemoryStreamBuf
+            (
+            Byte const* const aData,
+            size_t const aSize
+            )
+        {
+            // The get area is never written through
+            char* const begin = const_cast< char* >( reinterpret_cast< char const* >( aData ) );
+            setg( begin, begin, begin + aSize );
+        }
+
+        MemoryStreamBuf::pos_type MemoryStreamBuf::seekoff
+            (
+            off_type aOffset,
+            std::ios_base::seekdir aDir,
+            std::ios_base::openmode aMode
+            )
+        {
+            off_type base = 0;
+            if( aDir == std::ios_base::cur )
+            {
+                base = gptr() - eback();
+            }
+            else if( aDir == std::ios_base::end )
+            {
+                base = egptr() - eback();
+            }
+
+            off_type const pos = base + aOffset;
+            if( ( ( aMode & std::ios_base::in ) == 0 ) || ( pos < 0 ) || ( pos > ( egptr() - eback() ) ) )
+            {
+                return pos_type( off_type( -1 ) );
+            }
+            setg( eback(), eback() + pos, egptr() );
+            return pos_type( pos );
+        }
+
+        MemoryStreamBuf::pos_type MemoryStreamBuf::seekpos
+            (
+            pos_type aPos,
+            std::ios_base::openmode aMode
+            )
+        {
+            return seekoff( off_type( aPos ), std::ios_base::beg, aMode );
+        }
+
+    } // namespace Stream
+
+} // namespace Bfdp
@@ -0,0 +1,273 @@
+/**
+    BFDP Stream Record Index Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base includes
+#include "Bfdp/Stream/RecordIndex.hpp"
+
+// External Includes
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+// Internal Includes
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/ErrorReporter/Functions.hpp"
+
+#define BFDP_MODULE "Bfdp::Stream"
+
+namespace Bfdp
+{
+
+    namespace Stream
+    {
+
+        namespace RecordIndexInternal
+        {
+
+            static char const* const FileMagic = "BFDP-RECORD-INDEX 1";
+
+            //! Read a "<aName> <value>" line
+            //!
+            //! @return true if successful, false otherwise.
+            static bool ReadValue
+                (
+                std::istream& aIn,
+                char const* const aName,
+                uint64_t& aOut
+                )
+            {
+                std::string line;
+                BFDP_RETURNIF_V( !std::getline( aIn, line ), false );
+
+                std::istringstream ss( line );
+                std::string name;
+                char extra;
+                return ( ss >> name >> aOut ) && ( name == aName ) && !( ss >> extra );
+            }
+
+        } // namespace RecordIndexInternal
+
+        using namespace RecordIndexInternal;
+
+        RecordIndex::RecordIndex()
+            : mComplete( false )
+            , mDataBytes( 0U )
+            , mInterval( DefaultInterval )
+            , mKey( 0U )
+            , mNumOffsets( 0U )
+            , mNumRecords( 0U )
+        {
+        }
+
+        bool RecordIndex::Add
+            (
+            uint64_t const aRecord,
+            uint64_t const aPosBits
+            )
+        {
+            BFDP_RETURNIF_V( mComplete || ( aRecord != mNumOffsets * mInterval ), false );
+            BFDP_RETURNIF_V( ( mNumOffsets > 0 ) && ( aPosBits < GetOffsets()[mNumOffsets - 1] ), false );
+
+            size_t const capacity = mOffsets.GetSize() / sizeof( uint64_t );
+            if( mNumOffsets == capacity )
+            {
+                // Grow geometrically to amortize adding one offset at a time
+                Data::ByteBuffer newOffsets;
+                BFDP_RETURNIF_V( !newOffsets.Allocate( std::max< size_t >( 2 * capacity, 16U ) * sizeof( uint64_t ) ), false );
+                if( mNumOffsets > 0 )
+                {
+                    std::memcpy( newOffsets.GetPtr(), mOffsets.GetConstPtr(), mNumOffsets * sizeof( uint64_t ) );
+                }
+                mOffsets.Swap( newOffsets );
+            }
+
+            mOffsets.GetPtrT< uint64_t >()[mNumOffsets++] = aPosBits;
+            return true;
+        }
+
+        void RecordIndex::Complete
+            (
+            uint64_t const aNumRecords
+            )
+        {
+            mNumRecords = aNumRecords;
+            mComplete = true;
+        }
+
+        bool RecordIndex::Find
+            (
+            uint64_t const aRecord,
+            uint64_t& aOutRecord,
+            uint64_t& aOutPosBits
+            ) const
+        {
+            BFDP_RETURNIF_V( mNumOffsets == 0, false );
+
+            size_t const i = static_cast< size_t >( std::min< uint64_t >( aRecord / mInterval, mNumOffsets - 1 ) );
+            aOutRecord = i * mInterval;
+            aOutPosBits = GetOffsets()[i];
+            return true;
+        }
+
+        uint64_t RecordIndex::GetDataBytes() const
+        {
+            return mDataBytes;
+        }
+
+        uint64_t RecordIndex::GetInterval() const
+        {
+            return mInterval;
+        }
+
+        uint64_t RecordIndex::GetKey() const
+        {
+            return mKey;
+        }
+
+        uint64_t RecordIndex::GetNumRecords() const
+        {
+            return mNumRecords;
+        }
+
+        bool RecordIndex::IsComplete() const
+        {
+            return mComplete;
+        }
+
+        bool RecordIndex::IsMatch
+            (
+            uint64_t const aDataBytes,
+            uint64_t const aKey
+            ) const
+        {
+            return mComplete && ( mDataBytes == aDataBytes ) && ( mKey == aKey );
+        }
+
+        bool RecordIndex::Load
+            (
+            std::string const& aFileName
+            )
+        {
+            Reset( DefaultInterval, 0U, 0U );
+
+            std::ifstream in( aFileName.c_str() );
+            BFDP_RETURNIF_V( !in, false );
+
+            std::string line;
+            uint64_t interval = 0;
+            uint64_t dataBytes = 0;
+            uint64_t key = 0;
+            uint64_t numRecords = 0;
+            bool ok = std::getline( in, line ) && ( line == FileMagic ) &&
+                ReadValue( in, "interval", interval ) &&
+                ReadValue( in, "data-bytes", dataBytes ) &&
+                ReadValue( in, "key", key ) &&
+                ReadValue( in, "records", numRecords ) &&
+                ( interval != 0 );
+            if( !ok )
+            {
+                BFDP_RUNTIME_ERROR( "Invalid record index header" );
+                return false;
+            }
+
+            Reset( interval, dataBytes, key );
+            uint64_t posBits;
+            while( in >> posBits )
+            {
+                if( !Add( mNumOffsets * mInterval, posBits ) )
+                {
+                    BFDP_RUNTIME_ERROR( "Invalid record index entry" );
+                    Reset( DefaultInterval, 0U, 0U );
+                    return false;
+                }
+            }
+
+            // Every interval up to the end of the last record must be indexed
+            if( !in.eof() || ( mNumOffsets != ( numRecords / mInterval ) + 1 ) )
+            {
+                BFDP_RUNTIME_ERROR( "Invalid record index entries" );
+                Reset( DefaultInterval, 0U, 0U );
+                return false;
+            }
+
+            Complete( numRecords );
+            return true;
+        }
+
+        void RecordIndex::Reset
+            (
+            uint64_t const aInterval,
+            uint64_t const aDataBytes,
+            uint64_t const aKey
+            )
+        {
+            mComplete = false;
+            mDataBytes = aDataBytes;
+            mInterval = std::max< uint64_t >( aInterval, 1U );
+            mKey = aKey;
+            mNumRecords = 0;
+            // Keep the memory of the offsets for the next index
+            mNumOffsets = 0;
+        }
+
+        bool RecordIndex::Save
+            (
+            std::string const& aFileName
+            ) const
+        {
+            BFDP_RETURNIF_VE( !mComplete, false, "Cannot save an incomplete record index" );
+
+            std::ofstream out( aFileName.c_str(), std::ios::out | std::ios::trunc );
+            BFDP_RETURNIF_V( !out, false );
+
+            out << FileMagic << "\n"
+                << "interval " << mInterval << "\n"
+                << "data-bytes " << mDataBytes << "\n"
+                << "key " << mKey << "\n"
+                << "records " << mNumRecords << "\n";
+            for( size_t i = 0; i < mNumOffsets; ++i )
+            {
+                out << GetOffsets()[i] << "\n";
+            }
+            out.flush();
+            return !out.fail();
+        }
+
+        uint64_t const* RecordIndex::GetOffsets() const
+        {
+            return mOffsets.GetConstPtrT< uint64_t >();
+        }
+
+    } // namespace Stream
+
+} // namespace Bfdp
@@ -40,6 +40,7 @@
 // Internal Includes
 #include "Bfdp/BitManip/Conversion.hpp"
 #include "Bfdp/BitManip/GenericBitStream.hpp"
+#include "Bfdp/Data/BufferPool.hpp"
 #include "Bfdp/ErrorReporter/Functions.hpp"
 
 #define BFDP_MODULE "Bfdp::Stream"
@@ -113,7 +114,8 @@ namespace Bfdp
             Control::Type control = Control::Continue;
             while( bitstream.GetBitsTillEnd() )
             {
-                // TODO: Make GenericBitStream work for read-only operations while const
+                // Observers inspect data through GenericBitStream::GetView(); the stream itself
+                // stays mutable so the observer can report progress by seeking.
                 control = mObserver.OnStreamData( bitstream );
                 mLastControlCode = control;
 
@@ -170,12 +172,12 @@ namespace Bfdp
             }
 
             // Before the next read, free up space in the buffer by moving
-            // existing data to the beginning.  This assumes in-place memcpy
-            // works from lowest address to highest for efficiency over
-            // supporting insane STL's.
+            // existing data to the beginning, and rebase the bit position to
+            // match.
             if( mBufferDataOffset != 0 )
             {
-                std::memcpy( mBuffer.GetDataPtr(), mBuffer.GetDataPtr() + numProcessedBytes, mBufferDataSizeBytes );
+                std::memmove( mBuffer.GetDataPtr(), mBuffer.GetDataPtr() + mBufferDataOffset, mBufferDataSizeBytes );
+                mBufferPositionBits -= BitManip::BytesToBits( mBufferDataOffset );
                 mBufferDataOffset = 0;
             }
 
@@ -216,6 +218,12 @@ namespace Bfdp
                 return false;
             }
             mBufferDataSizeBytes += readSize;
+            if( ( mSkipBits != 0 ) && ( mBufferDataSizeBytes > 0 ) )
+            {
+                // Begin within the first byte read after a seek
+                mBufferPositionBits = mSkipBits;
+                mSkipBits = 0;
+            }
 
             // If the read went past the end of the input stream, readSize
             // will probably be zero; but the eofbit wll be set in istream and
@@ -251,6 +259,29 @@ namespace Bfdp
             return true;
         }
 
+        bool StreamBase::Seek
+            (
+            uint64_t const aPosBits
+            )
+        {
+            if( ( mBufferDataSizeBytes != 0 ) || ( mTotalProcessedBytes != 0 ) || ( mTotalProcessedBits != 0 ) )
+            {
+                BFDP_INTERNAL_ERROR( "Stream seek after read" );
+                return false;
+            }
+
+            mIn.seekg( static_cast< std::streamoff >( aPosBits / BitManip::BitsPerByte ), std::ios::beg );
+            if( !mIn )
+            {
+                // Not seekable (e.g., a pipe); leave the stream where it was
+                mIn.clear();
+                return false;
+            }
+
+            mSkipBits = static_cast< size_t >( aPosBits % BitManip::BitsPerByte );
+            return true;
+        }
+
         bool StreamBase::IsValid() const
         {
             return IsValidImpl();
@@ -262,7 +293,7 @@ namespace Bfdp
             std::istream& aIn,
             IStreamObserver& aObserver
             )
-            : mBuffer()
+            : mBuffer( 0U, Data::BufferPool::GetShared() )
             , mBufferDataOffset( 0U )
             , mBufferDataSizeBytes( 0U )
             , mBufferPositionBits( 0U )
@@ -272,6 +303,7 @@ namespace Bfdp
             , mLastControlCode( Control::Continue )
             , mName( aName )
             , mObserver( aObserver )
+            , mSkipBits( 0U )
             , mTotalProcessedBytes( 0U )
             , mTotalProcessedBits( 0U )
         {
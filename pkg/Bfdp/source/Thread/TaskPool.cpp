@@ -0,0 +1,173 @@
+/**
+    BFDP Thread Task Pool Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "Bfdp/Thread/TaskPool.hpp"
+
+namespace Bfdp
+{
+
+    namespace Thread
+    {
+
+        /* static */ size_t TaskPool::GetDefaultNumThreads()
+        {
+            unsigned int const numThreads = std::thread::hardware_concurrency();
+            return ( numThreads == 0 ) ? 1U : numThreads;
+        }
+
+        TaskPool::TaskPool
+            (
+            size_t const aNumThreads
+            )
+            : mStopping( false )
+        {
+            for( size_t i = 0; i < aNumThreads; ++i )
+            {
+                mWorkers.push_back( std::thread( &TaskPool::WorkerMain, this ) );
+            }
+        }
+
+        TaskPool::~TaskPool()
+        {
+            {
+                std::lock_guard< std::mutex > lock( mQueueMutex );
+                mStopping = true;
+            }
+            mQueueSignal.notify_all();
+            for( WorkerList::iterator iter = mWorkers.begin(); iter != mWorkers.end(); ++iter )
+            {
+                iter->join();
+            }
+
+            // Without workers, tasks nobody waited for are still run
+            while( !mQueue.empty() )
+            {
+                Run( *mQueue.front() );
+                mQueue.pop_front();
+            }
+        }
+
+        size_t TaskPool::GetNumThreads() const
+        {
+            return mWorkers.size();
+        }
+
+        TaskPool::TaskPtr TaskPool::Submit
+            (
+            Work const& aWork
+            )
+        {
+            TaskPtr task = std::make_shared< Task >( aWork );
+            {
+                std::lock_guard< std::mutex > lock( mQueueMutex );
+                mQueue.push_back( task );
+            }
+            mQueueSignal.notify_one();
+            return task;
+        }
+
+        void TaskPool::Wait
+            (
+            TaskPtr const& aTask
+            )
+        {
+            Run( *aTask );
+
+            std::unique_lock< std::mutex > lock( aTask->mDoneMutex );
+            while( !aTask->mDone )
+            {
+                aTask->mDoneSignal.wait( lock );
+            }
+        }
+
+        /* static */ void TaskPool::Run
+            (
+            Task& aTask
+            )
+        {
+            if( aTask.mClaimed.exchange( true ) )
+            {
+                // Already running, or done
+                return;
+            }
+
+            aTask.mWork();
+            {
+                std::lock_guard< std::mutex > lock( aTask.mDoneMutex );
+                aTask.mDone = true;
+            }
+            aTask.mDoneSignal.notify_all();
+        }
+
+        void TaskPool::WorkerMain()
+        {
+            for( ;; )
+            {
+                TaskPtr task;
+                {
+                    std::unique_lock< std::mutex > lock( mQueueMutex );
+                    while( !mStopping && mQueue.empty() )
+                    {
+                        mQueueSignal.wait( lock );
+                    }
+                    if( mQueue.empty() )
+                    {
+                        // Stopping, and no work is left
+                        return;
+                    }
+                    task = mQueue.front();
+                    mQueue.pop_front();
+                }
+                Run( *task );
+            }
+        }
+
+        TaskPool::Task::Task
+            (
+            Work const& aWork
+            )
+            : mWork( aWork )
+            , mClaimed( false )
+            , mDone( false )
+        {
+        }
+
+        bool TaskPool::Task::IsDone()
+        {
+            std::lock_guard< std::mutex > lock( mDoneMutex );
+            return mDone;
+        }
+
+    } // namespace Thread
+
+} // namespace Bfdp
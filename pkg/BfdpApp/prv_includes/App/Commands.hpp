@@ -37,6 +37,8 @@
 #include "App/Context.hpp"
 
 #define APP_NAME "bfdp"
+#define APP_CMD_ENCODE_NAME "encode"
+#define APP_CMD_ENCODE_DESC "Encode field values into a data stream"
 #define APP_CMD_PARSE_NAME "parse"
 #define APP_CMD_PARSE_DESC "Parse a data stream"
 #define APP_CMD_VALIDATE_SPEC_NAME "validate-spec"
@@ -45,6 +47,13 @@
 namespace App
 {
 
+    int CmdEncode
+        (
+        Context& aContext,
+        int const aArgC,
+        char const* const* const aArgV
+        );
+
     int CmdParse
         (
         Context& aContext,
@@ -37,12 +37,28 @@
 #include <string>
 
 #include "Bfdp/Console/ArgParser.hpp"
+#include "BfsdlParser/Objects/Tree.hpp"
 
 namespace App
 {
 
     typedef std::map< std::string, std::string > SavedParamMap;
 
+    //! Load a BFSDL spec file into aRoot
+    //!
+    //! Regular files are mapped and parsed in place; anything else (e.g., a pipe) is streamed.
+    //!
+    //! @param[out] aResult 0 if the spec is loaded, nonzero otherwise (valid if opened)
+    //! @param[out] aKey Hash of the spec if the file is mapped, 0 if it is streamed
+    //! @return Whether the file could be opened
+    bool LoadSpec
+        (
+        BfsdlParser::Objects::TreePtr const aRoot,
+        std::string const& aFileName,
+        int& aResult,
+        uint64_t& aKey
+        );
+
     //! Helper function to save parameters to a SavedParamMap (passed in userdata)
     //!
     //! @return Success
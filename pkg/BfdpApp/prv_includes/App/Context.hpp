@@ -77,6 +77,9 @@ namespace App
             LogLevel::Type const aMinLevel = LogLevel::Problem
             );
 
+        //! Stop logging anything, including problems
+        void Silence();
+
     private:
         int mLogLevel;
     };
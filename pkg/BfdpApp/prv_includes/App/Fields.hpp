@@ -0,0 +1,118 @@
+/**
+    BFDP Console Application Field Helpers
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef App_Fields
+#define App_Fields
+
+#include <map>
+#include <vector>
+
+#include "Bfdp/BitManip/Endian.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/Unicode/CodingMap.hpp"
+#include "Bfdp/Unicode/IConverter.hpp"
+#include "BfsdlParser/Objects/ArrayField.hpp"
+#include "BfsdlParser/Objects/Common.hpp"
+#include "BfsdlParser/Objects/Field.hpp"
+#include "BfsdlParser/Objects/Tree.hpp"
+
+namespace App
+{
+
+    //! Room for any single encoded symbol; Utf8Converter::GetMaxBytes() exceeds
+    //! Unicode::MaxBytesForConversion
+    static size_t BFDP_CONSTEXPR MaxSymbolBytes = 8U;
+
+    //! Deepest nesting of class fields that can be decoded or encoded
+    static size_t BFDP_CONSTEXPR MaxFrameDepth = 16U;
+
+    //! A string coding, ready to decode or encode with
+    struct Codec
+    {
+        Bfdp::Unicode::IConverterPtr converter;
+
+        //! Whether printable ASCII bytes decode and encode to themselves
+        bool asciiCompatible;
+    };
+    typedef std::map< Bfdp::Unicode::CodingId, Codec > CodecMap;
+
+    typedef std::vector< BfsdlParser::Objects::FieldPtr > FieldList;
+
+    //! Values of fields that determine how later fields are decoded or encoded
+    typedef std::map< BfsdlParser::Objects::Field const*, uint64_t > FieldValueMap;
+
+    //! Append aField to the FieldList at aArg; for use with Tree::IterateFields()
+    void AddFieldToList
+        (
+        BfsdlParser::Objects::FieldPtr& aField,
+        void* const aArg
+        );
+
+    //! Get the codec for a coding from aCodecs, setting it up on first use
+    //!
+    //! @return The codec, or NULL if the coding is not supported.
+    Codec const* FindCodec
+        (
+        CodecMap& aCodecs,
+        Bfdp::Unicode::CodingId const aCodingId
+        );
+
+    //! @return The number of elements in an array, given the field values so far
+    BfsdlParser::Objects::ArraySizeType GetArraySize
+        (
+        FieldValueMap const& aValues,
+        BfsdlParser::Objects::ArrayField const& aField
+        );
+
+    //! @return The last value of a field that determines how later fields are decoded or
+    //!     encoded, or 0 if none.
+    uint64_t GetFieldValue
+        (
+        FieldValueMap const& aValues,
+        BfsdlParser::Objects::Field const& aField
+        );
+
+    //! @return The class of the records held by aField, or NULL if aField does not hold
+    //!     nested records.
+    BfsdlParser::Objects::Tree const* GetRecordClass
+        (
+        BfsdlParser::Objects::Field const& aField
+        );
+
+    Bfdp::BitManip::Endianness::Type ToBitManipEndianness
+        (
+        BfsdlParser::Objects::Endianness::Type const aEndianness
+        );
+
+} // namespace App
+
+#endif // App_Fields
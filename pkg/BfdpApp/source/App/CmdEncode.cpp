@@ -0,0 +1,989 @@
+/**
+    BFDP Encode Command Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#define BFDP_MODULE "App::CmdEncode"
+
+// Base Includes
+#include "App/Commands.hpp"
+
+// External Includes
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+// Internal Includes
+#include "App/Common.hpp"
+#include "App/Fields.hpp"
+#include "Bfdp/BitManip/BitWriter.hpp"
+#include "Bfdp/BitManip/Conversion.hpp"
+#include "Bfdp/Data/Ieee754.hpp"
+#include "Bfdp/Data/Radix.hpp"
+#include "Bfdp/ErrorReporter/Functions.hpp"
+#include "Bfdp/Unicode/CodingMap.hpp"
+#include "Bfdp/Unicode/Common.hpp"
+#include "Bfdp/Unicode/Utf8Converter.hpp"
+#include "BfsdlParser/Objects/ArrayField.hpp"
+#include "BfsdlParser/Objects/ClassField.hpp"
+#include "BfsdlParser/Objects/Database.hpp"
+#include "BfsdlParser/Objects/FloatField.hpp"
+#include "BfsdlParser/Objects/FStringField.hpp"
+#include "BfsdlParser/Objects/IObject.hpp"
+#include "BfsdlParser/Objects/NumericField.hpp"
+#include "BfsdlParser/Objects/PStringField.hpp"
+#include "BfsdlParser/Objects/Property.hpp"
+#include "BfsdlParser/Objects/StringField.hpp"
+#include "BfsdlParser/Objects/Tree.hpp"
+#include "BfsdlParser/Objects/UnionField.hpp"
+#include "BfsdlParser/StreamParser.hpp"
+
+namespace App
+{
+
+    using Bfdp::BitManip::BitWriter;
+    using Bfdp::Console::ArgParser;
+    using Bfdp::Console::Msg;
+    using Bfdp::Console::Param;
+    using BfsdlParser::Objects::ArrayField;
+    using BfsdlParser::Objects::ArraySizeType;
+    using BfsdlParser::Objects::ClassField;
+    using BfsdlParser::Objects::Database;
+    using BfsdlParser::Objects::DatabasePtr;
+    using BfsdlParser::Objects::Endianness;
+    using BfsdlParser::Objects::Field;
+    using BfsdlParser::Objects::FieldPtr;
+    using BfsdlParser::Objects::FieldType;
+    using BfsdlParser::Objects::FloatField;
+    using BfsdlParser::Objects::FloatFormat;
+    using BfsdlParser::Objects::FStringField;
+    using BfsdlParser::Objects::NumericField;
+    using BfsdlParser::Objects::NumericFieldProperties;
+    using BfsdlParser::Objects::Property;
+    using BfsdlParser::Objects::PropertyPtr;
+    using BfsdlParser::Objects::PStringField;
+    using BfsdlParser::Objects::StringField;
+    using BfsdlParser::Objects::StringLengthType;
+    using BfsdlParser::Objects::Tree;
+    using BfsdlParser::Objects::UnionField;
+
+    namespace CmdEncodeInternal
+    {
+
+        //! Widest numeric field that can be encoded
+        static size_t BFDP_CONSTEXPR MaxNumericBits = 64U;
+
+        //! @return Whether aChar is whitespace that may surround an array element
+        static inline bool IsBlank
+            (
+            char const aChar
+            )
+        {
+            return ( aChar == ' ' ) || ( aChar == '\t' ) || ( aChar == '\r' );
+        }
+
+        //! Parse a decimal integer, which may be negative if aSigned
+        //!
+        //! @return true if successful, false if the text is not an integer in range of aNumBits.
+        static bool ParseInteger
+            (
+            char const* const aBegin,
+            char const* const aEnd,
+            bool const aSigned,
+            size_t const aNumBits,
+            uint64_t& aOut
+            )
+        {
+            bool const negative = ( aBegin != aEnd ) && ( *aBegin == '-' );
+            char const* const digits = negative ? aBegin + 1 : aBegin;
+            uint64_t magnitude = 0;
+            BFDP_RETURNIF_V( ( digits == aEnd ) || ( negative && !aSigned ), false );
+            BFDP_RETURNIF_V( !Bfdp::Data::ConvertDigits( 10, digits, static_cast< size_t >( aEnd - digits ), magnitude ), false );
+
+            // Unsigned values must fit in aNumBits; signed values in aNumBits - 1, or exactly
+            // reach the most negative value.
+            size_t const valueBits = aSigned ? aNumBits - 1U : aNumBits;
+            uint64_t const limit = ( valueBits >= MaxNumericBits )
+                ? std::numeric_limits< uint64_t >::max()
+                : ( ( static_cast< uint64_t >( 1U ) << valueBits ) - ( negative ? 0U : 1U ) );
+            BFDP_RETURNIF_V( magnitude > limit, false );
+
+            aOut = negative ? ( 0U - magnitude ) : magnitude;
+            return true;
+        }
+
+    } // namespace CmdEncodeInternal
+
+    using namespace CmdEncodeInternal;
+
+    //! Encodes text in the form printed by the parse command back into binary data
+    //!
+    //! Each line is one field, "name=value", named within its records as the parse command
+    //! names it.  Fields are expected in the order of the specification, and the values of
+    //! fields that give the length of an array or select the case of a union are tracked as
+    //! they are encoded.
+    class FieldEncoder
+    {
+    public:
+        FieldEncoder
+            (
+            Context& aContext,
+            std::istream& aIn,
+            BitWriter& aOut
+            )
+            : mAtEnd( false )
+            , mByteOrder( Endianness::Default )
+            , mContext( aContext )
+            , mHaveLine( false )
+            , mIn( aIn )
+            , mLineNumber( 0 )
+            , mOut( aOut )
+            , mValuePos( 0 )
+        {
+        }
+
+        //! Encode records until the end of the input
+        //!
+        //! The input may end between any two fields of the last record.
+        //!
+        //! @return true if successful, false otherwise.
+        bool EncodeRecords
+            (
+            Tree const& aRoot
+            )
+        {
+            while( ReadLine() )
+            {
+                size_t const lineNumber = mLineNumber;
+                if( !EncodeTree( aRoot ) )
+                {
+                    // The last record may be cut short, as the parse command prints it when the
+                    // data ends within a record
+                    return mAtEnd && !mIn.bad();
+                }
+                if( mLineNumber == lineNumber )
+                {
+                    // Most likely cause is that the spec did not define any fields.
+                    // Stop with an error to avoid an infinite loop.
+                    mContext.Log( stderr, Msg( "No fields to encode" ), Context::LogLevel::Problem );
+                    return false;
+                }
+            }
+            return !mIn.bad();
+        }
+
+        //! Set the default byte order, which orders the halves of binary128 values
+        void SetByteOrder
+            (
+            Endianness::Type const aByteOrder
+            )
+        {
+            mByteOrder = aByteOrder;
+        }
+
+        //! Set the root of the fields, and find the fields whose values must be tracked
+        //!
+        //! @return true if successful, false otherwise.
+        bool SetRoot
+            (
+            Tree const& aRoot
+            )
+        {
+            mFieldLists.clear();
+            mFieldValues.clear();
+            return AddTree( aRoot, 0 );
+        }
+
+    private:
+        typedef std::map< Tree const*, FieldList > FieldListMap;
+
+        //! List the fields of aTree and the classes nested within it
+        //!
+        //! @return true if successful, false otherwise.
+        bool AddTree
+            (
+            Tree const& aTree,
+            size_t const aDepth
+            )
+        {
+            if( mFieldLists.find( &aTree ) != mFieldLists.end() )
+            {
+                return true;
+            }
+
+            // The fields of a tree are only iterated here; encoding does not change them
+            FieldList& fields = mFieldLists[&aTree];
+            const_cast< Tree& >( aTree ).IterateFields( &AddFieldToList, &fields );
+            for( size_t i = 0; i < fields.size(); ++i )
+            {
+                Field const& field = *fields[i];
+                if( field.GetFieldType() == FieldType::Array )
+                {
+                    ArrayField const& arrayField = static_cast< ArrayField const& >( field );
+                    if( arrayField.GetCountField() )
+                    {
+                        mFieldValues[arrayField.GetCountField().get()] = 0U;
+                    }
+                }
+
+                Tree const* recordClass = GetRecordClass( field );
+                if( field.GetFieldType() == FieldType::Union )
+                {
+                    UnionField const& unionField = static_cast< UnionField const& >( field );
+                    mFieldValues[unionField.GetTagField().get()] = 0U;
+                    for( size_t c = 0; c < unionField.GetNumCases(); ++c )
+                    {
+                        BFDP_RETURNIF_V( !AddNestedTree( field, *unionField.GetCaseClass( c ), aDepth ), false );
+                    }
+                }
+                else if( recordClass != NULL )
+                {
+                    BFDP_RETURNIF_V( !AddNestedTree( field, *recordClass, aDepth ), false );
+                }
+            }
+            return true;
+        }
+
+        //! List the fields of the class of aField's records
+        //!
+        //! @return true if successful, false otherwise.
+        bool AddNestedTree
+            (
+            Field const& aField,
+            Tree const& aClass,
+            size_t const aDepth
+            )
+        {
+            if( aDepth >= MaxFrameDepth )
+            {
+                mContext.Log( stderr, Msg( "Classes nested more than " ) << std::to_string( MaxFrameDepth ) << " deep at " << aField.GetName(), Context::LogLevel::Problem );
+                return false;
+            }
+            return AddTree( aClass, aDepth + 1 );
+        }
+
+        //! Encode each field of aTree once
+        //!
+        //! @return true if successful, false otherwise.
+        bool EncodeTree
+            (
+            Tree const& aTree
+            )
+        {
+            FieldList const& fields = mFieldLists[&aTree];
+            for( size_t i = 0; i < fields.size(); ++i )
+            {
+                Field const& field = *fields[i];
+                Tree const* recordClass = GetRecordClass( field );
+                bool ok = true;
+                if( field.GetFieldType() == FieldType::Union )
+                {
+                    ok = EncodeUnion( static_cast< UnionField const& >( field ) );
+                }
+                else if( recordClass != NULL )
+                {
+                    ok = EncodeRecordsOf( field, *recordClass );
+                }
+                else if( !ReadValue( field ) )
+                {
+                    ok = false;
+                }
+                else
+                {
+                    switch( field.GetFieldType() )
+                    {
+                        case FieldType::Numeric:
+                            ok = Encode( static_cast< NumericField const& >( field ) );
+                            break;
+
+                        case FieldType::Float:
+                            ok = Encode( static_cast< FloatField const& >( field ) );
+                            break;
+
+                        case FieldType::String:
+                            ok = Encode( static_cast< StringField const& >( field ) );
+                            break;
+
+                        case FieldType::Array:
+                            ok = Encode( static_cast< ArrayField const& >( field ) );
+                            break;
+
+                        case FieldType::Unknown:
+                        default:
+                            mContext.Log( stderr, Msg( "Failed to encode " ) << field.GetTypeStr() << " field " << field.GetName(), Context::LogLevel::Problem );
+                            ok = false;
+                            break;
+                    }
+                }
+                BFDP_RETURNIF_V( !ok, false );
+            }
+            return true;
+        }
+
+        //! Encode the records of a class field, or an array of them
+        //!
+        //! @return true if successful, false otherwise.
+        bool EncodeRecordsOf
+            (
+            Field const& aField,
+            Tree const& aClass
+            )
+        {
+            bool const isArray = ( aField.GetFieldType() == FieldType::Array );
+            ArraySizeType const count = isArray
+                ? GetArraySize( mFieldValues, static_cast< ArrayField const& >( aField ) )
+                : 1U;
+            if( count == 0 )
+            {
+                // An empty array of records is a line of its own
+                BFDP_RETURNIF_V( !ReadValue( aField ), false );
+                if( mLine.compare( mValuePos, std::string::npos, "[]" ) != 0 )
+                {
+                    return Fail( aField, "Expected [] for" );
+                }
+                return true;
+            }
+
+            size_t const prefixLength = mPrefix.size();
+            bool ok = true;
+            for( ArraySizeType i = 0; ok && ( i < count ); ++i )
+            {
+                mPrefix += aField.GetName();
+                if( isArray )
+                {
+                    char index[24];
+                    int const length = std::snprintf( index, sizeof( index ), "[%llu]", static_cast< unsigned long long >( i ) );
+                    mPrefix.append( index, static_cast< size_t >( length ) );
+                }
+                mPrefix += '.';
+                ok = EncodeTree( aClass );
+                mPrefix.resize( prefixLength );
+            }
+            return ok;
+        }
+
+        //! Encode the record of the union case selected by the tag
+        //!
+        //! @return true if successful, false otherwise.
+        bool EncodeUnion
+            (
+            UnionField const& aField
+            )
+        {
+            uint64_t const tag = GetFieldValue( mFieldValues, *aField.GetTagField() );
+            size_t const caseNum = aField.FindCase( tag );
+            if( caseNum == UnionField::NoCase )
+            {
+                mContext.Log( stderr, Msg( "No case of union " ) << mPrefix << aField.GetName() << " for tag " << std::to_string( tag ), Context::LogLevel::Problem );
+                return false;
+            }
+            return EncodeRecordsOf( aField, *aField.GetCaseClass( caseNum ) );
+        }
+
+        bool Encode
+            (
+            ArrayField const& aField
+            )
+        {
+            Field const& element = *aField.GetElement();
+            if( ( element.GetFieldType() != FieldType::Numeric ) && ( element.GetFieldType() != FieldType::Float ) )
+            {
+                mContext.Log( stderr, Msg( "Unsupported array " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                return false;
+            }
+
+            char const* pos = mLine.c_str() + mValuePos;
+            char const* const end = mLine.c_str() + mLine.size();
+            if( ( pos == end ) || ( *pos != '[' ) || ( end[-1] != ']' ) )
+            {
+                return Fail( aField, "Expected [...] for" );
+            }
+            ++pos;
+
+            // Elements are separated by commas; "[]" has none
+            char const* const listEnd = end - 1;
+            ArraySizeType count = 0;
+            while( pos < listEnd )
+            {
+                char const* elementEnd = static_cast< char const* >( std::memchr( pos, ',', static_cast< size_t >( listEnd - pos ) ) );
+                char const* const next = ( elementEnd != NULL ) ? elementEnd + 1 : listEnd;
+                elementEnd = ( elementEnd != NULL ) ? elementEnd : listEnd;
+                while( ( pos < elementEnd ) && IsBlank( *pos ) )
+                {
+                    ++pos;
+                }
+                while( ( elementEnd > pos ) && IsBlank( elementEnd[-1] ) )
+                {
+                    --elementEnd;
+                }
+
+                bool const ok = ( element.GetFieldType() == FieldType::Numeric )
+                    ? EncodeNumeric( static_cast< NumericField const& >( element ), pos, elementEnd, NULL )
+                    : EncodeFloat( static_cast< FloatField const& >( element ), pos, elementEnd );
+                if( !ok )
+                {
+                    return Fail( aField, "Invalid element for" );
+                }
+                ++count;
+                pos = next;
+            }
+
+            ArraySizeType const expected = GetArraySize( mFieldValues, aField );
+            if( count != expected )
+            {
+                mContext.Log( stderr, Msg( "Expected " ) << std::to_string( expected ) << " elements for " << mPrefix << aField.GetName() << " at line " << std::to_string( mLineNumber ) << ", found " << std::to_string( count ), Context::LogLevel::Problem );
+                return false;
+            }
+            return true;
+        }
+
+        bool Encode
+            (
+            FloatField const& aField
+            )
+        {
+            return EncodeFloat( aField, mLine.c_str() + mValuePos, mLine.c_str() + mLine.size() ) ||
+                Fail( aField, "Invalid value for" );
+        }
+
+        bool Encode
+            (
+            NumericField const& aField
+            )
+        {
+            FieldValueMap::iterator iter = mFieldValues.find( &aField );
+            return EncodeNumeric( aField, mLine.c_str() + mValuePos, mLine.c_str() + mLine.size(), ( iter != mFieldValues.end() ) ? &iter->second : NULL ) ||
+                Fail( aField, "Invalid value for" );
+        }
+
+        bool Encode
+            (
+            StringField const& aField
+            )
+        {
+            Codec const* const codec = FindCodec( mCodecs, aField.GetCoding() );
+            if( codec == NULL )
+            {
+                mContext.Log( stderr, Msg( "Unsupported coding for " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                return false;
+            }
+
+            char const* const begin = mLine.c_str() + mValuePos;
+            char const* const end = mLine.c_str() + mLine.size();
+            if( ( ( end - begin ) < 2 ) || ( *begin != '"' ) || ( end[-1] != '"' ) )
+            {
+                return Fail( aField, "Expected quoted string for" );
+            }
+            BFDP_RETURNIF_V( !Unescape( aField, *codec, begin + 1, end - 1 ), false );
+
+            StringLengthType::Id const lengthType = aField.GetLengthType();
+            if( lengthType == StringLengthType::Prefixed )
+            {
+                size_t const lengthBits = static_cast< PStringField const& >( aField ).GetLengthBits();
+                if( ( lengthBits < MaxNumericBits ) && ( ( static_cast< uint64_t >( mBytes.size() ) >> lengthBits ) != 0 ) )
+                {
+                    return Fail( aField, "String too long for" );
+                }
+                mOut.Write( mBytes.size(), lengthBits );
+                WriteBytes();
+                return true;
+            }
+
+            // All supported codings are byte-oriented, so the terminator is a single byte
+            Bfdp::Byte term[MaxSymbolBytes];
+            if( ( codec->converter->GetMaxBytes() > sizeof( term ) ) ||
+                ( 1U != codec->converter->ConvertSymbol( aField.GetTermChar(), term, sizeof( term ) ) ) )
+            {
+                mContext.Log( stderr, Msg( "Unsupported terminator for " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                return false;
+            }
+            if( mBytes.find( static_cast< char >( term[0] ) ) != std::string::npos )
+            {
+                return Fail( aField, "Terminator within string" );
+            }
+
+            if( lengthType == StringLengthType::Fixed )
+            {
+                // Fixed-length strings are terminated, then padded with more terminators,
+                // unless they fill the field exactly
+                size_t const numBytes = static_cast< FStringField const& >( aField ).GetNumBytes();
+                if( ( mBytes.size() > numBytes ) ||
+                    ( ( mBytes.size() == numBytes ) && !aField.AllowsUnterminated() ) )
+                {
+                    return Fail( aField, "String too long for" );
+                }
+                mBytes.resize( numBytes, static_cast< char >( term[0] ) );
+            }
+            else
+            {
+                mBytes += static_cast< char >( term[0] );
+            }
+            WriteBytes();
+            return true;
+        }
+
+        //! Encode a floating-point value from text
+        //!
+        //! @return true if successful, false otherwise.
+        bool EncodeFloat
+            (
+            FloatField const& aField,
+            char const* const aBegin,
+            char const* const aEnd
+            )
+        {
+            // Values are parsed in place; a value is never followed by a digit that strtod()
+            // could run on into
+            char* parseEnd = NULL;
+            switch( aField.GetFormat() )
+            {
+                case FloatFormat::Binary16:
+                    mOut.Write( Bfdp::Data::Ieee754::EncodeBinary16( std::strtod( aBegin, &parseEnd ) ), 16 );
+                    break;
+
+                case FloatFormat::Binary32:
+                    // Parse directly to single precision, to avoid rounding twice
+                    mOut.Write( Bfdp::Data::Ieee754::EncodeBinary32( std::strtof( aBegin, &parseEnd ) ), 32 );
+                    break;
+
+                case FloatFormat::Binary64:
+                    mOut.Write( Bfdp::Data::Ieee754::EncodeBinary64( std::strtod( aBegin, &parseEnd ) ), 64 );
+                    break;
+
+                case FloatFormat::Binary128:
+                {
+                    // Halves are written in byte order, as the parse command reads them
+                    uint64_t high = 0;
+                    uint64_t low = 0;
+                    Bfdp::Data::Ieee754::EncodeBinary128( std::strtod( aBegin, &parseEnd ), high, low );
+                    bool const highFirst = ( mByteOrder == Endianness::Big );
+                    mOut.Write( highFirst ? high : low, 64 );
+                    mOut.Write( highFirst ? low : high, 64 );
+                    break;
+                }
+
+                case FloatFormat::Unknown:
+                default:
+                    mContext.Log( stderr, Msg( "Unsupported field " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                    return false;
+            }
+            return ( parseEnd == aEnd ) && ( aBegin != aEnd );
+        }
+
+        //! Encode an integer value from text, and save it to aSaveTo (if not NULL)
+        //!
+        //! @return true if successful, false otherwise.
+        bool EncodeNumeric
+            (
+            NumericField const& aField,
+            char const* const aBegin,
+            char const* const aEnd,
+            uint64_t* const aSaveTo
+            )
+        {
+            NumericFieldProperties const& props = aField.GetNumericFieldProperties();
+            size_t const bits = props.mIntegralBits + props.mFractionalBits;
+            if( !Bfdp::IsWithinRange< size_t >( props.mSigned ? 2U : 1U, bits, MaxNumericBits ) )
+            {
+                mContext.Log( stderr, Msg( "Unsupported field " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                return false;
+            }
+
+            // Values are printed raw (fixed-point values as an integer of all of their bits)
+            uint64_t value = 0;
+            BFDP_RETURNIF_V( !ParseInteger( aBegin, aEnd, props.mSigned, bits, value ), false );
+            mOut.Write( value, bits );
+            if( aSaveTo != NULL )
+            {
+                *aSaveTo = value & Bfdp::BitManip::CreateMask< uint64_t >( bits );
+            }
+            return true;
+        }
+
+        //! Log a problem with the current field
+        //!
+        //! @return false
+        bool Fail
+            (
+            Field const& aField,
+            char const* const aWhat
+            )
+        {
+            mContext.Log( stderr, Msg( aWhat ) << " " << mPrefix << aField.GetName() << " at line " << std::to_string( mLineNumber ), Context::LogLevel::Problem );
+            return false;
+        }
+
+        //! Read the next non-empty line of input, unless one is already read
+        //!
+        //! @return true if a line is read, false at the end of the input.
+        bool ReadLine()
+        {
+            while( !mHaveLine && std::getline( mIn, mLine ) )
+            {
+                ++mLineNumber;
+                if( !mLine.empty() && ( mLine[mLine.size() - 1] == '\r' ) )
+                {
+                    mLine.resize( mLine.size() - 1 );
+                }
+                mHaveLine = !mLine.empty();
+            }
+            return mHaveLine;
+        }
+
+        //! Read the line of a field, and find its value
+        //!
+        //! @return true if successful, false if the next line is not for aField.
+        bool ReadValue
+            (
+            Field const& aField
+            )
+        {
+            if( !ReadLine() )
+            {
+                mContext.Log( stderr, Msg( "Input ends before " ) << mPrefix << aField.GetName(), Context::LogLevel::Debug );
+                mAtEnd = true;
+                return false;
+            }
+            mHaveLine = false;
+
+            std::string const& name = aField.GetName();
+            size_t const nameEnd = mPrefix.size() + name.size();
+            if( ( mLine.size() <= nameEnd ) ||
+                ( mLine[nameEnd] != '=' ) ||
+                ( mLine.compare( 0, mPrefix.size(), mPrefix ) != 0 ) ||
+                ( mLine.compare( mPrefix.size(), name.size(), name ) != 0 ) )
+            {
+                return Fail( aField, "Expected" );
+            }
+            mValuePos = nameEnd + 1;
+            return true;
+        }
+
+        //! Convert the text of a quoted string (without the quotes) to bytes of its coding
+        //!
+        //! Inverts the escaping of the parse command: \" and \\ are literal, \xHH is a control
+        //! character (below 0x20, or 0x7F) or otherwise a byte that does not decode, and \u{H}
+        //! is a symbol that UTF-8 cannot hold.  Other text is UTF-8.
+        //!
+        //! @return true if successful, false otherwise.
+        bool Unescape
+            (
+            StringField const& aField,
+            Codec const& aCodec,
+            char const* const aBegin,
+            char const* const aEnd
+            )
+        {
+            mBytes.clear();
+            char const* pos = aBegin;
+            while( pos < aEnd )
+            {
+                if( aCodec.asciiCompatible )
+                {
+                    char const* runEnd = pos;
+                    while( ( runEnd < aEnd ) && ( *runEnd >= 0x20 ) && ( *runEnd <= 0x7E ) && ( *runEnd != '"' ) && ( *runEnd != '\\' ) )
+                    {
+                        ++runEnd;
+                    }
+                    if( runEnd != pos )
+                    {
+                        mBytes.append( pos, static_cast< size_t >( runEnd - pos ) );
+                        pos = runEnd;
+                        continue;
+                    }
+                }
+
+                Bfdp::Unicode::CodePoint symbol = 0;
+                if( *pos == '\\' )
+                {
+                    char const escape = ( ( pos + 1 ) < aEnd ) ? pos[1] : '\0';
+                    if( ( escape == '"' ) || ( escape == '\\' ) )
+                    {
+                        symbol = static_cast< Bfdp::Unicode::CodePoint >( escape );
+                        pos += 2;
+                    }
+                    else if( ( escape == 'x' ) && ( ( aEnd - pos ) >= 4 ) )
+                    {
+                        uint64_t value = 0;
+                        if( !Bfdp::Data::ConvertDigits( 16, pos + 2, 2, value ) )
+                        {
+                            return Fail( aField, "Invalid escape in" );
+                        }
+                        pos += 4;
+                        if( ( value >= 0x20U ) && ( value != 0x7FU ) )
+                        {
+                            // A byte that does not decode
+                            mBytes += static_cast< char >( value );
+                            continue;
+                        }
+                        symbol = static_cast< Bfdp::Unicode::CodePoint >( value );
+                    }
+                    else if( escape == 'u' )
+                    {
+                        char const* const close = static_cast< char const* >( std::memchr( pos, '}', static_cast< size_t >( aEnd - pos ) ) );
+                        uint64_t value = 0;
+                        if( ( close == NULL ) || ( pos[2] != '{' ) ||
+                            !Bfdp::Data::ConvertDigits( 16, pos + 3, static_cast< size_t >( close - pos - 3 ), value ) ||
+                            ( value > std::numeric_limits< Bfdp::Unicode::CodePoint >::max() ) )
+                        {
+                            return Fail( aField, "Invalid escape in" );
+                        }
+                        symbol = static_cast< Bfdp::Unicode::CodePoint >( value );
+                        pos = close + 1;
+                    }
+                    else
+                    {
+                        return Fail( aField, "Invalid escape in" );
+                    }
+                }
+                else if( *pos == '"' )
+                {
+                    return Fail( aField, "Unescaped quote in" );
+                }
+                else
+                {
+                    size_t const symbolBytes = mUtf8.ConvertBytes( reinterpret_cast< Bfdp::Byte const* >( pos ), static_cast< size_t >( aEnd - pos ), symbol );
+                    if( symbolBytes == 0 )
+                    {
+                        return Fail( aField, "Invalid UTF-8 in" );
+                    }
+                    pos += symbolBytes;
+                }
+
+                Bfdp::Byte encoded[MaxSymbolBytes];
+                size_t const encodedBytes = ( aCodec.converter->GetMaxBytes() <= sizeof( encoded ) )
+                    ? aCodec.converter->ConvertSymbol( symbol, encoded, sizeof( encoded ) )
+                    : 0U;
+                if( encodedBytes == 0 )
+                {
+                    return Fail( aField, "Symbol not in coding of" );
+                }
+                mBytes.append( reinterpret_cast< char const* >( encoded ), encodedBytes );
+            }
+            return true;
+        }
+
+        //! Write the bytes of the current string
+        void WriteBytes()
+        {
+            for( size_t i = 0; i < mBytes.size(); ++i )
+            {
+                mOut.Write( static_cast< Bfdp::Byte >( mBytes[i] ), Bfdp::BitManip::BitsPerByte );
+            }
+        }
+
+        //! Whether the input ended within a record
+        bool mAtEnd;
+
+        Endianness::Type mByteOrder;
+
+        //! Bytes of the current string, in its coding
+        std::string mBytes;
+
+        CodecMap mCodecs;
+        Context& mContext;
+        FieldListMap mFieldLists;
+        FieldValueMap mFieldValues;
+
+        //! Whether mLine holds a line that is not yet encoded
+        bool mHaveLine;
+
+        std::istream& mIn;
+        std::string mLine;
+        size_t mLineNumber;
+        BitWriter& mOut;
+
+        //! Names of the enclosing records, each followed by '.'
+        std::string mPrefix;
+
+        Bfdp::Unicode::Utf8Converter mUtf8;
+
+        //! Where the value begins in mLine
+        size_t mValuePos;
+    };
+
+    int CmdEncode
+        (
+        Context& aContext,
+        int const aArgC,
+        char const* const* const aArgV
+        )
+    {
+        SavedParamMap args;
+
+        ArgParser parser = ArgParser()
+            .SetName( APP_NAME " " APP_CMD_ENCODE_NAME )
+            .SetPrologue( APP_CMD_ENCODE_DESC )
+            .AddHelp()
+            .Add( Param::CreateLong( "spec", 's' )
+                    .SetDescription( "Path to specification file" )
+                    .SetValueName( "spec_file" )
+                    .SetCallback( SaveToParamMap )
+                    .SetUserdataPtr( &args )
+                )
+            .Add( Param::CreateLong( "data", 'd' )
+                    .SetDescription( "Path to field values, as printed by " APP_CMD_PARSE_NAME " (- := stdin)" )
+                    .SetDefault( "", "text_file" )
+                    .SetCallback( SaveToParamMap )
+                    .SetUserdataPtr( &args )
+                )
+            .Add( Param::CreateLong( "output", 'o' )
+                    .SetDescription( "Path to data file to write (- := stdout)" )
+                    .SetDefault( "", "data_file" )
+                    .SetCallback( SaveToParamMap )
+                    .SetUserdataPtr( &args )
+                )
+            .Add( Param::CreateLong( "format", 'f' )
+                    .SetDescription( "Format of output data" )
+                    .SetDefault( "raw", "format" )
+                    .SetCallback( SaveToParamMap )
+                    .SetUserdataPtr( &args )
+                );
+
+        int ret = parser.Parse( aArgV, aArgC );
+        if( 0 != ret )
+        {
+            // Error logged by the parser
+            parser.PrintHelp( stdout );
+            return ret;
+        }
+
+        std::string const formatStr = args["format"];
+        if( formatStr != "raw" )
+        {
+            aContext.Log( stderr, Msg( "Invalid stream format '" ) << formatStr << "'", Context::LogLevel::Problem );
+            return 1;
+        }
+
+        std::string specFileName = args["spec"];
+        std::string textFileName = args["data"];
+        std::ifstream textFileStream;
+        std::istream* textStream = &std::cin;
+        if( textFileName.empty() || ( textFileName == "-" ) )
+        {
+            textFileName = "<stdin>";
+        }
+        else
+        {
+            textFileStream.open( textFileName );
+            textStream = &textFileStream;
+        }
+        if( !*textStream )
+        {
+            aContext.Log( stderr, Msg( "Failed to open " ) << textFileName, Context::LogLevel::Problem );
+            return 1;
+        }
+
+        std::string outFileName = args["output"];
+        std::ofstream outFileStream;
+        std::streambuf* outBuf = std::cout.rdbuf();
+        if( outFileName.empty() || ( outFileName == "-" ) )
+        {
+            outFileName = "<stdout>";
+        }
+        else
+        {
+            outFileStream.open( outFileName, std::ios::out | std::ios::binary | std::ios::trunc );
+            outBuf = outFileStream.rdbuf();
+        }
+        if( ( outBuf == NULL ) || ( ( outBuf != std::cout.rdbuf() ) && !outFileStream ) )
+        {
+            aContext.Log( stderr, Msg( "Failed to open " ) << outFileName, Context::LogLevel::Problem );
+            return 1;
+        }
+
+        // Create a database to receive objects discovered from the stream
+        DatabasePtr db = Database::CreateArena();
+        if( !db )
+        {
+            aContext.Log( stderr, Msg( "Failed to create Database" ), Context::LogLevel::Problem );
+            return -1;
+        }
+
+        // Set Filename property for future reference
+        PropertyPtr fileNameProp = Property::StaticCast
+            (
+            db->GetRoot()->Add( BfsdlParser::Objects::CreateObject< Property >( db->GetRoot()->GetAllocator(), "Filename" ) )
+            );
+        if( !fileNameProp ||
+            !fileNameProp->SetString( specFileName ) )
+        {
+            aContext.Log( stderr, Msg( "Failed to set Filename property" ), Context::LogLevel::Problem );
+            return -1;
+        }
+
+        uint64_t specKey;
+        aContext.Log( stderr, Msg( "Processing BFSDL Stream..." ) << specFileName, Context::LogLevel::Debug );
+        if( !LoadSpec( db->GetRoot(), specFileName, ret, specKey ) )
+        {
+            aContext.Log( stderr, Msg( "Failed to open " ) << specFileName, Context::LogLevel::Problem );
+            return 1;
+        }
+        else if( ret != 0 )
+        {
+            // If the BFSDL stream is not loaded, stop early
+            return ret;
+        }
+
+        Endianness::Type defaultBitOrder = db->GetRoot()->GetNumericPropertyWithDefault< Endianness::Type >( "DefaultBitOrder", Endianness::Default );
+        Endianness::Type defaultByteOrder = db->GetRoot()->GetNumericPropertyWithDefault< Endianness::Type >( "DefaultByteOrder", Endianness::Default );
+        BitWriter writer( *outBuf, ToBitManipEndianness( defaultBitOrder ), ToBitManipEndianness( defaultByteOrder ) );
+        FieldEncoder encoder( aContext, *textStream, writer );
+        encoder.SetByteOrder( defaultByteOrder );
+        if( !writer.IsOk() || !encoder.SetRoot( *db->GetRoot() ) )
+        {
+            return 1;
+        }
+
+        // Progress goes to stderr, since the data may be written to stdout
+        aContext.Log( stderr, Msg( "Encoding " ) << textFileName << " to " << outFileName << " as '" << formatStr << "'", Context::LogLevel::Debug );
+        if( !encoder.EncodeRecords( *db->GetRoot() ) )
+        {
+            BFDP_UNUSED_RETURN( writer.Finish() );
+            return 1;
+        }
+        if( !writer.Finish() || ( outFileStream.is_open() && !outFileStream.flush() ) || !std::cout.flush() )
+        {
+            aContext.Log( stderr, Msg( "Failed to write " ) << outFileName, Context::LogLevel::Problem );
+            return 1;
+        }
+
+        uint64_t const totalBits = writer.GetPosBits();
+        aContext.Log( stderr, Msg( "Total: " ) << std::to_string( totalBits / Bfdp::BitManip::BitsPerByte ) << "." << std::to_string( totalBits % Bfdp::BitManip::BitsPerByte ) << " Bb", Context::LogLevel::Info );
+        return 0;
+    }
+
+} // namespace App
@@ -38,21 +38,48 @@
 // External Includes
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 
 // Internal Includes
 #include "App/Common.hpp"
+#include "App/Fields.hpp"
+#include "Bfdp/BitManip/BitView.hpp"
+#include "Bfdp/BitManip/Conversion.hpp"
+#include "Bfdp/BitManip/EndianBitReader.hpp"
+#include "Bfdp/Data/BufferPool.hpp"
+#include "Bfdp/Data/Ieee754.hpp"
+#include "Bfdp/Data/MappedFile.hpp"
+#include "Bfdp/Data/Radix.hpp"
 #include "Bfdp/ErrorReporter/Functions.hpp"
+#include "Bfdp/Stream/MemoryStreamBuf.hpp"
 #include "Bfdp/Stream/RawStream.hpp"
+#include "Bfdp/Stream/RecordIndex.hpp"
+#include "Bfdp/Thread/TaskPool.hpp"
+#include "Bfdp/Unicode/CodingMap.hpp"
 #include "Bfdp/Unicode/Common.hpp"
+#include "Bfdp/Unicode/Utf8Converter.hpp"
+#include "BfsdlParser/Objects/ArrayField.hpp"
+#include "BfsdlParser/Objects/ClassField.hpp"
 #include "BfsdlParser/Objects/Database.hpp"
+#include "BfsdlParser/Objects/FloatField.hpp"
+#include "BfsdlParser/Objects/FStringField.hpp"
 #include "BfsdlParser/Objects/IObject.hpp"
 #include "BfsdlParser/Objects/NumericField.hpp"
 #include "BfsdlParser/Objects/NumericValueBuilder.hpp"
+#include "BfsdlParser/Objects/PStringField.hpp"
 #include "BfsdlParser/Objects/Property.hpp"
+#include "BfsdlParser/Objects/StringField.hpp"
+#include "BfsdlParser/Objects/UnionField.hpp"
 #include "BfsdlParser/Objects/Tree.hpp"
 #include "BfsdlParser/StreamParser.hpp"
 
@@ -61,8 +88,12 @@ namespace App
 {
 
     using Bfdp::Console::ArgParser;
+    using BfsdlParser::Objects::ArrayField;
+    using BfsdlParser::Objects::ArrayFieldPtr;
+    using BfsdlParser::Objects::ArraySizeType;
     using BfsdlParser::Objects::BitBase;
     using BfsdlParser::Objects::BfsdlVersionType;
+    using BfsdlParser::Objects::ClassField;
     using Bfdp::Stream::Control;
     using BfsdlParser::Objects::Database;
     using BfsdlParser::Objects::DatabasePtr;
@@ -70,213 +101,2068 @@ namespace App
     using BfsdlParser::Objects::Field;
     using BfsdlParser::Objects::FieldPtr;
     using BfsdlParser::Objects::FieldType;
+    using BfsdlParser::Objects::FloatField;
+    using BfsdlParser::Objects::FloatFormat;
+    using BfsdlParser::Objects::FStringField;
+    using Bfdp::BitManip::EndianBitReader;
     using Bfdp::BitManip::GenericBitStream;
     using BfsdlParser::Objects::IObjectPtr;
     using Bfdp::Console::Msg;
     using BfsdlParser::Objects::NumericField;
     using BfsdlParser::Objects::NumericFieldProperties;
-    using BfsdlParser::Objects::NumericFieldPtr;
     using BfsdlParser::Objects::NumericValueBuilder;
     using BfsdlParser::Objects::ObjectType;
     using Bfdp::Console::Param;
+    using BfsdlParser::Objects::PStringField;
     using BfsdlParser::Objects::Property;
     using BfsdlParser::Objects::PropertyPtr;
+    using Bfdp::Stream::RecordIndex;
+    using BfsdlParser::Objects::StringField;
+    using BfsdlParser::Objects::StringLengthType;
     using BfsdlParser::Objects::Tree;
     using BfsdlParser::Objects::TreePtr;
+    using BfsdlParser::Objects::UnionField;
 
-    namespace CmdValidateSpecInternal
+    namespace CmdParseInternal
     {
 
-    }
-    using namespace CmdValidateSpecInternal;
+        //! Most array elements unpacked at once; bounds the size of the unpack buffer
+        static size_t BFDP_CONSTEXPR MaxArrayChunk = 4096U;
+
+        //! Size of the data decoded by each task when decoding in parallel
+        static uint64_t BFDP_CONSTEXPR ShardBits = 8U << 20;
+
+        //! Shards in flight per thread when decoding in parallel
+        static size_t BFDP_CONSTEXPR ShardsPerThread = 4U;
+
+        //! Records that must decode from a guessed position before a shard is decoded from it
+        static uint64_t BFDP_CONSTEXPR SyncRecords = 8U;
+
+        //! Most positions tried when guessing where the first record of a shard begins
+        static size_t BFDP_CONSTEXPR MaxSyncBytes = 4096U;
+
+        //! Record boundaries kept by each shard, to recover from a wrong guess of where it begins
+        static size_t BFDP_CONSTEXPR MaxResyncRecords = 256U;
+
+        //! Record number past any record in the data
+        static uint64_t BFDP_CONSTEXPR NoRecordLimit = std::numeric_limits< uint64_t >::max();
+
+        //! Position past the end of any data
+        static uint64_t BFDP_CONSTEXPR NoPosLimit = std::numeric_limits< uint64_t >::max();
+
+        //! The end of a record decoded by a shard
+        struct RecordBoundary
+        {
+            //! Position of the end of the record in the data
+            uint64_t posBits;
+
+            //! Amount of the output of the shard up to the end of the record
+            std::streamoff outBytes;
+        };
+        typedef std::vector< RecordBoundary > RecordBoundaryList;
+
+        //! Records to decode, as given by the --records option
+        struct RecordRange
+        {
+            //! @return Whether the range counts back from the end of the data
+            bool NeedsCount() const
+            {
+                return ( first < 0 ) || ( hasEnd && ( end < 0 ) );
+            }
+
+            //! First record, and the record after the last; negative values count back from the
+            //! end of the data.
+            int64_t first;
+            int64_t end;
+
+            //! Whether the range stops before the end of the data
+            bool hasEnd;
+        };
+
+        //! Get the size of every value of aField, if all values are the same size
+        //!
+        //! @return true if successful, false if the size of a value depends on the data.
+        static bool GetFixedFieldBits
+            (
+            Field const& aField,
+            uint64_t& aOutBits
+            )
+        {
+            switch( aField.GetFieldType() )
+            {
+                case FieldType::Numeric:
+                {
+                    NumericFieldProperties const& props = static_cast< NumericField const& >( aField ).GetNumericFieldProperties();
+                    aOutBits = props.mIntegralBits + props.mFractionalBits;
+                    return true;
+                }
+
+                case FieldType::Float:
+                    aOutBits = static_cast< FloatField const& >( aField ).GetBits();
+                    return true;
+
+                case FieldType::String:
+                    if( static_cast< StringField const& >( aField ).GetLengthType() != StringLengthType::Fixed )
+                    {
+                        return false;
+                    }
+                    aOutBits = Bfdp::BitManip::BytesToBits( static_cast< FStringField const& >( aField ).GetNumBytes() );
+                    return true;
+
+                case FieldType::Array:
+                {
+                    ArrayField const& arrayField = static_cast< ArrayField const& >( aField );
+                    BFDP_RETURNIF_V( arrayField.GetCountField() || !arrayField.GetElement(), false );
+                    BFDP_RETURNIF_V( !GetFixedFieldBits( *arrayField.GetElement(), aOutBits ), false );
+                    aOutBits *= arrayField.GetCount();
+                    return true;
+                }
+
+                default:
+                    return false;
+            }
+        }
+
+        //! Get the size of a seekable input stream, leaving the stream at the beginning
+        //!
+        //! @return true if successful, false if the stream cannot seek.
+        static bool GetStreamSize
+            (
+            std::istream& aIn,
+            uint64_t& aOutBytes
+            )
+        {
+            aIn.seekg( 0, std::ios::end );
+            std::streamoff const size = aIn.tellg();
+            aIn.seekg( 0, std::ios::beg );
+            if( !aIn || ( size < 0 ) )
+            {
+                aIn.clear();
+                return false;
+            }
+            aOutBytes = static_cast< uint64_t >( size );
+            return true;
+        }
+
+        //! Parse a decimal record number, which may be negative
+        //!
+        //! @return true if successful, false otherwise.
+        static bool ParseRecordNumber
+            (
+            std::string const& aText,
+            int64_t& aOut
+            )
+        {
+            bool const negative = !aText.empty() && ( aText[0] == '-' );
+            size_t const start = negative ? 1U : 0U;
+            uint64_t value = 0;
+            BFDP_RETURNIF_V( aText.size() == start, false );
+            BFDP_RETURNIF_V( !Bfdp::Data::ConvertDigits( 10, &aText[start], aText.size() - start, value ), false );
+            BFDP_RETURNIF_V( value > static_cast< uint64_t >( std::numeric_limits< int64_t >::max() ), false );
+
+            aOut = negative ? -static_cast< int64_t >( value ) : static_cast< int64_t >( value );
+            return true;
+        }
+
+        //! Parse a range of records: "first:end" (either may be omitted), or a single record
+        //!
+        //! @return true if successful, false otherwise.
+        static bool ParseRecordRange
+            (
+            std::string const& aText,
+            RecordRange& aOut
+            )
+        {
+            aOut.first = 0;
+            aOut.end = 0;
+            aOut.hasEnd = false;
+
+            size_t const colon = aText.find( ':' );
+            if( colon == std::string::npos )
+            {
+                BFDP_RETURNIF_V( !ParseRecordNumber( aText, aOut.first ), false );
+                // Record -1 is the last one, so the range runs to the end of the data
+                aOut.end = aOut.first + 1;
+                aOut.hasEnd = ( aOut.end != 0 );
+                return true;
+            }
+
+            std::string const first = aText.substr( 0, colon );
+            std::string const end = aText.substr( colon + 1 );
+            BFDP_RETURNIF_V( !first.empty() && !ParseRecordNumber( first, aOut.first ), false );
+            aOut.hasEnd = !end.empty();
+            return !aOut.hasEnd || ParseRecordNumber( end, aOut.end );
+        }
+
+        //! @return The number of a record, counting back from aNumRecords if negative
+        static uint64_t ResolveRecord
+            (
+            int64_t const aRecord,
+            uint64_t const aNumRecords
+            )
+        {
+            if( aRecord >= 0 )
+            {
+                return static_cast< uint64_t >( aRecord );
+            }
+            uint64_t const back = static_cast< uint64_t >( -aRecord );
+            return ( back < aNumRecords ) ? aNumRecords - back : 0U;
+        }
+
+        //! Decode the raw bits of a floating-point value for printing
+        //!
+        //! @param[in] aLow Raw bits, or the low 64 bits of a binary128 value
+        //! @param[in] aHigh High 64 bits of a binary128 value
+        //! @param[out] aDigits Significant digits that round-trip the format (binary128 is
+        //!     reduced to binary64)
+        //! @return true if the format is supported, false otherwise.
+        static bool DecodeFloat
+            (
+            FloatFormat::Id const aFormat,
+            uint64_t const aLow,
+            uint64_t const aHigh,
+            double& aValue,
+            std::streamsize& aDigits
+            )
+        {
+            aDigits = 17;
+            switch( aFormat )
+            {
+                case FloatFormat::Binary16:
+                    aValue = Bfdp::Data::Ieee754::DecodeBinary16( static_cast< uint16_t >( aLow ) );
+                    aDigits = 5;
+                    break;
+
+                case FloatFormat::Binary32:
+                    aValue = Bfdp::Data::Ieee754::DecodeBinary32( static_cast< uint32_t >( aLow ) );
+                    aDigits = 9;
+                    break;
+
+                case FloatFormat::Binary64:
+                    aValue = Bfdp::Data::Ieee754::DecodeBinary64( aLow );
+                    break;
+
+                case FloatFormat::Binary128:
+                    aValue = Bfdp::Data::Ieee754::DecodeBinary128( aHigh, aLow );
+                    break;
+
+                case FloatFormat::Unknown:
+                default:
+                    return false;
+            }
+            return true;
+        }
+
+        //! @return Whether aByte is printed as-is within quotes by an ASCII-compatible coding
+        static inline bool IsPlainAscii
+            (
+            Bfdp::Byte const aByte
+            )
+        {
+            return ( aByte >= 0x20U ) && ( aByte <= 0x7EU ) && ( aByte != '"' ) && ( aByte != '\\' );
+        }
+
+        static void PrintEscapedByte
+            (
+            std::ostream& aOut,
+            unsigned int const aValue
+            )
+        {
+            static char const HexDigits[] = "0123456789abcdef";
+            char const escaped[] = { '\\', 'x', HexDigits[( aValue >> 4 ) & 0xFU], HexDigits[aValue & 0xFU] };
+            aOut.write( escaped, sizeof( escaped ) );
+        }
+
+        //! Print string data decoded by aCodec as UTF-8, escaping control characters and any
+        //! bytes that cannot be decoded.
+        //!
+        //! Runs of printable ASCII are written straight from aData when the coding is
+        //! ASCII-compatible.
+        static void PrintString
+            (
+            std::ostream& aOut,
+            Bfdp::Byte const* const aData,
+            size_t const aSize,
+            Bfdp::Unicode::IConverter& aCodec,
+            bool const aAsciiCompatible
+            )
+        {
+            Bfdp::Unicode::Utf8Converter utf8;
+            size_t i = 0;
+            while( i < aSize )
+            {
+                if( aAsciiCompatible )
+                {
+                    size_t runEnd = i;
+                    while( ( runEnd < aSize ) && IsPlainAscii( aData[runEnd] ) )
+                    {
+                        ++runEnd;
+                    }
+                    if( runEnd != i )
+                    {
+                        aOut.write( reinterpret_cast< char const* >( &aData[i] ), static_cast< std::streamsize >( runEnd - i ) );
+                        i = runEnd;
+                        continue;
+                    }
+                }
+
+                Bfdp::Unicode::CodePoint symbol = 0;
+                size_t const symbolBytes = aCodec.ConvertBytes( &aData[i], aSize - i, symbol );
+                if( symbolBytes == 0 )
+                {
+                    PrintEscapedByte( aOut, aData[i] );
+                    ++i;
+                    continue;
+                }
+                i += symbolBytes;
+
+                Bfdp::Byte encoded[MaxSymbolBytes];
+                size_t encodedBytes = 0;
+                if( ( symbol == '"' ) || ( symbol == '\\' ) )
+                {
+                    aOut.put( '\\' ).put( static_cast< char >( symbol ) );
+                }
+                else if( ( symbol < 0x20U ) || ( symbol == 0x7FU ) )
+                {
+                    PrintEscapedByte( aOut, symbol );
+                }
+                else if( 0 != ( encodedBytes = utf8.ConvertSymbol( symbol, encoded, sizeof( encoded ) ) ) )
+                {
+                    aOut.write( reinterpret_cast< char const* >( encoded ), static_cast< std::streamsize >( encodedBytes ) );
+                }
+                else
+                {
+                    aOut << "\\u{" << std::hex << symbol << std::dec << "}";
+                }
+            }
+        }
+
+    } // namespace CmdParseInternal
+
+    using namespace CmdParseInternal;
+
+    class StreamDataObserver
+        : public Bfdp::Stream::IStreamObserver
+    {
+    public:
+        StreamDataObserver
+            (
+            Context& aContext
+            )
+            : mArray()
+            , mBoundaries( NULL )
+            , mCodec( NULL )
+            , mContext( aContext )
+            , mDepth( 0 )
+            , mEndPosBits( NoPosLimit )
+            , mEndRecord( NoRecordLimit )
+            , mFieldIsComplete( false )
+            , mFieldIsPending( false )
+            , mFirstRecord( 0 )
+            , mIndex( NULL )
+            , mOut( std::cout.rdbuf() )
+            , mOutBuf( std::cout.rdbuf() )
+            , mPosBits( 0 )
+            , mReader( Bfdp::BitManip::Endianness::Default, Bfdp::BitManip::Endianness::Default )
+            , mRecord( 0 )
+            , mStep( 0 )
+        {
+        }
+
+        //! Complete any field that may end with the data stream
+        //!
+        //! @return false if the stream ended in the middle of a field, true otherwise.
+        bool EndOfStream()
+        {
+            if( mFieldIsPending &&
+                ( mString.field != NULL ) &&
+                mString.lengthKnown &&
+                mString.field->AllowsUnterminated() )
+            {
+                // Unterminated strings may be cut short by the end of the stream (D.1.4)
+                mFieldIsPending = false;
+                return EmitString( *mString.field, reinterpret_cast< Bfdp::Byte const* >( mString.text.data() ), mString.text.size() );
+            }
+            if( mFieldIsPending && ( mArray.field != NULL ) )
+            {
+                // End the line of elements printed so far
+                mOut << std::endl;
+            }
+            return !mFieldIsPending;
+        }
+
+        //! Get the size of every record, if all records are the same size
+        //!
+        //! @return true if successful, false if the size of a record depends on its data.
+        bool GetFixedRecordBits
+            (
+            uint64_t& aOutBits
+            ) const
+        {
+            return GetFixedBits( 0, mLayout.size(), aOutBits ) && ( aOutBits != 0 );
+        }
+
+        //! @return The number of records decoded, counting from the start of the data
+        uint64_t GetNumRecords() const
+        {
+            return mRecord;
+        }
+
+        //! @return The position in the data of the end of the data decoded
+        uint64_t GetPosBits() const
+        {
+            return mPosBits;
+        }
+
+        //! Set the list to add the end of each decoded record to, up to MaxResyncRecords of them
+        void SetBoundaries
+            (
+            RecordBoundaryList* const aBoundaries
+            )
+        {
+            mBoundaries = aBoundaries;
+            if( mBoundaries != NULL )
+            {
+                // Keep adding boundaries out of the decoding loop's way
+                mBoundaries->reserve( MaxResyncRecords );
+            }
+        }
+
+        //! Set the default bit and byte order of numeric fields
+        void SetEndianness
+            (
+            Endianness::Type const aBitOrder,
+            Endianness::Type const aByteOrder
+            )
+        {
+            mReader = EndianBitReader( ToBitManipEndianness( aBitOrder ), ToBitManipEndianness( aByteOrder ) );
+        }
+
+        //! Stop decoding at the first record boundary at or past aPosBits in the data
+        void SetEndPosition
+            (
+            uint64_t const aPosBits
+            )
+        {
+            mEndPosBits = aPosBits;
+        }
+
+        //! Set where decoded fields are printed (stdout by default)
+        //!
+        //! @note Takes effect with the next call to SetRecords().
+        void SetOutput
+            (
+            std::streambuf* const aOutBuf
+            )
+        {
+            mOutBuf = aOutBuf;
+        }
+
+        //! Set the pointer to the field root, and flatten the fields it describes.
+        //!
+        //! @return true if successful, false otherwise.
+        bool SetRoot
+            (
+            TreePtr& aRoot
+            )
+        {
+            mLayout.clear();
+            mCaseSteps.clear();
+            mFieldValues.clear();
+            mDepth = 0;
+            mStep = 0;
+            mPrefix.clear();
+            return AddToLayout( *aRoot, 0 );
+        }
+
+        //! Set the records to print, and where decoding begins
+        //!
+        //! Records outside of the range are decoded without printing them, and decoding stops
+        //! at the end of the range.
+        //!
+        //! @param[in] aStartRecord Number of the record at which decoding begins
+        //! @param[in] aStartPosBits Position of that record in the data
+        //! @param[in] aFirstRecord First record to print
+        //! @param[in] aEndRecord Record after the last one to print
+        //! @param[in] aIndex Index to add the decoded records to, or NULL
+        //! @return true if successful, false otherwise.
+        bool SetRecords
+            (
+            uint64_t const aStartRecord,
+            uint64_t const aStartPosBits,
+            uint64_t const aFirstRecord,
+            uint64_t const aEndRecord,
+            RecordIndex* const aIndex
+            )
+        {
+            mRecord = aStartRecord;
+            mPosBits = aStartPosBits;
+            mFirstRecord = aFirstRecord;
+            mEndRecord = aEndRecord;
+            mIndex = aIndex;
+            mOut.rdbuf( ( mRecord >= mFirstRecord ) ? mOutBuf : NULL );
+            return ( mIndex == NULL ) || IndexRecord( mPosBits );
+        }
+
+    private:
+        //! One step through the flattened fields of a record
+        //!
+        //! A class field is laid out as an Enter step, the steps of its class, then a Leave step,
+        //! so moving into or out of a nested record is a jump to a known index.  A union is laid
+        //! out as a Switch step followed by the records of each case, and the case is entered
+        //! through a jump table.
+        struct Step
+        {
+            enum Kind
+            {
+                Enter,  //!< Begin the records of a class field, or an array of them
+                Leave,  //!< End one record; repeat from the matching Enter if more remain
+                Parse,  //!< Decode a field that holds data
+                Switch  //!< Jump to the case of a union selected by its tag
+            };
+
+            Kind kind;
+
+            //! The field to parse, the class field (or array) for Enter and Leave, or the union
+            //! for Switch and the Enter and Leave of its cases
+            Field const* field;
+
+            //! Where to continue after the records (for Enter and Switch), or the index of the
+            //! matching Enter (for Leave)
+            size_t jump;
+
+            //! Index in mCaseSteps of the first case (for Switch)
+            size_t cases;
+        };
+        typedef std::vector< Step > Layout;
+
+        //! Progress through the records of an entered class field
+        struct Frame
+        {
+            //! Index of the Enter step
+            size_t enter;
+
+            //! Current record, and the number of records
+            ArraySizeType index;
+            ArraySizeType count;
+
+            //! Length of the name prefix outside of the frame
+            size_t prefixLength;
+        };
+
+        //! Progress through the current array field
+        struct ArrayState
+        {
+            ArrayState()
+                : field( NULL )
+                , remaining( 0 )
+                , elementBits( 0 )
+                , wordsPerElement( 0 )
+                , first( true )
+            {
+            }
+
+            void Reset()
+            {
+                field = NULL;
+                remaining = 0;
+                elementBits = 0;
+                wordsPerElement = 0;
+                first = true;
+                // Keep the capacity of the buffer for the next array
+                words.clear();
+            }
+
+            //! Field being parsed, or NULL if none is started
+            ArrayField const* field;
+
+            //! Elements left to parse
+            ArraySizeType remaining;
+
+            //! Size of each element
+            size_t elementBits;
+
+            //! Number of 64-bit (or smaller) words that make up an element
+            size_t wordsPerElement;
+
+            //! Whether no elements have been printed yet
+            bool first;
+
+            //! Unpacked raw words of the elements being printed
+            std::vector< uint64_t > words;
+        };
+
+        //! Progress through the current string field
+        struct StringState
+        {
+            StringState()
+                : field( NULL )
+                , lengthKnown( false )
+                , remaining( 0 )
+                , termByte( 0 )
+            {
+            }
+
+            void Reset()
+            {
+                field = NULL;
+                lengthKnown = false;
+                remaining = 0;
+                termByte = 0;
+                // Keep the capacity of the buffers for the next string
+                text.clear();
+                scratch.clear();
+            }
+
+            //! Field being parsed, or NULL if none is started
+            StringField const* field;
+
+            //! Whether the length (or the need to search for a terminator) is known
+            bool lengthKnown;
+
+            //! Bytes left in a fixed or prefixed-length string
+            size_t remaining;
+
+            //! Encoded terminator of a bounded string
+            Bfdp::Byte termByte;
+
+            //! Text of a string that straddles more than one buffer
+            std::string text;
+
+            //! Realigned copy of buffered bytes when a string does not begin on a byte boundary
+            std::string scratch;
+        };
+
+        //! Append the steps that parse the fields of aTree to the layout
+        //!
+        //! @return true if successful, false otherwise.
+        bool AddToLayout
+            (
+            Tree& aTree,
+            size_t const aDepth
+            )
+        {
+            FieldList fields;
+            aTree.IterateFields( &AddFieldToList, &fields );
+            for( size_t i = 0; i < fields.size(); ++i )
+            {
+                Field const& field = *fields[i];
+                ArrayFieldPtr arrayField = ArrayField::StaticCast( fields[i] );
+                if( arrayField && arrayField->GetCountField() )
+                {
+                    // Track the values of fields that give the length of an array
+                    mFieldValues[arrayField->GetCountField().get()] = 0U;
+                }
+
+                Tree const* recordClass = GetRecordClass( field );
+                if( field.GetFieldType() == FieldType::Union )
+                {
+                    if( !AddUnionToLayout( static_cast< UnionField const& >( field ), aDepth ) )
+                    {
+                        return false;
+                    }
+                }
+                else if( recordClass != NULL )
+                {
+                    if( !AddRecordToLayout( field, *recordClass, aDepth ) )
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    if( field.GetFieldType() == FieldType::String )
+                    {
+                        // Set up codings now, so that decoding never needs to; an unsupported
+                        // coding is reported when the field is decoded.
+                        BFDP_UNUSED_RETURN( FindCodec( mCodecs, static_cast< StringField const& >( field ).GetCoding() ) );
+                    }
+                    Step const step = { Step::Parse, &field, 0, 0 };
+                    mLayout.push_back( step );
+                }
+            }
+            return true;
+        }
+
+        //! Append the Enter, class and Leave steps for the records of aField
+        //!
+        //! @return true if successful, false otherwise.
+        bool AddRecordToLayout
+            (
+            Field const& aField,
+            Tree const& aClass,
+            size_t const aDepth
+            )
+        {
+            if( aDepth >= MaxFrameDepth )
+            {
+                mContext.Log( stderr, Msg( "Classes nested more than " ) << std::to_string( MaxFrameDepth ) << " deep at " << aField.GetName(), Context::LogLevel::Problem );
+                return false;
+            }
+
+            size_t const enter = mLayout.size();
+            Step const enterStep = { Step::Enter, &aField, 0, 0 };
+            mLayout.push_back( enterStep );
+            if( !AddToLayout( const_cast< Tree& >( aClass ), aDepth + 1 ) )
+            {
+                return false;
+            }
+            Step const leaveStep = { Step::Leave, &aField, enter, 0 };
+            mLayout.push_back( leaveStep );
+            mLayout[enter].jump = mLayout.size();
+            return true;
+        }
+
+        //! Append the Switch step and the records of each case of a union
+        //!
+        //! @return true if successful, false otherwise.
+        bool AddUnionToLayout
+            (
+            UnionField const& aField,
+            size_t const aDepth
+            )
+        {
+            // Track the value of the tag
+            mFieldValues[aField.GetTagField().get()] = 0U;
+
+            size_t const switchStep = mLayout.size();
+            size_t const cases = mCaseSteps.size();
+            Step const step = { Step::Switch, &aField, 0, cases };
+            mLayout.push_back( step );
+            mCaseSteps.resize( cases + aField.GetNumCases() );
+            for( size_t i = 0; i < aField.GetNumCases(); ++i )
+            {
+                mCaseSteps[cases + i] = mLayout.size();
+                if( !AddRecordToLayout( aField, *aField.GetCaseClass( i ), aDepth ) )
+                {
+                    return false;
+                }
+            }
+
+            // Each case continues after the last one
+            size_t const end = mLayout.size();
+            mLayout[switchStep].jump = end;
+            for( size_t i = 0; i < aField.GetNumCases(); ++i )
+            {
+                mLayout[mCaseSteps[cases + i]].jump = end;
+            }
+            return true;
+        }
+
+        //! Get the size of the steps in [aBegin, aEnd), if they always decode the same size
+        //!
+        //! @return true if successful, false if the size depends on the data.
+        bool GetFixedBits
+            (
+            size_t const aBegin,
+            size_t const aEnd,
+            uint64_t& aOutBits
+            ) const
+        {
+            aOutBits = 0;
+            size_t i = aBegin;
+            while( i < aEnd )
+            {
+                Step const& step = mLayout[i];
+                uint64_t bits = 0;
+                if( step.kind == Step::Enter )
+                {
+                    // The class steps run up to the Leave step just before the jump
+                    BFDP_RETURNIF_V( !GetFixedBits( i + 1, step.jump - 1, bits ), false );
+                    if( step.field->GetFieldType() == FieldType::Array )
+                    {
+                        ArrayField const& arrayField = static_cast< ArrayField const& >( *step.field );
+                        BFDP_RETURNIF_V( arrayField.GetCountField(), false );
+                        bits *= arrayField.GetCount();
+                    }
+                    i = step.jump;
+                }
+                else if( step.kind == Step::Parse )
+                {
+                    BFDP_RETURNIF_V( !GetFixedFieldBits( *step.field, bits ), false );
+                    ++i;
+                }
+                else
+                {
+                    // The case of a union is selected by the data
+                    return false;
+                }
+                aOutBits += bits;
+            }
+            return true;
+        }
+
+        //! Add the current record to the index, if it falls on the index interval
+        //!
+        //! @return true if successful, false otherwise.
+        bool IndexRecord
+            (
+            uint64_t const aPosBits
+            )
+        {
+            if( ( mRecord % mIndex->GetInterval() ) != 0 )
+            {
+                return true;
+            }
+            else if( !mIndex->Add( mRecord, aPosBits ) )
+            {
+                BFDP_INTERNAL_ERROR( "Record index out of order" );
+                return false;
+            }
+            return true;
+        }
+
+        //! Append the name of the current record of aFrame to the name prefix
+        void AppendPrefix
+            (
+            Frame const& aFrame
+            )
+        {
+            Field const& field = *mLayout[aFrame.enter].field;
+            mPrefix += field.GetName();
+            if( field.GetFieldType() == FieldType::Array )
+            {
+                char index[24];
+                int const length = std::snprintf( index, sizeof( index ), "[%llu]", static_cast< unsigned long long >( aFrame.index ) );
+                mPrefix.append( index, static_cast< size_t >( length ) );
+            }
+            mPrefix += '.';
+        }
+
+        //! Begin the records of a class field
+        //!
+        //! @return false if more data is needed first, true otherwise.
+        bool EnterRecords
+            (
+            Step const& aStep,
+            GenericBitStream& aInBitStream
+            )
+        {
+            ArraySizeType const count = ( aStep.field->GetFieldType() == FieldType::Array )
+                ? GetArraySize( mFieldValues, static_cast< ArrayField const& >( *aStep.field ) )
+                : 1U;
+            if( count == 0 )
+            {
+                mOut << mPrefix << aStep.field->GetName() << "=[]" << std::endl;
+                mStep = aStep.jump;
+                return true;
+            }
+            else if( aInBitStream.GetBitsTillEnd() == 0 )
+            {
+                return false;
+            }
+
+            // Depth is bounded when the layout is built
+            Frame& frame = mFrames[mDepth++];
+            frame.enter = mStep;
+            frame.index = 0;
+            frame.count = count;
+            frame.prefixLength = mPrefix.size();
+            AppendPrefix( frame );
+            ++mStep;
+            return true;
+        }
+
+        //! End a record, and move on to the next record of the frame or leave it
+        void LeaveRecord()
+        {
+            Frame& frame = mFrames[mDepth - 1];
+            mPrefix.resize( frame.prefixLength );
+            if( ++frame.index < frame.count )
+            {
+                AppendPrefix( frame );
+                mStep = frame.enter + 1;
+            }
+            else
+            {
+                --mDepth;
+                mStep = mLayout[frame.enter].jump;
+            }
+        }
+
+        //! Jump to the records of the union case selected by the tag
+        //!
+        //! @return true if successful, false if the tag has no case.
+        bool SelectCase
+            (
+            Step const& aStep
+            )
+        {
+            UnionField const& unionField = static_cast< UnionField const& >( *aStep.field );
+            uint64_t const tag = GetFieldValue( mFieldValues, *unionField.GetTagField() );
+            size_t const caseNum = unionField.FindCase( tag );
+            if( caseNum == UnionField::NoCase )
+            {
+                mContext.Log( stderr, Msg( "No case of union " ) << mPrefix << unionField.GetName() << " for tag " << std::to_string( tag ), Context::LogLevel::Problem );
+                return false;
+            }
+
+            mStep = mCaseSteps[aStep.cases + caseNum];
+            return true;
+        }
+
+        BFDP_OVERRIDE( Control::Type OnStreamData
+            (
+            GenericBitStream& aInBitStream
+            ) )
+        {
+            if( mLayout.empty() )
+            {
+                // Most likely cause is that the spec did not define any fields.
+                // Stop with an error to avoid an infinite loop.
+                mContext.Log( stderr, Msg( "No fields to parse" ), Context::LogLevel::Problem );
+                return Control::Error;
+            }
+            else if( ( mStep == 0 ) && ( ( mRecord >= mEndRecord ) || ( mPosBits >= mEndPosBits ) ) )
+            {
+                // Past the last record to print, or the end of a shard
+                return Control::Stop;
+            }
+
+            // Track the position in the data of the records decoded from the buffer
+            size_t const startPosBits = aInBitStream.GetPosBits();
+            Control::Type const control = DecodeRecords( aInBitStream, startPosBits );
+            mPosBits += aInBitStream.GetPosBits() - startPosBits;
+            return control;
+        }
+
+        //! Decode fields from the buffer
+        //!
+        //! @param[in] aStartPosBits Position in the buffer that corresponds to mPosBits
+        Control::Type DecodeRecords
+            (
+            GenericBitStream& aInBitStream,
+            size_t const aStartPosBits
+            )
+        {
+            for( ;; )
+            {
+                if( mStep == mLayout.size() )
+                {
+                    // End of the record; cycle back to the first field.
+                    mStep = 0;
+                    return EndRecord( mPosBits + ( aInBitStream.GetPosBits() - aStartPosBits ) );
+                }
+
+                Step const& step = mLayout[mStep];
+                if( step.kind == Step::Enter )
+                {
+                    if( !EnterRecords( step, aInBitStream ) )
+                    {
+                        break;
+                    }
+                    continue;
+                }
+                else if( step.kind == Step::Leave )
+                {
+                    LeaveRecord();
+                    continue;
+                }
+                else if( step.kind == Step::Switch )
+                {
+                    if( !SelectCase( step ) )
+                    {
+                        return Control::Error;
+                    }
+                    continue;
+                }
+
+                Field const& curField = *step.field;
+                if( ( aInBitStream.GetBitsTillEnd() == 0 ) && !IsEmptyArray( curField ) )
+                {
+                    // Wait for more data; only empty arrays can complete without it
+                    break;
+                }
+
+                Control::Type fieldRet = Control::Continue;
+                switch( curField.GetFieldType() )
+                {
+                    case FieldType::Numeric:
+                        fieldRet = Parse( static_cast< NumericField const& >( curField ), aInBitStream );
+                        break;
+
+                    case FieldType::String:
+                        fieldRet = Parse( static_cast< StringField const& >( curField ), aInBitStream );
+                        break;
+
+                    case FieldType::Float:
+                        fieldRet = Parse( static_cast< FloatField const& >( curField ), aInBitStream );
+                        break;
+
+                    case FieldType::Array:
+                        fieldRet = Parse( static_cast< ArrayField const& >( curField ), aInBitStream );
+                        break;
+
+                    case FieldType::Unknown:
+                    default:
+                        mContext.Log( stderr, Msg( "Failed to parse " ) << curField.GetTypeStr() << " field " << curField.GetName(), Context::LogLevel::Problem );
+                        fieldRet = Control::Error;
+                        break;
+                }
+                if( fieldRet != Control::Continue )
+                {
+                    return fieldRet;
+                }
+                else if( !mFieldIsComplete )
+                {
+                    break;
+                }
+                ++mStep;
+
+                // Reset per-field parsing state
+                mFieldIsComplete = false;
+                mNumericValueBuilder.Reset();
+                mString.Reset();
+                mArray.Reset();
+            }
+            return Control::Continue;
+        }
+
+        //! Move on to the next record, which begins at aPosBits in the data
+        Control::Type EndRecord
+            (
+            uint64_t const aPosBits
+            )
+        {
+            ++mRecord;
+            if( mRecord == mFirstRecord )
+            {
+                mOut.rdbuf( mOutBuf );
+            }
+            if( ( mIndex != NULL ) && !IndexRecord( aPosBits ) )
+            {
+                return Control::Error;
+            }
+            if( ( mBoundaries != NULL ) && ( mBoundaries->size() < MaxResyncRecords ) )
+            {
+                RecordBoundary const boundary = { aPosBits, mOut.tellp() };
+                mBoundaries->push_back( boundary );
+            }
+            return Control::Continue;
+        }
+
+        //! @return Whether aField is an array with no elements, which needs no data
+        bool IsEmptyArray
+            (
+            Field const& aField
+            )
+        {
+            return ( aField.GetFieldType() == FieldType::Array ) &&
+                ( GetArraySize( mFieldValues, static_cast< ArrayField const& >( aField ) ) == 0U );
+        }
+
+        //! Set up the element size and count of an array field, and print its opening
+        //!
+        //! @return true if successful, false otherwise.
+        bool BeginArray
+            (
+            ArrayField const& aField
+            )
+        {
+            // Plain pointers avoid reference counting for every array decoded
+            Field const* const element = aField.GetElement().get();
+            NumericField const* const numericElement = ( element->GetFieldType() == FieldType::Numeric )
+                ? static_cast< NumericField const* >( element )
+                : NULL;
+            FloatField const* const floatElement = ( element->GetFieldType() == FieldType::Float )
+                ? static_cast< FloatField const* >( element )
+                : NULL;
+            if( numericElement != NULL )
+            {
+                NumericFieldProperties const& props = numericElement->GetNumericFieldProperties();
+                mArray.elementBits = props.mIntegralBits + props.mFractionalBits;
+                mArray.wordsPerElement = 1;
+            }
+            else if( floatElement != NULL )
+            {
+                mArray.elementBits = floatElement->GetBits();
+                mArray.wordsPerElement = Bfdp::BitManip::BitsToBytes( mArray.elementBits ) / sizeof( uint64_t );
+                mArray.wordsPerElement = std::max< size_t >( mArray.wordsPerElement, 1U );
+            }
+            if( !Bfdp::IsWithinRange< size_t >( 1U, mArray.elementBits / mArray.wordsPerElement, Bfdp::BitManip::BytesToBits( sizeof( uint64_t ) ) ) )
+            {
+                mContext.Log( stderr, Msg( "Unsupported array " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                return false;
+            }
+
+            mArray.remaining = GetArraySize( mFieldValues, aField );
+
+            mArray.field = &aField;
+            PrintName( aField );
+            mOut << "[";
+            return true;
+        }
+
+        //! Set up the codec and termination state of a string field
+        //!
+        //! @return true if successful, false otherwise.
+        bool BeginString
+            (
+            StringField const& aField
+            )
+        {
+            mCodec = FindCodec( mCodecs, aField.GetCoding() );
+            if( mCodec == NULL )
+            {
+                mContext.Log( stderr, Msg( "Unsupported coding for " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                return false;
+            }
+
+            StringLengthType::Id const lengthType = aField.GetLengthType();
+            if( lengthType != StringLengthType::Prefixed )
+            {
+                // All supported codings are byte-oriented, so a terminator is found by searching
+                // for a single byte.
+                Bfdp::Byte term[MaxSymbolBytes];
+                if( ( mCodec->converter->GetMaxBytes() > sizeof( term ) ) ||
+                    ( 1U != mCodec->converter->ConvertSymbol( aField.GetTermChar(), term, sizeof( term ) ) ) )
+                {
+                    mContext.Log( stderr, Msg( "Unsupported terminator for " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                    return false;
+                }
+                mString.termByte = term[0];
+            }
+
+            mString.field = &aField;
+            mString.lengthKnown = ( lengthType != StringLengthType::Prefixed );
+            mString.remaining = ( lengthType == StringLengthType::Fixed )
+                ? static_cast< FStringField const& >( aField ).GetNumBytes()
+                : 0U;
+            return true;
+        }
+
+        //! Print a complete string field
+        //!
+        //! @return true if successful, false otherwise.
+        bool EmitString
+            (
+            StringField const& aField,
+            Bfdp::Byte const* const aData,
+            size_t aSize
+            )
+        {
+            if( aField.GetLengthType() == StringLengthType::Fixed )
+            {
+                // Fixed-length strings are padded after the terminator
+                Bfdp::Byte const* term = static_cast< Bfdp::Byte const* >( std::memchr( aData, mString.termByte, aSize ) );
+                if( term != NULL )
+                {
+                    aSize = static_cast< size_t >( term - aData );
+                }
+                else if( !aField.AllowsUnterminated() )
+                {
+                    mContext.Log( stderr, Msg( "Unterminated string " ) << aField.GetName(), Context::LogLevel::Problem );
+                    return false;
+                }
+            }
+
+            PrintName( aField );
+            mOut << "\"";
+            PrintString( mOut, aData, aSize, *mCodec->converter, mCodec->asciiCompatible );
+            mOut << "\"" << std::endl;
+            return true;
+        }
+
+        Control::Type Parse
+            (
+            ArrayField const& aField,
+            GenericBitStream& aInBitStream
+            )
+        {
+            if( ( mArray.field == NULL ) && !BeginArray( aField ) )
+            {
+                return Control::Error;
+            }
+
+            // Unpack as many whole elements as are buffered, a chunk at a time
+            size_t const wordBits = mArray.elementBits / mArray.wordsPerElement;
+            size_t const posBits = aInBitStream.GetPosBits();
+            size_t const available = aInBitStream.GetBitsTillEnd() / mArray.elementBits;
+            size_t count = static_cast< size_t >( std::min< ArraySizeType >( mArray.remaining, available ) );
+            size_t pos = posBits;
+            while( count > 0 )
+            {
+                size_t const chunk = std::min( count, MaxArrayChunk );
+                mArray.words.resize( chunk * mArray.wordsPerElement );
+                mReader.ReadArray( aInBitStream.GetDataPtr(), pos, wordBits, mArray.words.size(), mArray.words.data() );
+                if( !PrintArrayElements( *aField.GetElement(), chunk ) )
+                {
+                    return Control::Error;
+                }
+                pos += chunk * mArray.elementBits;
+                count -= chunk;
+                mArray.remaining -= chunk;
+            }
+
+            if( !aInBitStream.SeekBits( pos ) )
+            {
+                BFDP_INTERNAL_ERROR( "Failed to seek past array data" );
+                return Control::Error;
+            }
+
+            bool const done = ( mArray.remaining == 0 );
+            if( done )
+            {
+                mOut << "]" << std::endl;
+            }
+            mFieldIsPending = !done;
+            mFieldIsComplete = done;
+            return ( done || ( pos != posBits ) )
+                ? Control::Continue
+                : Control::NoData;
+        }
+
+        Control::Type Parse
+            (
+            FloatField const& aField,
+            GenericBitStream& aInBitStream
+            )
+        {
+            size_t const bits = aField.GetBits();
+            if( aInBitStream.GetBitsTillEnd() < bits )
+            {
+                mFieldIsPending = true;
+                return Control::NoData;
+            }
+            mFieldIsPending = false;
+
+            // Read the raw word(s) with the field's bit and byte order, then reinterpret them
+            uint64_t raw = 0;
+            uint64_t rawHigh = 0;
+            bool ok = false;
+            if( bits <= Bfdp::BitManip::BytesToBits( sizeof( raw ) ) )
+            {
+                ok = mReader.ReadBits( aInBitStream, bits, raw );
+            }
+            else
+            {
+                size_t const halfBits = bits / 2;
+                uint64_t first = 0;
+                uint64_t second = 0;
+                ok = mReader.ReadBits( aInBitStream, halfBits, first ) &&
+                    mReader.ReadBits( aInBitStream, halfBits, second );
+                bool const highFirst = ( mReader.GetByteOrder() == Bfdp::BitManip::Endianness::Big );
+                rawHigh = highFirst ? first : second;
+                raw = highFirst ? second : first;
+            }
+            if( !ok )
+            {
+                mContext.Log( stderr, Msg( "Failed to read " ) << aField.GetName(), Context::LogLevel::Problem );
+                return Control::Error;
+            }
+
+            double value = 0.0;
+            std::streamsize digits = 0;
+            if( !DecodeFloat( aField.GetFormat(), raw, rawHigh, value, digits ) )
+            {
+                mContext.Log( stderr, Msg( "Unsupported field " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                return Control::Error;
+            }
+
+            std::streamsize const prevPrecision = mOut.precision( digits );
+            PrintName( aField );
+            mOut << value << std::endl;
+            mOut.precision( prevPrecision );
+
+            mFieldIsComplete = true;
+            return Control::Continue;
+        }
+
+        Control::Type Parse
+            (
+            NumericField const& aField,
+            GenericBitStream& aInBitStream
+            )
+        {
+            if( !mNumericValueBuilder.HasProperties() )
+            {
+                if( !mNumericValueBuilder.SetFieldProperties( aField.GetNumericFieldProperties() ) )
+                {
+                    mContext.Log( stderr, Msg( "Unsupported field " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
+                    return Control::Error;
+                }
+            }
+            size_t bitsToRead = mNumericValueBuilder.GetBitsTillComplete();
+            if( bitsToRead == 0 )
+            {
+                return Control::Continue;
+            }
+            else if( aInBitStream.GetBitsTillEnd() < bitsToRead )
+            {
+                // Byte and bit order apply to the field as a whole, so wait until all of it is
+                // buffered rather than reading it in pieces.
+                mFieldIsPending = true;
+                return Control::NoData;
+            }
+            mFieldIsPending = false;
+
+            uint64_t uintValue = 0;
+            if( !mReader.ReadBits( aInBitStream, bitsToRead, uintValue ) )
+            {
+                mContext.Log( stderr, Msg( "Failed to read " ) << aField.GetName(), Context::LogLevel::Problem );
+                return Control::Error;
+            }
+            if( !mNumericValueBuilder.ParseBits( uintValue, bitsToRead ) )
+            {
+                mContext.Log( stderr, Msg( "Failed to parse " ) << aField.GetName(), Context::LogLevel::Problem );
+                return Control::Error;
+            }
+            if( mNumericValueBuilder.IsComplete() )
+            {
+                // If complete, dump value and mark complete
+                // TODO: Should have a FixedPointNumber class that encapsulates the value, makes it pretty, etc...
+                if( mNumericValueBuilder.IsSigned() )
+                {
+                    PrintName( aField );
+                    mOut << mNumericValueBuilder.GetRawS64() << std::endl;
+                }
+                else
+                {
+                    PrintName( aField );
+                    mOut << mNumericValueBuilder.GetRawU64() << std::endl;
+                }
+                if( !mFieldValues.empty() )
+                {
+                    FieldValueMap::iterator iter = mFieldValues.find( &aField );
+                    if( iter != mFieldValues.end() )
+                    {
+                        iter->second = mNumericValueBuilder.GetRawU64();
+                    }
+                }
+                mFieldIsComplete = true;
+            }
+            // Either way, continue
+            return Control::Continue;
+        }
+
+        Control::Type Parse
+            (
+            StringField const& aField,
+            GenericBitStream& aInBitStream
+            )
+        {
+            if( ( mString.field == NULL ) && !BeginString( aField ) )
+            {
+                return Control::Error;
+            }
+
+            if( !mString.lengthKnown )
+            {
+                // Prefixed-length string; the length is read like any other numeric field
+                size_t const prefixBits = static_cast< PStringField const& >( aField ).GetLengthBits();
+                if( aInBitStream.GetBitsTillEnd() < prefixBits )
+                {
+                    mFieldIsPending = true;
+                    return Control::NoData;
+                }
+
+                uint64_t length = 0;
+                if( !mReader.ReadBits( aInBitStream, prefixBits, length ) )
+                {
+                    mContext.Log( stderr, Msg( "Failed to read length of " ) << aField.GetName(), Context::LogLevel::Problem );
+                    return Control::Error;
+                }
+                mString.remaining = static_cast< size_t >( length );
+                mString.lengthKnown = true;
+            }
+
+            size_t const posBits = aInBitStream.GetPosBits();
+            Bfdp::BitManip::BitView const view = aInBitStream.GetView();
+            Bfdp::Byte const* data = NULL;
+            size_t availBytes = 0;
+            if( !view.GetAlignedBytes( data, availBytes ) )
+            {
+                // Strings are byte-oriented, but may follow a field that ends mid-byte; search
+                // and copy from a realigned view of the buffered bytes.
+                availBytes = view.GetSizeBits() / Bfdp::BitManip::BitsPerByte;
+                mString.scratch.resize( availBytes );
+                for( size_t i = 0; i < availBytes; ++i )
+                {
+                    mString.scratch[i] = static_cast< char >( mReader.Read( aInBitStream.GetDataPtr(), posBits + Bfdp::BitManip::BytesToBits( i ), Bfdp::BitManip::BitsPerByte ) );
+                }
+                data = reinterpret_cast< Bfdp::Byte const* >( mString.scratch.data() );
+            }
+
+            size_t dataBytes = 0;
+            size_t consumedBytes = 0;
+            bool done = false;
+            if( aField.GetLengthType() == StringLengthType::Bounded )
+            {
+                // memchr() is vectorized by the C library, which beats a byte-wise scan for any
+                // string of useful length.
+                Bfdp::Byte const* term = static_cast< Bfdp::Byte const* >( std::memchr( data, mString.termByte, availBytes ) );
+                done = ( term != NULL );
+                dataBytes = done ? static_cast< size_t >( term - data ) : availBytes;
+                consumedBytes = done ? dataBytes + 1 : dataBytes;
+            }
+            else
+            {
+                dataBytes = std::min( availBytes, mString.remaining );
+                consumedBytes = dataBytes;
+                mString.remaining -= dataBytes;
+                done = ( mString.remaining == 0 );
+            }
+
+            bool ok = true;
+            if( done && mString.text.empty() )
+            {
+                // The whole string is buffered; print it from there without copying
+                ok = EmitString( aField, data, dataBytes );
+            }
+            else
+            {
+                // The string straddles the buffer; hold on to the part seen so far
+                mString.text.append( reinterpret_cast< char const* >( data ), dataBytes );
+                if( done )
+                {
+                    ok = EmitString( aField, reinterpret_cast< Bfdp::Byte const* >( mString.text.data() ), mString.text.size() );
+                }
+            }
+            if( !ok )
+            {
+                return Control::Error;
+            }
+
+            if( !aInBitStream.SeekBits( posBits + Bfdp::BitManip::BytesToBits( consumedBytes ) ) )
+            {
+                BFDP_INTERNAL_ERROR( "Failed to seek past string data" );
+                return Control::Error;
+            }
+
+            mFieldIsPending = !done;
+            mFieldIsComplete = done;
+            return ( done || ( aInBitStream.GetPosBits() != posBits ) )
+                ? Control::Continue
+                : Control::NoData;
+        }
+
+        //! Print the full name of a field within the current records, followed by '='
+        void PrintName
+            (
+            Field const& aField
+            )
+        {
+            mOut << mPrefix << aField.GetName() << '=';
+        }
+
+        //! Print unpacked array elements, separated by commas
+        //!
+        //! @return true if successful, false otherwise.
+        bool PrintArrayElements
+            (
+            Field const& aElement,
+            size_t const aCount
+            )
+        {
+            uint64_t const* const words = mArray.words.data();
+            if( aElement.GetFieldType() == FieldType::Numeric )
+            {
+                bool const isSigned = static_cast< NumericField const& >( aElement ).GetNumericFieldProperties().mSigned;
+                size_t const extendShift = Bfdp::BitManip::BytesToBits( sizeof( uint64_t ) ) - mArray.elementBits;
+                for( size_t i = 0; i < aCount; ++i )
+                {
+                    mOut << ( mArray.first ? "" : ", " );
+                    mArray.first = false;
+                    if( isSigned )
+                    {
+                        // Sign-extend from the element width
+                        mOut << ( static_cast< int64_t >( words[i] << extendShift ) >> extendShift );
+                    }
+                    else
+                    {
+                        mOut << words[i];
+                    }
+                }
+                return true;
+            }
+
+            FloatFormat::Id const format = static_cast< FloatField const& >( aElement ).GetFormat();
+            bool const highFirst = ( mReader.GetByteOrder() == Bfdp::BitManip::Endianness::Big );
+            std::streamsize const prevPrecision = mOut.precision();
+            for( size_t i = 0; i < aCount; ++i )
+            {
+                uint64_t const* const element = &words[i * mArray.wordsPerElement];
+                uint64_t low = element[0];
+                uint64_t high = 0U;
+                if( mArray.wordsPerElement > 1 )
+                {
+                    high = highFirst ? element[0] : element[1];
+                    low = highFirst ? element[1] : element[0];
+                }
 
-    class StreamDataObserver
-        : public Bfdp::Stream::IStreamObserver
+                double value = 0.0;
+                std::streamsize digits = 0;
+                if( !DecodeFloat( format, low, high, value, digits ) )
+                {
+                    mOut.precision( prevPrecision );
+                    mContext.Log( stderr, Msg( "Unsupported field " ) << aElement.GetTypeStr() << " " << aElement.GetName(), Context::LogLevel::Problem );
+                    return false;
+                }
+                mOut.precision( digits );
+                mOut << ( mArray.first ? "" : ", " ) << value;
+                mArray.first = false;
+            }
+            mOut.precision( prevPrecision );
+            return true;
+        }
+
+        ArrayState mArray;
+
+        //! Where to add the end of each decoded record, or NULL
+        RecordBoundaryList* mBoundaries;
+
+        //! Enter step of each union case; a Switch step indexes its cases from Step::cases
+        std::vector< size_t > mCaseSteps;
+
+        //! Coding of the current string field, and every coding used so far
+        Codec const* mCodec;
+        CodecMap mCodecs;
+
+        Context& mContext;
+        size_t mDepth;
+
+        //! Position in the data at which decoding stops, once a record ends
+        uint64_t mEndPosBits;
+
+        //! Record after the last one to print, where decoding stops
+        uint64_t mEndRecord;
+
+        bool mFieldIsComplete;
+        bool mFieldIsPending;
+        FieldValueMap mFieldValues;
+
+        //! First record to print
+        uint64_t mFirstRecord;
+
+        Frame mFrames[MaxFrameDepth];
+
+        //! Index to add decoded records to, or NULL
+        RecordIndex* mIndex;
+
+        Layout mLayout;
+        NumericValueBuilder mNumericValueBuilder;
+
+        //! Output of decoded fields; has no buffer outside of the records to print
+        std::ostream mOut;
+        std::streambuf* mOutBuf;
+
+        //! Position in the data of the unread part of the buffer
+        uint64_t mPosBits;
+
+        std::string mPrefix;
+        EndianBitReader mReader;
+
+        //! Number of the current record, counting from the start of the data
+        uint64_t mRecord;
+
+        size_t mStep;
+        StringState mString;
+    };
+
+    namespace CmdParseInternal
     {
-    public:
-        StreamDataObserver
+
+        //! @return A data stream of the given format, or NULL if the format is not supported.
+        static Bfdp::Stream::StreamPtr CreateStream
+            (
+            std::string const& aFormat,
+            std::string const& aName,
+            std::istream& aIn,
+            Bfdp::Stream::IStreamObserver& aObserver
+            )
+        {
+            Bfdp::Stream::StreamPtr streamPtr = nullptr;
+            if( aFormat == "raw" )
+            {
+                streamPtr = std::make_shared< Bfdp::Stream::RawStream >( aName, aIn, aObserver );
+            }
+            return streamPtr;
+        }
+
+        //! Read a data stream to its end, or to the end of the records to decode
+        //!
+        //! @return An empty string if successful, or a description of the failure.
+        static std::string ReadRecords
+            (
+            Bfdp::Stream::StreamBase& aStream,
+            StreamDataObserver& aObserver
+            )
+        {
+            if( !aStream.ReadStream() || aStream.HasError() )
+            {
+                // TODO: Print parse context from Stream object
+                return "Binary data stream parse failure";
+            }
+            else if( !aObserver.EndOfStream() )
+            {
+                return "Data stream ended within a field";
+            }
+            return std::string();
+        }
+
+        //! Log how well streams reused their read buffers
+        static void LogBufferPoolStats
             (
             Context& aContext
             )
-            : mContext( aContext )
-            , mFieldIsComplete( false )
         {
+            Bfdp::Data::BufferPool const& pool = Bfdp::Data::BufferPool::GetShared();
+            aContext.Log( stdout, Msg( "Stream buffers: " ) << std::to_string( pool.GetHits() ) << " reused, "
+                << std::to_string( pool.GetMisses() ) << " allocated", Context::LogLevel::Debug );
         }
 
-        //! Set the pointer to the field root.
-        void SetRoot
+        //! Index the records of the data in a pass that prints nothing, then rewind the data
+        //!
+        //! @return true if successful, false otherwise.
+        static bool IndexRecords
             (
-            TreePtr& aRoot
+            Context& aContext,
+            TreePtr& aRoot,
+            std::string const& aFormat,
+            std::string const& aName,
+            std::istream& aIn,
+            RecordIndex& aIndex
             )
         {
-            mFrameStack.clear();
-            mFrameStack.emplace_back( aRoot );
+            StreamDataObserver observer( aContext );
+            Bfdp::Stream::StreamPtr streamPtr = CreateStream( aFormat, aName, aIn, observer );
+            BFDP_RETURNIF_V( !streamPtr || !observer.SetRoot( aRoot ), false );
+            observer.SetEndianness
+                (
+                aRoot->GetNumericPropertyWithDefault< Endianness::Type >( "DefaultBitOrder", Endianness::Default ),
+                aRoot->GetNumericPropertyWithDefault< Endianness::Type >( "DefaultByteOrder", Endianness::Default )
+                );
+            BFDP_RETURNIF_V( !observer.SetRecords( 0, 0, NoRecordLimit, NoRecordLimit, &aIndex ), false );
 
-            Frame& rootFrame = mFrameStack.back();
-            aRoot->IterateFields( &StreamDataObserver::AddFieldsToFrame, &rootFrame );
-            // Reset the end iterator, in case of ambiguity in C++03 and incomplete
-            // implementation of C++11 by compilers.
-            rootFrame.mCurFieldIter = rootFrame.mFields.end();
+            aContext.Log( stdout, Msg( "Indexing records of " ) << aName, Context::LogLevel::Debug );
+            bool const ok = ReadRecords( *streamPtr, observer ).empty();
+            aIn.clear();
+            aIn.seekg( 0, std::ios::beg );
+            BFDP_RETURNIF_V( !ok || !aIn, false );
+
+            aIndex.Complete( observer.GetNumRecords() );
+            return true;
         }
 
-    private:
-        typedef std::list< FieldPtr > FieldList;
-        struct Frame
+        //! A run of records decoded on its own by a worker thread
+        struct Shard
         {
-            Frame
+            Shard
                 (
-                TreePtr& aTree
+                Context& aContext,
+                Bfdp::Byte const* const aData,
+                size_t const aSize
                 )
-                : mFields()
-                , mCurFieldIter( mFields.end() )
-                , mTree( aTree )
+                : buffer( aData, aSize )
+                , in( &buffer )
+                , observer( aContext )
+                , beginBits( 0 )
+                , processedBits( 0 )
             {
             }
 
-            FieldList mFields;
-            FieldList::iterator mCurFieldIter;
-            TreePtr mTree;
+            //! The bytes that hold the records
+            Bfdp::Stream::MemoryStreamBuf buffer;
+            std::istream in;
+
+            StreamDataObserver observer;
+            Bfdp::Stream::StreamPtr stream;
+
+            //! Decoded fields, printed once every earlier shard has been
+            std::stringbuf out;
+
+            //! Position in the data of the first record
+            uint64_t beginBits;
+
+            //! End of the first records decoded
+            RecordBoundaryList boundaries;
+
+            //! Amount of data decoded
+            uint64_t processedBits;
+
+            //! Description of the decode failure, or empty if successful
+            std::string error;
+
+            Bfdp::Thread::TaskPool::TaskPtr task;
         };
-        typedef std::list< Frame > FrameStack;
+        typedef std::shared_ptr< Shard > ShardPtr;
 
-        static void AddFieldsToFrame
+        //! Records to decode in parallel
+        struct ShardPlan
+        {
+            std::string format;
+            std::string name;
+
+            //! Data holding the records
+            Bfdp::Byte const* data;
+            size_t dataBytes;
+
+            //! Size of every record, or 0 if records vary in size
+            uint64_t recordBits;
+            Endianness::Type bitOrder;
+            Endianness::Type byteOrder;
+
+            //! First record to decode, and the record after the last
+            uint64_t firstRecord;
+            uint64_t endRecord;
+
+            //! Records per shard
+            uint64_t shardRecords;
+
+            //! Whether the last shard runs to the end of the data, to report any partial record
+            bool toEnd;
+        };
+
+        //! Set up the decoding of shard aIndex of aPlan
+        //!
+        //! @return The shard, or NULL on failure.
+        static ShardPtr CreateShard
             (
-            FieldPtr& aField,
-            void* const aArg
+            Context& aContext,
+            TreePtr& aRoot,
+            ShardPlan const& aPlan,
+            size_t const aIndex,
+            bool const aLast
             )
         {
-            Frame* frame = reinterpret_cast< Frame* >( aArg );
-            frame->mFields.push_back( aField );
+            uint64_t const firstRecord = aPlan.firstRecord + ( aIndex * aPlan.shardRecords );
+            uint64_t const endRecord = ( aLast && aPlan.toEnd )
+                ? NoRecordLimit
+                : std::min( firstRecord + aPlan.shardRecords, aPlan.endRecord );
+            uint64_t const beginBits = firstRecord * aPlan.recordBits;
+            uint64_t const endBits = ( endRecord == NoRecordLimit )
+                ? Bfdp::BitManip::BytesToBits( aPlan.dataBytes )
+                : endRecord * aPlan.recordBits;
+            size_t const beginByte = static_cast< size_t >( std::min< uint64_t >( beginBits / Bfdp::BitManip::BitsPerByte, aPlan.dataBytes ) );
+            size_t const endByte = static_cast< size_t >( std::min< uint64_t >( ( endBits + Bfdp::BitManip::BitsPerByte - 1 ) / Bfdp::BitManip::BitsPerByte, aPlan.dataBytes ) );
+
+            ShardPtr shard = std::make_shared< Shard >( aContext, aPlan.data + beginByte, endByte - beginByte );
+            shard->stream = CreateStream( aPlan.format, aPlan.name, shard->in, shard->observer );
+            BFDP_RETURNIF_V( !shard->stream || !shard->observer.SetRoot( aRoot ), ShardPtr() );
+            shard->observer.SetEndianness( aPlan.bitOrder, aPlan.byteOrder );
+            shard->observer.SetOutput( &shard->out );
+            BFDP_RETURNIF_V( !shard->observer.SetRecords( firstRecord, beginBits, firstRecord, endRecord, NULL ), ShardPtr() );
+
+            // Records need not begin on a byte boundary
+            size_t const skipBits = static_cast< size_t >( beginBits % Bfdp::BitManip::BitsPerByte );
+            BFDP_RETURNIF_V( ( skipBits != 0 ) && ( endByte != beginByte ) && !shard->stream->Seek( skipBits ), ShardPtr() );
+            return shard;
         }
 
-        BFDP_OVERRIDE( Control::Type OnStreamData
+        //! Decode records of a fixed size in record-aligned shards across a pool of threads, and
+        //! print the shards in order
+        //!
+        //! @return 0 if successful, nonzero otherwise.
+        static int DecodeShards
             (
-            GenericBitStream& aInBitStream
-            ) )
+            Context& aContext,
+            TreePtr& aRoot,
+            ShardPlan const& aPlan,
+            size_t const aNumThreads,
+            uint64_t& aOutProcessedBits
+            )
         {
-            if( mFrameStack.empty() )
+            aOutProcessedBits = 0;
+            uint64_t const numRecords = ( aPlan.endRecord > aPlan.firstRecord ) ? aPlan.endRecord - aPlan.firstRecord : 0U;
+            size_t numShards = static_cast< size_t >( ( numRecords + aPlan.shardRecords - 1 ) / aPlan.shardRecords );
+            if( aPlan.toEnd )
             {
-                // Should always leave the top frame loaded to avoid churning
-                // through the database re-loading it all the time; so this
-                // likely means SetRoot() wasn't called.
-                BFDP_INTERNAL_ERROR( "Failed to get current frame" );
-                return Control::Error;
+                // Any partial record at the end is decoded (and reported) by the last shard
+                numShards = std::max< size_t >( numShards, 1U );
             }
-            Frame& curFrame = mFrameStack.back();
-            // Handle end of frame
-            while( curFrame.mCurFieldIter == curFrame.mFields.end() )
+            aContext.Log( stdout, Msg( "Decoding " ) << std::to_string( numShards ) << " shards on " << std::to_string( aNumThreads ) << " threads", Context::LogLevel::Debug );
+
+            // Keep a bounded number of shards in flight, so that output is held in memory for
+            // only a few shards at a time.  The pool is declared last so that it finishes (skipping
+            // any shards still queued after a failure) before the shards are released.
+            std::atomic< bool > stopped( false );
+            std::deque< ShardPtr > pending;
+            Bfdp::Thread::TaskPool pool( aNumThreads );
+            size_t const window = aNumThreads * ShardsPerThread;
+            size_t next = 0;
+            for( size_t i = 0; i < numShards; ++i )
             {
-                if( mFrameStack.size() > 1 ) {
-                    // End of a non-root frame, pop the stack to the parent.
-                    mFrameStack.pop_back();
-                    curFrame = mFrameStack.back();
-                }
-                else
+                while( ( next < numShards ) && ( next < i + window ) )
                 {
-                    // Root frame; just cycle back to the first field.
-                    curFrame.mCurFieldIter = curFrame.mFields.begin();
-                    if( curFrame.mCurFieldIter == curFrame.mFields.end() )
+                    ShardPtr shard = CreateShard( aContext, aRoot, aPlan, next, next + 1 == numShards );
+                    if( !shard )
                     {
-                        // Most likely cause is that the spec did not define any fields.
-                        // Stop with an error to avoid an infinite loop.
-                        mContext.Log( stderr, Msg( "No fields to parse" ), Context::LogLevel::Problem );
-                        return Control::Error;
+                        aContext.Log( stderr, Msg( "Failed to set up shard of " ) << aPlan.name, Context::LogLevel::Problem );
+                        stopped = true;
+                        return 1;
                     }
+                    Shard* const work = shard.get();
+                    shard->task = pool.Submit( [work, &stopped]()
+                        {
+                            if( stopped )
+                            {
+                                work->error = "Stopped";
+                                return;
+                            }
+                            work->error = ReadRecords( *work->stream, work->observer );
+                            work->processedBits = Bfdp::BitManip::BytesToBits( static_cast< uint64_t >( work->stream->GetTotalProcessedBytes() ) ) +
+                                work->stream->GetTotalProcessedBits();
+                        } );
+                    pending.push_back( shard );
+                    ++next;
                 }
-            }
-
-            while( aInBitStream.GetBitsTillEnd() )
-            {
-                FieldPtr curField = *curFrame.mCurFieldIter;
-                Control::Type fieldRet = Control::Continue;
-                switch( curField->GetFieldType() )
-                {
-                    case FieldType::Numeric:
-                        fieldRet = Parse( *NumericField::StaticCast( curField ), aInBitStream );
-                        break;
 
-                    case FieldType::String:
-                    case FieldType::Unknown:
-                    default:
-                        mContext.Log( stderr, Msg( "Failed to parse " ) << curField->GetTypeStr() << " field " << curField->GetName(), Context::LogLevel::Problem );
-                        fieldRet = Control::Error;
-                        break;
-                }
-                if( fieldRet != Control::Continue )
-                {
-                    return fieldRet;
-                }
-                else if( !mFieldIsComplete )
+                ShardPtr shard = pending.front();
+                pending.pop_front();
+                pool.Wait( shard->task );
+                std::string const text = shard->out.str();
+                std::cout.write( text.data(), static_cast< std::streamsize >( text.size() ) );
+                aOutProcessedBits += shard->processedBits;
+                if( !shard->error.empty() )
                 {
+                    aContext.Log( stderr, Msg( shard->error ), Context::LogLevel::Problem );
+                    stopped = true;
                     break;
                 }
-                curFrame.mCurFieldIter++;
+            }
 
-                // Reset per-field parsing state
-                mFieldIsComplete = false;
-                mNumericValueBuilder.Reset();
+            return stopped ? 1 : 0;
+        }
 
-                if( curFrame.mCurFieldIter == curFrame.mFields.end() ) {
-                    // Reached the end of the frame; continue to the next.
-                    return Control::Continue;
-                }
-            }
-            return Control::Continue;
+        //! Set up the decoding of the records that begin at aBeginBits of aPlan's data, up to the
+        //! first record boundary at or past aEndBits
+        //!
+        //! @param[in] aFirstRecord First record to print, counting from the first record of the
+        //!     shard; NoRecordLimit prints nothing.
+        //! @param[in] aEndRecord Record after the last one to decode, counting the same way
+        //! @return The shard, or NULL on failure.
+        static ShardPtr CreateShardAt
+            (
+            Context& aContext,
+            TreePtr& aRoot,
+            ShardPlan const& aPlan,
+            uint64_t const aBeginBits,
+            uint64_t const aEndBits,
+            uint64_t const aFirstRecord,
+            uint64_t const aEndRecord
+            )
+        {
+            size_t const beginByte = static_cast< size_t >( aBeginBits / Bfdp::BitManip::BitsPerByte );
+            ShardPtr shard = std::make_shared< Shard >( aContext, aPlan.data + beginByte, aPlan.dataBytes - beginByte );
+            shard->beginBits = aBeginBits;
+            shard->stream = CreateStream( aPlan.format, aPlan.name, shard->in, shard->observer );
+            BFDP_RETURNIF_V( !shard->stream || !shard->observer.SetRoot( aRoot ), ShardPtr() );
+            shard->observer.SetEndianness( aPlan.bitOrder, aPlan.byteOrder );
+            shard->observer.SetOutput( &shard->out );
+            shard->observer.SetEndPosition( aEndBits );
+            shard->observer.SetBoundaries( &shard->boundaries );
+            BFDP_RETURNIF_V( !shard->observer.SetRecords( 0, aBeginBits, aFirstRecord, aEndRecord, NULL ), ShardPtr() );
+
+            size_t const skipBits = static_cast< size_t >( aBeginBits % Bfdp::BitManip::BitsPerByte );
+            BFDP_RETURNIF_V( ( skipBits != 0 ) && !shard->stream->Seek( skipBits ), ShardPtr() );
+            return shard;
         }
 
-        Control::Type Parse
+        //! Guess where the first record at or past aBeginBits of aPlan's data begins, and set up
+        //! the decoding of records from there up to the first record boundary at or past aEndBits
+        //!
+        //! A record is guessed to begin at the first byte from which SyncRecords records decode
+        //! without error, or from which the records decode to the end of the data.
+        //!
+        //! @return The shard, or NULL if no record was found.
+        static ShardPtr FindShard
             (
-            NumericField const& aField,
-            GenericBitStream& aInBitStream
+            Context& aContext,
+            TreePtr& aRoot,
+            ShardPlan const& aPlan,
+            uint64_t const aBeginBits,
+            uint64_t const aEndBits
             )
         {
-            if( !mNumericValueBuilder.HasProperties() )
+            uint64_t const dataBits = Bfdp::BitManip::BytesToBits( static_cast< uint64_t >( aPlan.dataBytes ) );
+            uint64_t const searchEndBits = std::min( aEndBits, aBeginBits + Bfdp::BitManip::BytesToBits( static_cast< uint64_t >( MaxSyncBytes ) ) );
+            for( uint64_t posBits = aBeginBits; posBits < searchEndBits; posBits += Bfdp::BitManip::BitsPerByte )
             {
-                if( !mNumericValueBuilder.SetFieldProperties( aField.GetNumericFieldProperties() ) )
+                ShardPtr probe = CreateShardAt( aContext, aRoot, aPlan, posBits, NoPosLimit, NoRecordLimit, SyncRecords );
+                BFDP_RETURNIF_V( !probe, ShardPtr() );
+                if( ReadRecords( *probe->stream, probe->observer ).empty() &&
+                    ( ( probe->observer.GetNumRecords() == SyncRecords ) || ( probe->observer.GetPosBits() == dataBits ) ) )
                 {
-                    mContext.Log( stderr, Msg( "Unsupported field " ) << aField.GetTypeStr() << " " << aField.GetName(), Context::LogLevel::Problem );
-                    return Control::Error;
+                    return CreateShardAt( aContext, aRoot, aPlan, posBits, aEndBits, 0, NoRecordLimit );
                 }
             }
-            size_t bitsToRead = std::min( aInBitStream.GetBitsTillEnd(), mNumericValueBuilder.GetBitsTillComplete() );
-            if( bitsToRead == 0 )
-            {
-                return Control::Continue;
-            }
-            uint64_t uintValue = 0;
-            if( !aInBitStream.ReadBits(reinterpret_cast< Bfdp::Byte* >( &uintValue ), bitsToRead ) )
-            {
-                mContext.Log( stderr, Msg( "Failed to read " ) << aField.GetName(), Context::LogLevel::Problem );
-                return Control::Error;
-            }
-            if( !mNumericValueBuilder.ParseBits( uintValue, bitsToRead ) )
+            return ShardPtr();
+        }
+
+        //! Find where the records of aShard, decoded from a guessed position, meet the records
+        //! that begin at aPosBits, by decoding from aPosBits up to the last of the record
+        //! boundaries kept by aShard
+        //!
+        //! @param[out] aOutBridge Output of the records from aPosBits up to where they meet
+        //! @return The amount of the output of aShard before where the records meet, or -1 if they
+        //!     do not meet.
+        static std::streamoff Resynchronize
+            (
+            Context& aContext,
+            TreePtr& aRoot,
+            ShardPlan const& aPlan,
+            Shard const& aShard,
+            uint64_t const aPosBits,
+            std::string& aOutBridge
+            )
+        {
+            RecordBoundaryList const& boundaries = aShard.boundaries;
+            BFDP_RETURNIF_V( boundaries.empty() || ( aPosBits > boundaries.back().posBits ), -1 );
+            ShardPtr bridge = CreateShardAt( aContext, aRoot, aPlan, aPosBits, boundaries.back().posBits, 0, NoRecordLimit );
+            BFDP_RETURNIF_V( !bridge || !ReadRecords( *bridge->stream, bridge->observer ).empty(), -1 );
+
+            // Both lists of boundaries are in order of position
+            RecordBoundary const start = { aPosBits, 0 };
+            size_t j = 0;
+            for( size_t i = 0; i <= bridge->boundaries.size(); ++i )
             {
-                mContext.Log( stderr, Msg( "Failed to parse " ) << aField.GetName(), Context::LogLevel::Problem );
-                return Control::Error;
+                RecordBoundary const& boundary = ( i == 0 ) ? start : bridge->boundaries[i - 1];
+                while( ( j < boundaries.size() ) && ( boundaries[j].posBits < boundary.posBits ) )
+                {
+                    ++j;
+                }
+                if( ( j < boundaries.size() ) && ( boundaries[j].posBits == boundary.posBits ) )
+                {
+                    aOutBridge = bridge->out.str().substr( 0, static_cast< size_t >( boundary.outBytes ) );
+                    return boundaries[j].outBytes;
+                }
             }
-            if( mNumericValueBuilder.IsComplete() )
+            return -1;
+        }
+
+        //! A shard of records that vary in size, decoded from a guessed position
+        struct Speculation
+        {
+            //! Position in the data at which the search for the first record begins, and at which
+            //! the next shard's search begins
+            uint64_t beginBits;
+            uint64_t endBits;
+
+            //! Decoded records, or NULL if no record was found
+            ShardPtr shard;
+
+            Bfdp::Thread::TaskPool::TaskPtr task;
+        };
+        typedef std::shared_ptr< Speculation > SpeculationPtr;
+
+        //! Decode records that vary in size in shards across a pool of threads, and print the
+        //! shards in order
+        //!
+        //! The records of each shard are decoded from a guessed position, then validated against
+        //! the end of the records of the shard before it.  When the guess was wrong, printing
+        //! resumes from a matching record boundary of the shard, or else the shard is decoded
+        //! again from the right position.
+        //!
+        //! @return 0 if successful, nonzero otherwise.
+        static int DecodeSpeculativeShards
+            (
+            Context& aContext,
+            TreePtr& aRoot,
+            ShardPlan const& aPlan,
+            size_t const aNumThreads,
+            uint64_t& aOutProcessedBits
+            )
+        {
+            uint64_t const dataBits = Bfdp::BitManip::BytesToBits( static_cast< uint64_t >( aPlan.dataBytes ) );
+            size_t const numShards = static_cast< size_t >( std::max< uint64_t >( ( dataBits + ShardBits - 1 ) / ShardBits, 1U ) );
+            aContext.Log( stdout, Msg( "Decoding " ) << std::to_string( numShards ) << " speculative shards on " << std::to_string( aNumThreads ) << " threads", Context::LogLevel::Debug );
+
+            // Problems found by speculative decoding are reported only when a shard is decoded
+            // from a validated position
+            Context quietContext( aContext );
+            quietContext.Silence();
+
+            // As for DecodeShards(), the pool is declared last so that it finishes before the
+            // shards are released
+            std::atomic< bool > stopped( false );
+            std::deque< SpeculationPtr > pending;
+            Bfdp::Thread::TaskPool pool( aNumThreads );
+            size_t const window = aNumThreads * ShardsPerThread;
+            size_t next = 0;
+            size_t numResynced = 0;
+            size_t numRedecoded = 0;
+            aOutProcessedBits = 0;
+            for( size_t i = 0; i < numShards; ++i )
             {
-                // If complete, dump value and mark complete
-                // TODO: Should have a FixedPointNumber class that encapsulates the value, makes it pretty, etc...
-                if( mNumericValueBuilder.IsSigned() )
+                while( ( next < numShards ) && ( next < i + window ) )
                 {
-                    std::cout << aField.GetName() << "=" << mNumericValueBuilder.GetRawS64() << std::endl;
+                    SpeculationPtr speculation = std::make_shared< Speculation >();
+                    speculation->beginBits = next * ShardBits;
+                    speculation->endBits = std::min( ( next + 1 ) * ShardBits, dataBits );
+                    Speculation* const work = speculation.get();
+                    speculation->task = pool.Submit( [work, &aRoot, &aPlan, &quietContext, &stopped]()
+                        {
+                            if( stopped )
+                            {
+                                return;
+                            }
+                            work->shard = ( work->beginBits == 0 )
+                                ? CreateShardAt( quietContext, aRoot, aPlan, 0, work->endBits, 0, NoRecordLimit )
+                                : FindShard( quietContext, aRoot, aPlan, work->beginBits, work->endBits );
+                            if( work->shard )
+                            {
+                                work->shard->error = ReadRecords( *work->shard->stream, work->shard->observer );
+                            }
+                        } );
+                    pending.push_back( speculation );
+                    ++next;
                 }
-                else
+
+                SpeculationPtr speculation = pending.front();
+                pending.pop_front();
+                pool.Wait( speculation->task );
+                if( ( i != 0 ) && ( aOutProcessedBits >= speculation->endBits ) )
                 {
-                    std::cout << aField.GetName() << "=" << mNumericValueBuilder.GetRawU64() << std::endl;
+                    // Every record that begins in this shard was decoded by an earlier shard
+                    continue;
+                }
+
+                // Validate the guess against the end of the records printed so far
+                ShardPtr shard = speculation->shard;
+                std::string bridge;
+                std::streamoff outBytes = -1;
+                if( shard && shard->error.empty() && ( shard->beginBits == aOutProcessedBits ) )
+                {
+                    outBytes = 0;
+                }
+                else if( shard && shard->error.empty() )
+                {
+                    outBytes = Resynchronize( quietContext, aRoot, aPlan, *shard, aOutProcessedBits, bridge );
+                    numResynced += ( outBytes < 0 ) ? 0U : 1U;
+                }
+                if( outBytes < 0 )
+                {
+                    // The guess was wrong, or decoding failed; decode again from where the
+                    // records printed so far end, reporting any problems this time
+                    shard = CreateShardAt( aContext, aRoot, aPlan, aOutProcessedBits, speculation->endBits, 0, NoRecordLimit );
+                    if( !shard )
+                    {
+                        aContext.Log( stderr, Msg( "Failed to set up shard of " ) << aPlan.name, Context::LogLevel::Problem );
+                        stopped = true;
+                        return 1;
+                    }
+                    shard->error = ReadRecords( *shard->stream, shard->observer );
+                    outBytes = 0;
+                    ++numRedecoded;
+                }
+
+                std::string const text = shard->out.str();
+                std::cout.write( bridge.data(), static_cast< std::streamsize >( bridge.size() ) );
+                std::cout.write( text.data() + outBytes, static_cast< std::streamsize >( text.size() ) - outBytes );
+                aOutProcessedBits = shard->observer.GetPosBits();
+                if( !shard->error.empty() )
+                {
+                    aContext.Log( stderr, Msg( shard->error ), Context::LogLevel::Problem );
+                    stopped = true;
+                    break;
                 }
-                mFieldIsComplete = true;
             }
-            // Either way, continue
-            return Control::Continue;
+
+            aContext.Log( stdout, Msg( "Resynchronized " ) << std::to_string( numResynced ) << " shards, decoded " << std::to_string( numRedecoded ) << " again", Context::LogLevel::Debug );
+            return stopped ? 1 : 0;
         }
 
-        Context& mContext;
-        bool mFieldIsComplete;
-        FrameStack mFrameStack;
-        NumericValueBuilder mNumericValueBuilder;
-    };
+    } // namespace CmdParseInternal
 
     int CmdParse
         (
@@ -308,6 +2194,30 @@ namespace App
                     .SetDefault( "raw", "format" )
                     .SetCallback( SaveToParamMap )
                     .SetUserdataPtr( &args )
+                )
+            .Add( Param::CreateLong( "records", 'r' )
+                    .SetDescription( "Records to print, as first:end (end excluded; negative counts back from the end)" )
+                    .SetDefault( "", "range" )
+                    .SetCallback( SaveToParamMap )
+                    .SetUserdataPtr( &args )
+                )
+            .Add( Param::CreateLong( "index", 'i' )
+                    .SetDescription( "Path to record index file (created if missing or stale)" )
+                    .SetDefault( "", "index_file" )
+                    .SetCallback( SaveToParamMap )
+                    .SetUserdataPtr( &args )
+                )
+            .Add( Param::CreateLong( "index-interval" )
+                    .SetDescription( "Number of records between index entries" )
+                    .SetDefault( "1024", "count" )
+                    .SetCallback( SaveToParamMap )
+                    .SetUserdataPtr( &args )
+                )
+            .Add( Param::CreateLong( "threads", 't' )
+                    .SetDescription( "Number of threads to decode records with (0 := all cores)" )
+                    .SetDefault( "1", "count" )
+                    .SetCallback( SaveToParamMap )
+                    .SetUserdataPtr( &args )
                 );
 
         int ret = parser.Parse( aArgV, aArgC );
@@ -318,6 +2228,34 @@ namespace App
             return ret;
         }
 
+        std::string recordsStr = args["records"];
+        bool const ranged = !recordsStr.empty();
+        RecordRange range = { 0, 0, false };
+        if( ranged && !ParseRecordRange( recordsStr, range ) )
+        {
+            aContext.Log( stderr, Msg( "Invalid record range '" ) << recordsStr << "'", Context::LogLevel::Problem );
+            return 1;
+        }
+
+        std::string indexFileName = args["index"];
+        int64_t indexInterval = 0;
+        if( !ParseRecordNumber( args["index-interval"], indexInterval ) || ( indexInterval <= 0 ) )
+        {
+            aContext.Log( stderr, Msg( "Invalid index interval '" ) << args["index-interval"] << "'", Context::LogLevel::Problem );
+            return 1;
+        }
+
+        int64_t numThreads = 0;
+        if( !ParseRecordNumber( args["threads"], numThreads ) || ( numThreads < 0 ) )
+        {
+            aContext.Log( stderr, Msg( "Invalid number of threads '" ) << args["threads"] << "'", Context::LogLevel::Problem );
+            return 1;
+        }
+        else if( numThreads == 0 )
+        {
+            numThreads = static_cast< int64_t >( Bfdp::Thread::TaskPool::GetDefaultNumThreads() );
+        }
+
         std::string specFileName = args["spec"];
         std::string dataFileName = args["data"];
         std::fstream dataFileStream;
@@ -339,12 +2277,8 @@ namespace App
 
         // Validate the input format and create a data stream
         std::string format_str = args["format"];
-        Bfdp::Stream::StreamPtr streamPtr = nullptr;
         StreamDataObserver streamDataObserver( aContext );
-        if( format_str == "raw" )
-        {
-            streamPtr = std::make_shared< Bfdp::Stream::RawStream >( dataFileName, dataFileStream, streamDataObserver );
-        }
+        Bfdp::Stream::StreamPtr streamPtr = CreateStream( format_str, dataFileName, dataFileStream, streamDataObserver );
         if( !streamPtr )
         {
             aContext.Log( stderr, Msg( "Invalid stream format '" ) << format_str << "'", Context::LogLevel::Problem );
@@ -357,7 +2291,7 @@ namespace App
         }
 
         // Create a database to receive objects discovered from the stream
-        DatabasePtr db = Database::Create();
+        DatabasePtr db = Database::CreateArena();
         if( !db )
         {
             aContext.Log( stderr, Msg( "Failed to create Database" ), Context::LogLevel::Problem );
@@ -367,7 +2301,7 @@ namespace App
         // Set Filename property for future reference
         PropertyPtr fileNameProp = Property::StaticCast
             (
-            db->GetRoot()->Add( std::make_shared< Property >( "Filename" ) )
+            db->GetRoot()->Add( BfsdlParser::Objects::CreateObject< Property >( db->GetRoot()->GetAllocator(), "Filename" ) )
             );
         if( !fileNameProp ||
             !fileNameProp->SetString( specFileName ) )
@@ -376,48 +2310,165 @@ namespace App
             return -1;
         }
 
-        std::fstream specStream( specFileName.c_str(), std::ios::in | std::ios::binary );
-        if( !specStream.is_open() )
+        uint64_t specKey = 0;
+        aContext.Log( stdout, Msg( "Processing BFSDL Stream..." ) << specFileName, Context::LogLevel::Debug );
+        if( !LoadSpec( db->GetRoot(), specFileName, ret, specKey ) )
         {
             aContext.Log( stderr, Msg( "Failed to open " ) << specFileName, Context::LogLevel::Problem );
             return 1;
         }
-        else
+        else if( ret != 0 )
         {
-            aContext.Log( stdout, Msg( "Processing BFSDL Stream..." ) << specFileName, Context::LogLevel::Debug );
-            ret = BfsdlParser::ParseStream( db->GetRoot(), specStream, 4096 );
-            specStream.close();
-            if( ret != 0 )
-            {
-                // If the BFSDL stream is not loaded, stop early
-                return ret;
-            }
+            // If the BFSDL stream is not loaded, stop early
+            return ret;
         }
 
-        streamDataObserver.SetRoot( db->GetRoot() );
+        if( !streamDataObserver.SetRoot( db->GetRoot() ) )
+        {
+            return 1;
+        }
         Endianness::Type defaultBitOrder = db->GetRoot()->GetNumericPropertyWithDefault< Endianness::Type >( "DefaultBitOrder", Endianness::Default );
         Endianness::Type defaultByteOrder = db->GetRoot()->GetNumericPropertyWithDefault< Endianness::Type >( "DefaultByteOrder", Endianness::Default );
-        if( Endianness::Little != defaultBitOrder )
+        streamDataObserver.SetEndianness( defaultBitOrder, defaultByteOrder );
+
+        // Records of a fixed size are found by their number; otherwise an index of the records
+        // is loaded, or built by the first pass over the data.
+        uint64_t dataBytes = 0;
+        bool const seekable = GetStreamSize( dataFileStream, dataBytes );
+        uint64_t recordBits = 0;
+        bool const fixedSize = seekable && streamDataObserver.GetFixedRecordBits( recordBits );
+        uint64_t numRecords = fixedSize ? Bfdp::BitManip::BytesToBits( dataBytes ) / recordBits : 0U;
+        bool haveCount = fixedSize;
+        bool buildIndex = false;
+        RecordIndex index;
+        if( !indexFileName.empty() && !seekable )
+        {
+            aContext.Log( stderr, Msg( "Cannot index records of " ) << dataFileName, Context::LogLevel::Problem );
+            return 1;
+        }
+        else if( !indexFileName.empty() && ( specKey == 0 ) )
+        {
+            // A streamed spec has no key to check a saved index against
+            aContext.Log( stderr, Msg( "Cannot index records with spec " ) << specFileName, Context::LogLevel::Problem );
+            return 1;
+        }
+        else if( !indexFileName.empty() && !fixedSize )
         {
-            aContext.Log( stderr, Msg( "Unsupported DefaultBitOrder" ), Context::LogLevel::Problem );
-            // TODO: Add support in Stream (hint: probably need to use something other than GenericBitStream... )
+            haveCount = index.Load( indexFileName ) && index.IsMatch( dataBytes, specKey );
+            numRecords = index.GetNumRecords();
+            buildIndex = !haveCount;
+        }
+        if( range.NeedsCount() && !haveCount )
+        {
+            if( !seekable )
+            {
+                aContext.Log( stderr, Msg( "Cannot count records of " ) << dataFileName, Context::LogLevel::Problem );
+                return 1;
+            }
+            buildIndex = true;
+        }
+
+        if( buildIndex )
+        {
+            index.Reset( static_cast< uint64_t >( indexInterval ), dataBytes, specKey );
+        }
+        if( buildIndex && ranged )
+        {
+            // Index in a pass of its own, so that decoding can begin close to the range
+            if( !IndexRecords( aContext, db->GetRoot(), format_str, dataFileName, dataFileStream, index ) )
+            {
+                aContext.Log( stderr, Msg( "Failed to index records of " ) << dataFileName, Context::LogLevel::Problem );
+                return 1;
+            }
+            if( !indexFileName.empty() && !index.Save( indexFileName ) )
+            {
+                aContext.Log( stderr, Msg( "Failed to save record index " ) << indexFileName, Context::LogLevel::Problem );
+                return 1;
+            }
+            buildIndex = false;
+            numRecords = index.GetNumRecords();
+        }
+
+        uint64_t const firstRecord = ResolveRecord( range.first, numRecords );
+        uint64_t const endRecord = range.hasEnd ? ResolveRecord( range.end, numRecords ) : NoRecordLimit;
+
+        // Records of a fixed size can be decoded independently of each other; records that vary
+        // in size are decoded from guessed positions, unless the first pass builds an index.
+        // Either needs the data mapped in memory, so stdin, pipes and empty files are decoded
+        // sequentially.
+        Bfdp::Data::MappedFile dataMap;
+        bool const speculative = !fixedSize && !ranged && !buildIndex;
+        bool const mapped = ( numThreads > 1 ) && ( fixedSize || speculative ) && !args["data"].empty() &&
+            dataMap.Open( dataFileName ) && ( dataMap.GetConstPtr() != NULL );
+        if( mapped )
+        {
+            ShardPlan plan;
+            plan.format = format_str;
+            plan.name = dataFileName;
+            plan.data = dataMap.GetConstPtr();
+            plan.dataBytes = dataMap.GetSize();
+            plan.recordBits = recordBits;
+            plan.bitOrder = defaultBitOrder;
+            plan.byteOrder = defaultByteOrder;
+            plan.firstRecord = firstRecord;
+            plan.endRecord = std::min( endRecord, numRecords );
+            plan.shardRecords = fixedSize ? std::max< uint64_t >( ShardBits / recordBits, 1U ) : 0U;
+            plan.toEnd = ( endRecord >= numRecords );
+
+            uint64_t processedBits = 0;
+            ret = fixedSize
+                ? DecodeShards( aContext, db->GetRoot(), plan, static_cast< size_t >( numThreads ), processedBits )
+                : DecodeSpeculativeShards( aContext, db->GetRoot(), plan, static_cast< size_t >( numThreads ), processedBits );
+            aContext.Log( stdout, Msg( "Total: " ) << std::to_string( processedBits / Bfdp::BitManip::BitsPerByte ) << "." << std::to_string( processedBits % Bfdp::BitManip::BitsPerByte ) << " Bb", Context::LogLevel::Info );
+            LogBufferPoolStats( aContext );
+            return ret;
+        }
+
+        uint64_t startRecord = 0;
+        uint64_t startBits = 0;
+        if( fixedSize )
+        {
+            startRecord = std::min( firstRecord, numRecords );
+            startBits = startRecord * recordBits;
+        }
+        else if( index.IsComplete() && !index.Find( firstRecord, startRecord, startBits ) )
+        {
+            BFDP_INTERNAL_ERROR( "Empty record index" );
             return 1;
         }
-        if( Endianness::Little != defaultByteOrder )
+        if( ( startBits != 0 ) && !streamPtr->Seek( startBits ) )
+        {
+            // Decode from the beginning instead
+            startRecord = 0;
+            startBits = 0;
+        }
+        if( startRecord != 0 )
+        {
+            aContext.Log( stdout, Msg( "Starting at record " ) << std::to_string( startRecord ), Context::LogLevel::Debug );
+        }
+        if( !streamDataObserver.SetRecords( startRecord, startBits, firstRecord, endRecord, buildIndex ? &index : NULL ) )
         {
-            aContext.Log( stderr, Msg( "Unsupported DefaultByteOrder" ), Context::LogLevel::Problem );
-            // TODO: Add support in Stream (hint: probably need to use something other than GenericBitStream... )
             return 1;
         }
 
         aContext.Log( stdout, Msg( "Processing data stream " ) << dataFileName << " as '" << format_str << "'", Context::LogLevel::Debug );
-        if( !streamPtr->ReadStream() || streamPtr->HasError() )
+        std::string const error = ReadRecords( *streamPtr, streamDataObserver );
+        if( !error.empty() )
         {
-            aContext.Log( stderr, Msg( "Binary data stream parse failure" ), Context::LogLevel::Problem );
-            // TODO: Print parse context from Stream object
+            aContext.Log( stderr, Msg( error ), Context::LogLevel::Problem );
             ret = 1;
         }
+        else if( buildIndex )
+        {
+            index.Complete( streamDataObserver.GetNumRecords() );
+            if( !index.Save( indexFileName ) )
+            {
+                aContext.Log( stderr, Msg( "Failed to save record index " ) << indexFileName, Context::LogLevel::Problem );
+                ret = 1;
+            }
+        }
         aContext.Log( stdout, Msg( "Total: " ) << streamPtr->GetTotalProcessedStr(), Context::LogLevel::Info );
+        LogBufferPoolStats( aContext );
 
         return ret;
     }
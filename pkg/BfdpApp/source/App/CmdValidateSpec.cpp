@@ -36,17 +36,19 @@
 #include "App/Commands.hpp"
 
 // External Includes
-#include <fstream>
 #include <memory>
 
 // Internal Includes
 #include "App/Common.hpp"
 #include "Bfdp/ErrorReporter/Functions.hpp"
 #include "Bfdp/Unicode/Common.hpp"
+#include "BfsdlParser/Objects/ArrayField.hpp"
+#include "BfsdlParser/Objects/ClassField.hpp"
 #include "BfsdlParser/Objects/Database.hpp"
 #include "BfsdlParser/Objects/IObject.hpp"
 #include "BfsdlParser/Objects/Property.hpp"
 #include "BfsdlParser/Objects/Tree.hpp"
+#include "BfsdlParser/Objects/UnionField.hpp"
 #include "BfsdlParser/StreamParser.hpp"
 
 using Bfdp::Console::ArgParser;
@@ -56,35 +58,87 @@ using Bfdp::Console::Param;
 namespace App
 {
 
+    using BfsdlParser::Objects::ArrayField;
     using BfsdlParser::Objects::BitBase;
     using BfsdlParser::Objects::BfsdlVersionType;
+    using BfsdlParser::Objects::ClassField;
     using BfsdlParser::Objects::Database;
     using BfsdlParser::Objects::DatabasePtr;
     using BfsdlParser::Objects::Endianness;
     using BfsdlParser::Objects::Field;
     using BfsdlParser::Objects::FieldPtr;
+    using BfsdlParser::Objects::FieldType;
+    using BfsdlParser::Objects::Ieee754VersionType;
     using BfsdlParser::Objects::IObjectPtr;
     using BfsdlParser::Objects::ObjectType;
     using BfsdlParser::Objects::Property;
     using BfsdlParser::Objects::PropertyPtr;
     using BfsdlParser::Objects::Tree;
     using BfsdlParser::Objects::TreePtr;
+    using BfsdlParser::Objects::UnionField;
+    using BfsdlParser::Objects::UnionFieldPtr;
 
     namespace CmdValidateSpecInternal
     {
         static bool gIsTestMode = false;
 
-        static void DumpField
+        struct FieldDump
+        {
+            Context* context;
+
+            //! Names of the enclosing class fields, each followed by '.'
+            std::string prefix;
+        };
+
+        static void DumpNestedField
             (
             FieldPtr& aField,
             void* const aArg
             )
         {
-            Context* context = reinterpret_cast< Context* >( aArg );
+            FieldDump* dump = reinterpret_cast< FieldDump* >( aArg );
 
             std::stringstream ss;
-            ss << "FIELD " << aField->GetName() << " : " << aField->GetTypeStr();
-            context->Log( stdout, Msg( ss.str() ), Context::LogLevel::Info );
+            ss << "FIELD " << dump->prefix << aField->GetName() << " : " << aField->GetTypeStr();
+            dump->context->Log( stdout, Msg( ss.str() ), Context::LogLevel::Info );
+
+            // Fields of a class (or an array of them) follow, named within the class field
+            FieldPtr element = aField;
+            if( element->GetFieldType() == FieldType::Array )
+            {
+                element = ArrayField::StaticCast( aField )->GetElement();
+            }
+            if( element && ( element->GetFieldType() == FieldType::Class ) )
+            {
+                FieldDump nested = { dump->context, dump->prefix + aField->GetName() + "." };
+                ClassField::StaticCast( element )->GetClass()->IterateFields( &DumpNestedField, &nested );
+            }
+
+            // Each case of a union follows, named by its tag value
+            UnionFieldPtr unionField = UnionField::StaticCast( aField );
+            for( size_t i = 0; unionField && ( i < unionField->GetNumCases() ); ++i )
+            {
+                TreePtr const& caseClass = unionField->GetCaseClass( i );
+
+                std::stringstream caseName;
+                caseName << dump->prefix << aField->GetName() << "(" << unionField->GetCaseTag( i ) << ")";
+                std::stringstream caseSs;
+                caseSs << "FIELD " << caseName.str() << " : " << caseClass->GetName();
+                dump->context->Log( stdout, Msg( caseSs.str() ), Context::LogLevel::Info );
+
+                FieldDump nested = { dump->context, caseName.str() + "." };
+                caseClass->IterateFields( &DumpNestedField, &nested );
+            }
+        }
+
+        static void DumpField
+            (
+            FieldPtr& aField,
+            void* const aArg
+            )
+        {
+            FieldDump dump = { reinterpret_cast< Context* >( aArg ), std::string() };
+            DumpNestedField( aField, &dump );
         }
 
         static void DumpProperty
@@ -159,10 +213,24 @@ namespace App
                     ss << "<invalid>";
                 }
             }
-            else if( aProperty->GetName() == "DefaultStringCode" )
+            else if(
+                ( aProperty->GetName() == "DefaultStringCode" ) ||
+                ( aProperty->GetName() == "DefaultFloatFormat" ) )
             {
                 ss << aProperty->GetString();
             }
+            else if( aProperty->GetName() == "IEEE754Version" )
+            {
+                Ieee754VersionType version = 0;
+                if( aProperty->GetNumericValue( version ) )
+                {
+                    ss << version;
+                }
+                else
+                {
+                    ss << "<invalid>";
+                }
+            }
             else if( aProperty->GetName() == "Filename" )
             {
                 if( gIsTestMode )
@@ -244,7 +312,7 @@ namespace App
         }
 
         // Create a database to receive objects discovered from the stream
-        DatabasePtr db = Database::Create();
+        DatabasePtr db = Database::CreateArena();
         if( !db )
         {
             BFDP_RUNTIME_ERROR( "Failed to create Database" );
@@ -254,7 +322,7 @@ namespace App
         // Set Filename property for future reference
         PropertyPtr fileNameProp = Property::StaticCast
             (
-            db->GetRoot()->Add( std::make_shared< Property >( "Filename" ) )
+            db->GetRoot()->Add( BfsdlParser::Objects::CreateObject< Property >( db->GetRoot()->GetAllocator(), "Filename" ) )
             );
         if( !fileNameProp ||
             !fileNameProp->SetString( specFile ) )
@@ -263,17 +331,12 @@ namespace App
             return -1;
         }
 
-        std::fstream fs( specFile.c_str(), std::ios::in | std::ios::binary );
-        if( !fs.is_open() )
+        uint64_t specKey;
+        if( !LoadSpec( db->GetRoot(), specFile, ret, specKey ) )
         {
             BFDP_RUNTIME_ERROR( "Cannot open file" );
             ret = 1;
         }
-        else
-        {
-            ret = BfsdlParser::ParseStream( db->GetRoot(), fs, 4096 );
-            fs.close();
-        }
 
         db->Iterate( &aContext, DumpProperty, DumpField );
 
@@ -35,13 +35,43 @@
 // Base Includes
 #include "App/Common.hpp"
 
+// External Includes
+#include <fstream>
+
 // Internal Includes
+#include "Bfdp/Algorithm/Calc.hpp"
+#include "Bfdp/Data/MappedFile.hpp"
 #include "Bfdp/ErrorReporter/Functions.hpp"
 #include "Bfdp/Macros.hpp"
+#include "BfsdlParser/StreamParser.hpp"
 
 namespace App
 {
 
+    bool LoadSpec
+        (
+        BfsdlParser::Objects::TreePtr const aRoot,
+        std::string const& aFileName,
+        int& aResult,
+        uint64_t& aKey
+        )
+    {
+        aKey = 0;
+        Bfdp::Data::MappedFile specData;
+        if( specData.Open( aFileName ) )
+        {
+            aResult = BfsdlParser::ParseBuffer( aRoot, specData.GetConstPtr(), specData.GetSize() );
+            aKey = Bfdp::Algorithm::FastHash( specData.GetConstPtr(), specData.GetSize() );
+            return true;
+        }
+
+        std::fstream fs( aFileName.c_str(), std::ios::in | std::ios::binary );
+        BFDP_RETURNIF_V( !fs, false );
+
+        aResult = BfsdlParser::ParseStream( aRoot, fs, 4096 );
+        return true;
+    }
+
     int SaveToParamMap
         (
         Bfdp::Console::ArgParser const& aParser,
@@ -87,4 +87,9 @@ namespace App
         }
     }
 
+    void Context::Silence()
+    {
+        mLogLevel = static_cast< int >( LogLevel::Problem ) - 1;
+    }
+
 } // namespace App
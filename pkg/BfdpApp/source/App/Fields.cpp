@@ -0,0 +1,137 @@
+/**
+    BFDP Console Application Field Helpers
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#define BFDP_MODULE "App::Fields"
+
+// Base Includes
+#include "App/Fields.hpp"
+
+// Internal Includes
+#include "BfsdlParser/Objects/ClassField.hpp"
+
+namespace App
+{
+
+    using BfsdlParser::Objects::ArrayField;
+    using BfsdlParser::Objects::ArraySizeType;
+    using BfsdlParser::Objects::ClassField;
+    using BfsdlParser::Objects::Endianness;
+    using BfsdlParser::Objects::Field;
+    using BfsdlParser::Objects::FieldPtr;
+    using BfsdlParser::Objects::FieldType;
+    using BfsdlParser::Objects::Tree;
+
+    void AddFieldToList
+        (
+        FieldPtr& aField,
+        void* const aArg
+        )
+    {
+        reinterpret_cast< FieldList* >( aArg )->push_back( aField );
+    }
+
+    Codec const* FindCodec
+        (
+        CodecMap& aCodecs,
+        Bfdp::Unicode::CodingId const aCodingId
+        )
+    {
+        CodecMap::iterator iter = aCodecs.find( aCodingId );
+        if( iter == aCodecs.end() )
+        {
+            Codec codec;
+            codec.converter = Bfdp::Unicode::GetCodec( aCodingId );
+            codec.asciiCompatible = ( codec.converter != NULL );
+            for( Bfdp::Byte b = 0x20U; codec.asciiCompatible && ( b <= 0x7EU ); ++b )
+            {
+                Bfdp::Unicode::CodePoint symbol = 0;
+                Bfdp::Byte encoded[MaxSymbolBytes];
+                codec.asciiCompatible = ( 1U == codec.converter->ConvertBytes( &b, 1U, symbol ) ) &&
+                    ( symbol == b ) &&
+                    ( codec.converter->GetMaxBytes() <= sizeof( encoded ) ) &&
+                    ( 1U == codec.converter->ConvertSymbol( b, encoded, sizeof( encoded ) ) ) &&
+                    ( encoded[0] == b );
+            }
+            iter = aCodecs.insert( CodecMap::value_type( aCodingId, codec ) ).first;
+        }
+        return iter->second.converter ? &iter->second : NULL;
+    }
+
+    ArraySizeType GetArraySize
+        (
+        FieldValueMap const& aValues,
+        ArrayField const& aField
+        )
+    {
+        if( aField.GetCountField() )
+        {
+            return GetFieldValue( aValues, *aField.GetCountField() );
+        }
+        return aField.GetCount();
+    }
+
+    uint64_t GetFieldValue
+        (
+        FieldValueMap const& aValues,
+        Field const& aField
+        )
+    {
+        FieldValueMap::const_iterator iter = aValues.find( &aField );
+        return ( iter != aValues.end() ) ? iter->second : 0U;
+    }
+
+    Tree const* GetRecordClass
+        (
+        Field const& aField
+        )
+    {
+        Field const* field = &aField;
+        if( field->GetFieldType() == FieldType::Array )
+        {
+            field = static_cast< ArrayField const& >( aField ).GetElement().get();
+        }
+        return ( ( field != NULL ) && ( field->GetFieldType() == FieldType::Class ) )
+            ? static_cast< ClassField const* >( field )->GetClass().get()
+            : NULL;
+    }
+
+    Bfdp::BitManip::Endianness::Type ToBitManipEndianness
+        (
+        Endianness::Type const aEndianness
+        )
+    {
+        return ( aEndianness == Endianness::Big )
+            ? Bfdp::BitManip::Endianness::Big
+            : Bfdp::BitManip::Endianness::Little;
+    }
+
+} // namespace App
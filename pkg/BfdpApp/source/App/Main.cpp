@@ -123,7 +123,8 @@ int BFDP_app_main
     std::stringstream cmdText;
     cmdText << "Commands:" << std::endl
         << "    help - Show this help text" << std::endl
-        << "    " APP_CMD_PARSE_NAME " - " APP_CMD_PARSE_DESC
+        << "    " APP_CMD_ENCODE_NAME " - " APP_CMD_ENCODE_DESC << std::endl
+        << "    " APP_CMD_PARSE_NAME " - " APP_CMD_PARSE_DESC << std::endl
         << "    " APP_CMD_VALIDATE_SPEC_NAME " - " APP_CMD_VALIDATE_SPEC_DESC;
     parser.SetEpilogue( cmdText.str() );
 
@@ -155,6 +156,10 @@ int BFDP_app_main
             BFDP_MISUSE_ERROR( "Test Misuse Error");
             BFDP_RUNTIME_ERROR( "Test RunTime Error");
         }
+        else if( cmd == APP_CMD_ENCODE_NAME )
+        {
+            ret = CmdEncode( gContext, argc - cmdIdx, &argv[cmdIdx] );
+        }
         else if( cmd == APP_CMD_PARSE_NAME )
         {
             ret = CmdParse( gContext, argc - cmdIdx, &argv[cmdIdx] );
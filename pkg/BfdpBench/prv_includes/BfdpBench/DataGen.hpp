@@ -0,0 +1,71 @@
+/**
+    BFDP Bench Synthetic Data Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfdpBench_DataGen
+#define BfdpBench_DataGen
+
+// External Includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Internal Includes
+#include "Bfdp/String.hpp"
+#include "BfdpGen/Random.hpp"
+
+namespace BfdpBench
+{
+
+    //! @return aSize random bytes
+    std::vector< Bfdp::Byte > GenerateBytes
+        (
+        size_t const aSize,
+        uint64_t const aSeed = BfdpGen::DefaultSeed
+        );
+
+    //! @return aCount distinct identifiers of varying length
+    std::vector< std::string > GenerateNames
+        (
+        size_t const aCount,
+        uint64_t const aSeed = BfdpGen::DefaultSeed
+        );
+
+    //! @return About aSize bytes of valid UTF-8 text, mixing 1 to 4 byte sequences
+    std::string GenerateUtf8
+        (
+        size_t const aSize,
+        uint64_t const aSeed = BfdpGen::DefaultSeed
+        );
+
+} // namespace BfdpBench
+
+#endif // BfdpBench_DataGen
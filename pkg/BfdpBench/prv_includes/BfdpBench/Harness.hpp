@@ -0,0 +1,192 @@
+/**
+    BFDP Bench Harness Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfdpBench_Harness
+#define BfdpBench_Harness
+
+// External Includes
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+
+//! Register a benchmark function with the harness
+//!
+//! @param _name Name reported for the benchmark, as "Group/Case"
+//! @param _func Function of type BfdpBench::BenchFunc
+#define BFDP_BENCH( _name, _func ) \
+    static BfdpBench::Registrar const gRegistrar_##_func( _name, _func )
+
+namespace BfdpBench
+{
+
+    //! State of one timed run of a benchmark
+    //!
+    //! A benchmark function does its setup, then runs the work under test in a
+    //! `while( aState.KeepRunning() )` loop.  Only the loop is timed.
+    class State BFDP_FINAL
+        : private Bfdp::NonAssignable
+        , private Bfdp::NonCopyable
+    {
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        explicit State
+            (
+            uint64_t const aIterations
+            );
+
+        //! @return Bytes processed by one iteration, or 0 if not set
+        uint64_t GetBytesPerIteration() const;
+
+        //! @return Time spent in the KeepRunning() loop
+        uint64_t GetElapsedNs() const;
+
+        //! @return The reason given to SkipWithError(), or empty if none
+        std::string const& GetError() const;
+
+        uint64_t GetIterations() const;
+
+        //! @return Combination of the values passed to Sink()
+        uint64_t GetSink() const;
+
+        //! @return Whether the loop should run again
+        inline bool KeepRunning();
+
+        //! Set how many bytes of input each iteration processes, for throughput
+        void SetBytesPerIteration
+            (
+            uint64_t const aBytes
+            );
+
+        //! Keep a result alive, so the work that produced it cannot be optimized away
+        inline void Sink
+            (
+            uint64_t const aValue
+            );
+
+        //! Stop the benchmark and report it as failed
+        //!
+        //! @note Call before entering the loop, or break out of it afterwards.
+        void SkipWithError
+            (
+            std::string const& aReason
+            );
+
+    private:
+        uint64_t mBytesPerIteration;
+        Clock::time_point mEnd;
+        std::string mError;
+        uint64_t const mIterations;
+        uint64_t mRemaining;
+        uint64_t mSink;
+        Clock::time_point mStart;
+    };
+
+    typedef void (*BenchFunc)
+        (
+        State& aState
+        );
+
+    //! Adds a benchmark to the harness during static initialization
+    //!
+    //! @see BFDP_BENCH
+    class Registrar BFDP_FINAL
+    {
+    public:
+        Registrar
+            (
+            char const* const aName,
+            BenchFunc const aFunc
+            );
+    };
+
+    struct Options
+    {
+        Options();
+
+        //! Only run benchmarks whose name contains this text (all if empty)
+        std::string filter;
+
+        //! Report format: "text" or "json"
+        std::string format;
+
+        //! Minimum time for each timed run
+        uint64_t minTimeMs;
+
+        //! Path to write the report to (stdout if empty)
+        std::string outFileName;
+
+        //! Number of timed runs per benchmark; the median is reported
+        size_t repetitions;
+    };
+
+    //! Run the registered benchmarks selected by aOptions and write the report
+    //!
+    //! @return 0 if every selected benchmark ran successfully
+    int RunBenchmarks
+        (
+        Options const& aOptions
+        );
+
+    bool State::KeepRunning()
+    {
+        if( mRemaining == mIterations )
+        {
+            mStart = Clock::now();
+        }
+
+        if( ( mRemaining == 0U ) || !mError.empty() )
+        {
+            mEnd = Clock::now();
+            return false;
+        }
+
+        --mRemaining;
+        return true;
+    }
+
+    void State::Sink
+        (
+        uint64_t const aValue
+        )
+    {
+        mSink = ( mSink * 31U ) ^ aValue;
+    }
+
+} // namespace BfdpBench
+
+#endif // BfdpBench_Harness
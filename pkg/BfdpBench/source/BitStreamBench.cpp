@@ -0,0 +1,185 @@
+/**
+    BFDP Bench Bit Stream Benchmarks
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <vector>
+
+// Internal Includes
+#include "Bfdp/BitManip/BitBuffer.hpp"
+#include "Bfdp/BitManip/BitReader.hpp"
+#include "Bfdp/BitManip/BitView.hpp"
+#include "Bfdp/BitManip/GenericBitStream.hpp"
+#include "BfdpBench/DataGen.hpp"
+#include "BfdpBench/Harness.hpp"
+
+namespace BfdpBench
+{
+
+    using Bfdp::Byte;
+    using Bfdp::BitManip::BitBuffer;
+    using Bfdp::BitManip::BitReader;
+    using Bfdp::BitManip::BitView;
+    using Bfdp::BitManip::BytesToBits;
+    using Bfdp::BitManip::GenericBitStream;
+
+    namespace BitStreamBenchInternal
+    {
+
+        static size_t const DataBytes = 64U * 1024U;
+
+        static void GenericReadBits
+            (
+            State& aState,
+            size_t const aNumBits
+            )
+        {
+            std::vector< Byte > const data = GenerateBytes( DataBytes );
+            BitBuffer buffer( data.data(), BytesToBits( data.size() ) );
+            size_t const numValues = buffer.GetDataBits() / aNumBits;
+            aState.SetBytesPerIteration( data.size() );
+
+            while( aState.KeepRunning() )
+            {
+                GenericBitStream stream( buffer );
+                for( size_t i = 0; i < numValues; ++i )
+                {
+                    uint64_t value = 0U;
+                    stream.ReadBits( reinterpret_cast< Byte* >( &value ), aNumBits );
+                    aState.Sink( value );
+                }
+            }
+        }
+
+        static void GenericWriteBits
+            (
+            State& aState,
+            size_t const aNumBits
+            )
+        {
+            std::vector< Byte > const data = GenerateBytes( DataBytes );
+            BitBuffer buffer( data.data(), BytesToBits( data.size() ) );
+            size_t const numValues = buffer.GetDataBits() / aNumBits;
+            aState.SetBytesPerIteration( data.size() );
+
+            uint64_t value = BfdpGen::DefaultSeed;
+            while( aState.KeepRunning() )
+            {
+                GenericBitStream stream( buffer );
+                for( size_t i = 0; i < numValues; ++i )
+                {
+                    stream.WriteBits( reinterpret_cast< Byte const* >( &value ), aNumBits );
+                    value += 0x9E3779B9U;
+                }
+            }
+            aState.Sink( buffer.GetDataPtr()[0] );
+        }
+
+        static void ReaderRead
+            (
+            State& aState,
+            size_t const aNumBits
+            )
+        {
+            std::vector< Byte > const data = GenerateBytes( DataBytes );
+            size_t const numValues = BytesToBits( data.size() ) / aNumBits;
+            aState.SetBytesPerIteration( data.size() );
+
+            while( aState.KeepRunning() )
+            {
+                BitReader reader( BitView( data.data(), 0U, BytesToBits( data.size() ) ) );
+                for( size_t i = 0; i < numValues; ++i )
+                {
+                    aState.Sink( reader.Read( aNumBits ) );
+                }
+            }
+        }
+
+        static void BenchGenericRead13
+            (
+            State& aState
+            )
+        {
+            GenericReadBits( aState, 13U );
+        }
+
+        static void BenchGenericRead64
+            (
+            State& aState
+            )
+        {
+            GenericReadBits( aState, 64U );
+        }
+
+        static void BenchGenericWrite13
+            (
+            State& aState
+            )
+        {
+            GenericWriteBits( aState, 13U );
+        }
+
+        static void BenchGenericWrite64
+            (
+            State& aState
+            )
+        {
+            GenericWriteBits( aState, 64U );
+        }
+
+        static void BenchReaderRead13
+            (
+            State& aState
+            )
+        {
+            ReaderRead( aState, 13U );
+        }
+
+        static void BenchReaderRead64
+            (
+            State& aState
+            )
+        {
+            ReaderRead( aState, 64U );
+        }
+
+    } // namespace BitStreamBenchInternal
+
+    using namespace BitStreamBenchInternal;
+
+    BFDP_BENCH( "BitStream/GenericReadBits/13", BenchGenericRead13 );
+    BFDP_BENCH( "BitStream/GenericReadBits/64", BenchGenericRead64 );
+    BFDP_BENCH( "BitStream/GenericWriteBits/13", BenchGenericWrite13 );
+    BFDP_BENCH( "BitStream/GenericWriteBits/64", BenchGenericWrite64 );
+    BFDP_BENCH( "BitStream/BitReaderRead/13", BenchReaderRead13 );
+    BFDP_BENCH( "BitStream/BitReaderRead/64", BenchReaderRead64 );
+
+} // namespace BfdpBench
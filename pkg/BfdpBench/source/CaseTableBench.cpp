@@ -0,0 +1,197 @@
+/**
+    BFDP Bench Case Table Benchmarks
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <cstdint>
+#include <vector>
+
+// Internal Includes
+#include "Bfdp/Algorithm/CaseTable.hpp"
+#include "BfdpBench/Harness.hpp"
+
+namespace BfdpBench
+{
+
+    using Bfdp::Algorithm::CaseTable;
+
+    namespace CaseTableBenchInternal
+    {
+
+        //! Message types of a protocol, each a case of a union
+        static size_t const NumTypes = 256U;
+
+        //! Messages dispatched per iteration
+        static size_t const NumLookups = 4096U;
+
+        //! @return Case number of aTag by linear scan, as a protocol decoder without a case
+        //!     table would find it
+        static size_t LinearFind
+            (
+            std::vector< uint64_t > const& aTags,
+            uint64_t const aTag
+            )
+        {
+            for( size_t i = 0; i < aTags.size(); ++i )
+            {
+                if( aTags[i] == aTag )
+                {
+                    return i;
+                }
+            }
+            return CaseTable::NoCase;
+        }
+
+        //! @return Every tag from 0 to NumTypes - 1, out of order as cases appear in a spec
+        static std::vector< uint64_t > MakeDenseTags()
+        {
+            std::vector< uint64_t > tags;
+            for( size_t i = 0; i < NumTypes; ++i )
+            {
+                tags.push_back( ( i * 167U ) % NumTypes );
+            }
+            return tags;
+        }
+
+        //! @return Spread-out tag values, like 32-bit message identifiers
+        static std::vector< uint64_t > MakeSparseTags()
+        {
+            std::vector< uint64_t > tags;
+            uint64_t value = 0x9E3779B97F4A7C15ULL;
+            for( size_t i = 0; i < NumTypes; ++i )
+            {
+                value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+                tags.push_back( value >> 32 );
+            }
+            return tags;
+        }
+
+        //! @return A stream of messages of every type in aTags, in a scattered order
+        static std::vector< uint64_t > MakeStream
+            (
+            std::vector< uint64_t > const& aTags
+            )
+        {
+            std::vector< uint64_t > stream;
+            stream.reserve( NumLookups );
+            for( size_t i = 0; i < NumLookups; ++i )
+            {
+                stream.push_back( aTags[( i * 97U + ( i >> 8 ) ) % aTags.size()] );
+            }
+            return stream;
+        }
+
+        //! Dispatch a stream of messages through a case table, as bfdp parse selects union cases
+        static void FindCases
+            (
+            State& aState,
+            std::vector< uint64_t > const& aTags
+            )
+        {
+            CaseTable table;
+            if( !table.Build( &aTags[0], aTags.size() ) )
+            {
+                aState.SkipWithError( "Failed to build case table" );
+                return;
+            }
+            std::vector< uint64_t > const stream = MakeStream( aTags );
+            aState.SetBytesPerIteration( stream.size() * sizeof( uint64_t ) );
+
+            while( aState.KeepRunning() )
+            {
+                for( size_t i = 0; i < stream.size(); ++i )
+                {
+                    aState.Sink( table.Find( stream[i] ) );
+                }
+            }
+        }
+
+        //! Baseline for FindCases
+        static void ScanCases
+            (
+            State& aState,
+            std::vector< uint64_t > const& aTags
+            )
+        {
+            std::vector< uint64_t > const stream = MakeStream( aTags );
+            aState.SetBytesPerIteration( stream.size() * sizeof( uint64_t ) );
+
+            while( aState.KeepRunning() )
+            {
+                for( size_t i = 0; i < stream.size(); ++i )
+                {
+                    aState.Sink( LinearFind( aTags, stream[i] ) );
+                }
+            }
+        }
+
+        static void BenchFindDense
+            (
+            State& aState
+            )
+        {
+            FindCases( aState, MakeDenseTags() );
+        }
+
+        static void BenchFindSparse
+            (
+            State& aState
+            )
+        {
+            FindCases( aState, MakeSparseTags() );
+        }
+
+        static void BenchScanDense
+            (
+            State& aState
+            )
+        {
+            ScanCases( aState, MakeDenseTags() );
+        }
+
+        static void BenchScanSparse
+            (
+            State& aState
+            )
+        {
+            ScanCases( aState, MakeSparseTags() );
+        }
+
+    } // namespace CaseTableBenchInternal
+
+    using namespace CaseTableBenchInternal;
+
+    BFDP_BENCH( "CaseTable/Find/Dense256", BenchFindDense );
+    BFDP_BENCH( "CaseTable/Find/Sparse256", BenchFindSparse );
+    BFDP_BENCH( "CaseTable/LinearScan/Dense256", BenchScanDense );
+    BFDP_BENCH( "CaseTable/LinearScan/Sparse256", BenchScanSparse );
+
+} // namespace BfdpBench
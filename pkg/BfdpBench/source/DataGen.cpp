@@ -0,0 +1,141 @@
+/**
+    BFDP Bench Synthetic Data Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "BfdpBench/DataGen.hpp"
+
+// External Includes
+#include <set>
+
+namespace BfdpBench
+{
+
+    namespace DataGenInternal
+    {
+
+        static char const IdentChars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+
+        //! Letters and underscore, which may begin an identifier
+        static size_t const NumIdentStartChars = 53;
+
+    } // namespace DataGenInternal
+
+    using BfdpGen::Random;
+    using namespace DataGenInternal;
+
+    std::vector< Bfdp::Byte > GenerateBytes
+        (
+        size_t const aSize,
+        uint64_t const aSeed
+        )
+    {
+        Random random( aSeed );
+        std::vector< Bfdp::Byte > bytes( aSize );
+        for( size_t i = 0; i < aSize; ++i )
+        {
+            bytes[i] = static_cast< Bfdp::Byte >( random.Next() >> 56 );
+        }
+        return bytes;
+    }
+
+    std::vector< std::string > GenerateNames
+        (
+        size_t const aCount,
+        uint64_t const aSeed
+        )
+    {
+        Random random( aSeed );
+        std::set< std::string > seen;
+        std::vector< std::string > names;
+        names.reserve( aCount );
+        while( names.size() < aCount )
+        {
+            std::string name( 1U, IdentChars[random.NextBelow( NumIdentStartChars )] );
+            size_t const length = 4U + static_cast< size_t >( random.NextBelow( 28U ) );
+            while( name.size() < length )
+            {
+                name += IdentChars[random.NextBelow( sizeof( IdentChars ) - 1U )];
+            }
+
+            if( seen.insert( name ).second )
+            {
+                names.push_back( name );
+            }
+        }
+        return names;
+    }
+
+    std::string GenerateUtf8
+        (
+        size_t const aSize,
+        uint64_t const aSeed
+        )
+    {
+        Random random( aSeed );
+        std::string text;
+        text.reserve( aSize + 4U );
+        while( text.size() < aSize )
+        {
+            // Mostly ASCII, as in real specifications, with some of each longer sequence
+            uint64_t const kind = random.NextBelow( 16U );
+            if( kind < 10U )
+            {
+                text += static_cast< char >( 0x20U + random.NextBelow( 0x5FU ) );
+            }
+            else if( kind < 13U )
+            {
+                uint64_t const cp = 0x80U + random.NextBelow( 0x800U - 0x80U );
+                text += static_cast< char >( 0xC0U | ( cp >> 6 ) );
+                text += static_cast< char >( 0x80U | ( cp & 0x3FU ) );
+            }
+            else if( kind < 15U )
+            {
+                // Skip the surrogate range, which is not valid in UTF-8
+                uint64_t cp = 0x800U + random.NextBelow( 0x10000U - 0x800U - 0x800U );
+                cp += ( cp >= 0xD800U ) ? 0x800U : 0U;
+                text += static_cast< char >( 0xE0U | ( cp >> 12 ) );
+                text += static_cast< char >( 0x80U | ( ( cp >> 6 ) & 0x3FU ) );
+                text += static_cast< char >( 0x80U | ( cp & 0x3FU ) );
+            }
+            else
+            {
+                uint64_t const cp = 0x10000U + random.NextBelow( 0x110000U - 0x10000U );
+                text += static_cast< char >( 0xF0U | ( cp >> 18 ) );
+                text += static_cast< char >( 0x80U | ( ( cp >> 12 ) & 0x3FU ) );
+                text += static_cast< char >( 0x80U | ( ( cp >> 6 ) & 0x3FU ) );
+                text += static_cast< char >( 0x80U | ( cp & 0x3FU ) );
+            }
+        }
+        return text;
+    }
+
+} // namespace BfdpBench
@@ -0,0 +1,228 @@
+/**
+    BFDP Bench Decode Benchmarks
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+// Internal Includes
+#include "App/Commands.hpp"
+#include "App/Context.hpp"
+#include "BfdpBench/Harness.hpp"
+#include "BfdpGen/CaptureGen.hpp"
+#include "BfdpGen/Random.hpp"
+#include "BfdpGen/SpecGen.hpp"
+
+namespace BfdpBench
+{
+
+    namespace DecodeBenchInternal
+    {
+
+        static size_t const DataBytes = 1024U * 1024U;
+
+        //! Discards everything written to it
+        class NullBuffer BFDP_FINAL
+            : public std::streambuf
+        {
+        protected:
+            BFDP_OVERRIDE( int_type overflow
+                (
+                int_type aChar
+                ) )
+            {
+                return traits_type::not_eof( aChar );
+            }
+
+            BFDP_OVERRIDE( std::streamsize xsputn
+                (
+                char_type const* aData,
+                std::streamsize aCount
+                ) )
+            {
+                BFDP_UNUSED_PARAMETER( aData );
+                return aCount;
+            }
+        };
+
+        static bool WriteFile
+            (
+            std::string const& aFileName,
+            char const* const aData,
+            size_t const aSize
+            )
+        {
+            std::ofstream out( aFileName, std::ios::out | std::ios::binary | std::ios::trunc );
+            out.write( aData, static_cast< std::streamsize >( aSize ) );
+            return static_cast< bool >( out );
+        }
+
+        static bool WriteCapture
+            (
+            std::string const& aFileName,
+            BfdpGen::Spec const& aSpec,
+            uint64_t const aNumRecords,
+            BfdpGen::ValueMode::Type const aValues
+            )
+        {
+            std::filebuf out;
+            BFDP_RETURNIF_V( !out.open( aFileName, std::ios::out | std::ios::binary | std::ios::trunc ), false );
+            bool const ok = BfdpGen::GenerateCapture( aSpec, aNumRecords, aValues, BfdpGen::DefaultSeed, out );
+            return ( NULL != out.close() ) && ok;
+        }
+
+        //! Decode generated records with `bfdp parse`, printing to a discarding stream
+        static void DecodeRecords
+            (
+            State& aState,
+            BfdpGen::SpecOptions const& aOptions,
+            BfdpGen::ValueMode::Type const aValues,
+            char const* const aNumThreads
+            )
+        {
+            static char const SpecFileName[] = "BfdpBench_decode.bfsdl";
+            static char const DataFileName[] = "BfdpBench_decode.bin";
+
+            BfdpGen::Spec spec;
+            if( !BfdpGen::GenerateSpec( aOptions, spec ) )
+            {
+                aState.SkipWithError( "Failed to generate specification" );
+                return;
+            }
+
+            // Whole records only, so the data never ends within a field
+            uint64_t const numRecords = BfdpGen::GetNumRecordsForBytes( spec, DataBytes );
+            if( !WriteFile( SpecFileName, spec.text.data(), spec.text.size() )
+                || !WriteCapture( DataFileName, spec, numRecords, aValues ) )
+            {
+                aState.SkipWithError( "Failed to write input files" );
+                return;
+            }
+            aState.SetBytesPerIteration( static_cast< size_t >( ( numRecords * spec.recordBits ) / 8U ) );
+
+            char const* const argv[] =
+            {
+                APP_CMD_PARSE_NAME,
+                "--spec", SpecFileName,
+                "--data", DataFileName,
+                "--threads", aNumThreads
+            };
+
+            // The decoder captures std::cout when it is created, so swap it before running
+            NullBuffer nullBuffer;
+            std::streambuf* const coutBuffer = std::cout.rdbuf( &nullBuffer );
+            App::Context context;
+            context.Silence();
+
+            while( aState.KeepRunning() )
+            {
+                if( 0 != App::CmdParse( context, static_cast< int >( BFDP_COUNT_OF_ARRAY( argv ) ), argv ) )
+                {
+                    aState.SkipWithError( "Decoding failed" );
+                    break;
+                }
+            }
+
+            std::cout.rdbuf( coutBuffer );
+            BFDP_UNUSED_RETURN( std::remove( SpecFileName ) );
+            BFDP_UNUSED_RETURN( std::remove( DataFileName ) );
+        }
+
+        static void BenchDecode
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 64U;
+            DecodeRecords( aState, options, BfdpGen::ValueMode::Random, "1" );
+        }
+
+        static void BenchDecodeThreaded
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 64U;
+            DecodeRecords( aState, options, BfdpGen::ValueMode::Random, "0" );
+        }
+
+        //! Widths around byte and word boundaries up to 64 bits, holding extreme values
+        static void BenchDecodeEdge
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 64U;
+            options.widths = BfdpGen::WidthMode::Edge;
+            DecodeRecords( aState, options, BfdpGen::ValueMode::Edge, "1" );
+        }
+
+        static void BenchDecodeMax
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 64U;
+            options.widths = BfdpGen::WidthMode::Max;
+            DecodeRecords( aState, options, BfdpGen::ValueMode::Edge, "1" );
+        }
+
+        static void BenchDecodeFixedPoint
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 64U;
+            options.fixedPoint = true;
+            DecodeRecords( aState, options, BfdpGen::ValueMode::Random, "1" );
+        }
+
+    } // namespace DecodeBenchInternal
+
+    using namespace DecodeBenchInternal;
+
+    BFDP_BENCH( "Decode/CmdParse/64Fields", BenchDecode );
+    BFDP_BENCH( "Decode/CmdParse/64Fields/AllThreads", BenchDecodeThreaded );
+    BFDP_BENCH( "Decode/CmdParse/64Fields/EdgeWidths", BenchDecodeEdge );
+    BFDP_BENCH( "Decode/CmdParse/64Fields/MaxWidths", BenchDecodeMax );
+    BFDP_BENCH( "Decode/CmdParse/64Fields/FixedPoint", BenchDecodeFixedPoint );
+
+} // namespace BfdpBench
@@ -0,0 +1,380 @@
+/**
+    BFDP Bench Harness Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#define BFDP_MODULE "BfdpBench::Harness"
+
+// Base Includes
+#include "BfdpBench/Harness.hpp"
+
+// External Includes
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+// Internal Includes
+#include "Bfdp/ErrorReporter/Functions.hpp"
+
+namespace BfdpBench
+{
+
+    namespace HarnessInternal
+    {
+
+        struct Entry
+        {
+            char const* name;
+            BenchFunc func;
+        };
+
+        struct Result
+        {
+            std::string name;
+            std::string error;
+            uint64_t iterations;
+            uint64_t bytesPerIter;
+            double medianNs;
+            double minNs;
+            double bytesPerSec;
+        };
+
+        //! Where benchmark results are discarded; volatile, so they cannot be optimized out
+        static volatile uint64_t gSink = 0U;
+
+        //! Upper bound on iterations, so a benchmark that measures nothing still terminates
+        static uint64_t const MaxIterations = 1000000000ULL;
+
+        //! @return The registered benchmarks
+        //!
+        //! @note A function-local static avoids depending on the order of static initialization.
+        static std::vector< Entry >& GetRegistry()
+        {
+            static std::vector< Entry > registry;
+            return registry;
+        }
+
+        static std::string EscapeJson
+            (
+            std::string const& aText
+            )
+        {
+            std::ostringstream out;
+            for( size_t i = 0; i < aText.size(); ++i )
+            {
+                char const c = aText[i];
+                if( ( c == '"' ) || ( c == '\\' ) )
+                {
+                    out << '\\' << c;
+                }
+                else if( static_cast< unsigned char >( c ) < 0x20U )
+                {
+                    out << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << static_cast< int >( c ) << std::dec;
+                }
+                else
+                {
+                    out << c;
+                }
+            }
+            return out.str();
+        }
+
+        static std::string GetTimestamp()
+        {
+            std::time_t const now = std::time( NULL );
+            char text[32];
+            size_t const size = std::strftime( text, sizeof( text ), "%Y-%m-%dT%H:%M:%SZ", std::gmtime( &now ) );
+            return std::string( text, size );
+        }
+
+        //! Run aEntry once with aIterations
+        //!
+        //! @return Nanoseconds per iteration
+        static double RunOnce
+            (
+            Entry const& aEntry,
+            uint64_t const aIterations,
+            Result& aResult
+            )
+        {
+            State state( aIterations );
+            aEntry.func( state );
+            aResult.error = state.GetError();
+            aResult.bytesPerIter = state.GetBytesPerIteration();
+
+            gSink = state.GetSink();
+            return static_cast< double >( state.GetElapsedNs() ) / static_cast< double >( aIterations );
+        }
+
+        static Result RunEntry
+            (
+            Entry const& aEntry,
+            Options const& aOptions
+            )
+        {
+            Result result = { aEntry.name, "", 1U, 0U, 0.0, 0.0, 0.0 };
+            uint64_t const minTimeNs = aOptions.minTimeMs * 1000000ULL;
+
+            // Grow the iteration count until a single run takes the minimum time
+            double nsPerIter = RunOnce( aEntry, result.iterations, result );
+            while( result.error.empty()
+                && ( ( nsPerIter * static_cast< double >( result.iterations ) ) < static_cast< double >( minTimeNs ) )
+                && ( result.iterations < MaxIterations ) )
+            {
+                double const estimate = ( nsPerIter > 0.0 )
+                    ? 1.4 * static_cast< double >( minTimeNs ) / nsPerIter
+                    : static_cast< double >( MaxIterations );
+                uint64_t const next = static_cast< uint64_t >
+                    (
+                    std::min( estimate, static_cast< double >( result.iterations ) * 100.0 )
+                    );
+                result.iterations = std::min( std::max( next, result.iterations * 2U ), MaxIterations );
+                nsPerIter = RunOnce( aEntry, result.iterations, result );
+            }
+
+            std::vector< double > samples;
+            for( size_t i = 0; result.error.empty() && ( i < aOptions.repetitions ); ++i )
+            {
+                samples.push_back( RunOnce( aEntry, result.iterations, result ) );
+            }
+            BFDP_RETURNIF_V( samples.empty(), result );
+
+            std::sort( samples.begin(), samples.end() );
+            result.minNs = samples.front();
+            result.medianNs = samples[samples.size() / 2U];
+            if( result.medianNs > 0.0 )
+            {
+                result.bytesPerSec = static_cast< double >( result.bytesPerIter ) * 1e9 / result.medianNs;
+            }
+            return result;
+        }
+
+    } // namespace HarnessInternal
+
+    using namespace HarnessInternal;
+
+    State::State
+        (
+        uint64_t const aIterations
+        )
+        : mBytesPerIteration( 0U )
+        , mIterations( aIterations )
+        , mRemaining( aIterations )
+        , mSink( 0U )
+    {
+    }
+
+    uint64_t State::GetBytesPerIteration() const
+    {
+        return mBytesPerIteration;
+    }
+
+    uint64_t State::GetElapsedNs() const
+    {
+        return static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::nanoseconds >( mEnd - mStart ).count() );
+    }
+
+    std::string const& State::GetError() const
+    {
+        return mError;
+    }
+
+    uint64_t State::GetIterations() const
+    {
+        return mIterations;
+    }
+
+    uint64_t State::GetSink() const
+    {
+        return mSink;
+    }
+
+    void State::SetBytesPerIteration
+        (
+        uint64_t const aBytes
+        )
+    {
+        mBytesPerIteration = aBytes;
+    }
+
+    void State::SkipWithError
+        (
+        std::string const& aReason
+        )
+    {
+        mError = aReason;
+    }
+
+    Registrar::Registrar
+        (
+        char const* const aName,
+        BenchFunc const aFunc
+        )
+    {
+        Entry const entry = { aName, aFunc };
+        GetRegistry().push_back( entry );
+    }
+
+    Options::Options()
+        : format( "text" )
+        , minTimeMs( 200U )
+        , repetitions( 5U )
+    {
+    }
+
+    int RunBenchmarks
+        (
+        Options const& aOptions
+        )
+    {
+        bool const json = ( aOptions.format == "json" );
+        if( !json && ( aOptions.format != "text" ) )
+        {
+            BFDP_MISUSE_ERROR( "Invalid report format" );
+            return 1;
+        }
+        else if( aOptions.repetitions == 0U )
+        {
+            BFDP_MISUSE_ERROR( "Repetitions must be at least 1" );
+            return 1;
+        }
+
+        std::ofstream outFile;
+        if( !aOptions.outFileName.empty() )
+        {
+            outFile.open( aOptions.outFileName, std::ios::out | std::ios::trunc );
+            if( !outFile )
+            {
+                BFDP_RUNTIME_ERROR( "Failed to open report file" );
+                return 1;
+            }
+        }
+        std::ostream& out = aOptions.outFileName.empty() ? std::cout : outFile;
+
+        // Sort by name, so reports from different builds line up
+        std::vector< Entry > entries = GetRegistry();
+        std::sort
+            (
+            entries.begin(),
+            entries.end(),
+            [] ( Entry const& aLhs, Entry const& aRhs ) { return std::string( aLhs.name ) < aRhs.name; }
+            );
+
+        std::vector< Result > results;
+        for( size_t i = 0; i < entries.size(); ++i )
+        {
+            if( std::string( entries[i].name ).find( aOptions.filter ) == std::string::npos )
+            {
+                continue;
+            }
+
+            std::cerr << "Running " << entries[i].name << "..." << std::endl;
+            results.push_back( RunEntry( entries[i], aOptions ) );
+        }
+
+        int ret = 0;
+        if( json )
+        {
+            out << "{" << std::endl
+                << "  \"context\": {" << std::endl
+                << "    \"date\": \"" << GetTimestamp() << "\"," << std::endl
+                << "    \"min_time_ms\": " << aOptions.minTimeMs << "," << std::endl
+                << "    \"repetitions\": " << aOptions.repetitions << std::endl
+                << "  }," << std::endl
+                << "  \"benchmarks\": [";
+        }
+        else
+        {
+            out << std::left << std::setw( 40 ) << "Benchmark" << std::right
+                << std::setw( 12 ) << "Iterations"
+                << std::setw( 16 ) << "ns/iter"
+                << std::setw( 16 ) << "min ns/iter"
+                << std::setw( 12 ) << "MB/s" << std::endl;
+        }
+
+        out << std::fixed << std::setprecision( 2 );
+        for( size_t i = 0; i < results.size(); ++i )
+        {
+            Result const& r = results[i];
+            if( !r.error.empty() )
+            {
+                ret = 1;
+            }
+
+            if( json )
+            {
+                out << ( ( i == 0U ) ? "" : "," ) << std::endl
+                    << "    {" << std::endl
+                    << "      \"name\": \"" << EscapeJson( r.name ) << "\"," << std::endl;
+                if( !r.error.empty() )
+                {
+                    out << "      \"error\": \"" << EscapeJson( r.error ) << "\"" << std::endl;
+                }
+                else
+                {
+                    out << "      \"iterations\": " << r.iterations << "," << std::endl
+                        << "      \"ns_per_iter\": " << r.medianNs << "," << std::endl
+                        << "      \"min_ns_per_iter\": " << r.minNs << "," << std::endl
+                        << "      \"bytes_per_second\": " << r.bytesPerSec << std::endl;
+                }
+                out << "    }";
+            }
+            else if( !r.error.empty() )
+            {
+                out << std::left << std::setw( 40 ) << r.name << std::right << "  ERROR: " << r.error << std::endl;
+            }
+            else
+            {
+                out << std::left << std::setw( 40 ) << r.name << std::right
+                    << std::setw( 12 ) << r.iterations
+                    << std::setw( 16 ) << r.medianNs
+                    << std::setw( 16 ) << r.minNs
+                    << std::setw( 12 ) << ( r.bytesPerSec / 1e6 ) << std::endl;
+            }
+        }
+
+        if( json )
+        {
+            out << std::endl << "  ]" << std::endl << "}" << std::endl;
+        }
+
+        if( !out )
+        {
+            BFDP_RUNTIME_ERROR( "Failed to write report" );
+            ret = 1;
+        }
+        return ret;
+    }
+
+} // namespace BfdpBench
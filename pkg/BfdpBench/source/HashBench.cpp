@@ -0,0 +1,155 @@
+/**
+    BFDP Bench Hash Benchmarks
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <map>
+#include <string>
+#include <vector>
+
+// Internal Includes
+#include "Bfdp/Algorithm/Calc.hpp"
+#include "Bfdp/Algorithm/HashedString.hpp"
+#include "BfdpBench/DataGen.hpp"
+#include "BfdpBench/Harness.hpp"
+
+namespace BfdpBench
+{
+
+    using Bfdp::Algorithm::FastHash;
+    using Bfdp::Algorithm::HashedString;
+
+    namespace HashBenchInternal
+    {
+
+        //! About the number of properties and subtrees in a large specification
+        static size_t const NumNames = 1000U;
+
+        static uint64_t GetTotalSize
+            (
+            std::vector< std::string > const& aNames
+            )
+        {
+            uint64_t size = 0U;
+            for( size_t i = 0; i < aNames.size(); ++i )
+            {
+                size += aNames[i].size();
+            }
+            return size;
+        }
+
+        static void BenchFastHashBlock
+            (
+            State& aState
+            )
+        {
+            std::vector< Bfdp::Byte > const data = GenerateBytes( 64U * 1024U );
+            aState.SetBytesPerIteration( data.size() );
+
+            while( aState.KeepRunning() )
+            {
+                aState.Sink( FastHash( data.data(), data.size() ) );
+            }
+        }
+
+        static void BenchFastHashNames
+            (
+            State& aState
+            )
+        {
+            std::vector< std::string > const names = GenerateNames( NumNames );
+            aState.SetBytesPerIteration( GetTotalSize( names ) );
+
+            while( aState.KeepRunning() )
+            {
+                for( size_t i = 0; i < names.size(); ++i )
+                {
+                    aState.Sink( FastHash( names[i] ) );
+                }
+            }
+        }
+
+        //! Look up every name in a map keyed by HashedString, the way Objects::Tree does
+        static void BenchHashedStringFind
+            (
+            State& aState
+            )
+        {
+            std::vector< std::string > const names = GenerateNames( NumNames );
+            std::map< HashedString, size_t, HashedString::StrictWeakCompare > map;
+            for( size_t i = 0; i < names.size(); ++i )
+            {
+                map.insert( std::make_pair( HashedString( names[i] ), i ) );
+            }
+            aState.SetBytesPerIteration( GetTotalSize( names ) );
+
+            while( aState.KeepRunning() )
+            {
+                for( size_t i = 0; i < names.size(); ++i )
+                {
+                    aState.Sink( map.find( HashedString( names[i] ) )->second );
+                }
+            }
+        }
+
+        //! Baseline for BenchHashedStringFind
+        static void BenchStringFind
+            (
+            State& aState
+            )
+        {
+            std::vector< std::string > const names = GenerateNames( NumNames );
+            std::map< std::string, size_t > map;
+            for( size_t i = 0; i < names.size(); ++i )
+            {
+                map.insert( std::make_pair( names[i], i ) );
+            }
+            aState.SetBytesPerIteration( GetTotalSize( names ) );
+
+            while( aState.KeepRunning() )
+            {
+                for( size_t i = 0; i < names.size(); ++i )
+                {
+                    aState.Sink( map.find( names[i] )->second );
+                }
+            }
+        }
+
+    } // namespace HashBenchInternal
+
+    using namespace HashBenchInternal;
+
+    BFDP_BENCH( "Hash/FastHash/Block64K", BenchFastHashBlock );
+    BFDP_BENCH( "Hash/FastHash/Names", BenchFastHashNames );
+    BFDP_BENCH( "Hash/HashedStringMap/Find", BenchHashedStringFind );
+    BFDP_BENCH( "Hash/StringMap/Find", BenchStringFind );
+
+} // namespace BfdpBench
@@ -0,0 +1,178 @@
+/**
+    BFDP Bench Lexer Benchmarks
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Lexer/ISymbolObserver.hpp"
+#include "Bfdp/Lexer/RangeSymbolCategory.hpp"
+#include "Bfdp/Lexer/StaticSymbolBuffer.hpp"
+#include "Bfdp/Lexer/StringSymbolCategory.hpp"
+#include "Bfdp/Lexer/Symbolizer.hpp"
+#include "Bfdp/Unicode/CodingMap.hpp"
+#include "BfdpBench/DataGen.hpp"
+#include "BfdpBench/Harness.hpp"
+#include "BfdpGen/SpecGen.hpp"
+
+namespace BfdpBench
+{
+
+    using Bfdp::Lexer::RangeSymbolCategory;
+    using Bfdp::Lexer::StringSymbolCategory;
+
+    namespace LexerBenchInternal
+    {
+
+        //! Counts the symbols reported by the Symbolizer
+        class CountingObserver BFDP_FINAL
+            : public Bfdp::Lexer::ISymbolObserver
+        {
+        public:
+            CountingObserver()
+                : mNumSymbols( 0U )
+            {
+            }
+
+            uint64_t GetNumSymbols() const
+            {
+                return mNumSymbols;
+            }
+
+            BFDP_OVERRIDE( bool OnMappedSymbols
+                (
+                int const aCategory,
+                std::string const& aSymbols,
+                size_t const aNumSymbols
+                ) )
+            {
+                BFDP_UNUSED_PARAMETER( aCategory );
+                BFDP_UNUSED_PARAMETER( aSymbols );
+                mNumSymbols += aNumSymbols;
+                return true;
+            }
+
+            BFDP_OVERRIDE( bool OnUnmappedSymbols
+                (
+                std::string const& aSymbols,
+                size_t const aNumSymbols
+                ) )
+            {
+                BFDP_UNUSED_PARAMETER( aSymbols );
+                mNumSymbols += aNumSymbols;
+                return true;
+            }
+
+        private:
+            uint64_t mNumSymbols;
+        };
+
+        //! Symbolize aText with categories similar to the BFSDL tokenizer's
+        static void Symbolize
+            (
+            State& aState,
+            std::string const& aText
+            )
+        {
+            RangeSymbolCategory const lower( 1, 'a', 'z', true );
+            RangeSymbolCategory const upper( 2, 'A', 'Z', true );
+            RangeSymbolCategory const digits( 3, '0', '9', true );
+            StringSymbolCategory const whitespace( 4, " \t\r\n", true );
+            StringSymbolCategory const punctuation( 5, ":;=\"#._", false );
+            Bfdp::Byte const* const bytes = Bfdp::Char( aText.c_str() );
+            aState.SetBytesPerIteration( aText.size() );
+
+            while( aState.KeepRunning() )
+            {
+                CountingObserver observer;
+                Bfdp::Lexer::StaticSymbolBuffer< 64 > buffer;
+                Bfdp::Lexer::Symbolizer lexer
+                    (
+                    observer,
+                    buffer,
+                    Bfdp::Unicode::GetCodec( Bfdp::Unicode::GetCodingId( "UTF8" ) )
+                    );
+                lexer.AddCategory( &lower );
+                lexer.AddCategory( &upper );
+                lexer.AddCategory( &digits );
+                lexer.AddCategory( &whitespace );
+                lexer.AddCategory( &punctuation );
+
+                size_t pos = 0;
+                while( pos < aText.size() )
+                {
+                    size_t bytesRead = 0;
+                    if( !lexer.Parse( &bytes[pos], aText.size() - pos, bytesRead ) || ( bytesRead == 0U ) )
+                    {
+                        break;
+                    }
+                    pos += bytesRead;
+                }
+                lexer.EndParsing();
+
+                if( pos != aText.size() )
+                {
+                    aState.SkipWithError( "Symbolizer stopped early" );
+                    break;
+                }
+                aState.Sink( observer.GetNumSymbols() );
+            }
+        }
+
+        static void BenchSymbolizeSpec
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 2000U;
+            BfdpGen::Spec spec;
+            BfdpGen::GenerateSpec( options, spec );
+            Symbolize( aState, spec.text );
+        }
+
+        static void BenchSymbolizeUtf8
+            (
+            State& aState
+            )
+        {
+            Symbolize( aState, GenerateUtf8( 64U * 1024U ) );
+        }
+
+    } // namespace LexerBenchInternal
+
+    using namespace LexerBenchInternal;
+
+    BFDP_BENCH( "Lexer/Symbolizer/Spec", BenchSymbolizeSpec );
+    BFDP_BENCH( "Lexer/Symbolizer/Utf8Text", BenchSymbolizeUtf8 );
+
+} // namespace BfdpBench
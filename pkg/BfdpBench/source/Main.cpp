@@ -0,0 +1,129 @@
+/**
+    BFDP Bench Main
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#define BFDP_MODULE "BfdpBench::Main"
+
+// External Includes
+#include <cstdio>
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Console/ArgParser.hpp"
+#include "Bfdp/ErrorReporter/Functions.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfdpBench/Harness.hpp"
+#include "BfdpGen/Console.hpp"
+
+using Bfdp::Console::ArgParser;
+using Bfdp::Console::Param;
+using BfdpGen::ParseCount;
+using BfdpGen::SavedParamMap;
+using BfdpGen::SaveToParamMap;
+
+int main
+    (
+    int argc,
+    char** argv
+    )
+{
+    BfdpGen::SetErrorHandlers();
+
+    SavedParamMap args;
+    BfdpBench::Options options;
+
+    ArgParser parser = ArgParser()
+        .SetName( "BfdpBench" )
+        .SetPrologue( "Binary Format Data Parser Benchmarks" )
+        .Add( Param::CreateLong( "help", 'h' )
+                .SetDescription( "Show this help text" )
+                .SetOptional()
+                .SetCallback( BfdpGen::ShowHelp )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "filter" )
+                .SetDescription( "Only run benchmarks whose name contains this text" )
+                .SetDefault( "", "text" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "format" )
+                .SetDescription( "Report format (text or json)" )
+                .SetDefault( options.format, "format" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "output" )
+                .SetDescription( "Path to write the report to (default: stdout)" )
+                .SetDefault( "", "report_file" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "min-time" )
+                .SetDescription( "Minimum time of each timed run, in milliseconds" )
+                .SetDefault( std::to_string( options.minTimeMs ), "ms" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "repetitions" )
+                .SetDescription( "Number of timed runs per benchmark; the median is reported" )
+                .SetDefault( std::to_string( options.repetitions ), "count" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            );
+
+    int ret = parser.Parse( argv, argc );
+    if( args.count( "help" ) != 0 )
+    {
+        // Help was printed by the parser
+        return 0;
+    }
+    else if( 0 != ret )
+    {
+        // Error logged by the parser
+        parser.PrintHelp( stdout );
+        return ret;
+    }
+
+    uint64_t repetitions = 0U;
+    if( !ParseCount( args["min-time"], options.minTimeMs ) ||
+        !ParseCount( args["repetitions"], repetitions ) )
+    {
+        BFDP_MISUSE_ERROR( "Invalid number" );
+        return 1;
+    }
+
+    options.filter = args["filter"];
+    options.format = args["format"];
+    options.outFileName = args["output"];
+    options.repetitions = static_cast< size_t >( repetitions );
+    return BfdpBench::RunBenchmarks( options );
+}
@@ -0,0 +1,116 @@
+/**
+    BFDP Bench Specification Benchmarks
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <string>
+
+// Internal Includes
+#include "BfdpBench/Harness.hpp"
+#include "BfdpGen/SpecGen.hpp"
+#include "BfsdlParser/Objects/Database.hpp"
+#include "BfsdlParser/StreamParser.hpp"
+
+namespace BfdpBench
+{
+
+    using BfsdlParser::Objects::Database;
+    using BfsdlParser::Objects::DatabasePtr;
+
+    namespace SpecBenchInternal
+    {
+
+        //! Load a specification through the Tokenizer and Interpreter into a new database
+        static void LoadSpec
+            (
+            State& aState,
+            BfdpGen::SpecOptions const& aOptions
+            )
+        {
+            BfdpGen::Spec spec;
+            BfdpGen::GenerateSpec( aOptions, spec );
+            std::string const& text = spec.text;
+            aState.SetBytesPerIteration( text.size() );
+
+            while( aState.KeepRunning() )
+            {
+                DatabasePtr db = Database::CreateArena();
+                if( !db || ( 0 != BfsdlParser::ParseBuffer( db->GetRoot(), Bfdp::Char( text.c_str() ), text.size() ) ) )
+                {
+                    aState.SkipWithError( "Failed to load specification" );
+                    break;
+                }
+            }
+        }
+
+        static void BenchLoad100
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 100U;
+            LoadSpec( aState, options );
+        }
+
+        static void BenchLoad2000
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 2000U;
+            LoadSpec( aState, options );
+        }
+
+        //! Classes nested 16 deep, each with a 4 KiB comment, and fixed-point fields
+        static void BenchLoadNested
+            (
+            State& aState
+            )
+        {
+            BfdpGen::SpecOptions options;
+            options.numFields = 2000U;
+            options.depth = 16U;
+            options.commentBytes = 4096U;
+            options.fixedPoint = true;
+            LoadSpec( aState, options );
+        }
+
+    } // namespace SpecBenchInternal
+
+    using namespace SpecBenchInternal;
+
+    BFDP_BENCH( "Spec/ParseBuffer/100Fields", BenchLoad100 );
+    BFDP_BENCH( "Spec/ParseBuffer/2000Fields", BenchLoad2000 );
+    BFDP_BENCH( "Spec/ParseBuffer/2000Fields/Nested", BenchLoadNested );
+
+} // namespace BfdpBench
@@ -0,0 +1,151 @@
+/**
+    BFDP Bench Stream Benchmarks
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <istream>
+#include <vector>
+
+// Internal Includes
+#include "Bfdp/Stream/IStreamObserver.hpp"
+#include "Bfdp/Stream/MemoryStreamBuf.hpp"
+#include "Bfdp/Stream/RawStream.hpp"
+#include "BfdpBench/DataGen.hpp"
+#include "BfdpBench/Harness.hpp"
+
+namespace BfdpBench
+{
+
+    using Bfdp::Byte;
+    using Bfdp::BitManip::GenericBitStream;
+    using Bfdp::Stream::Control;
+
+    namespace StreamBenchInternal
+    {
+
+        static size_t const DataBytes = 4U * 1024U * 1024U;
+
+        //! Consumes stream data in pieces of a fixed size
+        class ConsumingObserver BFDP_FINAL
+            : public Bfdp::Stream::IStreamObserver
+        {
+        public:
+            //! @param aPieceBits Bits to read per callback, or 0 for all available bits
+            explicit ConsumingObserver
+                (
+                size_t const aPieceBits
+                )
+                : mPieceBits( aPieceBits )
+                , mSum( 0U )
+            {
+            }
+
+            uint64_t GetSum() const
+            {
+                return mSum;
+            }
+
+            BFDP_OVERRIDE( Control::Type OnStreamData
+                (
+                GenericBitStream& aInBitStream
+                ) )
+            {
+                size_t const bitsLeft = aInBitStream.GetBitsTillEnd();
+                if( mPieceBits == 0U )
+                {
+                    mSum += bitsLeft;
+                    aInBitStream.SeekBits( aInBitStream.GetPosBits() + bitsLeft );
+                    return Control::Continue;
+                }
+                else if( bitsLeft < mPieceBits )
+                {
+                    return Control::NoData;
+                }
+
+                uint64_t value = 0U;
+                aInBitStream.ReadBits( reinterpret_cast< Byte* >( &value ), mPieceBits );
+                mSum += value;
+                return Control::Continue;
+            }
+
+        private:
+            size_t const mPieceBits;
+            uint64_t mSum;
+        };
+
+        static void ReadStream
+            (
+            State& aState,
+            size_t const aPieceBits
+            )
+        {
+            std::vector< Byte > const data = GenerateBytes( DataBytes );
+            aState.SetBytesPerIteration( data.size() );
+
+            while( aState.KeepRunning() )
+            {
+                Bfdp::Stream::MemoryStreamBuf buffer( data.data(), data.size() );
+                std::istream in( &buffer );
+                ConsumingObserver observer( aPieceBits );
+                Bfdp::Stream::RawStream stream( "bench", in, observer );
+                if( !stream.IsValid() || !stream.ReadStream() || stream.HasError() )
+                {
+                    aState.SkipWithError( "Stream read failed" );
+                    break;
+                }
+                aState.Sink( observer.GetSum() );
+            }
+        }
+
+        static void BenchReadBulk
+            (
+            State& aState
+            )
+        {
+            ReadStream( aState, 0U );
+        }
+
+        static void BenchReadRecord32
+            (
+            State& aState
+            )
+        {
+            ReadStream( aState, 32U );
+        }
+
+    } // namespace StreamBenchInternal
+
+    using namespace StreamBenchInternal;
+
+    BFDP_BENCH( "Stream/RawStream/Bulk", BenchReadBulk );
+    BFDP_BENCH( "Stream/RawStream/Record32", BenchReadRecord32 );
+
+} // namespace BfdpBench
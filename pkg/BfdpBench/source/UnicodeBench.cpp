@@ -0,0 +1,131 @@
+/**
+    BFDP Bench Unicode Benchmarks
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <string>
+#include <vector>
+
+// Internal Includes
+#include "Bfdp/Unicode/Utf8Converter.hpp"
+#include "BfdpBench/DataGen.hpp"
+#include "BfdpBench/Harness.hpp"
+
+namespace BfdpBench
+{
+
+    using Bfdp::Byte;
+    using Bfdp::Unicode::CodePoint;
+
+    namespace UnicodeBenchInternal
+    {
+
+        static size_t const TextBytes = 256U * 1024U;
+
+        static void BenchUtf8Decode
+            (
+            State& aState
+            )
+        {
+            std::string const text = GenerateUtf8( TextBytes );
+            Byte const* const bytes = Bfdp::Char( text.c_str() );
+            Bfdp::Unicode::Utf8Converter converter;
+            aState.SetBytesPerIteration( text.size() );
+
+            while( aState.KeepRunning() )
+            {
+                CodePoint sum = 0U;
+                size_t pos = 0;
+                while( pos < text.size() )
+                {
+                    CodePoint cp;
+                    size_t const n = converter.ConvertBytes( &bytes[pos], text.size() - pos, cp );
+                    if( n == 0U )
+                    {
+                        break;
+                    }
+                    sum += cp;
+                    pos += n;
+                }
+
+                if( pos != text.size() )
+                {
+                    aState.SkipWithError( "Invalid UTF-8" );
+                    break;
+                }
+                aState.Sink( sum );
+            }
+        }
+
+        static void BenchUtf8Encode
+            (
+            State& aState
+            )
+        {
+            std::string const text = GenerateUtf8( TextBytes );
+            Byte const* const bytes = Bfdp::Char( text.c_str() );
+            Bfdp::Unicode::Utf8Converter converter;
+
+            std::vector< CodePoint > symbols;
+            for( size_t pos = 0; pos < text.size(); )
+            {
+                CodePoint cp;
+                size_t const n = converter.ConvertBytes( &bytes[pos], text.size() - pos, cp );
+                if( n == 0U )
+                {
+                    aState.SkipWithError( "Invalid UTF-8" );
+                    return;
+                }
+                symbols.push_back( cp );
+                pos += n;
+            }
+            aState.SetBytesPerIteration( text.size() );
+
+            std::vector< Byte > out( text.size() + converter.GetMaxBytes() );
+            while( aState.KeepRunning() )
+            {
+                size_t pos = 0;
+                for( size_t i = 0; i < symbols.size(); ++i )
+                {
+                    pos += converter.ConvertSymbol( symbols[i], &out[pos], out.size() - pos );
+                }
+                aState.Sink( pos );
+            }
+        }
+
+    } // namespace UnicodeBenchInternal
+
+    using namespace UnicodeBenchInternal;
+
+    BFDP_BENCH( "Unicode/Utf8Converter/Decode", BenchUtf8Decode );
+    BFDP_BENCH( "Unicode/Utf8Converter/Encode", BenchUtf8Encode );
+
+} // namespace BfdpBench
@@ -0,0 +1,77 @@
+/**
+    BFDP Generator Capture Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfdpGen_CaptureGen
+#define BfdpGen_CaptureGen
+
+// External Includes
+#include <cstdint>
+#include <streambuf>
+
+// Internal Includes
+#include "BfdpGen/SpecGen.hpp"
+
+namespace BfdpGen
+{
+
+    //! How the values of generated fields are chosen
+    struct ValueMode
+    {
+        enum Type
+        {
+            Random, //!< Any value of the field's width
+            Edge    //!< Zero, one, and the extremes of the field's width, in turn
+        };
+    };
+
+    //! @return The largest number of records of aSpec that fit in aMaxBytes and end on a byte boundary
+    uint64_t GetNumRecordsForBytes
+        (
+        Spec const& aSpec,
+        uint64_t const aMaxBytes
+        );
+
+    //! Write aNumRecords records laid out according to aSpec
+    //!
+    //! @return Whether all data was written to aOut
+    bool GenerateCapture
+        (
+        Spec const& aSpec,
+        uint64_t const aNumRecords,
+        ValueMode::Type const aValues,
+        uint64_t const aSeed,
+        std::streambuf& aOut
+        );
+
+} // namespace BfdpGen
+
+#endif // BfdpGen_CaptureGen
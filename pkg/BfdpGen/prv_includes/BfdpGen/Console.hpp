@@ -0,0 +1,87 @@
+/**
+    BFDP Generator Console Helper Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfdpGen_Console
+#define BfdpGen_Console
+
+// External Includes
+#include <cstdint>
+#include <map>
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Console/ArgParser.hpp"
+
+//! Console helpers shared by the BfdpGen and BfdpBench programs
+namespace BfdpGen
+{
+
+    typedef std::map< std::string, std::string > SavedParamMap;
+
+    //! @return Whether aText is a whole, non-negative number
+    bool ParseCount
+        (
+        std::string const& aText,
+        uint64_t& aOut
+        );
+
+    //! Argument callback for a help parameter, which prints the help and stops parsing
+    //!
+    //! The parameter is saved to a SavedParamMap (passed in userdata), so that the program can
+    //! tell that help was asked for rather than that parsing failed.
+    //!
+    //! @return Nonzero, to stop parsing
+    int ShowHelp
+        (
+        Bfdp::Console::ArgParser const& aParser,
+        Bfdp::Console::Param const& aParam,
+        std::string const& aValue,
+        uintptr_t const aUserdata
+        );
+
+    //! Helper function to save parameters to a SavedParamMap (passed in userdata)
+    //!
+    //! @return Success
+    int SaveToParamMap
+        (
+        Bfdp::Console::ArgParser const& aParser,
+        Bfdp::Console::Param const& aParam,
+        std::string const& aValue,
+        uintptr_t const aUserdata
+        );
+
+    //! Print internal, misuse and run-time errors to stderr
+    void SetErrorHandlers();
+
+} // namespace BfdpGen
+
+#endif // BfdpGen_Console
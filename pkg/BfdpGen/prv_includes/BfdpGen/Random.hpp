@@ -0,0 +1,70 @@
+/**
+    BFDP Generator Random Number Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfdpGen_Random
+#define BfdpGen_Random
+
+// External Includes
+#include <cstdint>
+
+namespace BfdpGen
+{
+
+    //! Seed used unless one is given, so generated data is the same on every run
+    static uint64_t const DefaultSeed = 0x9E3779B97F4A7C15ULL;
+
+    //! Small, fast pseudo-random number generator (xorshift64*)
+    //!
+    //! The sequence is fixed for a given seed on every platform, unlike the std:: distributions.
+    class Random
+    {
+    public:
+        explicit Random
+            (
+            uint64_t const aSeed = DefaultSeed
+            );
+
+        uint64_t Next();
+
+        //! @return A value in [0, aBound), or 0 if aBound is 0
+        uint64_t NextBelow
+            (
+            uint64_t const aBound
+            );
+
+    private:
+        uint64_t mState;
+    };
+
+} // namespace BfdpGen
+
+#endif // BfdpGen_Random
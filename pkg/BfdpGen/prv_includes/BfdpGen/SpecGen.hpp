@@ -0,0 +1,122 @@
+/**
+    BFDP Generator Specification Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfdpGen_SpecGen
+#define BfdpGen_SpecGen
+
+// External Includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Internal Includes
+#include "Bfdp/BitManip/Endian.hpp"
+
+namespace BfdpGen
+{
+
+    //! How the widths of generated fields are chosen
+    struct WidthMode
+    {
+        enum Type
+        {
+            Random, //!< Any width from 1 to 64 bits
+            Edge,   //!< Widths around byte and word boundaries, up to 64 bits, in turn
+            Max     //!< 64 bits for every field
+        };
+    };
+
+    //! A data field of a generated specification
+    struct FieldLayout
+    {
+        size_t bits;
+        bool isSigned;
+    };
+
+    struct SpecOptions
+    {
+        SpecOptions();
+
+        //! Number of data fields, not counting the fields that hold nested classes
+        size_t numFields;
+
+        //! Number of levels of classes nested in each other
+        size_t depth;
+
+        //! Size of the comments written at the beginning of each scope (0 for none)
+        size_t commentBytes;
+
+        //! Size of a string literal written in the header (0 for none)
+        //!
+        //! @note The literal is the value of a CustomExtension, which the interpreter rejects (at
+        //!     the end of the literal), so this is only for exercising the tokenizer.
+        size_t literalBytes;
+
+        //! Whether to mix fixed-point fields in with the integer fields
+        bool fixedPoint;
+
+        WidthMode::Type widths;
+
+        Bfdp::BitManip::Endianness::Type bitOrder;
+
+        Bfdp::BitManip::Endianness::Type byteOrder;
+
+        uint64_t seed;
+    };
+
+    //! A generated BFSDL specification
+    struct Spec
+    {
+        std::string text;
+
+        //! Data fields of one record, in stream order
+        std::vector< FieldLayout > fields;
+
+        size_t recordBits;
+
+        Bfdp::BitManip::Endianness::Type bitOrder;
+
+        Bfdp::BitManip::Endianness::Type byteOrder;
+    };
+
+    //! Generate a specification according to aOptions
+    //!
+    //! @return false if aOptions cannot produce a valid specification
+    bool GenerateSpec
+        (
+        SpecOptions const& aOptions,
+        Spec& aOut
+        );
+
+} // namespace BfdpGen
+
+#endif // BfdpGen_SpecGen
@@ -0,0 +1,142 @@
+/**
+    BFDP Generator Capture Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "BfdpGen/CaptureGen.hpp"
+
+// Internal Includes
+#include "Bfdp/BitManip/BitWriter.hpp"
+#include "Bfdp/BitManip/Mask.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfdpGen/Random.hpp"
+
+namespace BfdpGen
+{
+
+    namespace CaptureGenInternal
+    {
+
+        //! Number of distinct values ValueMode::Edge produces for each field
+        static uint64_t const NumEdgeValues = 5U;
+
+        //! @return Edge value aIndex for a field of aField's width, in its least significant bits
+        static uint64_t GetEdgeValue
+            (
+            FieldLayout const& aField,
+            uint64_t const aIndex
+            )
+        {
+            uint64_t const mask = Bfdp::BitManip::CreateMask< uint64_t >( aField.bits );
+            uint64_t const topBit = static_cast< uint64_t >( 1U ) << ( aField.bits - 1U );
+            switch( aIndex % NumEdgeValues )
+            {
+            case 0:
+                return 0U;
+
+            case 1:
+                // 1 when unsigned, or -1 when signed
+                return aField.isSigned ? mask : 1U;
+
+            case 2:
+                // Maximum
+                return aField.isSigned ? ( mask >> 1 ) : mask;
+
+            case 3:
+                // Minimum when signed, or only the top bit set
+                return topBit;
+
+            default:
+                // One below the maximum, or one above the minimum when signed
+                return aField.isSigned ? ( ( topBit + 1U ) & mask ) : ( mask - 1U );
+            }
+        }
+
+        //! @return The greatest common divisor of aA and aB
+        static uint64_t Gcd
+            (
+            uint64_t aA,
+            uint64_t aB
+            )
+        {
+            while( aB != 0U )
+            {
+                uint64_t const r = aA % aB;
+                aA = aB;
+                aB = r;
+            }
+            return aA;
+        }
+
+    } // namespace CaptureGenInternal
+
+    using namespace CaptureGenInternal;
+
+    uint64_t GetNumRecordsForBytes
+        (
+        Spec const& aSpec,
+        uint64_t const aMaxBytes
+        )
+    {
+        BFDP_RETURNIF_V( aSpec.recordBits == 0U, 0U );
+
+        // Records that fit, rounded down to a multiple that fills whole bytes
+        uint64_t const step = 8U / Gcd( aSpec.recordBits, 8U );
+        uint64_t const numRecords = ( aMaxBytes * 8U ) / aSpec.recordBits;
+        return numRecords - ( numRecords % step );
+    }
+
+    bool GenerateCapture
+        (
+        Spec const& aSpec,
+        uint64_t const aNumRecords,
+        ValueMode::Type const aValues,
+        uint64_t const aSeed,
+        std::streambuf& aOut
+        )
+    {
+        Random random( aSeed );
+        Bfdp::BitManip::BitWriter writer( aOut, aSpec.bitOrder, aSpec.byteOrder );
+        for( uint64_t r = 0; ( r < aNumRecords ) && writer.IsOk(); ++r )
+        {
+            for( size_t i = 0; i < aSpec.fields.size(); ++i )
+            {
+                FieldLayout const& field = aSpec.fields[i];
+                uint64_t const value = ( aValues == ValueMode::Edge )
+                    ? GetEdgeValue( field, r + i )
+                    : random.Next();
+                writer.Write( value, field.bits );
+            }
+        }
+        return writer.Finish();
+    }
+
+} // namespace BfdpGen
@@ -0,0 +1,115 @@
+/**
+    BFDP Generator Console Helper Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#define BFDP_MODULE "BfdpGen::Console"
+
+// Base Includes
+#include "BfdpGen/Console.hpp"
+
+// External Includes
+#include <cstdio>
+#include <sstream>
+
+// Internal Includes
+#include "Bfdp/ErrorReporter/Functions.hpp"
+#include "Bfdp/Macros.hpp"
+
+namespace BfdpGen
+{
+
+    namespace ConsoleInternal
+    {
+
+        static void OnError
+            (
+            char const* const aModuleName,
+            unsigned int const aLine,
+            char const* const aErrorText
+            )
+        {
+            std::fprintf( stderr, "Error: %s@%u %s\n", aModuleName, aLine, aErrorText );
+        }
+
+    } // namespace ConsoleInternal
+
+    using namespace ConsoleInternal;
+
+    bool ParseCount
+        (
+        std::string const& aText,
+        uint64_t& aOut
+        )
+    {
+        std::istringstream in( aText );
+        in >> aOut;
+        return !aText.empty() && ( aText[0] != '-' ) && !in.fail() && in.eof();
+    }
+
+    int SaveToParamMap
+        (
+        Bfdp::Console::ArgParser const& aParser,
+        Bfdp::Console::Param const& aParam,
+        std::string const& aValue,
+        uintptr_t const aUserdata
+        )
+    {
+        BFDP_UNUSED_PARAMETER( aParser );
+        BFDP_UNUSED_PARAMETER( aUserdata );
+
+        SavedParamMap* pmap = aParam.GetUserdataPtr< SavedParamMap >();
+        BFDP_RETURNIF_VA( pmap == nullptr, 1, "No map to save parameter" );
+
+        (*pmap)[aParam.GetName()] = aValue;
+        return 0;
+    }
+
+    int ShowHelp
+        (
+        Bfdp::Console::ArgParser const& aParser,
+        Bfdp::Console::Param const& aParam,
+        std::string const& aValue,
+        uintptr_t const aUserdata
+        )
+    {
+        aParser.PrintHelp( stdout );
+        BFDP_UNUSED_RETURN( SaveToParamMap( aParser, aParam, aValue, aUserdata ) );
+        return 1;
+    }
+
+    void SetErrorHandlers()
+    {
+        Bfdp::ErrorReporter::SetInternalErrorHandler( OnError );
+        Bfdp::ErrorReporter::SetMisuseErrorHandler( OnError );
+        Bfdp::ErrorReporter::SetRunTimeErrorHandler( OnError );
+    }
+
+} // namespace BfdpGen
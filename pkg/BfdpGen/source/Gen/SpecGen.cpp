@@ -0,0 +1,307 @@
+/**
+    BFDP Generator Specification Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#define BFDP_MODULE "BfdpGen::SpecGen"
+
+// Base Includes
+#include "BfdpGen/SpecGen.hpp"
+
+// External Includes
+#include <algorithm>
+#include <sstream>
+
+// Internal Includes
+#include "Bfdp/ErrorReporter/Functions.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfdpGen/Random.hpp"
+
+namespace BfdpGen
+{
+
+    using Bfdp::BitManip::Endianness;
+
+    namespace SpecGenInternal
+    {
+
+        //! Widths on either side of byte and word boundaries, where bit readers change strategy
+        static size_t const EdgeWidths[] = { 1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33, 55, 56, 57, 63, 64 };
+
+        //! Words for comment and literal text, including comment markers that must be ignored
+        static char const* const TextWords[] =
+        {
+            "lorem", "ipsum", "dolor", "sit", "amet", "/*", "//", "\"", "*", "#1#", "u64", "class", "{", "};"
+        };
+
+        //! Length of the lines of generated comments
+        static size_t const LineLength = 80;
+
+        //! Levels past which indentation stops growing, keeping whitespace runs below the
+        //! tokenizer's symbol size limit however deep the classes are nested
+        static size_t const MaxIndentLevels = 32;
+
+        static char const* GetOrderStr
+            (
+            Endianness::Type const aOrder
+            )
+        {
+            return ( aOrder == Endianness::Big ) ? "BE" : "LE";
+        }
+
+        //! Writes the text of a specification and records the layout of its fields
+        class SpecWriter
+        {
+        public:
+            SpecWriter
+                (
+                SpecOptions const& aOptions
+                )
+                : mNextField( 0U )
+                , mOptions( aOptions )
+                , mRandom( aOptions.seed )
+            {
+            }
+
+            std::string GetText() const
+            {
+                return mText.str();
+            }
+
+            void WriteHeader()
+            {
+                mText << ":BFSDL_HEADER" << std::endl
+                    << ":Version=#1#" << std::endl
+                    << ":BitBase=\"Bit\"" << std::endl
+                    << ":DefaultBitOrder=\"" << GetOrderStr( mOptions.bitOrder ) << "\"" << std::endl
+                    << ":DefaultByteOrder=\"" << GetOrderStr( mOptions.byteOrder ) << "\"" << std::endl;
+
+                if( mOptions.literalBytes > 0U )
+                {
+                    mText << ":CustomExtension=\"";
+                    size_t size = 0U;
+                    while( size < mOptions.literalBytes )
+                    {
+                        std::string const word = GetWord();
+                        mText << ( ( word == "\"" ) ? "\\\"" : word ) << " ";
+                        size += word.size() + 1U;
+                    }
+                    mText << "\"" << std::endl;
+                }
+
+                mText << ":END_HEADER" << std::endl << std::endl;
+            }
+
+            //! Write the definitions in the scope at aLevel, including the classes nested in it
+            void WriteScope
+                (
+                size_t const aLevel,
+                std::vector< FieldLayout >& aLayout
+                )
+            {
+                std::string const indent( std::min( aLevel, MaxIndentLevels ) * 4U, ' ' );
+                WriteComments( indent, aLevel );
+
+                std::vector< FieldLayout > nestedLayout;
+                bool const hasNested = ( aLevel < mOptions.depth );
+                if( hasNested )
+                {
+                    mText << indent << "class Level" << ( aLevel + 1U ) << std::endl
+                        << indent << "{" << std::endl;
+                    WriteScope( aLevel + 1U, nestedLayout );
+                    mText << indent << "};" << std::endl << std::endl;
+                }
+
+                // Fields are shared evenly between the scopes, and the innermost takes the rest
+                size_t numFields = mOptions.numFields / ( mOptions.depth + 1U );
+                if( !hasNested )
+                {
+                    numFields += mOptions.numFields % ( mOptions.depth + 1U );
+                }
+
+                for( size_t i = 0; i < numFields; ++i )
+                {
+                    if( hasNested && ( i == ( numFields / 2U ) ) )
+                    {
+                        WriteNestedField( indent, aLevel, nestedLayout, aLayout );
+                    }
+                    WriteField( indent, aLayout );
+                }
+
+                if( hasNested && ( numFields == 0U ) )
+                {
+                    WriteNestedField( indent, aLevel, nestedLayout, aLayout );
+                }
+            }
+
+        private:
+            std::string GetWord()
+            {
+                return TextWords[mRandom.NextBelow( BFDP_COUNT_OF_ARRAY( TextWords ) )];
+            }
+
+            void WriteComments
+                (
+                std::string const& aIndent,
+                size_t const aLevel
+                )
+            {
+                BFDP_RETURNIF( mOptions.commentBytes == 0U );
+
+                mText << aIndent << "// Level " << aLevel << ": " << GetWord() << " " << GetWord() << std::endl
+                    << aIndent << "/*" << std::endl;
+
+                size_t size = 0U;
+                while( size < mOptions.commentBytes )
+                {
+                    std::string line = aIndent + "  ";
+                    while( line.size() < LineLength )
+                    {
+                        line += " " + GetWord();
+                    }
+                    mText << line << std::endl;
+                    size += line.size() + 1U;
+                }
+
+                mText << aIndent << "*/" << std::endl;
+            }
+
+            void WriteField
+                (
+                std::string const& aIndent,
+                std::vector< FieldLayout >& aLayout
+                )
+            {
+                bool const isFixed = mOptions.fixedPoint && ( mRandom.NextBelow( 4U ) == 0U );
+                size_t const minBits = isFixed ? 2U : 1U;
+
+                FieldLayout field;
+                field.isSigned = ( mRandom.NextBelow( 2U ) == 0U );
+                switch( mOptions.widths )
+                {
+                case WidthMode::Edge:
+                    field.bits = EdgeWidths[mNextField % BFDP_COUNT_OF_ARRAY( EdgeWidths )];
+                    break;
+
+                case WidthMode::Max:
+                    field.bits = 64U;
+                    break;
+
+                case WidthMode::Random:
+                default:
+                    field.bits = 1U + static_cast< size_t >( mRandom.NextBelow( 64U ) );
+                    break;
+                }
+                field.bits = ( field.bits < minBits ) ? minBits : field.bits;
+
+                // A signed field needs at least one data bit besides the sign
+                field.isSigned = field.isSigned && ( field.bits > 1U );
+
+                mText << aIndent << ( field.isSigned ? "s" : "u" );
+                if( isFixed )
+                {
+                    size_t const fractionalBits = 1U + static_cast< size_t >( mRandom.NextBelow( field.bits - 1U ) );
+                    mText << ( field.bits - fractionalBits ) << "." << fractionalBits;
+                }
+                else
+                {
+                    mText << field.bits;
+                }
+                mText << " field_" << mNextField << ";" << std::endl;
+
+                ++mNextField;
+                aLayout.push_back( field );
+            }
+
+            void WriteNestedField
+                (
+                std::string const& aIndent,
+                size_t const aLevel,
+                std::vector< FieldLayout > const& aNestedLayout,
+                std::vector< FieldLayout >& aLayout
+                )
+            {
+                mText << aIndent << "Level" << ( aLevel + 1U ) << " nested;" << std::endl;
+                aLayout.insert( aLayout.end(), aNestedLayout.begin(), aNestedLayout.end() );
+            }
+
+            size_t mNextField;
+            SpecOptions const& mOptions;
+            Random mRandom;
+            std::ostringstream mText;
+        };
+
+    } // namespace SpecGenInternal
+
+    using namespace SpecGenInternal;
+
+    SpecOptions::SpecOptions()
+        : numFields( 16U )
+        , depth( 0U )
+        , commentBytes( 0U )
+        , literalBytes( 0U )
+        , fixedPoint( false )
+        , widths( WidthMode::Random )
+        , bitOrder( Endianness::Little )
+        , byteOrder( Endianness::Little )
+        , seed( DefaultSeed )
+    {
+    }
+
+    bool GenerateSpec
+        (
+        SpecOptions const& aOptions,
+        Spec& aOut
+        )
+    {
+        if( aOptions.numFields == 0U )
+        {
+            BFDP_MISUSE_ERROR( "A specification needs at least one field" );
+            return false;
+        }
+
+        SpecWriter writer( aOptions );
+        writer.WriteHeader();
+
+        aOut.fields.clear();
+        writer.WriteScope( 0U, aOut.fields );
+        aOut.text = writer.GetText();
+
+        aOut.recordBits = 0U;
+        for( size_t i = 0; i < aOut.fields.size(); ++i )
+        {
+            aOut.recordBits += aOut.fields[i].bits;
+        }
+        aOut.bitOrder = aOptions.bitOrder;
+        aOut.byteOrder = aOptions.byteOrder;
+        return true;
+    }
+
+} // namespace BfdpGen
@@ -0,0 +1,251 @@
+/**
+    BFDP Generator Main
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#define BFDP_MODULE "BfdpGen::Main"
+
+// External Includes
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Console/ArgParser.hpp"
+#include "Bfdp/ErrorReporter/Functions.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfdpGen/CaptureGen.hpp"
+#include "BfdpGen/Console.hpp"
+#include "BfdpGen/SpecGen.hpp"
+
+using Bfdp::BitManip::Endianness;
+using Bfdp::Console::ArgParser;
+using Bfdp::Console::Param;
+using BfdpGen::ParseCount;
+using BfdpGen::SavedParamMap;
+using BfdpGen::SaveToParamMap;
+
+static bool ParseOrder
+    (
+    std::string const& aText,
+    Endianness::Type& aOut
+    )
+{
+    aOut = ( aText == "BE" ) ? Endianness::Big : Endianness::Little;
+    return ( aText == "BE" ) || ( aText == "LE" );
+}
+
+int main
+    (
+    int argc,
+    char** argv
+    )
+{
+    BfdpGen::SetErrorHandlers();
+
+    SavedParamMap args;
+    ArgParser parser = ArgParser()
+        .SetName( "BfdpGen" )
+        .SetPrologue( "Generate BFSDL specifications and matching data for scale testing" )
+        .Add( Param::CreateLong( "help", 'h' )
+                .SetDescription( "Show this help text" )
+                .SetOptional()
+                .SetCallback( BfdpGen::ShowHelp )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "spec" )
+                .SetDescription( "Path to write the specification to" )
+                .SetValueName( "spec_file" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "data" )
+                .SetDescription( "Path to write data matching the specification to" )
+                .SetDefault( "", "data_file" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "bytes" )
+                .SetDescription( "Maximum size of the data; whole records are written" )
+                .SetDefault( "1048576", "count" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "fields" )
+                .SetDescription( "Number of data fields in a record" )
+                .SetDefault( "16", "count" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "depth" )
+                .SetDescription( "Levels of nested classes" )
+                .SetDefault( "0", "count" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "comment-bytes" )
+                .SetDescription( "Size of the comments at the beginning of each scope" )
+                .SetDefault( "0", "count" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "literal-bytes" )
+                .SetDescription( "Size of a string literal in the header; the specification is then rejected, for tokenizer testing only" )
+                .SetDefault( "0", "count" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "kinds" )
+                .SetDescription( "Kinds of fields (int or fixed, which mixes in fixed-point fields)" )
+                .SetDefault( "int", "kinds" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "widths" )
+                .SetDescription( "Field widths (random, edge, or max)" )
+                .SetDefault( "random", "mode" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "values" )
+                .SetDescription( "Field values (random or edge)" )
+                .SetDefault( "random", "mode" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "bit-order" )
+                .SetDescription( "Default bit order of the specification (LE or BE)" )
+                .SetDefault( "LE", "order" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "byte-order" )
+                .SetDescription( "Default byte order of the specification (LE or BE)" )
+                .SetDefault( "LE", "order" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            )
+        .Add( Param::CreateLong( "seed" )
+                .SetDescription( "Seed for the generated widths and values (0 := default)" )
+                .SetDefault( "0", "number" )
+                .SetCallback( SaveToParamMap )
+                .SetUserdataPtr( &args )
+            );
+
+    int ret = parser.Parse( argv, argc );
+    if( args.count( "help" ) != 0 )
+    {
+        // Help was printed by the parser
+        return 0;
+    }
+    else if( 0 != ret )
+    {
+        // Error logged by the parser
+        parser.PrintHelp( stdout );
+        return ret;
+    }
+
+    BfdpGen::SpecOptions options;
+    uint64_t maxBytes = 0U;
+    uint64_t numFields = 0U;
+    uint64_t depth = 0U;
+    uint64_t commentBytes = 0U;
+    uint64_t literalBytes = 0U;
+    if( !ParseCount( args["bytes"], maxBytes ) ||
+        !ParseCount( args["fields"], numFields ) ||
+        !ParseCount( args["depth"], depth ) ||
+        !ParseCount( args["comment-bytes"], commentBytes ) ||
+        !ParseCount( args["literal-bytes"], literalBytes ) ||
+        !ParseCount( args["seed"], options.seed ) )
+    {
+        BFDP_MISUSE_ERROR( "Invalid number" );
+        return 1;
+    }
+    else if( !ParseOrder( args["bit-order"], options.bitOrder ) ||
+        !ParseOrder( args["byte-order"], options.byteOrder ) )
+    {
+        BFDP_MISUSE_ERROR( "Invalid order" );
+        return 1;
+    }
+    options.numFields = static_cast< size_t >( numFields );
+    options.depth = static_cast< size_t >( depth );
+    options.commentBytes = static_cast< size_t >( commentBytes );
+    options.literalBytes = static_cast< size_t >( literalBytes );
+
+    std::string const kinds = args["kinds"];
+    std::string const widths = args["widths"];
+    std::string const values = args["values"];
+    options.fixedPoint = ( kinds == "fixed" );
+    options.widths = ( widths == "edge" ) ? BfdpGen::WidthMode::Edge
+        : ( widths == "max" ) ? BfdpGen::WidthMode::Max
+        : BfdpGen::WidthMode::Random;
+    BfdpGen::ValueMode::Type const valueMode = ( values == "edge" )
+        ? BfdpGen::ValueMode::Edge
+        : BfdpGen::ValueMode::Random;
+    if( ( ( kinds != "int" ) && ( kinds != "fixed" ) ) ||
+        ( ( widths != "random" ) && ( widths != "edge" ) && ( widths != "max" ) ) ||
+        ( ( values != "random" ) && ( values != "edge" ) ) )
+    {
+        BFDP_MISUSE_ERROR( "Invalid mode" );
+        return 1;
+    }
+
+    BfdpGen::Spec spec;
+    BFDP_RETURNIF_V( !BfdpGen::GenerateSpec( options, spec ), 1 );
+
+    std::ofstream specFile( args["spec"], std::ios::out | std::ios::binary | std::ios::trunc );
+    specFile << spec.text;
+    specFile.close();
+    if( !specFile )
+    {
+        BFDP_RUNTIME_ERROR( "Failed to write specification" );
+        return 1;
+    }
+
+    std::string const dataFileName = args["data"];
+    if( !dataFileName.empty() )
+    {
+        uint64_t const numRecords = BfdpGen::GetNumRecordsForBytes( spec, maxBytes );
+        std::filebuf dataFile;
+        if( ( dataFile.open( dataFileName, std::ios::out | std::ios::binary | std::ios::trunc ) == NULL ) ||
+            // Values draw from their own sequence, rather than repeating the spec's choices
+            !BfdpGen::GenerateCapture( spec, numRecords, valueMode, options.seed + 1U, dataFile ) ||
+            ( dataFile.close() == NULL ) )
+        {
+            BFDP_RUNTIME_ERROR( "Failed to write data" );
+            return 1;
+        }
+
+        std::cerr << "Wrote " << numRecords << " records of " << spec.recordBits << " bits" << std::endl;
+    }
+
+    return 0;
+}
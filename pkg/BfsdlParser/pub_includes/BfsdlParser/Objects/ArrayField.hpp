@@ -0,0 +1,105 @@
+/**
+    BFSDL Parser Array Field Declaration
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfsdlParser_Objects_ArrayField
+#define BfsdlParser_Objects_ArrayField
+
+// Base Includes
+#include "BfsdlParser/Objects/Field.hpp"
+
+// Internal Includes
+#include "BfsdlParser/Objects/Common.hpp"
+#include "BfsdlParser/Objects/NumericField.hpp"
+
+namespace BfsdlParser
+{
+
+    namespace Objects
+    {
+
+        class ArrayField;
+
+        typedef std::shared_ptr< ArrayField > ArrayFieldPtr;
+
+        //! Array Field
+        //!
+        //! Specialization of Field for a repeated element.  The number of elements is either fixed
+        //! or given by the value of an unsigned integer field that precedes the array.
+        class ArrayField
+            : public Field
+        {
+        public:
+            static ArrayFieldPtr StaticCast
+                (
+                IObjectPtr const aObject
+                );
+
+            //! Create an array with a fixed number of elements
+            ArrayField
+                (
+                std::string const& aName,
+                FieldPtr const aElement,
+                ArraySizeType const aCount
+                );
+
+            //! Create an array with the number of elements given by aCountField
+            ArrayField
+                (
+                std::string const& aName,
+                FieldPtr const aElement,
+                NumericFieldPtr const aCountField
+                );
+
+            virtual ~ArrayField();
+
+            //! @return The fixed number of elements (only valid if GetCountField() is NULL)
+            ArraySizeType GetCount() const;
+
+            //! @return The field that holds the number of elements, or NULL if fixed
+            NumericFieldPtr const& GetCountField() const;
+
+            //! @return The field describing each element
+            FieldPtr const& GetElement() const;
+
+            BFDP_OVERRIDE( std::string const& GetTypeStr() const );
+
+        private:
+            ArraySizeType const mCount;
+            NumericFieldPtr const mCountField;
+            FieldPtr const mElement;
+        };
+
+    } // namespace Objects
+
+} // namespace BfsdlParser
+
+#endif // BfsdlParser_Objects_ArrayField
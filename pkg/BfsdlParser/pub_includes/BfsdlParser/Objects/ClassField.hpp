@@ -0,0 +1,87 @@
+/**
+    BFSDL Parser Class Field Declaration
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfsdlParser_Objects_ClassField
+#define BfsdlParser_Objects_ClassField
+
+// Base Includes
+#include "BfsdlParser/Objects/Field.hpp"
+
+// Internal Includes
+#include "BfsdlParser/Objects/Common.hpp"
+#include "BfsdlParser/Objects/Tree.hpp"
+
+namespace BfsdlParser
+{
+
+    namespace Objects
+    {
+
+        class ClassField;
+
+        typedef std::shared_ptr< ClassField > ClassFieldPtr;
+
+        //! Class Field
+        //!
+        //! Specialization of Field for a nested record, whose layout is given by the fields of a
+        //! class Tree.
+        class ClassField
+            : public Field
+        {
+        public:
+            static ClassFieldPtr StaticCast
+                (
+                IObjectPtr const aObject
+                );
+
+            ClassField
+                (
+                std::string const& aName,
+                TreePtr const aClass
+                );
+
+            virtual ~ClassField();
+
+            //! @return The class that describes the fields of the record
+            TreePtr const& GetClass() const;
+
+            BFDP_OVERRIDE( std::string const& GetTypeStr() const );
+
+        private:
+            TreePtr const mClass;
+        };
+
+    } // namespace Objects
+
+} // namespace BfsdlParser
+
+#endif // BfsdlParser_Objects_ClassField
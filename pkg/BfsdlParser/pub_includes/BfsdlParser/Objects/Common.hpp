@@ -100,6 +100,25 @@ namespace BfsdlParser
             {
                 Numeric,
                 String,
+                Float,
+                Array,
+                Class,
+                Union,
+
+                Count,
+                Unknown = Count
+            };
+        };
+
+        //! IEEE 754 binary interchange formats (Appendix C.1)
+        struct FloatFormat
+        {
+            enum Id
+            {
+                Binary16,
+                Binary32,   //!< Also known as "single"
+                Binary64,   //!< Also known as "double"
+                Binary128,
 
                 Count,
                 Unknown = Count
@@ -120,8 +139,26 @@ namespace BfsdlParser
             size_t mFractionalBits;
         };
 
+        struct StringLengthType
+        {
+            // Type of length determination according to BFSDL Specification
+            enum Id
+            {
+                Bounded,    //!< Determined by a terminator, or the size of the parent stream or container
+                Fixed,      //!< len attribute (D.1.2)
+                Prefixed,   //!< plen attribute (D.1.5)
+
+                Unknown
+            };
+        };
+
+        //! Number of elements in an array field
+        typedef uint64_t ArraySizeType;
+
         typedef uint16_t BfsdlVersionType;
 
+        typedef uint16_t Ieee754VersionType;
+
     } // namespace Objects
 
 } // namespace BfsdlParser
@@ -42,6 +42,7 @@
 
 // Internal Includes
 #include "Bfdp/Common.hpp"
+#include "Bfdp/Data/IAllocator.hpp"
 #include "Bfdp/Macros.hpp"
 #include "BfsdlParser/Objects/IObject.hpp"
 #include "BfsdlParser/Objects/Tree.hpp"
@@ -58,7 +59,8 @@ namespace BfsdlParser
 
         //! Object Database
         //!
-        //! Keeps track of objects parsed from a BFSDL stream.
+        //! Keeps track of objects parsed from a BFSDL stream.  Objects are allocated from the heap,
+        //! or from an allocator shared by the whole database (see Create() and CreateArena()).
         class Database BFDP_FINAL
             : public Bfdp::NonCopyable
             , public Bfdp::NonAssignable
@@ -66,6 +68,22 @@ namespace BfsdlParser
         public:
             static DatabasePtr Create();
 
+            //! Create a database whose objects draw their memory from aAllocator
+            //!
+            //! Objects keep aAllocator alive, so it is released along with the last of them.
+            //!
+            //! @note aAllocator may be freed to from any thread that releases an object.
+            static DatabasePtr Create
+                (
+                Bfdp::Data::IAllocatorPtr const& aAllocator
+                );
+
+            //! Create a database whose objects are allocated from an ArenaAllocator of its own
+            //!
+            //! Loading a spec then takes memory a block at a time, and the whole object graph is
+            //! released at once.
+            static DatabasePtr CreateArena();
+
             TreePtr& GetRoot();
 
             void Iterate
@@ -63,6 +63,11 @@ namespace BfsdlParser
 
             virtual ~FStringField();
 
+            BFDP_OVERRIDE( StringLengthType::Id GetLengthType() const );
+
+            //! @return The number of bytes occupied by the string data, including any terminator
+            size_t GetNumBytes() const;
+
         private:
             BFDP_OVERRIDE( std::string GetConcreteTypeStr() const );
 
@@ -0,0 +1,99 @@
+/**
+    BFSDL Parser Float Field Declaration
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfsdlParser_Objects_FloatField
+#define BfsdlParser_Objects_FloatField
+
+// Base Includes
+#include "BfsdlParser/Objects/Field.hpp"
+
+// Internal Includes
+#include "BfsdlParser/Objects/Common.hpp"
+
+namespace BfsdlParser
+{
+
+    namespace Objects
+    {
+
+        class FloatField;
+
+        typedef std::shared_ptr< FloatField > FloatFieldPtr;
+
+        //! Float Field
+        //!
+        //! Specialization of Field for floating-point data types.
+        class FloatField
+            : public Field
+        {
+        public:
+            static FloatFieldPtr StaticCast
+                (
+                IObjectPtr const aObject
+                );
+
+            //! @return The format with the given name, or FloatFormat::Unknown if not supported.
+            static FloatFormat::Id GetFormatId
+                (
+                std::string const& aName
+                );
+
+            //! @return The minimum IEEE754Version setting that defines aFormat
+            static Ieee754VersionType GetMinIeee754Version
+                (
+                FloatFormat::Id const aFormat
+                );
+
+            FloatField
+                (
+                std::string const& aName,
+                FloatFormat::Id const aFormat
+                );
+
+            virtual ~FloatField();
+
+            //! @return The number of bits the field occupies
+            size_t GetBits() const;
+
+            FloatFormat::Id GetFormat() const;
+
+            BFDP_OVERRIDE( std::string const& GetTypeStr() const );
+
+        private:
+            FloatFormat::Id const mFormat;
+        };
+
+    } // namespace Objects
+
+} // namespace BfsdlParser
+
+#endif // BfsdlParser_Objects_FloatField
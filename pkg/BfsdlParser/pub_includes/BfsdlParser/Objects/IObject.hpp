@@ -40,9 +40,11 @@
 // External Includes
 #include <memory>
 #include <string>
+#include <utility>
 
 // Internal Includes
 #include "Bfdp/Algorithm/HashedString.hpp"
+#include "Bfdp/Data/StlAllocator.hpp"
 #include "BfsdlParser/Objects/Common.hpp"
 
 namespace BfsdlParser
@@ -74,6 +76,23 @@ namespace BfsdlParser
             virtual ObjectType::Id GetType() const = 0;
         };
 
+        //! Create an object, with its memory drawn from aAllocator if given or the heap otherwise
+        //!
+        //! The object keeps aAllocator alive until it is destroyed.
+        template< class T, class... ArgsT >
+        std::shared_ptr< T > CreateObject
+            (
+            Bfdp::Data::IAllocatorPtr const& aAllocator,
+            ArgsT&&... aArgs
+            )
+        {
+            if( !aAllocator )
+            {
+                return std::make_shared< T >( std::forward< ArgsT >( aArgs )... );
+            }
+            return std::allocate_shared< T >( Bfdp::Data::StlAllocator< T >( aAllocator ), std::forward< ArgsT >( aArgs )... );
+        }
+
     } // namespace Objects
 
 } // namespace BfsdlParser
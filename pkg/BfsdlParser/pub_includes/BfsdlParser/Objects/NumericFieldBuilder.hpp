@@ -60,6 +60,13 @@ namespace BfsdlParser
                 std::string const& aName
                 ) const;
 
+            //! Create the field, with its memory drawn from aAllocator (NULL for the heap)
+            NumericFieldPtr GetField
+                (
+                std::string const& aName,
+                Bfdp::Data::IAllocatorPtr const& aAllocator
+                ) const;
+
             //! @return true if the suffix was supplied, false otherwise.
             bool IsComplete() const;
 
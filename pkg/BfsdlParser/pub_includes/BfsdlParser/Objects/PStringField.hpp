@@ -63,6 +63,11 @@ namespace BfsdlParser
 
             virtual ~PStringField();
 
+            BFDP_OVERRIDE( StringLengthType::Id GetLengthType() const );
+
+            //! @return The width of the length prefix, in bits
+            size_t GetLengthBits() const;
+
         private:
             BFDP_OVERRIDE( std::string GetConcreteTypeStr() const );
 
@@ -39,6 +39,7 @@
 // Internal Includes
 #include "Bfdp/Unicode/Common.hpp"
 #include "Bfdp/Unicode/CodingMap.hpp"
+#include "BfsdlParser/Objects/Common.hpp"
 
 namespace BfsdlParser
 {
@@ -72,6 +73,18 @@ namespace BfsdlParser
 
             virtual ~StringField();
 
+            //! @return Whether the string may end without a terminator
+            bool AllowsUnterminated() const;
+
+            //! @return The encoding of the string data
+            Bfdp::Unicode::CodingId GetCoding() const;
+
+            //! @return How the length of the string data is determined
+            virtual StringLengthType::Id GetLengthType() const;
+
+            //! @return The terminator character
+            Bfdp::Unicode::CodePoint GetTermChar() const;
+
             BFDP_OVERRIDE( std::string const& GetTypeStr() const );
 
         protected:
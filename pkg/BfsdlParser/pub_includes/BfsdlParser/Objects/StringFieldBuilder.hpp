@@ -69,6 +69,13 @@ namespace BfsdlParser
                 std::string const& aName
                 ) const;
 
+            //! Create the field, with its memory drawn from aAllocator (NULL for the heap)
+            StringFieldPtr GetField
+                (
+                std::string const& aName,
+                Bfdp::Data::IAllocatorPtr const& aAllocator
+                ) const;
+
             //! Parse the identifier
             //!
             //! This will be 'string', or any derivative (ex: cstring, pstring).
@@ -93,6 +100,12 @@ namespace BfsdlParser
 
             void Reset();
 
+            //! Set the unit of the plen() width attribute
+            void SetBitBase
+                (
+                BitBase::Type const aBitBase
+                );
+
             void SetDefaultCoding
                 (
                 Bfdp::Unicode::CodingId const aCode
@@ -104,24 +117,16 @@ namespace BfsdlParser
                 );
 
         private:
-            struct LengthType
-            {
-                // Type of length determination according to BFSDL Specification
-                enum Id
-                {
-                    Bounded,    //!< Determined by the size of the parent stream or container
-                    Fixed,      //!< len attribute (D.1.2)
-                    Prefixed,   //!< plen attribute (D.1.5)
-
-                    Unknown
-                };
-            };
-
             AttributeParseResult::Type SetCodeAttr
                 (
                 std::string const& aValue
                 );
 
+            AttributeParseResult::Type SetLenAttr
+                (
+                size_t const aNumBytes
+                );
+
             AttributeParseResult::Type SetPlenAttr
                 (
                 size_t const aLength
@@ -143,9 +148,11 @@ namespace BfsdlParser
             bool mError;
             bool mIdentParsed;
 
+            BitBase::Type mBitBase;
+
             Bfdp::Data::Tristate mAllowUnterminated;
             Bfdp::Unicode::CodingId mCode;
-            LengthType::Id mLengthType;
+            StringLengthType::Id mLengthType;
             size_t mLengthValue;
             Bfdp::Unicode::CodePoint mTermChar;
 
@@ -45,6 +45,8 @@
 // Internal includes
 #include "Bfdp/Algorithm/Calc.hpp"
 #include "Bfdp/Algorithm/HashedString.hpp"
+#include "Bfdp/Data/IAllocator.hpp"
+#include "Bfdp/Data/StlAllocator.hpp"
 #include "Bfdp/Macros.hpp"
 #include "BfsdlParser/Objects/IObject.hpp"
 #include "BfsdlParser/Objects/Field.hpp"
@@ -62,13 +64,34 @@ namespace BfsdlParser
 
         //! Object Tree Container
         //!
-        //! Encapsulates a collection of objects
+        //! Encapsulates a collection of objects.  A named Tree within another describes a class
+        //! (BFSDL section 7), whose fields make up a nested record.
         class Tree
             : public ObjectBase
         {
         public:
+            //! @return Pointer to Tree object if aObject is a Tree, otherwise NULL.
+            static TreePtr StaticCast
+                (
+                IObjectPtr const aObject
+                );
+
             Tree();
 
+            explicit Tree
+                (
+                std::string const& aName
+                );
+
+            //! Construct a tree whose containers draw memory from aAllocator
+            //!
+            //! Objects created for the tree should use the same allocator; see GetAllocator().
+            Tree
+                (
+                std::string const& aName,
+                Bfdp::Data::IAllocatorPtr const& aAllocator
+                );
+
             virtual ~Tree();
 
             //! @return Pointer to the object if added to the tree, NULL otherwise.
@@ -77,6 +100,20 @@ namespace BfsdlParser
                 IObjectPtr const aNode
                 );
 
+            //! @note This does NOT do a recursive lookup.
+            //! @return Pointer to the last field named aName in the tree, NULL if not found.
+            FieldPtr FindField
+                (
+                std::string const& aName
+                );
+
+            //! @note This does NOT do a recursive lookup.
+            //! @return Pointer to the sub-tree if found in the tree, NULL otherwise.
+            TreePtr FindTree
+                (
+                std::string const& aName
+                );
+
             //! @note This does NOT do a recursive lookup.
             //! @return Pointer to the property object if found in the tree, NULL otherwise.
             PropertyPtr FindProperty
@@ -125,6 +162,12 @@ namespace BfsdlParser
                     : aDefault;
             }
 
+            //! @return The allocator for objects of the tree, or NULL for the heap
+            Bfdp::Data::IAllocatorPtr const& GetAllocator() const;
+
+            //! @return The number of fields in the tree (not including those of sub-trees)
+            size_t GetNumFields() const;
+
             //! Convenience function to get the value of a string property
             //!
             //! If you need to distinguish between the absence of a property vs empty
@@ -150,21 +193,46 @@ namespace BfsdlParser
                 void* const aArg
                 );
 
+            //! Add the fields and sub-trees of aOther to this tree
+            //!
+            //! Objects are shared with aOther rather than copied.  Properties are not merged.
+            //!
+            //! @return false if a sub-tree of aOther has the name of one in this tree, in which
+            //!     case nothing is merged; true otherwise.
+            bool Merge
+                (
+                Tree const& aOther
+                );
+
         private:
             typedef std::multimap
                 <
                 Bfdp::Algorithm::HashedString,
                 PropertyPtr,
-                Bfdp::Algorithm::HashedString::StrictWeakCompare
+                Bfdp::Algorithm::HashedString::StrictWeakCompare,
+                Bfdp::Data::StlAllocator< std::pair< Bfdp::Algorithm::HashedString const, PropertyPtr > >
                 > PropertyMap;
 
-            typedef std::list< FieldPtr > FieldList;
+            typedef std::list< FieldPtr, Bfdp::Data::StlAllocator< FieldPtr > > FieldList;
+
+            Bfdp::Data::IAllocatorPtr mAllocator;
 
             //! Fields are sequential data elements; so this must be ordered and can be duplicated.
             FieldList mFieldList;
 
             //! Properties are metadata about the scope of this tree; un-ordered and unique.
             PropertyMap mPropertyMap;
+
+            typedef std::map
+                <
+                Bfdp::Algorithm::HashedString,
+                TreePtr,
+                Bfdp::Algorithm::HashedString::StrictWeakCompare,
+                Bfdp::Data::StlAllocator< std::pair< Bfdp::Algorithm::HashedString const, TreePtr > >
+                > TreeMap;
+
+            //! Sub-trees are named types defined in the scope of this tree; un-ordered and unique.
+            TreeMap mTreeMap;
         };
 
     } // namespace Objects
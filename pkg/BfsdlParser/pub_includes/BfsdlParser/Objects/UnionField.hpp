@@ -0,0 +1,151 @@
+/**
+    BFSDL Parser Union Field Declaration
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfsdlParser_Objects_UnionField
+#define BfsdlParser_Objects_UnionField
+
+// Base Includes
+#include "BfsdlParser/Objects/Field.hpp"
+
+// External Includes
+#include <list>
+
+// Internal Includes
+#include "Bfdp/Algorithm/CaseTable.hpp"
+#include "Bfdp/Data/ByteBuffer.hpp"
+#include "BfsdlParser/Objects/Common.hpp"
+#include "BfsdlParser/Objects/NumericField.hpp"
+#include "BfsdlParser/Objects/Tree.hpp"
+
+namespace BfsdlParser
+{
+
+    namespace Objects
+    {
+
+        class UnionField;
+
+        typedef std::shared_ptr< UnionField > UnionFieldPtr;
+
+        //! Union Field
+        //!
+        //! Specialization of Field for switchable content: a record whose class is chosen by the
+        //! value of an unsigned integer tag field that precedes the union.
+        class UnionField
+            : public Field
+        {
+        public:
+            //! Returned by FindCase() when a tag value has no case
+            static size_t const NoCase = Bfdp::Algorithm::CaseTable::NoCase;
+
+            static UnionFieldPtr StaticCast
+                (
+                IObjectPtr const aObject
+                );
+
+            UnionField
+                (
+                std::string const& aName,
+                NumericFieldPtr const aTagField
+                );
+
+            virtual ~UnionField();
+
+            //! Add a case, to be decoded as aClass when the tag is aTag
+            //!
+            //! @return true if successful, false if aTag already has a case or the cases are
+            //!     complete.
+            bool AddCase
+                (
+                uint64_t const aTag,
+                TreePtr const aClass
+                );
+
+            //! Complete the cases, and build the table used to find them
+            //!
+            //! @return true if successful, false otherwise.
+            bool CompleteCases();
+
+            //! @pre CompleteCases() was successful
+            //! @return The case number for a tag value, or NoCase if it has no case.
+            inline size_t FindCase
+                (
+                uint64_t const aTag
+                ) const
+            {
+                return mCaseTable.Find( aTag );
+            }
+
+            //! @return Whether aTag already has a case
+            bool HasCase
+                (
+                uint64_t const aTag
+                ) const;
+
+            //! @return The class decoded for a case number
+            //! @note Walks the cases, so decoders should look up each class once.
+            TreePtr const& GetCaseClass
+                (
+                size_t const aCase
+                ) const;
+
+            //! @return The tag value of a case number
+            uint64_t GetCaseTag
+                (
+                size_t const aCase
+                ) const;
+
+            size_t GetNumCases() const;
+
+            //! @return The field whose value selects the case
+            NumericFieldPtr const& GetTagField() const;
+
+            BFDP_OVERRIDE( std::string const& GetTypeStr() const );
+
+        private:
+            typedef std::list< TreePtr > ClassList;
+
+            Bfdp::Algorithm::CaseTable mCaseTable;
+            ClassList mClasses;
+            bool mComplete;
+            size_t mNumCases;
+            NumericFieldPtr const mTagField;
+
+            //! Tag value of each case, in case order
+            Bfdp::Data::ByteBuffer mTags;
+        };
+
+    } // namespace Objects
+
+} // namespace BfsdlParser
+
+#endif // BfsdlParser_Objects_UnionField
@@ -49,6 +49,10 @@ namespace BfsdlParser
     //! Although the stream parser doesn't care about newlines, humans tend to want information
     //! about where parsing stopped in a file to troubleshoot an error.  This class attempts to
     //! keep track of that for printing nicer error messages.
+    //!
+    //! Since this information is only needed when an error is reported, processing new data
+    //! only records its extent.  The line, column, and context are calculated from the most
+    //! recent checkpoint when first requested.
     class ParsePosition
     {
     public:
@@ -59,6 +63,12 @@ namespace BfsdlParser
             size_t const aPosttextLen //!< [in] Maximum number of extra bytes to store
             );
 
+        //! Fold all data processed so far into the position counters
+        //!
+        //! Data passed to ProcessNewData() is referenced rather than copied, so this must be
+        //! called before the memory holding that data is modified or released.
+        void Checkpoint();
+
         //! @return The column at which the current context data begins
         size_t GetContextBeginColumn() const;
 
@@ -79,7 +89,10 @@ namespace BfsdlParser
 
         //! Process incoming data which has been read successfully
         //!
-        //! This data is added to the context and counted towards the current position.
+        //! This data is counted towards the current position.
+        //!
+        //! @pre aInData must immediately follow the data from the previous call, unless
+        //!     Checkpoint() was called in between.
         void ProcessNewData
             (
             Bfdp::Byte const* const aInData,
@@ -96,12 +109,26 @@ namespace BfsdlParser
             );
 
     private:
-        Bfdp::Data::ByteWindow mContextWindow;
+        //! Add the bytes of a single line to the context
+        //!
+        //! @note Newline characters are skipped.
+        void AddLineData
+            (
+            Bfdp::Byte const* const aInData,
+            size_t const aInSize
+            ) const;
+
+        //! Fold pending data into the position counters
+        void Resolve() const;
+
+        mutable Bfdp::Data::ByteWindow mContextWindow;
         Bfdp::Data::ByteBuffer mRemainderBuf;
 
-        size_t mCurLineNumber;
+        mutable size_t mCurLineNumber;
         std::string mName;
-        Bfdp::Byte mNewlineChar;
+        mutable Bfdp::Byte mNewlineChar;
+        mutable Bfdp::Byte const* mPendingData;
+        mutable size_t mPendingSize;
         size_t mRemainderSize;
     };
 
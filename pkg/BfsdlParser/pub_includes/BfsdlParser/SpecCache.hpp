@@ -0,0 +1,207 @@
+/**
+    BFSDL Parser Spec Cache Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfsdlParser_SpecCache
+#define BfsdlParser_SpecCache
+
+// Base Includes
+#include "Bfdp/NonAssignable.hpp"
+#include "Bfdp/NonCopyable.hpp"
+
+// External Includes
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+// Internal Includes
+#include "Bfdp/Algorithm/Calc.hpp"
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/Thread/TaskPool.hpp"
+#include "BfsdlParser/Objects/Database.hpp"
+#include "BfsdlParser/Objects/Tree.hpp"
+
+namespace BfsdlParser
+{
+
+    //! Process-wide cache of parsed External Streams (BFSDL section 6)
+    //!
+    //! Each External Stream is parsed once per canonical path and content, however many specs
+    //! refer to it, and the parsed Database is shared between them.  Loads run on a thread pool
+    //! so that independent libraries are parsed in parallel; the importing parser only blocks
+    //! once it needs the definitions.  A load which would wait on itself, directly or through
+    //! other loads in progress, fails as an import cycle.
+    class SpecCache BFDP_FINAL
+        : private Bfdp::NonAssignable
+        , private Bfdp::NonCopyable
+    {
+    public:
+        //! A parsed stream, shared by all loads of it
+        struct Entry;
+
+        typedef std::shared_ptr< Entry > EntryPtr;
+
+        //! A load in progress, from the stream which requested it
+        class Load BFDP_FINAL
+            : private Bfdp::NonAssignable
+            , private Bfdp::NonCopyable
+        {
+        public:
+            //! Stop waiting on the External Stream
+            ~Load();
+
+            //! @return The canonical path of the External Stream, or the source if unresolved
+            std::string const& GetPath() const;
+
+        private:
+            friend class SpecCache;
+
+            Load
+                (
+                SpecCache& aCache,
+                std::string const& aFromPath,
+                std::string const& aPath
+                );
+
+            SpecCache& mCache;
+            std::string mFromPath;
+            std::string mPath;
+            EntryPtr mEntry;
+            std::string mError;
+            bool mWaiting;
+        };
+
+        typedef std::shared_ptr< Load > LoadPtr;
+
+        //! @return The process-wide cache
+        static SpecCache& Get();
+
+        //! Start loading a library, which is parsed as its own BFSDL Stream (BFSDL section 6.1)
+        //!
+        //! @note A relative aSource is resolved against the directory of aFromFile.
+        //! @return The load, to pass to Finish().
+        LoadPtr StartLibrary
+            (
+            std::string const& aSource,
+            std::string const& aFromFile
+            );
+
+        //! Start loading an imported stream, which has no header of its own (BFSDL section 6.3)
+        //!
+        //! The stream is parsed with the header properties of aHeader, which are part of its key
+        //! in the cache.
+        //!
+        //! @note A relative aSource is resolved against the directory of aFromFile.
+        //! @return The load, to pass to Finish().
+        LoadPtr StartImport
+            (
+            std::string const& aSource,
+            std::string const& aFromFile,
+            Objects::TreePtr const aHeader
+            );
+
+        //! Wait for a load to complete
+        //!
+        //! @return The parsed stream, or NULL with aError set on failure.
+        Objects::DatabasePtr Finish
+            (
+            LoadPtr const& aLoad,
+            std::string& aError
+            );
+
+        //! Forget all parsed streams
+        //!
+        //! @note Loads already started are not affected.
+        void Clear();
+
+        //! @return The number of loads which shared a stream parsed for an earlier load
+        size_t GetNumHits();
+
+        //! @return The number of streams parsed
+        size_t GetNumParsed();
+
+    private:
+        typedef std::map< std::string, EntryPtr > EntryMap;
+
+        //! Streams in progress, mapped to the streams they are waiting on
+        typedef std::multimap< std::string, std::string > WaitMap;
+
+        SpecCache();
+
+        //! Add a wait from aFrom on aTo unless it would complete a cycle
+        //!
+        //! @pre mMutex is locked.
+        //! @return Whether the wait was added; if not, aCycle describes the cycle.
+        bool AddWait
+            (
+            std::string const& aFrom,
+            std::string const& aTo,
+            std::string& aCycle
+            );
+
+        //! @pre mMutex is locked.
+        //! @return Whether aFrom waits on aTo, directly or indirectly; if so, aPath describes the
+        //!     chain of waits.
+        bool IsWaiting
+            (
+            std::string const& aFrom,
+            std::string const& aTo,
+            std::set< std::string >& aVisited, //!< [in,out] Streams already searched
+            std::string& aPath
+            );
+
+        void RemoveWait
+            (
+            std::string const& aFrom,
+            std::string const& aTo
+            );
+
+        LoadPtr Start
+            (
+            std::string const& aSource,
+            std::string const& aFromFile,
+            Objects::TreePtr const aHeader
+            );
+
+        EntryMap mEntries;
+        size_t mNumHits;
+        size_t mNumParsed;
+        WaitMap mWaits;
+        std::mutex mMutex;
+        Bfdp::Thread::TaskPool mPool;
+    };
+
+} // namespace BfsdlParser
+
+#endif // BfsdlParser_SpecCache
@@ -41,14 +41,92 @@
 #include <istream>
 
 // Internal Includes
+#include "Bfdp/Common.hpp"
+#include "Bfdp/Data/ByteBuffer.hpp"
+#include "Bfdp/Macros.hpp"
 #include "BfsdlParser/Objects/Tree.hpp"
+#include "BfsdlParser/ParsePosition.hpp"
+#include "BfsdlParser/Token/Interpreter.hpp"
+#include "BfsdlParser/Token/Tokenizer.hpp"
 
 namespace BfsdlParser
 {
 
+    //! Push-style BFSDL stream parser
+    //!
+    //! Data is parsed directly from the caller's buffers as it is fed in, so no intermediate
+    //! copy of the stream is made.  If the parser cannot consume the end of a buffer, only that
+    //! tail is retained in a small carry buffer and joined with the next call to Feed().
+    class StreamParser BFDP_FINAL
+        : private Bfdp::NonAssignable
+        , private Bfdp::NonCopyable
+    {
+    public:
+        //! Maximum number of unparsed bytes which may be carried between calls to Feed()
+        static size_t const MaxCarrySize = 4096;
+
+        StreamParser
+            (
+            Objects::TreePtr const aDbContext
+            );
+
+        //! Parse the stream as imported into another, without a header (BFSDL section 6.3)
+        //!
+        //! @pre No data has been fed to the parser.
+        void BeginImport();
+
+        //! Parse the next span of the stream
+        //!
+        //! @note aData is not referenced after this returns.
+        //! @return true if parsing should continue, false on error.
+        bool Feed
+            (
+            Bfdp::Byte const* const aData,
+            size_t const aSize
+            );
+
+        //! Signal the end of the stream
+        //!
+        //! @note Any carried data which could not be parsed is discarded.
+        //! @return 0 on success, 1 otherwise.
+        int Finish();
+
+        //! @return Whether the parser stack was initialized successfully
+        bool IsInitOk() const;
+
+    private:
+        //! Parse as much of a span as possible and report errors
+        //!
+        //! @return true if parsing should continue, false on error.
+        bool ParseSpan
+            (
+            Bfdp::Byte const* const aData,
+            size_t const aSize,
+            size_t& aBytesParsed //!< [out] Number of bytes consumed
+            );
+
+        Token::Interpreter mInterpreter;
+        Token::Tokenizer mTokenizer;
+        ParsePosition mParsePos;
+        Bfdp::Data::ByteBuffer mCarry;
+        size_t mCarrySize;
+        bool mInitOk;
+        bool mOk;
+    };
+
+    //! Build a parser stack and feed data from a memory buffer into it.
+    //!
+    //! @return 0 on success, 1 otherwise.
+    int ParseBuffer
+        (
+        Objects::TreePtr const aDbContext,
+        Bfdp::Byte const* const aData,
+        size_t const aSize
+        );
+
     //! Build a parser stack and feed data from the stream into it.
     //!
-    //! @return 0 on success, false otherwise.
+    //! @return 0 on success, 1 otherwise.
     int ParseStream
         (
         Objects::TreePtr const aDbContext,
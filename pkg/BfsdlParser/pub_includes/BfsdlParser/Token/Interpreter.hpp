@@ -38,10 +38,18 @@
 #include "Bfdp/NonCopyable.hpp"
 #include "BfsdlParser/Token/ITokenObserver.hpp"
 
+// External Includes
+#include <list>
+
 // Internal Includes
 #include "Bfdp/StateMachine/Engine.hpp"
+#include "BfsdlParser/Objects/Common.hpp"
+#include "BfsdlParser/Objects/NumericField.hpp"
 #include "BfsdlParser/Objects/NumericFieldBuilder.hpp"
+#include "BfsdlParser/Objects/StringFieldBuilder.hpp"
 #include "BfsdlParser/Objects/Tree.hpp"
+#include "BfsdlParser/Objects/UnionField.hpp"
+#include "BfsdlParser/SpecCache.hpp"
 #include "BfsdlParser/Token/Tokenizer.hpp"
 
 namespace BfsdlParser
@@ -64,6 +72,17 @@ namespace BfsdlParser
                 Objects::TreePtr const aDbContext
                 );
 
+            //! Begin an imported stream, which has no header of its own (BFSDL section 6.3)
+            //!
+            //! Header properties already set on the stream root apply; the rest take defaults.
+            void BeginImport();
+
+            //! Complete the libraries used by the stream, and check that the stream did not end
+            //! within a class definition
+            //!
+            //! @return true if all libraries loaded and all classes were closed, false otherwise.
+            bool Finish();
+
             //! @return whether the Interpreter initialized successfully.
             bool IsInitOk() const;
 
@@ -92,6 +111,19 @@ namespace BfsdlParser
                 };
             };
 
+            //! A library whose stream is still being loaded
+            struct PendingLibrary
+            {
+                //! Named scope which receives the library's definitions
+                Objects::TreePtr tree;
+
+                SpecCache::LoadPtr load;
+            };
+
+            typedef std::list< PendingLibrary > PendingLibraryList;
+
+            typedef std::list< Objects::TreePtr > ScopeList;
+
             struct InputRef
             {
                 In::Type type;
@@ -104,6 +136,17 @@ namespace BfsdlParser
                 } d;
             };
 
+            //! Set header properties the stream did not define to their defaults
+            void ApplyHeaderDefaults();
+
+            //! Begin parsing an array count, to resume in the current state once complete
+            //!
+            //! @return false if the statement already defines an array, true otherwise.
+            bool BeginArray();
+
+            //! Begin parsing a class within mClass, to resume in the current state once complete
+            void BeginClassMember();
+
             void LogError
                 (
                 std::string const& aMessage
@@ -111,6 +154,33 @@ namespace BfsdlParser
 
             void LogError();
 
+            //! @note A library is loaded before it is returned.
+            //! @return The class named aName in the current scope or an enclosing one, or NULL if
+            //!     not found.
+            Objects::TreePtr FindClass
+                (
+                std::string const& aName
+                );
+
+            //! @return The innermost scope, where fields are added
+            Objects::TreePtr& GetScope();
+
+            //! Wait for aTree to receive its definitions, if it is a library still being loaded
+            //!
+            //! @return false if the library failed to load, true otherwise.
+            bool ResolveLibrary
+                (
+                Objects::TreePtr const& aTree
+                );
+
+            //! Log an error for an unsuccessful attribute result
+            //!
+            //! @return true if aResult indicates success, false otherwise.
+            bool CheckAttributeResult
+                (
+                Objects::AttributeParseResult::Type const aResult
+                );
+
             BFDP_OVERRIDE( bool OnControlCharacter
                 (
                 std::string const& aControlCharacter
@@ -181,15 +251,61 @@ namespace BfsdlParser
             void StateStatementBeginEvaluate();
             void StateStatementFixedPointNumericIdEvaluate();
             void StateStatementFixedPointNumericSuffixEvaluate();
+            void StateStatementFloatIdEvaluate();
+            void StateStatementFloatFormatOpenEvaluate();
+            void StateStatementFloatFormatValueEvaluate();
+            void StateStatementFloatFormatCloseEvaluate();
+            void StateStatementStringIdEvaluate();
+            void StateStatementStringAttrNameEvaluate();
+            void StateStatementStringAttrOpenEvaluate();
+            void StateStatementStringAttrValueEvaluate();
+            void StateStatementStringAttrCloseEvaluate();
+            void StateStatementClassNameEvaluate();
+            void StateStatementClassOpenEvaluate();
+            void StateStatementClassFieldIdEvaluate();
+            void StateStatementClassMemberEvaluate();
+            void StateStatementLibraryNameEvaluate();
+            void StateStatementLibraryOpenEvaluate();
+            void StateStatementLibrarySourceEvaluate();
+            void StateStatementLibraryCloseEvaluate();
+            void StateStatementImportSourceEvaluate();
+            void StateStatementUnionTagOpenEvaluate();
+            void StateStatementUnionTagEvaluate();
+            void StateStatementUnionTagCloseEvaluate();
+            void StateStatementUnionNameEvaluate();
+            void StateStatementUnionOpenEvaluate();
+            void StateStatementUnionCaseEvaluate();
+            void StateStatementUnionCaseColonEvaluate();
+            void StateStatementUnionCaseClassEvaluate();
+            void StateStatementUnionCaseEndEvaluate();
+            void StateStatementArrayCountEvaluate();
+            void StateStatementArrayCloseEvaluate();
             void StateStatementEndEvaluate();
 
+            //! @return aElement as an array field if the statement defines an array, otherwise
+            //!     aElement.
+            Objects::FieldPtr WrapArray
+                (
+                Objects::FieldPtr const aElement
+                );
+
             Objects::BitBase::Type mCurBitBase;
 
+            //! Root of the stream, which holds the header properties
             Objects::TreePtr mDb;
 
+            //! Stream scope followed by the classes being defined, innermost last
+            ScopeList mScopes;
+
             // Header tracking variables
             Header::StreamProgressType mHeaderStreamProgress;
 
+            //! Whether the stream is imported, and so may not have a header
+            bool mImport;
+
+            //! Libraries not yet needed by the stream, in the order of their definitions
+            PendingLibraryList mLibraries;
+
             // An identifier (relevancy depends on the context of the current state)
             std::string mIdentifier;
 
@@ -200,7 +316,19 @@ namespace BfsdlParser
             InputRef mInput;
 
             // Statement tracking variables
+            Objects::ArraySizeType mArrayCount;
+            Objects::NumericFieldPtr mArrayCountField;
+            bool mArrayDefined;
+            size_t mArrayReturnState;
+            Objects::TreePtr mClass;
+            size_t mClassMemberReturnState;
+            Objects::FloatFormat::Id mFloatFormat;
+            bool mFloatFormatExplicit;
             Objects::NumericFieldBuilder mNumericFieldBuilder;
+            Objects::StringFieldBuilder mStringFieldBuilder;
+            Objects::UnionFieldPtr mUnion;
+            uint64_t mUnionCaseTag;
+            Objects::NumericFieldPtr mUnionTagField;
 
             //! Whether a parsing error occurred
             bool mParseError;
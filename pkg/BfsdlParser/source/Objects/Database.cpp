@@ -33,9 +33,13 @@
 // Base includes
 #include "BfsdlParser/Objects/Database.hpp"
 
-// Internal Includes
+// External Includes
 #include <new>
 
+// Internal Includes
+#include "Bfdp/Data/ArenaAllocator.hpp"
+#include "Bfdp/Data/HeapAllocator.hpp"
+
 namespace BfsdlParser
 {
 
@@ -43,11 +47,19 @@ namespace BfsdlParser
     {
 
         /* static */ DatabasePtr Database::Create()
+        {
+            return Create( Bfdp::Data::IAllocatorPtr() );
+        }
+
+        /* static */ DatabasePtr Database::Create
+            (
+            Bfdp::Data::IAllocatorPtr const& aAllocator
+            )
         {
             DatabasePtr db = std::shared_ptr< Database >( new(std::nothrow) Database() );
             if( db )
             {
-                db->mRoot = std::make_shared< Tree >();
+                db->mRoot = CreateObject< Tree >( aAllocator, std::string(), aAllocator );
             }
 
             if( !db || !db->mRoot )
@@ -58,6 +70,16 @@ namespace BfsdlParser
             return db;
         }
 
+        /* static */ DatabasePtr Database::CreateArena()
+        {
+            Bfdp::Data::IAllocatorPtr arena = std::make_shared< Bfdp::Data::ArenaAllocator >
+                (
+                Bfdp::Data::ArenaAllocator::DefaultBlockSize,
+                Bfdp::Data::HeapAllocator::GetInstance()
+                );
+            return Create( arena );
+        }
+
         Objects::TreePtr& Database::GetRoot()
         {
             return mRoot;
@@ -61,6 +61,16 @@ namespace BfsdlParser
         {
         }
 
+        StringLengthType::Id FStringField::GetLengthType() const
+        {
+            return StringLengthType::Fixed;
+        }
+
+        size_t FStringField::GetNumBytes() const
+        {
+            return mNumBytes;
+        }
+
         std::string FStringField::GetConcreteTypeStr() const
         {
             std::stringstream ss;
@@ -0,0 +1,145 @@
+/**
+    BFSDL Parser Float Field Definition
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "BfsdlParser/Objects/FloatField.hpp"
+
+// Internal Includes
+#include "Bfdp/Macros.hpp"
+
+namespace BfsdlParser
+{
+
+    namespace Objects
+    {
+
+        namespace FloatFieldInternal
+        {
+
+            struct FormatInfo
+            {
+                char const* name;
+                char const* alias;
+                size_t bits;
+                Ieee754VersionType minVersion;
+            };
+
+            //! Indexed by FloatFormat::Id
+            static FormatInfo const sFormats[] =
+            {
+                { "binary16", NULL, 16, 2008 },
+                { "binary32", "single", 32, 1985 },
+                { "binary64", "double", 64, 1985 },
+                { "binary128", NULL, 128, 2008 },
+            };
+            BFDP_CTIME_ASSERT( BFDP_COUNT_OF_ARRAY( sFormats ) == FloatFormat::Count, "Format table mismatch" );
+
+        } // namespace FloatFieldInternal
+
+        using namespace FloatFieldInternal;
+
+        /* static */ FloatFieldPtr FloatField::StaticCast
+            (
+            IObjectPtr const aObject
+            )
+        {
+            FieldPtr basePtr = Field::StaticCast( aObject );
+            if( ( basePtr == NULL ) ||
+                ( basePtr->GetFieldType() != FieldType::Float ) )
+            {
+                return NULL;
+            }
+
+            return std::static_pointer_cast< FloatField >( aObject );
+        }
+
+        /* static */ FloatFormat::Id FloatField::GetFormatId
+            (
+            std::string const& aName
+            )
+        {
+            for( size_t i = 0; i < FloatFormat::Count; ++i )
+            {
+                if( ( aName == sFormats[i].name ) ||
+                    ( ( sFormats[i].alias != NULL ) && ( aName == sFormats[i].alias ) ) )
+                {
+                    return static_cast< FloatFormat::Id >( i );
+                }
+            }
+            return FloatFormat::Unknown;
+        }
+
+        /* static */ Ieee754VersionType FloatField::GetMinIeee754Version
+            (
+            FloatFormat::Id const aFormat
+            )
+        {
+            return ( aFormat < FloatFormat::Count ) ? sFormats[aFormat].minVersion : 0U;
+        }
+
+        FloatField::FloatField
+            (
+            std::string const& aName,
+            FloatFormat::Id const aFormat
+            )
+            : Field( aName, FieldType::Float )
+            , mFormat( aFormat )
+        {
+        }
+
+        FloatField::~FloatField()
+        {
+        }
+
+        size_t FloatField::GetBits() const
+        {
+            return ( mFormat < FloatFormat::Count ) ? sFormats[mFormat].bits : 0U;
+        }
+
+        FloatFormat::Id FloatField::GetFormat() const
+        {
+            return mFormat;
+        }
+
+        std::string const& FloatField::GetTypeStr() const
+        {
+            if( mTypeStr.empty() )
+            {
+                mTypeStr = std::string( "f:" ) + ( ( mFormat < FloatFormat::Count ) ? sFormats[mFormat].name : "unknown" );
+            }
+
+            return mTypeStr;
+        }
+
+    } // namespace Objects
+
+} // namespace BfsdlParser
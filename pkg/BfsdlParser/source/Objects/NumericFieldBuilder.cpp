@@ -61,9 +61,18 @@ namespace BfsdlParser
             (
             std::string const& aName
             ) const
+        {
+            return GetField( aName, Bfdp::Data::IAllocatorPtr() );
+        }
+
+        NumericFieldPtr NumericFieldBuilder::GetField
+            (
+            std::string const& aName,
+            Bfdp::Data::IAllocatorPtr const& aAllocator
+            ) const
         {
             BFDP_RETURNIF_V( !mComplete, NULL );
-            return std::make_shared< NumericField >( aName, mProps );
+            return CreateObject< NumericField >( aAllocator, aName, mProps );
         }
 
         bool NumericFieldBuilder::IsComplete() const
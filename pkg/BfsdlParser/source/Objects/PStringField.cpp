@@ -61,6 +61,16 @@ namespace BfsdlParser
         {
         }
 
+        StringLengthType::Id PStringField::GetLengthType() const
+        {
+            return StringLengthType::Prefixed;
+        }
+
+        size_t PStringField::GetLengthBits() const
+        {
+            return mLengthBits;
+        }
+
         std::string PStringField::GetConcreteTypeStr() const
         {
             std::stringstream ss;
@@ -75,6 +75,26 @@ namespace BfsdlParser
         {
         }
 
+        bool StringField::AllowsUnterminated() const
+        {
+            return mAllowUnterminated;
+        }
+
+        Bfdp::Unicode::CodingId StringField::GetCoding() const
+        {
+            return mCode;
+        }
+
+        /* virtual */ StringLengthType::Id StringField::GetLengthType() const
+        {
+            return StringLengthType::Bounded;
+        }
+
+        Bfdp::Unicode::CodePoint StringField::GetTermChar() const
+        {
+            return mTermChar;
+        }
+
         /* virtual */ std::string StringField::GetConcreteTypeStr() const
         {
             return "b";
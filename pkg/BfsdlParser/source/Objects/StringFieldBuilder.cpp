@@ -38,8 +38,10 @@
 #include <cstdlib>
 
 // Internal Includes
+#include "Bfdp/BitManip/Conversion.hpp"
 #include "Bfdp/Common.hpp"
 #include "Bfdp/ErrorReporter/Functions.hpp"
+#include "Bfdp/Unicode/Functions.hpp"
 #include "BfsdlParser/Objects/FStringField.hpp"
 #include "BfsdlParser/Objects/PStringField.hpp"
 #include "BfsdlParser/Objects/StringField.hpp"
@@ -62,10 +64,11 @@ namespace BfsdlParser
             : mComplete( false )
             , mError( false )
             , mIdentParsed( false )
+            , mBitBase( BitBase::Default )
             , mCode( InvalidCodingId )
-            , mLengthType( LengthType::Unknown )
+            , mLengthType( StringLengthType::Unknown )
             , mLengthValue( 0 )
-            , mTermChar( 0 )
+            , mTermChar( InvalidCodePoint )
             , mDefaultCode( Bfdp::Unicode::GetCodingId( "ASCII" ) )
             , mDefaultTermChar( 0U )
         {
@@ -86,9 +89,9 @@ namespace BfsdlParser
             }
 
             // Apply defaults
-            if( mLengthType == LengthType::Unknown )
+            if( mLengthType == StringLengthType::Unknown )
             {
-                mLengthType = LengthType::Bounded;
+                mLengthType = StringLengthType::Bounded;
             }
             if( mTermChar == InvalidCodePoint )
             {
@@ -111,19 +114,28 @@ namespace BfsdlParser
             (
             std::string const& aName
             ) const
+        {
+            return GetField( aName, Bfdp::Data::IAllocatorPtr() );
+        }
+
+        StringFieldPtr StringFieldBuilder::GetField
+            (
+            std::string const& aName,
+            Bfdp::Data::IAllocatorPtr const& aAllocator
+            ) const
         {
             BFDP_RETURNIF_V( !mComplete, NULL );
-            if( mLengthType == LengthType::Bounded )
+            if( mLengthType == StringLengthType::Bounded )
             {
-                return std::make_shared< StringField >( aName, mTermChar, mAllowUnterminated.IsTrue(), mCode );
+                return CreateObject< StringField >( aAllocator, aName, mTermChar, mAllowUnterminated.IsTrue(), mCode );
             }
-            else if( mLengthType == LengthType::Fixed )
+            else if( mLengthType == StringLengthType::Fixed )
             {
-                return std::make_shared< FStringField >( aName, mTermChar, mAllowUnterminated.IsTrue(), mCode, mLengthValue );
+                return CreateObject< FStringField >( aAllocator, aName, mTermChar, mAllowUnterminated.IsTrue(), mCode, mLengthValue );
             }
-            else if( mLengthType == LengthType::Prefixed )
+            else if( mLengthType == StringLengthType::Prefixed )
             {
-                return std::make_shared< PStringField >( aName, mTermChar, mAllowUnterminated.IsTrue(), mCode, mLengthValue );
+                return CreateObject< PStringField >( aAllocator, aName, mTermChar, mAllowUnterminated.IsTrue(), mCode, mLengthValue );
             }
 
             return NULL;
@@ -189,11 +201,49 @@ namespace BfsdlParser
 
         AttributeParseResult::Type StringFieldBuilder::ParseNumericAttribute
             (
-            std::string const& /* aName */,
-            NumericLiteral const& /* aValue */
+            std::string const& aName,
+            NumericLiteral const& aValue
             )
         {
-            return AttributeParseResult::Unknown;
+            AttributeParseResult::Type result = AttributeParseResult::Unsupported;
+
+            if( aName == "len" )
+            {
+                uint32_t numBytes = 0;
+                result = aValue.GetUint( numBytes, Bfdp::BitManip::BytesToBits( sizeof( numBytes ) ) )
+                    ? SetLenAttr( numBytes )
+                    : AttributeParseResult::InvalidArgument;
+            }
+            else if( aName == "plen" )
+            {
+                // Width is given in units of the BitBase setting
+                uint8_t width = 0;
+                if( !aValue.GetUint( width, Bfdp::BitManip::BytesToBits( sizeof( width ) ) ) ||
+                    ( width == 0 ) ||
+                    ( width > ( MAX_NUMERIC_FIELD_BITS / mBitBase ) ) )
+                {
+                    result = AttributeParseResult::InvalidArgument;
+                }
+                else
+                {
+                    result = SetPlenAttr( width * mBitBase );
+                }
+            }
+            else if( aName == "term" )
+            {
+                Bfdp::Unicode::CodePoint termChar = 0;
+                result = ( aValue.GetUint( termChar, Bfdp::BitManip::BytesToBits( sizeof( termChar ) ) ) &&
+                    Bfdp::Unicode::IsCharacter( termChar ) )
+                    ? SetTermAttr( termChar )
+                    : AttributeParseResult::InvalidArgument;
+            }
+
+            if( result != AttributeParseResult::Success )
+            {
+                mError = true;
+            }
+
+            return result;
         }
 
         AttributeParseResult::Type StringFieldBuilder::ParseStringAttribute
@@ -229,11 +279,19 @@ namespace BfsdlParser
 
             mAllowUnterminated.Reset();
             mCode = InvalidCodingId;
-            mLengthType = LengthType::Unknown;
+            mLengthType = StringLengthType::Unknown;
             mLengthValue = 0;
             mTermChar = InvalidCodePoint;
         }
 
+        void StringFieldBuilder::SetBitBase
+            (
+            BitBase::Type const aBitBase
+            )
+        {
+            mBitBase = aBitBase;
+        }
+
         void StringFieldBuilder::SetDefaultCoding
             (
             Bfdp::Unicode::CodingId const aCode
@@ -263,14 +321,28 @@ namespace BfsdlParser
             return AttributeParseResult::Success;
         }
 
+        AttributeParseResult::Type StringFieldBuilder::SetLenAttr
+            (
+            size_t const aNumBytes
+            )
+        {
+            BFDP_RETURNIF_V( mLengthType != StringLengthType::Unknown, AttributeParseResult::Redefinition );
+            BFDP_RETURNIF_V( aNumBytes == 0, AttributeParseResult::InvalidArgument );
+
+            mLengthType = StringLengthType::Fixed;
+            mLengthValue = aNumBytes;
+
+            return AttributeParseResult::Success;
+        }
+
         AttributeParseResult::Type StringFieldBuilder::SetPlenAttr
             (
             size_t const aLength
             )
         {
-            BFDP_RETURNIF_V( mLengthType != LengthType::Unknown, AttributeParseResult::Redefinition );
+            BFDP_RETURNIF_V( mLengthType != StringLengthType::Unknown, AttributeParseResult::Redefinition );
 
-            mLengthType = LengthType::Prefixed;
+            mLengthType = StringLengthType::Prefixed;
             mLengthValue = aLength;
 
             return AttributeParseResult::Success;
@@ -281,11 +353,10 @@ namespace BfsdlParser
             Bfdp::Unicode::CodePoint const aCodePoint
             )
         {
-            BFDP_RETURNIF_V( mLengthType != LengthType::Unknown, AttributeParseResult::Redefinition );
             BFDP_RETURNIF_V( mTermChar != InvalidCodePoint, AttributeParseResult::Redefinition );
 
+            // The terminator may be combined with any length determination (D.1)
             mTermChar = aCodePoint;
-            mLengthType = LengthType::Bounded;
 
             return AttributeParseResult::Success;
         }
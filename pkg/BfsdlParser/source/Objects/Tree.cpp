@@ -45,11 +45,42 @@ namespace BfsdlParser
     namespace Objects
     {
 
+        /* static */ TreePtr Tree::StaticCast
+            (
+            IObjectPtr const aObject
+            )
+        {
+            return ( ObjectType::Tree == aObject->GetType() )
+                ? std::static_pointer_cast< Tree >( aObject )
+                : NULL;
+        }
+
         Tree::Tree()
             : ObjectBase( std::string(), ObjectType::Tree )
         {
         }
 
+        Tree::Tree
+            (
+            std::string const& aName
+            )
+            : ObjectBase( aName, ObjectType::Tree )
+        {
+        }
+
+        Tree::Tree
+            (
+            std::string const& aName,
+            Bfdp::Data::IAllocatorPtr const& aAllocator
+            )
+            : ObjectBase( aName, ObjectType::Tree )
+            , mAllocator( aAllocator )
+            , mFieldList( FieldList::allocator_type( aAllocator ) )
+            , mPropertyMap( PropertyMap::key_compare(), PropertyMap::allocator_type( aAllocator ) )
+            , mTreeMap( TreeMap::key_compare(), TreeMap::allocator_type( aAllocator ) )
+        {
+        }
+
         Tree::~Tree()
         {
         }
@@ -89,8 +120,19 @@ namespace BfsdlParser
                 break;
 
             case ObjectType::Tree:
-                // Will likely be some use case for this later when supporting classes,
-                // enum values, sub-streams, etc...  For now, do not add.
+                {
+                    // Only named types are kept; enum values, sub-streams, etc... may use
+                    // unnamed trees later.
+                    BFDP_RETURNIF_V( aNode->GetName().empty(), NULL );
+                    std::pair< TreeMap::iterator, bool > inserted = mTreeMap.insert
+                        (
+                        std::make_pair( aNode->GetId(), Tree::StaticCast( aNode ) )
+                        );
+                    if( inserted.second )
+                    {
+                        result = inserted.first->second;
+                    }
+                }
                 break;
 
             case ObjectType::Count:
@@ -101,6 +143,33 @@ namespace BfsdlParser
             return result;
         }
 
+        FieldPtr Tree::FindField
+            (
+            std::string const& aName
+            )
+        {
+            // Fields are few per scope and looked up only while building the tree
+            for( FieldList::reverse_iterator iter = mFieldList.rbegin(); iter != mFieldList.rend(); ++iter )
+            {
+                if( ( *iter )->GetName() == aName )
+                {
+                    return *iter;
+                }
+            }
+            return NULL;
+        }
+
+        TreePtr Tree::FindTree
+            (
+            std::string const& aName
+            )
+        {
+            TreeMap::iterator iter = mTreeMap.find( Bfdp::Algorithm::HashedString( aName ) );
+            BFDP_RETURNIF_V( iter == mTreeMap.end(), NULL );
+
+            return iter->second;
+        }
+
         PropertyPtr Tree::FindProperty
             (
             std::string const& aName
@@ -115,6 +184,16 @@ namespace BfsdlParser
             return Property::StaticCast( iter->second );
         }
 
+        Bfdp::Data::IAllocatorPtr const& Tree::GetAllocator() const
+        {
+            return mAllocator;
+        }
+
+        size_t Tree::GetNumFields() const
+        {
+            return mFieldList.size();
+        }
+
         std::string Tree::GetStringProperty
             (
             std::string const& aName
@@ -152,6 +231,21 @@ namespace BfsdlParser
             }
         }
 
+        bool Tree::Merge
+            (
+            Tree const& aOther
+            )
+        {
+            for( TreeMap::const_iterator iter = aOther.mTreeMap.begin(); iter != aOther.mTreeMap.end(); ++iter )
+            {
+                BFDP_RETURNIF_V( mTreeMap.find( iter->first ) != mTreeMap.end(), false );
+            }
+
+            mFieldList.insert( mFieldList.end(), aOther.mFieldList.begin(), aOther.mFieldList.end() );
+            mTreeMap.insert( aOther.mTreeMap.begin(), aOther.mTreeMap.end() );
+            return true;
+        }
+
     } // namespace Objects
 
 } // namespace BfsdlParser
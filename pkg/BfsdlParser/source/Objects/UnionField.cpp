@@ -0,0 +1,166 @@
+/**
+    BFSDL Parser Union Field Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "BfsdlParser/Objects/UnionField.hpp"
+
+// External Includes
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+// Internal Includes
+#include "Bfdp/Macros.hpp"
+
+namespace BfsdlParser
+{
+
+    namespace Objects
+    {
+
+        /* static */ UnionFieldPtr UnionField::StaticCast
+            (
+            IObjectPtr const aObject
+            )
+        {
+            FieldPtr basePtr = Field::StaticCast( aObject );
+            if( ( basePtr == NULL ) ||
+                ( basePtr->GetFieldType() != FieldType::Union ) )
+            {
+                return NULL;
+            }
+
+            return std::static_pointer_cast< UnionField >( aObject );
+        }
+
+        UnionField::UnionField
+            (
+            std::string const& aName,
+            NumericFieldPtr const aTagField
+            )
+            : Field( aName, FieldType::Union )
+            , mComplete( false )
+            , mNumCases( 0U )
+            , mTagField( aTagField )
+        {
+        }
+
+        UnionField::~UnionField()
+        {
+        }
+
+        bool UnionField::AddCase
+            (
+            uint64_t const aTag,
+            TreePtr const aClass
+            )
+        {
+            if( mComplete || HasCase( aTag ) )
+            {
+                return false;
+            }
+
+            size_t const capacity = mTags.GetSize() / sizeof( uint64_t );
+            if( mNumCases == capacity )
+            {
+                // Grow geometrically to amortize adding one case at a time
+                Bfdp::Data::ByteBuffer newTags;
+                BFDP_RETURNIF_V( !newTags.Allocate( std::max< size_t >( 2 * capacity, 8U ) * sizeof( uint64_t ) ), false );
+                if( mNumCases > 0 )
+                {
+                    std::memcpy( newTags.GetPtr(), mTags.GetConstPtr(), mNumCases * sizeof( uint64_t ) );
+                }
+                mTags.Swap( newTags );
+            }
+
+            mTags.GetPtrT< uint64_t >()[mNumCases++] = aTag;
+            mClasses.push_back( aClass );
+            return true;
+        }
+
+        bool UnionField::CompleteCases()
+        {
+            mComplete = ( mNumCases > 0 ) && mCaseTable.Build( mTags.GetConstPtrT< uint64_t >(), mNumCases );
+            return mComplete;
+        }
+
+        TreePtr const& UnionField::GetCaseClass
+            (
+            size_t const aCase
+            ) const
+        {
+            ClassList::const_iterator iter = mClasses.begin();
+            std::advance( iter, aCase );
+            return *iter;
+        }
+
+        uint64_t UnionField::GetCaseTag
+            (
+            size_t const aCase
+            ) const
+        {
+            return mTags.GetConstPtrT< uint64_t >()[aCase];
+        }
+
+        bool UnionField::HasCase
+            (
+            uint64_t const aTag
+            ) const
+        {
+            // Only used while the spec is read; decoding uses the case table
+            uint64_t const* const tags = mTags.GetConstPtrT< uint64_t >();
+            return std::find( tags, tags + mNumCases, aTag ) != tags + mNumCases;
+        }
+
+        size_t UnionField::GetNumCases() const
+        {
+            return mNumCases;
+        }
+
+        NumericFieldPtr const& UnionField::GetTagField() const
+        {
+            return mTagField;
+        }
+
+        std::string const& UnionField::GetTypeStr() const
+        {
+            if( mTypeStr.empty() )
+            {
+                mTypeStr = "union(" + ( mTagField ? mTagField->GetName() : std::string( "???" ) ) + ")";
+            }
+
+            return mTypeStr;
+        }
+
+    } // namespace Objects
+
+} // namespace BfsdlParser
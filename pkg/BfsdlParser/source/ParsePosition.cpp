@@ -39,6 +39,7 @@
 #include <sstream>
 
 // Internal Includes
+#include "Bfdp/Algorithm/Search.hpp"
 #include "Bfdp/ErrorReporter/Functions.hpp"
 
 #define BFDP_MODULE "ParsePosition"
@@ -73,9 +74,11 @@ namespace BfsdlParser
         size_t const aPretextLen,
         size_t const aPosttextLen
         )
-        : mNewlineChar( '\0' )
-        , mCurLineNumber( 1U )
+        : mCurLineNumber( 1U )
         , mName( aName )
+        , mNewlineChar( '\0' )
+        , mPendingData( NULL )
+        , mPendingSize( 0U )
         , mRemainderSize( 0U )
     {
         // Try to allocate; worst case it fails and there's no context to print
@@ -89,23 +92,33 @@ namespace BfsdlParser
         }
     }
 
+    void ParsePosition::Checkpoint()
+    {
+        Resolve();
+        mPendingData = NULL;
+    }
+
     size_t ParsePosition::GetContextBeginColumn() const
     {
+        Resolve();
         return mContextWindow.GetBeginCounter();
     }
 
     size_t ParsePosition::GetContextPositionOffset() const
     {
+        Resolve();
         return mContextWindow.GetSize();
     }
 
     size_t ParsePosition::GetCurColNumber() const
     {
+        Resolve();
         return mContextWindow.GetEndCounter() + 1;
     }
 
     size_t ParsePosition::GetCurLineNumber() const
     {
+        Resolve();
         return mCurLineNumber;
     }
 
@@ -116,6 +129,8 @@ namespace BfsdlParser
 
     std::string ParsePosition::GetPrintableContext() const
     {
+        Resolve();
+
         std::stringstream ss;
         size_t ctxSize = mContextWindow.GetSize();
         for( size_t i = 0; i < ctxSize; ++i )
@@ -144,32 +159,17 @@ namespace BfsdlParser
     {
         mRemainderSize = 0; // Clear out remainder on new data, as it is no longer valid
 
-        for( size_t i = 0; i < aInSize; ++i )
+        if( mPendingData == NULL )
         {
-            switch( aInData[i] )
-            {
-                case 0x0a:
-                case 0x0d:
-                    if( mNewlineChar == 0x00 )
-                    {
-                        // Detect the first newline character as the one to count
-                        mNewlineChar = aInData[i];
-                    }
-                    if( aInData[i] == mNewlineChar )
-                    {
-                        // Start counting the next line
-                        mContextWindow.Reset();
-                        ++mCurLineNumber;
-                    }
-                    // Newline characters don't get pushed to the window
-                    break;
-
-                default:
-                    // Add everything else to the context window
-                    mContextWindow.PushData( &aInData[i], 1U );
-                    break;
-            }
+            mPendingData = aInData;
+        }
+        else if( aInData != &mPendingData[mPendingSize] )
+        {
+            BFDP_MISUSE_ERROR( "Non-contiguous data without checkpoint" );
+            Checkpoint();
+            mPendingData = aInData;
         }
+        mPendingSize += aInSize;
     }
 
     void ParsePosition::ProcessRemainderData
@@ -183,4 +183,73 @@ namespace BfsdlParser
         mRemainderBuf.CopyFrom( aInData, mRemainderSize );
     }
 
+    void ParsePosition::AddLineData
+        (
+        Bfdp::Byte const* const aInData,
+        size_t const aInSize
+        ) const
+    {
+        // Only the end of the line can fit in the window, so skip what would be discarded
+        // anyway.  Newline characters don't take up space in the window, so search backwards to
+        // find where the window data begins.
+        size_t windowSize = mContextWindow.GetRawBuffer().GetSize();
+        size_t start = aInSize;
+        size_t numKept = 0;
+        while( ( start > 0 ) && ( numKept < windowSize ) )
+        {
+            --start;
+            if( ( aInData[start] != 0x0a ) && ( aInData[start] != 0x0d ) )
+            {
+                ++numKept;
+            }
+        }
+        if( start > 0 )
+        {
+            mContextWindow.SkipData( start -
+                Bfdp::Algorithm::CountByte( aInData, start, 0x0a ) -
+                Bfdp::Algorithm::CountByte( aInData, start, 0x0d ) );
+        }
+
+        // Push runs of data between newline characters (which don't get pushed to the window)
+        while( start < aInSize )
+        {
+            size_t runLen = Bfdp::Algorithm::FindFirstByteOf( &aInData[start], aInSize - start, 0x0a, 0x0d );
+            mContextWindow.PushData( &aInData[start], runLen );
+            start += runLen + 1;
+        }
+    }
+
+    void ParsePosition::Resolve() const
+    {
+        BFDP_RETURNIF( mPendingSize == 0 );
+
+        Bfdp::Byte const* data = mPendingData;
+        size_t size = mPendingSize;
+        mPendingData = &data[size];
+        mPendingSize = 0;
+
+        if( mNewlineChar == 0x00 )
+        {
+            // Detect the first newline character as the one to count
+            size_t firstNewline = Bfdp::Algorithm::FindFirstByteOf( data, size, 0x0a, 0x0d );
+            if( firstNewline == size )
+            {
+                AddLineData( data, size );
+                return;
+            }
+            mNewlineChar = data[firstNewline];
+        }
+
+        size_t lineStart = 0;
+        size_t numNewlines = Bfdp::Algorithm::CountByte( data, size, mNewlineChar );
+        if( numNewlines > 0 )
+        {
+            // Start counting the last line
+            mCurLineNumber += numNewlines;
+            mContextWindow.Reset();
+            lineStart = Bfdp::Algorithm::FindLastByte( data, size, mNewlineChar ) + 1;
+        }
+        AddLineData( &data[lineStart], size - lineStart );
+    }
+
 } // namespace BfsdlParser
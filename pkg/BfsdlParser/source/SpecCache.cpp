@@ -0,0 +1,446 @@
+/**
+    BFSDL Parser Spec Cache Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#define BFDP_MODULE "BfsdlParser::SpecCache"
+
+// Base includes
+#include "BfsdlParser/SpecCache.hpp"
+
+// External Includes
+#include <cstdlib>
+#include <functional>
+#include <list>
+#include <set>
+
+// Internal Includes
+#include "Bfdp/Data/MappedFile.hpp"
+#include "Bfdp/ErrorReporter/Functions.hpp"
+#include "BfsdlParser/Objects/Property.hpp"
+#include "BfsdlParser/StreamParser.hpp"
+
+namespace BfsdlParser
+{
+
+    struct SpecCache::Entry
+    {
+        //! Canonical path of the stream
+        std::string path;
+
+        //! Identifies the content which was parsed
+        Bfdp::Algorithm::HashType hash;
+        size_t size;
+
+        Bfdp::Thread::TaskPool::TaskPtr task;
+
+        //! Results, valid once the task is done
+        Objects::DatabasePtr db;
+        bool ok;
+    };
+
+    namespace SpecCacheInternal
+    {
+
+        typedef std::shared_ptr< Bfdp::Data::MappedFile > MappedFilePtr;
+
+        typedef std::list< Objects::PropertyPtr > PropertyList;
+
+        //! Header properties passed to an imported stream
+        struct HeaderCopy
+        {
+            PropertyList properties;
+
+            //! The properties' names and values, which distinguish parses of the same stream
+            std::string signature;
+        };
+
+        static void CopyHeaderProperty
+            (
+            Objects::PropertyPtr& aProperty,
+            void* const aArg
+            )
+        {
+            HeaderCopy& copy = *static_cast< HeaderCopy* >( aArg );
+            if( aProperty->GetName() == "Filename" )
+            {
+                // Each stream has its own name
+                return;
+            }
+
+            Bfdp::Data::ByteBuffer const& data = aProperty->GetData();
+            Objects::PropertyPtr property = std::make_shared< Objects::Property >( aProperty->GetName() );
+            if( property->SetData( data.GetConstPtr(), data.GetSize() ) )
+            {
+                copy.properties.push_back( property );
+                copy.signature += aProperty->GetName() + "=" + aProperty->GetString() + ";";
+            }
+        }
+
+        //! @return The directory part of aFile, including the trailing separator
+        static std::string GetDirectory
+            (
+            std::string const& aFile
+            )
+        {
+#if defined( _WIN32 )
+            size_t const pos = aFile.find_last_of( "/\\" );
+#else
+            size_t const pos = aFile.find_last_of( '/' );
+#endif
+            return ( pos == std::string::npos ) ? std::string() : aFile.substr( 0, pos + 1 );
+        }
+
+        static bool IsAbsolutePath
+            (
+            std::string const& aPath
+            )
+        {
+#if defined( _WIN32 )
+            return ( !aPath.empty() && ( ( aPath[0] == '\\' ) || ( aPath[0] == '/' ) ) ) ||
+                ( ( aPath.size() >= 2 ) && ( aPath[1] == ':' ) );
+#else
+            return !aPath.empty() && ( aPath[0] == '/' );
+#endif
+        }
+
+        //! Resolve aPath to an absolute path without relative components or links
+        //!
+        //! @return Whether the path was resolved.
+        static bool GetCanonicalPath
+            (
+            std::string const& aPath,
+            std::string& aOut
+            )
+        {
+            BFDP_RETURNIF_V( aPath.empty(), false );
+
+#if defined( _WIN32 )
+            char* const path = _fullpath( NULL, aPath.c_str(), 0 );
+#else
+            char* const path = realpath( aPath.c_str(), NULL );
+#endif
+            BFDP_RETURNIF_V( path == NULL, false );
+
+            aOut = path;
+            std::free( path );
+            return true;
+        }
+
+        static void ParseEntry
+            (
+            SpecCache::EntryPtr const aEntry,
+            MappedFilePtr const aFile,
+            PropertyList const& aHeader,
+            bool const aImport
+            )
+        {
+            Objects::DatabasePtr db = Objects::Database::CreateArena();
+            Objects::TreePtr& root = db->GetRoot();
+
+            // The name locates errors, and resolves relative paths within the stream
+            Objects::PropertyPtr fileName = Objects::CreateObject< Objects::Property >( root->GetAllocator(), "Filename" );
+            bool ok = fileName->SetString( aEntry->path ) && root->Add( fileName );
+            for( PropertyList::const_iterator iter = aHeader.begin(); ok && ( iter != aHeader.end() ); ++iter )
+            {
+                ok = ( root->Add( *iter ) != NULL );
+            }
+            if( !ok )
+            {
+                BFDP_RUNTIME_ERROR( "Failed to set stream properties" );
+            }
+
+            if( ok )
+            {
+                StreamParser parser( root );
+                ok = parser.IsInitOk();
+                if( ok && aImport )
+                {
+                    parser.BeginImport();
+                }
+                if( ok && ( aFile->GetSize() > 0 ) )
+                {
+                    ok = parser.Feed( aFile->GetConstPtr(), aFile->GetSize() );
+                }
+                ok = ok && ( parser.Finish() == 0 );
+            }
+
+            aEntry->db = db;
+            aEntry->ok = ok;
+        }
+
+    } // namespace SpecCacheInternal
+
+    using namespace SpecCacheInternal;
+
+    SpecCache::Load::Load
+        (
+        SpecCache& aCache,
+        std::string const& aFromPath,
+        std::string const& aPath
+        )
+        : mCache( aCache )
+        , mFromPath( aFromPath )
+        , mPath( aPath )
+        , mWaiting( false )
+    {
+    }
+
+    SpecCache::Load::~Load()
+    {
+        if( mWaiting )
+        {
+            mCache.RemoveWait( mFromPath, mPath );
+        }
+    }
+
+    std::string const& SpecCache::Load::GetPath() const
+    {
+        return mPath;
+    }
+
+    /* static */ SpecCache& SpecCache::Get()
+    {
+        static SpecCache sCache;
+        return sCache;
+    }
+
+    SpecCache::SpecCache()
+        : mNumHits( 0U )
+        , mNumParsed( 0U )
+        , mPool( Bfdp::Thread::TaskPool::GetDefaultNumThreads() )
+    {
+    }
+
+    SpecCache::LoadPtr SpecCache::StartLibrary
+        (
+        std::string const& aSource,
+        std::string const& aFromFile
+        )
+    {
+        return Start( aSource, aFromFile, NULL );
+    }
+
+    SpecCache::LoadPtr SpecCache::StartImport
+        (
+        std::string const& aSource,
+        std::string const& aFromFile,
+        Objects::TreePtr const aHeader
+        )
+    {
+        return Start( aSource, aFromFile, aHeader );
+    }
+
+    Objects::DatabasePtr SpecCache::Finish
+        (
+        LoadPtr const& aLoad,
+        std::string& aError
+        )
+    {
+        if( !aLoad->mError.empty() )
+        {
+            aError = aLoad->mError;
+            return NULL;
+        }
+
+        Entry& entry = *aLoad->mEntry;
+        mPool.Wait( entry.task );
+        if( !entry.ok )
+        {
+            aError = "Failed to parse '" + entry.path + "'";
+            return NULL;
+        }
+        return entry.db;
+    }
+
+    void SpecCache::Clear()
+    {
+        std::lock_guard< std::mutex > lock( mMutex );
+        mEntries.clear();
+        mNumHits = 0U;
+        mNumParsed = 0U;
+    }
+
+    size_t SpecCache::GetNumHits()
+    {
+        std::lock_guard< std::mutex > lock( mMutex );
+        return mNumHits;
+    }
+
+    size_t SpecCache::GetNumParsed()
+    {
+        std::lock_guard< std::mutex > lock( mMutex );
+        return mNumParsed;
+    }
+
+    bool SpecCache::AddWait
+        (
+        std::string const& aFrom,
+        std::string const& aTo,
+        std::string& aCycle
+        )
+    {
+        std::set< std::string > visited;
+        std::string path;
+        if( IsWaiting( aTo, aFrom, visited, path ) )
+        {
+            aCycle = aFrom + " -> " + path;
+            return false;
+        }
+
+        mWaits.insert( std::make_pair( aFrom, aTo ) );
+        return true;
+    }
+
+    bool SpecCache::IsWaiting
+        (
+        std::string const& aFrom,
+        std::string const& aTo,
+        std::set< std::string >& aVisited,
+        std::string& aPath
+        )
+    {
+        if( aFrom == aTo )
+        {
+            aPath = aTo;
+            return true;
+        }
+        BFDP_RETURNIF_V( !aVisited.insert( aFrom ).second, false );
+
+        std::pair< WaitMap::iterator, WaitMap::iterator > waits = mWaits.equal_range( aFrom );
+        for( WaitMap::iterator iter = waits.first; iter != waits.second; ++iter )
+        {
+            if( IsWaiting( iter->second, aTo, aVisited, aPath ) )
+            {
+                aPath = aFrom + " -> " + aPath;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void SpecCache::RemoveWait
+        (
+        std::string const& aFrom,
+        std::string const& aTo
+        )
+    {
+        std::lock_guard< std::mutex > lock( mMutex );
+        std::pair< WaitMap::iterator, WaitMap::iterator > waits = mWaits.equal_range( aFrom );
+        for( WaitMap::iterator iter = waits.first; iter != waits.second; ++iter )
+        {
+            if( iter->second == aTo )
+            {
+                mWaits.erase( iter );
+                break;
+            }
+        }
+    }
+
+    SpecCache::LoadPtr SpecCache::Start
+        (
+        std::string const& aSource,
+        std::string const& aFromFile,
+        Objects::TreePtr const aHeader
+        )
+    {
+        std::string fromPath;
+        if( !GetCanonicalPath( aFromFile, fromPath ) )
+        {
+            fromPath = aFromFile;
+        }
+
+        std::string path;
+        bool const found = GetCanonicalPath
+            (
+            IsAbsolutePath( aSource ) ? aSource : GetDirectory( aFromFile ) + aSource,
+            path
+            );
+
+        LoadPtr load( new Load( *this, fromPath, found ? path : aSource ) );
+        if( !found )
+        {
+            load->mError = "Cannot find '" + aSource + "'";
+            return load;
+        }
+
+        MappedFilePtr file = std::make_shared< Bfdp::Data::MappedFile >();
+        if( !file->Open( path ) )
+        {
+            load->mError = "Cannot read '" + path + "'";
+            return load;
+        }
+        Bfdp::Algorithm::HashType const hash = Bfdp::Algorithm::FastHash( file->GetConstPtr(), file->GetSize() );
+
+        // Imports are parsed in the context of the importer's header, so each header is keyed
+        // separately.
+        HeaderCopy header;
+        if( aHeader )
+        {
+            aHeader->IterateProperties( CopyHeaderProperty, &header );
+        }
+        std::string const key = path + "\n" + ( aHeader ? "import:" + header.signature : "library" );
+
+        std::lock_guard< std::mutex > lock( mMutex );
+
+        std::string cycle;
+        if( !AddWait( fromPath, path, cycle ) )
+        {
+            load->mError = "Import cycle: " + cycle;
+            return load;
+        }
+        load->mWaiting = true;
+
+        EntryMap::iterator iter = mEntries.find( key );
+        if( ( iter != mEntries.end() ) && ( iter->second->hash == hash ) && ( iter->second->size == file->GetSize() ) )
+        {
+            // Parsed, or being parsed, from the same content
+            ++mNumHits;
+            load->mEntry = iter->second;
+            return load;
+        }
+
+        EntryPtr entry = std::make_shared< Entry >();
+        entry->path = path;
+        entry->hash = hash;
+        entry->size = file->GetSize();
+        entry->ok = false;
+        entry->task = mPool.Submit
+            (
+            std::bind( ParseEntry, entry, file, header.properties, aHeader != NULL )
+            );
+        mEntries[key] = entry;
+        ++mNumParsed;
+
+        load->mEntry = entry;
+        return load;
+    }
+
+} // namespace BfsdlParser
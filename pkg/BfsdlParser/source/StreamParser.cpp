@@ -36,6 +36,7 @@
 #include "BfsdlParser/StreamParser.hpp"
 
 // External Includes
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 
@@ -43,10 +44,7 @@
 #include "Bfdp/Data/ByteBuffer.hpp"
 #include "Bfdp/ErrorReporter/Functions.hpp"
 #include "Bfdp/Lexer/Symbolizer.hpp"
-#include "BfsdlParser/ParsePosition.hpp"
 #include "BfsdlParser/Objects/Property.hpp"
-#include "BfsdlParser/Token/Interpreter.hpp"
-#include "BfsdlParser/Token/Tokenizer.hpp"
 
 #define LOCAL_DEBUG 0
 
@@ -61,9 +59,219 @@
 namespace BfsdlParser
 {
 
-    //! Build a parser stack and feed data from the stream into it.
-    //!
-    //! @return 0 on success, 1 otherwise.
+    namespace StreamParserInternal
+    {
+
+        //! @return The filename associated with the stream, or empty if unknown
+        static std::string GetFileName
+            (
+            Objects::TreePtr const aDbContext
+            )
+        {
+            std::string fileName;
+            Objects::PropertyPtr fileNameProp = aDbContext->FindProperty( "Filename" );
+            if( fileNameProp )
+            {
+                fileName = fileNameProp->GetString();
+            }
+            return fileName;
+        }
+
+    } // namespace StreamParserInternal
+
+    using namespace StreamParserInternal;
+
+    StreamParser::StreamParser
+        (
+        Objects::TreePtr const aDbContext
+        )
+        : mInterpreter( aDbContext )
+        , mTokenizer( mInterpreter )
+        , mParsePos( GetFileName( aDbContext ), 10, 6 )
+        , mCarrySize( 0 )
+        , mInitOk( false )
+        , mOk( false )
+    {
+        if( !mInterpreter.IsInitOk() )
+        {
+            BFDP_RUNTIME_ERROR( "Failed to init Interpreter" );
+        }
+        else if( !mTokenizer.IsInitOk() )
+        {
+            BFDP_RUNTIME_ERROR( "Failed to init Tokenizer" );
+        }
+        else if( !mCarry.Allocate( MaxCarrySize ) )
+        {
+            BFDP_RUNTIME_ERROR( "Failed to allocate carry buffer" );
+        }
+        else
+        {
+            mInitOk = true;
+            mOk = true;
+        }
+    }
+
+    void StreamParser::BeginImport()
+    {
+        mInterpreter.BeginImport();
+    }
+
+    bool StreamParser::Feed
+        (
+        Bfdp::Byte const* const aData,
+        size_t const aSize
+        )
+    {
+        Bfdp::Byte const* data = aData;
+        size_t size = aSize;
+        while( mOk && ( size > 0 ) )
+        {
+            size_t bytesParsed = 0;
+            if( mCarrySize == 0 )
+            {
+                // Common case: parse directly from the caller's memory
+                mOk = ParseSpan( data, size, bytesParsed );
+                BFDP_RETURNIF_V( !mOk, false );
+
+                size_t const bytesLeft = size - bytesParsed;
+                if( bytesLeft > mCarry.GetSize() )
+                {
+                    BFDP_RUNTIME_ERROR( "Unparsed data exceeds carry buffer" );
+                    mOk = false;
+                    break;
+                }
+
+                DEBUG_TRACE( "  carry: " << bytesLeft );
+                std::memcpy( mCarry.GetPtr(), &data[bytesParsed], bytesLeft );
+                mCarrySize = bytesLeft;
+                break;
+            }
+
+            // Join carried data with as much new data as fits, then parse from the carry
+            size_t const carriedSize = mCarrySize;
+            size_t const bytesToCopy = std::min( size, mCarry.GetSize() - carriedSize );
+            std::memcpy( mCarry.GetPtr() + carriedSize, data, bytesToCopy );
+            mCarrySize += bytesToCopy;
+
+            mOk = ParseSpan( mCarry.GetConstPtr(), mCarrySize, bytesParsed );
+            BFDP_RETURNIF_V( !mOk, false );
+
+            if( bytesParsed >= carriedSize )
+            {
+                // All carried data was consumed; resume parsing from the caller's memory
+                size_t const newBytesParsed = bytesParsed - carriedSize;
+                mCarrySize = 0;
+                data += newBytesParsed;
+                size -= newBytesParsed;
+            }
+            else if( ( bytesParsed == 0 ) && ( mCarrySize == mCarry.GetSize() ) )
+            {
+                BFDP_RUNTIME_ERROR( "Unparsed data exceeds carry buffer" );
+                mOk = false;
+            }
+            else if( bytesParsed == 0 )
+            {
+                // Nothing could be parsed, so keep the new data and wait for more
+                data += bytesToCopy;
+                size -= bytesToCopy;
+            }
+            else
+            {
+                // Only some of the carried data was consumed; keep the rest and append the new
+                // data again on the next pass
+                mCarrySize = carriedSize - bytesParsed;
+                std::memmove( mCarry.GetPtr(), mCarry.GetConstPtr() + bytesParsed, mCarrySize );
+            }
+        }
+
+        return mOk;
+    }
+
+    int StreamParser::Finish()
+    {
+        mCarrySize = 0;
+        mOk = mOk && mInterpreter.Finish();
+        return mOk ? 0 : 1;
+    }
+
+    bool StreamParser::IsInitOk() const
+    {
+        return mInitOk;
+    }
+
+    bool StreamParser::ParseSpan
+        (
+        Bfdp::Byte const* const aData,
+        size_t const aSize,
+        size_t& aBytesParsed
+        )
+    {
+        bool ok = true;
+        size_t bytesParsed = 0;
+        size_t i = 0;
+        while( ok && ( i < aSize ) )
+        {
+            size_t bytesLeft = aSize - i;
+            DEBUG_TRACE( "parse: " << i << "..+" << bytesLeft );
+            ok = mTokenizer.Parse( &aData[i], bytesLeft, bytesParsed );
+            mParsePos.ProcessNewData( &aData[i], bytesParsed );
+            if( !ok )
+            {
+                mParsePos.ProcessRemainderData( &aData[i + bytesParsed], bytesLeft - bytesParsed );
+                std::stringstream ss;
+                ss << "Parse Error: " << mParsePos.GetName() << "@"
+                    << mParsePos.GetCurLineNumber() << ":" << mParsePos.GetCurColNumber()
+                    << std::endl;
+
+                if( mParsePos.GetContextBeginColumn() != 0 )
+                {
+                    ss << "...";
+                }
+                ss << mParsePos.GetPrintableContext() << std::endl;
+                if( mParsePos.GetContextBeginColumn() != 0 )
+                {
+                    ss << "   ";
+                }
+                if( mParsePos.GetContextPositionOffset() > 0 )
+                {
+                    ss << std::string( mParsePos.GetContextPositionOffset() - 1, ' ' ) << "^";
+                }
+                std::string msg = ss.str();
+                BFDP_RUNTIME_ERROR( msg.c_str() );
+            }
+            else if( bytesParsed == 0 )
+            {
+                // Needs more data, likely
+                DEBUG_TRACE( "  remainder:" << bytesLeft );
+                break;
+            }
+            else
+            {
+                DEBUG_TRACE( "  parsed " << bytesParsed );
+                i += bytesParsed;
+            }
+        }
+
+        // The span is not retained after this call
+        mParsePos.Checkpoint();
+        aBytesParsed = i;
+        return ok;
+    }
+
+    int ParseBuffer
+        (
+        Objects::TreePtr const aDbContext,
+        Bfdp::Byte const* const aData,
+        size_t const aSize
+        )
+    {
+        StreamParser parser( aDbContext );
+        BFDP_RETURNIF_V( !parser.IsInitOk(), 1 );
+
+        parser.Feed( aData, aSize );
+        return parser.Finish();
+    }
+
     int ParseStream
         (
         Objects::TreePtr const aDbContext,
@@ -71,85 +279,25 @@ namespace BfsdlParser
         size_t const aChunkSize
         )
     {
-        Token::Interpreter interpreter( aDbContext );
-        BFDP_RETURNIF_VE( !interpreter.IsInitOk(), 1, "Failed to init Interpreter" );
-        Token::Tokenizer tokenizer( interpreter );
-        BFDP_RETURNIF_VE( !tokenizer.IsInitOk(), 1, "Failed to init Tokenizer" );
+        StreamParser parser( aDbContext );
+        BFDP_RETURNIF_V( !parser.IsInitOk(), 1 );
 
         Bfdp::Data::ByteBuffer buf;
         BFDP_RETURNIF_VE( !buf.Allocate( aChunkSize ), 1, "Failed to allocate read buffer" );
-        buf.Clear();
-
-        // Get the filename associated with this stream
-        std::string fileName;
-        auto fileNameProp = aDbContext->FindPropertyT< Objects::Property >( "Filename" );
-        if( fileNameProp )
-        {
-            fileName = fileNameProp->GetString();
-        }
-        ParsePosition parsePos( fileName, 10, 6 );
 
         bool ok = true;
-        size_t dataStart = 0;
         while( ok )
         {
-            std::streamsize bytesToRead = static_cast< std::streamsize >( buf.GetSize() - dataStart );
-            DEBUG_TRACE( "read " << dataStart << "..+" << bytesToRead );
-            aIn.read( buf.GetPtrT< char >() + dataStart, bytesToRead );
+            DEBUG_TRACE( "read " << buf.GetSize() );
+            aIn.read( buf.GetPtrT< char >(), static_cast< std::streamsize >( buf.GetSize() ) );
             size_t bytesRead = static_cast< size_t >( aIn.gcount() );
-            DEBUG_TRACE( "read: " << bytesRead << " / " << bytesToRead );
+            DEBUG_TRACE( "read: " << bytesRead );
             if( bytesRead == 0 )
             {
                 break;
             }
 
-            size_t bytesParsed = 0;
-            size_t i = 0;
-            while( ok && ( i < bytesRead ) )
-            {
-                size_t bytesLeft = bytesRead - i;
-                DEBUG_TRACE( "parse: " << i << "..+" << bytesLeft );
-                ok = tokenizer.Parse( &buf[i], bytesLeft, bytesParsed );
-                parsePos.ProcessNewData( &buf[i], bytesParsed );
-                if( !ok )
-                {
-                    parsePos.ProcessRemainderData( &buf[i + bytesParsed], bytesLeft - bytesParsed );
-                    std::stringstream ss;
-                    ss << "Parse Error: " << parsePos.GetName() << "@"
-                        << parsePos.GetCurLineNumber() << ":" << parsePos.GetCurColNumber()
-                        << std::endl;
-
-                    if( parsePos.GetContextBeginColumn() != 0 )
-                    {
-                        ss << "...";
-                    }
-                    ss << parsePos.GetPrintableContext() << std::endl;
-                    if( parsePos.GetContextBeginColumn() != 0 )
-                    {
-                        ss << "   ";
-                    }
-                    if( parsePos.GetContextPositionOffset() > 0 )
-                    {
-                        ss << std::string( parsePos.GetContextPositionOffset() - 1, ' ' ) << "^";
-                    }
-                    std::string msg = ss.str();
-                    BFDP_RUNTIME_ERROR( msg.c_str() );
-                }
-                else if( bytesParsed == 0 )
-                {
-                    DEBUG_TRACE( "  remainder:" << bytesLeft );
-                    // Needs more data, likely; move it to the front of the buffer
-                    // and continue.
-                    std::memmove( &buf[0], &buf[i], bytesLeft );
-                    dataStart = bytesLeft;
-                    break;
-                }
-                else
-                {
-                    DEBUG_TRACE( "  parsed " << bytesParsed );
-                    i += bytesParsed;
-                }
-            }
+            ok = parser.Feed( buf.GetConstPtr(), bytesRead );
         }
 
         if( ok && !aIn.eof() && aIn.fail() )
@@ -158,7 +306,7 @@ namespace BfsdlParser
             ok = false;
         }
 
-        return ok ? 0 : 1;
+        return ( parser.Finish() == 0 ) && ok ? 0 : 1;
     }
 
 } // namespace BfsdlParser
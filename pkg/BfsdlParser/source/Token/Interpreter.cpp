@@ -45,9 +45,14 @@
 #include "Bfdp/Unicode/CodingMap.hpp"
 #include "Bfdp/Unicode/Common.hpp"
 #include "Bfdp/Unicode/Functions.hpp"
+#include "BfsdlParser/Objects/ArrayField.hpp"
+#include "BfsdlParser/Objects/ClassField.hpp"
+#include "BfsdlParser/Objects/FloatField.hpp"
 #include "BfsdlParser/Objects/NumericField.hpp"
 #include "BfsdlParser/Objects/NumericFieldBuilder.hpp"
 #include "BfsdlParser/Objects/Property.hpp"
+#include "BfsdlParser/Objects/StringField.hpp"
+#include "BfsdlParser/Objects/StringFieldBuilder.hpp"
 
 #define BFDP_MODULE "Token::Interpreter"
 
@@ -59,11 +64,20 @@ namespace BfsdlParser
 
         using namespace Bfdp;
 
+        using BfsdlParser::Objects::ArrayField;
+        using BfsdlParser::Objects::ArraySizeType;
         using BfsdlParser::Objects::BitBase;
+        using BfsdlParser::Objects::ClassField;
+        using BfsdlParser::Objects::CreateObject;
         using BfsdlParser::Objects::Endianness;
+        using BfsdlParser::Objects::FloatField;
+        using BfsdlParser::Objects::FloatFormat;
+        using BfsdlParser::Objects::Ieee754VersionType;
         using BfsdlParser::Objects::Property;
         using BfsdlParser::Objects::PropertyPtr;
+        using BfsdlParser::Objects::Tree;
         using BfsdlParser::Objects::TreePtr;
+        using BfsdlParser::Objects::UnionField;
 
         namespace InternalInterpreter
         {
@@ -82,6 +96,35 @@ namespace BfsdlParser
                     StatementBegin,
                     StatementFixedPointNumericId,
                     StatementFixedPointNumericSuffix,
+                    StatementFloatId,
+                    StatementFloatFormatOpen,
+                    StatementFloatFormatValue,
+                    StatementFloatFormatClose,
+                    StatementStringId,
+                    StatementStringAttrName,
+                    StatementStringAttrOpen,
+                    StatementStringAttrValue,
+                    StatementStringAttrClose,
+                    StatementClassName,
+                    StatementClassOpen,
+                    StatementClassFieldId,
+                    StatementClassMember,
+                    StatementLibraryName,
+                    StatementLibraryOpen,
+                    StatementLibrarySource,
+                    StatementLibraryClose,
+                    StatementImportSource,
+                    StatementUnionTagOpen,
+                    StatementUnionTag,
+                    StatementUnionTagClose,
+                    StatementUnionName,
+                    StatementUnionOpen,
+                    StatementUnionCase,
+                    StatementUnionCaseColon,
+                    StatementUnionCaseClass,
+                    StatementUnionCaseEnd,
+                    StatementArrayCount,
+                    StatementArrayClose,
                     StatementEnd,
 
                     Count
@@ -96,7 +139,7 @@ namespace BfsdlParser
                 typename T const aValue
                 )
             {
-                PropertyPtr pp = std::make_shared< Property >( aName );
+                PropertyPtr pp = CreateObject< Property >( aTree->GetAllocator(), aName );
                 BFDP_RETURNIF_V( !pp, false );
 
                 BFDP_RETURNIF_V( !pp->SetNumericValue( aValue ), false );
@@ -112,7 +155,7 @@ namespace BfsdlParser
                 std::string const& aValue
                 )
             {
-                PropertyPtr pp = std::make_shared< Property >( aName );
+                PropertyPtr pp = CreateObject< Property >( aTree->GetAllocator(), aName );
                 BFDP_RETURNIF_V( !pp, false );
 
                 BFDP_RETURNIF_V( !pp->SetString( aValue ), false );
@@ -121,6 +164,9 @@ namespace BfsdlParser
                 return true;
             }
 
+            //! IEEE754Version assumed when the header does not set one (C.1.1)
+            static Ieee754VersionType const DefaultIeee754Version = 1985U;
+
             static bool IsEndOfLine(std::string const& aValue)
             {
                 return ( ( aValue == ";" ) ||
@@ -139,6 +185,24 @@ namespace BfsdlParser
                     IsWithinRange< char >('0', aStatement[1], '9');
             }
 
+            //! @return Whether aWord begins a statement other than a field of a class type
+            static bool IsReservedWord
+                (
+                std::string const& aWord
+                )
+            {
+                Objects::StringFieldBuilder stringProbe;
+                return IsNumericField( aWord ) ||
+                    ( aWord == "f" ) ||
+                    ( aWord == "class" ) ||
+                    ( aWord == "union" ) ||
+                    ( aWord == "library" ) ||
+                    ( aWord == "importfile" ) ||
+                    ( aWord == "resource" ) ||
+                    ( aWord == "importsource" ) ||
+                    stringProbe.ParseIdentifier( aWord );
+            }
+
         };
         using namespace InternalInterpreter;
 
@@ -149,11 +213,20 @@ namespace BfsdlParser
             : mCurBitBase( Objects::BitBase::Default )
             , mDb( aDbContext )
             , mHeaderStreamProgress( Header::StreamBegin )
+            , mImport( false )
             , mInitOk( false )
+            , mArrayCount( 0U )
+            , mArrayDefined( false )
+            , mArrayReturnState( ParseState::StatementBegin )
+            , mClassMemberReturnState( ParseState::StatementBegin )
+            , mFloatFormat( FloatFormat::Unknown )
+            , mFloatFormatExplicit( false )
+            , mUnionCaseTag( 0U )
             , mParseError( false )
         {
             std::memset( &mInput, 0, sizeof( mInput ) );
             mInput.type = In::Invalid;
+            mScopes.push_back( mDb );
 
             bool ok = true;
             typedef StateMachine::CallMethod< Interpreter > CallMethod;
@@ -169,6 +242,35 @@ namespace BfsdlParser
             BFDP_STATE_ACTION( ParseState::StatementBegin, Evaluate, CallMethod( *this, &Interpreter::StateStatementBeginEvaluate ) );
             BFDP_STATE_ACTION( ParseState::StatementFixedPointNumericId, Evaluate, CallMethod( *this, &Interpreter::StateStatementFixedPointNumericIdEvaluate ) );
             BFDP_STATE_ACTION( ParseState::StatementFixedPointNumericSuffix, Evaluate, CallMethod( *this, &Interpreter::StateStatementFixedPointNumericSuffixEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementFloatId, Evaluate, CallMethod( *this, &Interpreter::StateStatementFloatIdEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementFloatFormatOpen, Evaluate, CallMethod( *this, &Interpreter::StateStatementFloatFormatOpenEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementFloatFormatValue, Evaluate, CallMethod( *this, &Interpreter::StateStatementFloatFormatValueEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementFloatFormatClose, Evaluate, CallMethod( *this, &Interpreter::StateStatementFloatFormatCloseEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementStringId, Evaluate, CallMethod( *this, &Interpreter::StateStatementStringIdEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementStringAttrName, Evaluate, CallMethod( *this, &Interpreter::StateStatementStringAttrNameEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementStringAttrOpen, Evaluate, CallMethod( *this, &Interpreter::StateStatementStringAttrOpenEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementStringAttrValue, Evaluate, CallMethod( *this, &Interpreter::StateStatementStringAttrValueEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementStringAttrClose, Evaluate, CallMethod( *this, &Interpreter::StateStatementStringAttrCloseEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementClassName, Evaluate, CallMethod( *this, &Interpreter::StateStatementClassNameEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementClassOpen, Evaluate, CallMethod( *this, &Interpreter::StateStatementClassOpenEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementClassFieldId, Evaluate, CallMethod( *this, &Interpreter::StateStatementClassFieldIdEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementClassMember, Evaluate, CallMethod( *this, &Interpreter::StateStatementClassMemberEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementLibraryName, Evaluate, CallMethod( *this, &Interpreter::StateStatementLibraryNameEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementLibraryOpen, Evaluate, CallMethod( *this, &Interpreter::StateStatementLibraryOpenEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementLibrarySource, Evaluate, CallMethod( *this, &Interpreter::StateStatementLibrarySourceEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementLibraryClose, Evaluate, CallMethod( *this, &Interpreter::StateStatementLibraryCloseEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementImportSource, Evaluate, CallMethod( *this, &Interpreter::StateStatementImportSourceEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionTagOpen, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionTagOpenEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionTag, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionTagEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionTagClose, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionTagCloseEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionName, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionNameEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionOpen, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionOpenEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionCase, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionCaseEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionCaseColon, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionCaseColonEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionCaseClass, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionCaseClassEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementUnionCaseEnd, Evaluate, CallMethod( *this, &Interpreter::StateStatementUnionCaseEndEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementArrayCount, Evaluate, CallMethod( *this, &Interpreter::StateStatementArrayCountEvaluate ) );
+            BFDP_STATE_ACTION( ParseState::StatementArrayClose, Evaluate, CallMethod( *this, &Interpreter::StateStatementArrayCloseEvaluate ) );
             BFDP_STATE_ACTION( ParseState::StatementEnd, Evaluate, CallMethod( *this, &Interpreter::StateStatementEndEvaluate ) );
 
             BFDP_STATE_MAP_END();
@@ -188,6 +290,129 @@ namespace BfsdlParser
             mInitOk = true;
         }
 
+        void Interpreter::ApplyHeaderDefaults()
+        {
+            SetNumericPropertyDefault( "BitBase", BitBase::Default );
+            SetNumericPropertyDefault( "DefaultByteOrder", Endianness::Default );
+            SetNumericPropertyDefault( "DefaultBitOrder", Endianness::Default );
+            SetStringPropertyDefault( "DefaultStringCode", "ASCII" );
+            SetNumericPropertyDefault< Bfdp::Unicode::CodePoint >( "DefaultStringTerm", 0U );
+            SetNumericPropertyDefault< Objects::BfsdlVersionType >( "Version", 1U );
+
+            GetNumericProperty("BitBase", mCurBitBase);
+
+            Bfdp::Unicode::CodePoint defaultStringTerm = 0U;
+            GetNumericProperty( "DefaultStringTerm", defaultStringTerm );
+            mStringFieldBuilder.SetDefaultTermChar( defaultStringTerm );
+
+            PropertyPtr codeProp = mDb->FindProperty( "DefaultStringCode" );
+            if( codeProp != NULL )
+            {
+                mStringFieldBuilder.SetDefaultCoding( Bfdp::Unicode::GetCodingId( codeProp->GetString() ) );
+            }
+        }
+
+        bool Interpreter::BeginArray()
+        {
+            if( mArrayDefined )
+            {
+                LogError( "Multi-dimensional arrays are not supported:" );
+                return false;
+            }
+
+            mArrayReturnState = mStateMachine.GetCurState();
+            mStateMachine.Transition( ParseState::StatementArrayCount );
+            return true;
+        }
+
+        void Interpreter::BeginClassMember()
+        {
+            mClassMemberReturnState = mStateMachine.GetCurState();
+            mStateMachine.Transition( ParseState::StatementClassMember );
+        }
+
+        void Interpreter::BeginImport()
+        {
+            mImport = true;
+            mHeaderStreamProgress = Header::StreamDone;
+            ApplyHeaderDefaults();
+
+            mStateMachine.Transition( ParseState::StatementBegin );
+            if( !mStateMachine.DoTransition() )
+            {
+                BFDP_RUNTIME_ERROR( "Failed to begin imported stream" );
+                mParseError = true;
+            }
+        }
+
+        bool Interpreter::CheckAttributeResult
+            (
+            Objects::AttributeParseResult::Type const aResult
+            )
+        {
+            std::stringstream ss;
+            switch( aResult )
+            {
+                case Objects::AttributeParseResult::Success:
+                    return true;
+
+                case Objects::AttributeParseResult::InvalidArgument:
+                    ss << "Invalid value for attribute '" << mIdentifier << "':";
+                    break;
+
+                case Objects::AttributeParseResult::Redefinition:
+                    ss << "Redefinition of attribute '" << mIdentifier << "' to";
+                    break;
+
+                case Objects::AttributeParseResult::Unsupported:
+                case Objects::AttributeParseResult::Unknown:
+                default:
+                    ss << "Unsupported attribute '" << mIdentifier << "' with";
+                    break;
+            }
+
+            LogError( ss.str() );
+            return false;
+        }
+
+        Objects::TreePtr Interpreter::FindClass
+            (
+            std::string const& aName
+            )
+        {
+            for( ScopeList::reverse_iterator iter = mScopes.rbegin(); iter != mScopes.rend(); ++iter )
+            {
+                TreePtr found = ( *iter )->FindTree( aName );
+                if( found )
+                {
+                    ResolveLibrary( found );
+                    return found;
+                }
+            }
+            return NULL;
+        }
+
+        bool Interpreter::Finish()
+        {
+            while( !mLibraries.empty() )
+            {
+                ResolveLibrary( mLibraries.front().tree );
+            }
+
+            if( mScopes.size() > 1 )
+            {
+                std::string msg = "Unterminated class '" + mScopes.back()->GetName() + "'";
+                BFDP_RUNTIME_ERROR( msg.c_str() );
+                mParseError = true;
+            }
+            return !mParseError;
+        }
+
+        Objects::TreePtr& Interpreter::GetScope()
+        {
+            return mScopes.back();
+        }
+
         bool Interpreter::IsInitOk() const
         {
             return mInitOk;
@@ -293,6 +518,45 @@ namespace BfsdlParser
             return !mParseError;
         }
 
+        bool Interpreter::ResolveLibrary
+            (
+            Objects::TreePtr const& aTree
+            )
+        {
+            for( PendingLibraryList::iterator iter = mLibraries.begin(); iter != mLibraries.end(); ++iter )
+            {
+                if( iter->tree != aTree )
+                {
+                    continue;
+                }
+
+                SpecCache::LoadPtr load = iter->load;
+                mLibraries.erase( iter );
+
+                std::string error;
+                Objects::DatabasePtr db = SpecCache::Get().Finish( load, error );
+                if( !db )
+                {
+                    std::string msg = "Failed to load library '" + aTree->GetName() + "': " + error;
+                    BFDP_RUNTIME_ERROR( msg.c_str() );
+                    mParseError = true;
+                    return false;
+                }
+
+                // The library's scope is new and empty, so nothing can conflict
+                if( !aTree->Merge( *db->GetRoot() ) )
+                {
+                    BFDP_INTERNAL_ERROR( "Failed to merge library" );
+                    mParseError = true;
+                    return false;
+                }
+                return true;
+            }
+
+            // Not a library, or already loaded
+            return true;
+        }
+
         void Interpreter::SetStringPropertyDefault
             (
             std::string const& aName,
@@ -368,14 +632,7 @@ namespace BfsdlParser
         {
             if( mHeaderStreamProgress == Header::StreamDone )
             {
-                SetNumericPropertyDefault( "BitBase", BitBase::Default );
-                SetNumericPropertyDefault( "DefaultByteOrder", Endianness::Default );
-                SetNumericPropertyDefault( "DefaultBitOrder", Endianness::Default );
-                SetStringPropertyDefault( "DefaultStringCode", "ASCII" );
-                SetNumericPropertyDefault< Bfdp::Unicode::CodePoint >( "DefaultStringTerm", 0U );
-                SetNumericPropertyDefault< Objects::BfsdlVersionType >( "Version", 1U );
-
-                GetNumericProperty("BitBase", mCurBitBase);
+                ApplyHeaderDefaults();
             }
         }
 
@@ -511,11 +768,38 @@ namespace BfsdlParser
                 {
                     errCode = ErrTypeStr;
                 }
-                else
+                else if( FloatField::GetFormatId( mInput.d.str->GetUtf8String() ) == FloatFormat::Unknown )
+                {
+                    errCode = ErrUnsupported;
+                }
+                else if( !SetStringProperty( mDb, mIdentifier, mInput.d.str->GetUtf8String() ) )
+                {
+                    errCode = ErrRuntime;
+                }
+            }
+            else if( mIdentifier == "IEEE754Version" )
+            {
+                Ieee754VersionType version = 0;
+                if( mInput.type != In::NumericLiteral )
+                {
+                    errCode = ErrTypeNum;
+                }
+                else if( mDb->FindProperty( mIdentifier ) != NULL )
+                {
+                    errCode = ErrRedefinition;
+                }
+                else if( !mInput.d.num->GetUint( version, Bfdp::BitManip::BytesToBits( sizeof( version ) ) ) )
+                {
+                    errCode = ErrInvalid;
+                }
+                else if( ( version != 1985U ) && ( version != 2008U ) )
                 {
-                    // TODO: Add floating point support
                     errCode = ErrUnsupported;
                 }
+                else if( !SetNumericProperty( mDb, mIdentifier, version ) )
+                {
+                    errCode = ErrRuntime;
+                }
             }
             else if( mIdentifier == "DefaultStringCode" )
             {
@@ -566,6 +850,10 @@ namespace BfsdlParser
                 {
                     errCode = ErrTypeStr;
                 }
+                else if( mInput.d.str->GetUtf8String() == "ieee754" )
+                {
+                    // Built in (Appendix C.1); nothing to enable
+                }
                 else
                 {
                     // Blue Sky: Plugin architecture to support extensions without forking?
@@ -632,6 +920,27 @@ namespace BfsdlParser
                 // Ignore empty statement
                 return;
             }
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "}" ) && ( mScopes.size() > 1 ) )
+            {
+                // End of a class definition; it becomes usable once complete, so a class cannot
+                // contain itself.
+                TreePtr completeClass = mScopes.back();
+                mScopes.pop_back();
+                if( completeClass->GetNumFields() == 0 )
+                {
+                    LogError( "Class has no fields before" );
+                }
+                else if( !GetScope()->Add( completeClass ) )
+                {
+                    LogError( "Failed to add class at" );
+                }
+                return;
+            }
+            if( mImport && ( mInput.type == In::Control ) && ( *mInput.d.ctrl == ":" ) )
+            {
+                LogError( "Header is not allowed in an imported stream; found" );
+                return;
+            }
             if( mInput.type != In::Word )
             {
                 LogError( "Unexpected" );
@@ -642,6 +951,16 @@ namespace BfsdlParser
             mIdentifier.clear();
             mNumericFieldBuilder.Reset();
             mNumericFieldBuilder.SetBitBase( mCurBitBase );
+            mStringFieldBuilder.Reset();
+            mStringFieldBuilder.SetBitBase( mCurBitBase );
+            mFloatFormat = FloatField::GetFormatId( mDb->GetStringProperty( "DefaultFloatFormat" ) );
+            mFloatFormatExplicit = false;
+            mArrayCount = 0U;
+            mArrayCountField.reset();
+            mArrayDefined = false;
+            mClass.reset();
+            mUnion.reset();
+            mUnionTagField.reset();
 
             // Parse keywords and bit format types in order of ambiguity
             // The functions will return true if they have "handled" the data, either by error or transition.
@@ -652,6 +971,23 @@ namespace BfsdlParser
                     return;
                 }
                 mStateMachine.Transition( ParseState::StatementFixedPointNumericId );
+            } else if( *mInput.d.word == "f" ) {
+                mStateMachine.Transition( ParseState::StatementFloatId );
+            } else if( mStringFieldBuilder.ParseIdentifier( *mInput.d.word ) ) {
+                mStateMachine.Transition( ParseState::StatementStringId );
+            } else if( *mInput.d.word == "class" ) {
+                mStateMachine.Transition( ParseState::StatementClassName );
+            } else if( *mInput.d.word == "union" ) {
+                mStateMachine.Transition( ParseState::StatementUnionTagOpen );
+            } else if( *mInput.d.word == "library" ) {
+                mStateMachine.Transition( ParseState::StatementLibraryName );
+            } else if( *mInput.d.word == "importfile" ) {
+                mStateMachine.Transition( ParseState::StatementImportSource );
+            } else if( ( *mInput.d.word == "resource" ) || ( *mInput.d.word == "importsource" ) ) {
+                // No system-defined access methods are supported (BFSDL section 6.2)
+                LogError( "Resources are not supported:" );
+            } else if( ( mClass = FindClass( *mInput.d.word ) ) != NULL ) {
+                mStateMachine.Transition( ParseState::StatementClassFieldId );
             } else {
                 LogError( "Unexpected" );
             }
@@ -665,7 +1001,8 @@ namespace BfsdlParser
                 mStateMachine.Transition( ParseState::StatementFixedPointNumericSuffix );
                 return;
             }
-            if( mInput.type != In::Word )
+            bool const isArray = ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "[" );
+            if( ( mInput.type != In::Word ) && !isArray )
             {
                 LogError( "Unexpected" );
                 return;
@@ -681,11 +1018,17 @@ namespace BfsdlParser
                 }
             }
 
+            if( isArray )
+            {
+                BeginArray();
+                return;
+            }
+
             mIdentifier = *mInput.d.word;
 
-            Objects::NumericFieldPtr field = mNumericFieldBuilder.GetField( mIdentifier );
+            Objects::NumericFieldPtr field = mNumericFieldBuilder.GetField( mIdentifier, mDb->GetAllocator() );
 
-            if( ( !field ) || ( !mDb->Add( field ) ) )
+            if( ( !field ) || ( !GetScope()->Add( WrapArray( field ) ) ) )
             {
                 LogError( "Failed to add numeric field" );
                 return;
@@ -711,14 +1054,669 @@ namespace BfsdlParser
             mStateMachine.Transition( ParseState::StatementFixedPointNumericId );
         }
 
-        void Interpreter::StateStatementEndEvaluate()
+        void Interpreter::StateStatementFloatIdEvaluate()
         {
-            if( ( mInput.type == In::Control ) && ( IsEndOfLine( *mInput.d.ctrl ) ) )
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "." ) && !mFloatFormatExplicit )
             {
-                mStateMachine.Transition( ParseState::StatementBegin );
+                // Period before the name means the format follows
+                mStateMachine.Transition( ParseState::StatementFloatFormatOpen );
                 return;
             }
-            LogError( "Expected end of statement; got" );
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "[" ) )
+            {
+                // Once the count is given, the format can no longer be
+                mFloatFormatExplicit = true;
+                BeginArray();
+                return;
+            }
+            if( mInput.type != In::Word )
+            {
+                LogError( "Unexpected" );
+                return;
+            }
+
+            mIdentifier = *mInput.d.word;
+
+            if( mFloatFormat == FloatFormat::Unknown )
+            {
+                LogError( "No floating-point format (or DefaultFloatFormat) for" );
+                return;
+            }
+            if( mDb->GetNumericPropertyWithDefault< Ieee754VersionType >( "IEEE754Version", DefaultIeee754Version ) <
+                FloatField::GetMinIeee754Version( mFloatFormat ) )
+            {
+                std::stringstream ss;
+                ss << "Floating-point format requires IEEE754Version=#" << FloatField::GetMinIeee754Version( mFloatFormat ) << "# for";
+                LogError( ss.str() );
+                return;
+            }
+
+            Objects::FloatFieldPtr field = CreateObject< FloatField >( mDb->GetAllocator(), mIdentifier, mFloatFormat );
+
+            if( ( !field ) || ( !GetScope()->Add( WrapArray( field ) ) ) )
+            {
+                LogError( "Failed to add float field" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementEnd );
+        }
+
+        void Interpreter::StateStatementFloatFormatOpenEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != "(" ) )
+            {
+                LogError( "Expected '(', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementFloatFormatValue );
+        }
+
+        void Interpreter::StateStatementFloatFormatValueEvaluate()
+        {
+            if( mInput.type != In::StringLiteral )
+            {
+                LogError( "Expected floating-point format, found" );
+                return;
+            }
+
+            mFloatFormat = FloatField::GetFormatId( mInput.d.str->GetUtf8String() );
+            if( mFloatFormat == FloatFormat::Unknown )
+            {
+                LogError( "Unsupported floating-point format" );
+                return;
+            }
+
+            mFloatFormatExplicit = true;
+            mStateMachine.Transition( ParseState::StatementFloatFormatClose );
+        }
+
+        void Interpreter::StateStatementFloatFormatCloseEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != ")" ) )
+            {
+                LogError( "Expected ')', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementFloatId );
+        }
+
+        void Interpreter::StateStatementStringIdEvaluate()
+        {
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "." ) )
+            {
+                // Period before the name means an attribute follows
+                mStateMachine.Transition( ParseState::StatementStringAttrName );
+                return;
+            }
+            if( mInput.type != In::Word )
+            {
+                LogError( "Unexpected" );
+                return;
+            }
+
+            if( !mStringFieldBuilder.Finalize() )
+            {
+                LogError( "Invalid string field" );
+                return;
+            }
+
+            mIdentifier = *mInput.d.word;
+
+            Objects::StringFieldPtr field = mStringFieldBuilder.GetField( mIdentifier, mDb->GetAllocator() );
+
+            if( ( !field ) || ( !GetScope()->Add( field ) ) )
+            {
+                LogError( "Failed to add string field" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementEnd );
+        }
+
+        void Interpreter::StateStatementStringAttrNameEvaluate()
+        {
+            if( mInput.type != In::Word )
+            {
+                LogError( "Expected attribute name, found" );
+                return;
+            }
+
+            mIdentifier = *mInput.d.word;
+            mStateMachine.Transition( ParseState::StatementStringAttrOpen );
+        }
+
+        void Interpreter::StateStatementStringAttrOpenEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != "(" ) )
+            {
+                LogError( "Expected '(', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementStringAttrValue );
+        }
+
+        void Interpreter::StateStatementStringAttrValueEvaluate()
+        {
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == ")" ) )
+            {
+                // Attribute without a value
+                if( CheckAttributeResult( mStringFieldBuilder.ParseStringAttribute( mIdentifier, std::string() ) ) )
+                {
+                    mStateMachine.Transition( ParseState::StatementStringId );
+                }
+                return;
+            }
+
+            Objects::AttributeParseResult::Type result = Objects::AttributeParseResult::Unknown;
+            if( mInput.type == In::NumericLiteral )
+            {
+                result = mStringFieldBuilder.ParseNumericAttribute( mIdentifier, *mInput.d.num );
+            }
+            else if( mInput.type == In::StringLiteral )
+            {
+                result = mStringFieldBuilder.ParseStringAttribute( mIdentifier, mInput.d.str->GetUtf8String() );
+            }
+            else
+            {
+                LogError( "Expected attribute value, found" );
+                return;
+            }
+
+            if( CheckAttributeResult( result ) )
+            {
+                mStateMachine.Transition( ParseState::StatementStringAttrClose );
+            }
+        }
+
+        void Interpreter::StateStatementStringAttrCloseEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != ")" ) )
+            {
+                LogError( "Expected ')', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementStringId );
+        }
+
+        void Interpreter::StateStatementClassNameEvaluate()
+        {
+            if( mInput.type != In::Word )
+            {
+                LogError( "Expected class name, found" );
+                return;
+            }
+            if( IsReservedWord( *mInput.d.word ) )
+            {
+                LogError( "Reserved word used as class name:" );
+                return;
+            }
+            if( GetScope()->FindTree( *mInput.d.word ) != NULL )
+            {
+                LogError( "Redefinition of class" );
+                return;
+            }
+
+            mIdentifier = *mInput.d.word;
+            mStateMachine.Transition( ParseState::StatementClassOpen );
+        }
+
+        void Interpreter::StateStatementClassOpenEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != "{" ) )
+            {
+                LogError( "Expected '{', found" );
+                return;
+            }
+
+            TreePtr newClass = CreateObject< Tree >( mDb->GetAllocator(), mIdentifier, mDb->GetAllocator() );
+            if( !newClass )
+            {
+                LogError( "Failed to create class at" );
+                return;
+            }
+
+            // Statements up to the matching '}' define the fields of the class
+            mScopes.push_back( newClass );
+            mStateMachine.Transition( ParseState::StatementBegin );
+        }
+
+        void Interpreter::StateStatementClassFieldIdEvaluate()
+        {
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "." ) && !mArrayDefined )
+            {
+                // Period before the name means a class within this one follows
+                BeginClassMember();
+                return;
+            }
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "[" ) )
+            {
+                BeginArray();
+                return;
+            }
+            if( mInput.type != In::Word )
+            {
+                LogError( "Unexpected" );
+                return;
+            }
+            if( mClass->GetNumFields() == 0 )
+            {
+                // Only a library may define no fields
+                LogError( "Library '" + mClass->GetName() + "' has no fields for" );
+                return;
+            }
+
+            mIdentifier = *mInput.d.word;
+
+            Objects::FieldPtr field = CreateObject< ClassField >( mDb->GetAllocator(), mIdentifier, mClass );
+
+            if( ( !field ) || ( !GetScope()->Add( WrapArray( field ) ) ) )
+            {
+                LogError( "Failed to add class field" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementEnd );
+        }
+
+        void Interpreter::StateStatementClassMemberEvaluate()
+        {
+            if( mInput.type != In::Word )
+            {
+                LogError( "Expected class name, found" );
+                return;
+            }
+
+            TreePtr member = mClass->FindTree( *mInput.d.word );
+            if( !member )
+            {
+                LogError( "No class in '" + mClass->GetName() + "' named" );
+                return;
+            }
+
+            mClass = member;
+            mStateMachine.Transition( mClassMemberReturnState );
+        }
+
+        void Interpreter::StateStatementLibraryNameEvaluate()
+        {
+            if( mInput.type != In::Word )
+            {
+                LogError( "Expected library name, found" );
+                return;
+            }
+            if( IsReservedWord( *mInput.d.word ) )
+            {
+                LogError( "Reserved word used as library name:" );
+                return;
+            }
+            if( GetScope()->FindTree( *mInput.d.word ) != NULL )
+            {
+                LogError( "Redefinition of class" );
+                return;
+            }
+
+            mIdentifier = *mInput.d.word;
+            mStateMachine.Transition( ParseState::StatementLibraryOpen );
+        }
+
+        void Interpreter::StateStatementLibraryOpenEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != "(" ) )
+            {
+                LogError( "Expected '(', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementLibrarySource );
+        }
+
+        void Interpreter::StateStatementLibrarySourceEvaluate()
+        {
+            if( mInput.type != In::StringLiteral )
+            {
+                LogError( "Expected library source, found" );
+                return;
+            }
+
+            // The library loads in the background until the stream first needs it
+            PendingLibrary library;
+            library.tree = CreateObject< Tree >( mDb->GetAllocator(), mIdentifier, mDb->GetAllocator() );
+            library.load = SpecCache::Get().StartLibrary( mInput.d.str->GetUtf8String(), mDb->GetStringProperty( "Filename" ) );
+            if( ( !library.tree ) || ( !GetScope()->Add( library.tree ) ) )
+            {
+                LogError( "Failed to add library at" );
+                return;
+            }
+            mLibraries.push_back( library );
+
+            mStateMachine.Transition( ParseState::StatementLibraryClose );
+        }
+
+        void Interpreter::StateStatementLibraryCloseEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != ")" ) )
+            {
+                LogError( "Expected ')', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementEnd );
+        }
+
+        void Interpreter::StateStatementImportSourceEvaluate()
+        {
+            if( mInput.type != In::StringLiteral )
+            {
+                LogError( "Expected import source, found" );
+                return;
+            }
+
+            // Imported definitions take effect in place, so the import cannot be deferred
+            std::string error;
+            SpecCache::LoadPtr load = SpecCache::Get().StartImport( mInput.d.str->GetUtf8String(), mDb->GetStringProperty( "Filename" ), mDb );
+            Objects::DatabasePtr db = SpecCache::Get().Finish( load, error );
+            if( !db )
+            {
+                LogError( "Failed to import (" + error + "):" );
+                return;
+            }
+            if( !GetScope()->Merge( *db->GetRoot() ) )
+            {
+                LogError( "Import conflicts with a class in scope:" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementEnd );
+        }
+
+        void Interpreter::StateStatementUnionTagOpenEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != "(" ) )
+            {
+                LogError( "Expected '(', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementUnionTag );
+        }
+
+        void Interpreter::StateStatementUnionTagEvaluate()
+        {
+            if( mInput.type != In::Word )
+            {
+                LogError( "Expected union tag, found" );
+                return;
+            }
+
+            // The tag is the value of an earlier field in the same scope
+            Objects::NumericFieldPtr tagField;
+            Objects::FieldPtr field = GetScope()->FindField( *mInput.d.word );
+            if( field )
+            {
+                tagField = Objects::NumericField::StaticCast( field );
+            }
+            if( !tagField )
+            {
+                LogError( "Union tag is not a numeric field in scope:" );
+                return;
+            }
+
+            Objects::NumericFieldProperties const& props = tagField->GetNumericFieldProperties();
+            if( props.mSigned || ( props.mFractionalBits != 0U ) )
+            {
+                LogError( "Union tag requires an unsigned integer field, found" );
+                return;
+            }
+
+            mUnionTagField = tagField;
+            mStateMachine.Transition( ParseState::StatementUnionTagClose );
+        }
+
+        void Interpreter::StateStatementUnionTagCloseEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != ")" ) )
+            {
+                LogError( "Expected ')', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementUnionName );
+        }
+
+        void Interpreter::StateStatementUnionNameEvaluate()
+        {
+            if( mInput.type != In::Word )
+            {
+                LogError( "Unexpected" );
+                return;
+            }
+
+            mIdentifier = *mInput.d.word;
+            mUnion = CreateObject< UnionField >( mDb->GetAllocator(), mIdentifier, mUnionTagField );
+            if( !mUnion )
+            {
+                LogError( "Failed to create union field" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementUnionOpen );
+        }
+
+        void Interpreter::StateStatementUnionOpenEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != "{" ) )
+            {
+                LogError( "Expected '{', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementUnionCase );
+        }
+
+        void Interpreter::StateStatementUnionCaseEvaluate()
+        {
+            if( ( mInput.type == In::Control ) && ( IsEndOfLine( *mInput.d.ctrl ) ) )
+            {
+                // Ignore empty statement
+                return;
+            }
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "}" ) )
+            {
+                // End of the cases; the union is usable once its case table is built
+                if( mUnion->GetNumCases() == 0 )
+                {
+                    LogError( "Union has no cases before" );
+                }
+                else if( !mUnion->CompleteCases() )
+                {
+                    LogError( "Failed to build union cases at" );
+                }
+                else if( !GetScope()->Add( mUnion ) )
+                {
+                    LogError( "Failed to add union field" );
+                }
+                else
+                {
+                    mStateMachine.Transition( ParseState::StatementBegin );
+                }
+                return;
+            }
+            if( mInput.type != In::NumericLiteral )
+            {
+                LogError( "Expected union case, found" );
+                return;
+            }
+
+            size_t const tagBits = mUnionTagField->GetNumericFieldProperties().mIntegralBits;
+            if( !mInput.d.num->GetUint( mUnionCaseTag, Bfdp::BitManip::BytesToBits( sizeof( mUnionCaseTag ) ) ) )
+            {
+                LogError( "Invalid union case" );
+                return;
+            }
+            else if( ( tagBits < Bfdp::BitManip::BytesToBits( sizeof( mUnionCaseTag ) ) ) &&
+                ( ( mUnionCaseTag >> tagBits ) != 0U ) )
+            {
+                LogError( "Union case exceeds the range of the tag:" );
+                return;
+            }
+            else if( mUnion->HasCase( mUnionCaseTag ) )
+            {
+                LogError( "Duplicate union case" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementUnionCaseColon );
+        }
+
+        void Interpreter::StateStatementUnionCaseColonEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != ":" ) )
+            {
+                LogError( "Expected ':', found" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementUnionCaseClass );
+        }
+
+        void Interpreter::StateStatementUnionCaseClassEvaluate()
+        {
+            mClass.reset();
+            if( mInput.type == In::Word )
+            {
+                mClass = FindClass( *mInput.d.word );
+            }
+            if( !mClass )
+            {
+                LogError( "Union case is not a class in scope:" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementUnionCaseEnd );
+        }
+
+        void Interpreter::StateStatementUnionCaseEndEvaluate()
+        {
+            if( ( mInput.type == In::Control ) && ( *mInput.d.ctrl == "." ) )
+            {
+                BeginClassMember();
+                return;
+            }
+            if( ( mInput.type != In::Control ) || ( !IsEndOfLine( *mInput.d.ctrl ) ) )
+            {
+                LogError( "Expected end of statement; got" );
+                return;
+            }
+            if( mClass->GetNumFields() == 0 )
+            {
+                LogError( "Library '" + mClass->GetName() + "' has no fields for union case at" );
+                return;
+            }
+            if( !mUnion->AddCase( mUnionCaseTag, mClass ) )
+            {
+                LogError( "Failed to add union case at" );
+                return;
+            }
+
+            mStateMachine.Transition( ParseState::StatementUnionCase );
+        }
+
+        void Interpreter::StateStatementArrayCountEvaluate()
+        {
+            if( mInput.type == In::NumericLiteral )
+            {
+                if( !mInput.d.num->GetUint( mArrayCount, Bfdp::BitManip::BytesToBits( sizeof( mArrayCount ) ) ) ||
+                    ( mArrayCount == 0U ) )
+                {
+                    LogError( "Invalid array count" );
+                    return;
+                }
+            }
+            else if( mInput.type == In::Word )
+            {
+                // The count is the value of an earlier field in the same scope
+                Objects::NumericFieldPtr countField;
+                Objects::FieldPtr field = GetScope()->FindField( *mInput.d.word );
+                if( field )
+                {
+                    countField = Objects::NumericField::StaticCast( field );
+                }
+                if( !countField )
+                {
+                    LogError( "Array count is not a numeric field in scope:" );
+                    return;
+                }
+
+                Objects::NumericFieldProperties const& props = countField->GetNumericFieldProperties();
+                if( props.mSigned || ( props.mFractionalBits != 0U ) )
+                {
+                    LogError( "Array count requires an unsigned integer field, found" );
+                    return;
+                }
+                mArrayCountField = countField;
+            }
+            else
+            {
+                LogError( "Expected array count, found" );
+                return;
+            }
+
+            mArrayDefined = true;
+            mStateMachine.Transition( ParseState::StatementArrayClose );
+        }
+
+        void Interpreter::StateStatementArrayCloseEvaluate()
+        {
+            if( ( mInput.type != In::Control ) ||
+                ( *mInput.d.ctrl != "]" ) )
+            {
+                LogError( "Expected ']', found" );
+                return;
+            }
+
+            mStateMachine.Transition( mArrayReturnState );
+        }
+
+        void Interpreter::StateStatementEndEvaluate()
+        {
+            if( ( mInput.type == In::Control ) && ( IsEndOfLine( *mInput.d.ctrl ) ) )
+            {
+                mStateMachine.Transition( ParseState::StatementBegin );
+                return;
+            }
+            LogError( "Expected end of statement; got" );
+        }
+
+        Objects::FieldPtr Interpreter::WrapArray
+            (
+            Objects::FieldPtr const aElement
+            )
+        {
+            if( !mArrayDefined || !aElement )
+            {
+                return aElement;
+            }
+            else if( mArrayCountField )
+            {
+                return CreateObject< ArrayField >( mDb->GetAllocator(), aElement->GetName(), aElement, mArrayCountField );
+            }
+            return CreateObject< ArrayField >( mDb->GetAllocator(), aElement->GetName(), aElement, mArrayCount );
         }
 
     } // namespace Token
@@ -61,7 +61,7 @@ namespace BfsdlParser
 
             static Lexer::RangeSymbolCategory CatAsterisk( Category::Asterisk, 42, false );
             static Lexer::RangeSymbolCategory CatBackslash( Category::Backslash, 92, false );
-            static Lexer::StringSymbolCategory CatControl( Category::Control, "[];:=", false );
+            static Lexer::StringSymbolCategory CatControl( Category::Control, "[]{}();:=", false );
             static Lexer::RangeSymbolCategory CatDecimalDigits( Category::DecimalDigits, 48, 57, true ); // 0-9
             static Lexer::RangeSymbolCategory CatDoubleQuotes( Category::DoubleQuotes, 34, false ); // Double Quotes
             static Lexer::StringSymbolCategory CatEndOfLine( Category::EndOfLine, "\r\n", true );
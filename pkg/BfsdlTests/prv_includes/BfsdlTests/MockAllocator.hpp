@@ -0,0 +1,89 @@
+/**
+    BFSDL Tests Mock Allocator Declarations
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef BfsdlTests_MockAllocator
+#define BfsdlTests_MockAllocator
+
+// Base Includes
+#include "Bfdp/Data/IAllocator.hpp"
+
+// Internal Includes
+#include "Bfdp/Macros.hpp"
+
+namespace BfsdlTests
+{
+
+    //! Test double that allocates from the heap, and counts the memory it hands out
+    class MockAllocator
+        : public Bfdp::Data::IAllocator
+    {
+    public:
+        MockAllocator();
+
+        ~MockAllocator();
+
+        BFDP_OVERRIDE( void* Allocate
+            (
+            size_t const aSize
+            ) );
+
+        BFDP_OVERRIDE( void Free
+            (
+            void* const aPtr,
+            size_t const aSize
+            ) );
+
+        //! Fail allocations (return NULL) until set otherwise
+        void SetFail
+            (
+            bool const aFail
+            );
+
+        //! @return The number of calls to Allocate() that succeeded
+        size_t GetNumAllocations() const;
+
+        //! @return The number of bytes allocated and not yet freed
+        size_t GetBytesOutstanding() const;
+
+        //! @return The number of allocations not yet freed
+        size_t GetNumOutstanding() const;
+
+    private:
+        size_t mBytesOutstanding;
+        bool mFail;
+        size_t mNumAllocations;
+        size_t mNumOutstanding;
+    };
+
+} // namespace BfsdlTests
+
+#endif // BfsdlTests_MockAllocator
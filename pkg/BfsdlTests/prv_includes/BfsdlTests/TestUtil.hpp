@@ -62,6 +62,12 @@ namespace BfsdlTests
 
     void ClearErrorHandlers();
 
+    //! @return The path of aFileName in the directory of the test specifications (test/specs)
+    std::string GetSpecPath
+        (
+        std::string const& aFileName
+        );
+
     void SetDefaultErrorHandlers();
 
     template< class T >
@@ -72,6 +78,15 @@ namespace BfsdlTests
             : aPtr;
     }
 
+    //! Read all of file aFileName into aOutData
+    //!
+    //! @return true if successful, false otherwise.
+    bool ReadFile
+        (
+        std::string const& aFileName,
+        std::string& aOutData
+        );
+
     ::testing::AssertionResult StrEq
         (
         std::string const& aExpected,
@@ -0,0 +1,196 @@
+/**
+    BFDP Algorithm Case Table Tests
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "Bfdp/Algorithm/CaseTable.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp::Algorithm;
+
+    class AlgorithmCaseTableTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    namespace AlgorithmCaseTableTestInternal
+    {
+
+        //! @return Case number of aTag by linear scan, as a protocol decoder without a case
+        //!     table would find it
+        static size_t LinearFind
+            (
+            std::vector< uint64_t > const& aTags,
+            uint64_t const aTag
+            )
+        {
+            for( size_t i = 0; i < aTags.size(); ++i )
+            {
+                if( aTags[i] == aTag )
+                {
+                    return i;
+                }
+            }
+            return CaseTable::NoCase;
+        }
+
+        //! @return Spread-out tag values, like 32-bit message identifiers
+        static std::vector< uint64_t > MakeSparseTags
+            (
+            size_t const aCount
+            )
+        {
+            std::vector< uint64_t > tags;
+            uint64_t value = 0x9E3779B97F4A7C15ULL;
+            for( size_t i = 0; i < aCount; ++i )
+            {
+                value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+                tags.push_back( value >> 32 );
+            }
+            return tags;
+        }
+
+    } // namespace AlgorithmCaseTableTestInternal
+
+    using namespace AlgorithmCaseTableTestInternal;
+
+    TEST_F( AlgorithmCaseTableTest, Dense )
+    {
+        CaseTable table;
+        ASSERT_TRUE( table.Find( 0U ) == CaseTable::NoCase );
+
+        // Tags near each other index a jump table, with gaps having no case
+        uint64_t const tags[] = { 12U, 10U, 15U, 11U };
+        ASSERT_TRUE( table.Build( tags, 4U ) );
+        ASSERT_TRUE( table.IsDense() );
+        ASSERT_EQ( 4U, table.GetNumCases() );
+        ASSERT_EQ( 0U, table.Find( 12U ) );
+        ASSERT_EQ( 1U, table.Find( 10U ) );
+        ASSERT_EQ( 2U, table.Find( 15U ) );
+        ASSERT_EQ( 3U, table.Find( 11U ) );
+        ASSERT_TRUE( table.Find( 13U ) == CaseTable::NoCase );
+        ASSERT_TRUE( table.Find( 9U ) == CaseTable::NoCase );
+        ASSERT_TRUE( table.Find( 16U ) == CaseTable::NoCase );
+        ASSERT_TRUE( table.Find( UINT64_MAX ) == CaseTable::NoCase );
+
+        // Tags at the top of the range do not overflow
+        uint64_t const highTags[] = { UINT64_MAX, UINT64_MAX - 1U };
+        ASSERT_TRUE( table.Build( highTags, 2U ) );
+        ASSERT_TRUE( table.IsDense() );
+        ASSERT_EQ( 0U, table.Find( UINT64_MAX ) );
+        ASSERT_EQ( 1U, table.Find( UINT64_MAX - 1U ) );
+        ASSERT_TRUE( table.Find( 0U ) == CaseTable::NoCase );
+
+        // Repeated tags are rejected
+        uint64_t const repeated[] = { 1U, 2U, 1U };
+        ASSERT_FALSE( table.Build( repeated, 3U ) );
+        ASSERT_EQ( 0U, table.GetNumCases() );
+        ASSERT_TRUE( table.Find( 1U ) == CaseTable::NoCase );
+
+        // An empty table has no cases
+        ASSERT_TRUE( table.Build( tags, 0U ) );
+        ASSERT_TRUE( table.Find( 12U ) == CaseTable::NoCase );
+    }
+
+    TEST_F( AlgorithmCaseTableTest, PerfectHash )
+    {
+        CaseTable table;
+
+        // Tags too far apart for a jump table are hashed
+        uint64_t const tags[] = { 0U, 1000U, 0x10000U, UINT64_MAX };
+        ASSERT_TRUE( table.Build( tags, 4U ) );
+        ASSERT_FALSE( table.IsDense() );
+        for( size_t i = 0; i < 4U; ++i )
+        {
+            ASSERT_EQ( i, table.Find( tags[i] ) );
+        }
+        ASSERT_TRUE( table.Find( 1U ) == CaseTable::NoCase );
+        ASSERT_TRUE( table.Find( 999U ) == CaseTable::NoCase );
+        ASSERT_TRUE( table.Find( UINT64_MAX - 1U ) == CaseTable::NoCase );
+
+        // Many cases, checked against a linear scan
+        std::vector< uint64_t > sparse = MakeSparseTags( 5000U );
+        ASSERT_TRUE( table.Build( &sparse[0], sparse.size() ) );
+        ASSERT_FALSE( table.IsDense() );
+        ASSERT_EQ( sparse.size(), table.GetNumCases() );
+        for( size_t i = 0; i < sparse.size(); ++i )
+        {
+            ASSERT_EQ( i, table.Find( sparse[i] ) );
+            ASSERT_EQ( LinearFind( sparse, sparse[i] + 1U ), table.Find( sparse[i] + 1U ) );
+        }
+    }
+
+    //! Dispatch of a protocol with 256 message types, checked against a linear scan of the
+    //! cases
+    TEST_F( AlgorithmCaseTableTest, Dispatch256Types )
+    {
+        static size_t const NumTypes = 256U;
+        static size_t const NumLookups = 4096U;
+
+        std::vector< uint64_t > denseTags;
+        for( size_t i = 0; i < NumTypes; ++i )
+        {
+            // Out of order, as cases appear in a spec
+            denseTags.push_back( ( i * 167U ) % NumTypes );
+        }
+        std::vector< uint64_t > sparseTags = MakeSparseTags( NumTypes );
+
+        std::vector< uint64_t > const* const tagSets[] = { &denseTags, &sparseTags };
+        for( size_t set = 0; set < 2U; ++set )
+        {
+            std::vector< uint64_t > const& tags = *tagSets[set];
+            SCOPED_TRACE( ::testing::Message( set == 0 ? "dense" : "sparse" ) );
+
+            CaseTable table;
+            ASSERT_TRUE( table.Build( &tags[0], tags.size() ) );
+            ASSERT_EQ( set == 0, table.IsDense() );
+
+            // A stream of messages of every type, in a scattered order
+            for( size_t i = 0; i < NumLookups; ++i )
+            {
+                uint64_t const tag = tags[( i * 97U + ( i >> 8 ) ) % NumTypes];
+                ASSERT_EQ( LinearFind( tags, tag ), table.Find( tag ) );
+            }
+        }
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,108 @@
+/**
+    BFDP Algorithm Search Tests
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "Bfdp/Algorithm/Search.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Byte;
+    using Bfdp::Char;
+    using namespace Bfdp::Algorithm;
+
+    class AlgorithmSearchTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( AlgorithmSearchTest, CountByte )
+    {
+        ASSERT_EQ( 0U, CountByte( NULL, 0, 'a' ) );
+
+        // Short buffers only use the byte loop
+        ASSERT_EQ( 0U, CountByte( Char( "bcd" ), 3, 'a' ) );
+        ASSERT_EQ( 2U, CountByte( Char( "abca" ), 4, 'a' ) );
+
+        // Long buffers use words, with a leftover tail
+        char const* text = "a\nbc\n\ndefghij\nklmnopqrstuvwxyz\n\n\n0123456789\n";
+        size_t len = std::strlen( text );
+        ASSERT_EQ( 8U, CountByte( Char( text ), len, '\n' ) );
+        ASSERT_EQ( 1U, CountByte( Char( text ), len, 'z' ) );
+        ASSERT_EQ( 0U, CountByte( Char( text ), len, '\r' ) );
+
+        // Every byte matches, including values with the high bit set
+        Byte const allSet[] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+        ASSERT_EQ( 9U, CountByte( allSet, sizeof( allSet ), 0xff ) );
+        ASSERT_EQ( 0U, CountByte( allSet, sizeof( allSet ), 0x7f ) );
+
+        // Adjacent values must not be falsely matched by borrows between bytes
+        Byte const adjacent[] = { 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00 };
+        ASSERT_EQ( 4U, CountByte( adjacent, sizeof( adjacent ), 0x01 ) );
+        ASSERT_EQ( 4U, CountByte( adjacent, sizeof( adjacent ), 0x00 ) );
+    }
+
+    TEST_F( AlgorithmSearchTest, FindFirstByteOf )
+    {
+        ASSERT_EQ( 0U, FindFirstByteOf( NULL, 0, '\r', '\n' ) );
+
+        char const* text = "0123456789abcdef\rghij\n";
+        size_t len = std::strlen( text );
+        ASSERT_EQ( 16U, FindFirstByteOf( Char( text ), len, '\r', '\n' ) );
+        ASSERT_EQ( 16U, FindFirstByteOf( Char( text ), len, '\n', '\r' ) );
+        ASSERT_EQ( 21U, FindFirstByteOf( Char( text ), len, '\n', '\n' ) );
+        ASSERT_EQ( 0U, FindFirstByteOf( Char( text ), len, '0', 'x' ) );
+        ASSERT_EQ( len, FindFirstByteOf( Char( text ), len, 'x', 'y' ) );
+    }
+
+    TEST_F( AlgorithmSearchTest, FindLastByte )
+    {
+        ASSERT_EQ( 0U, FindLastByte( NULL, 0, '\n' ) );
+
+        char const* text = "\n123456789abcdef\nghijklmnopqrstuv";
+        size_t len = std::strlen( text );
+        ASSERT_EQ( 16U, FindLastByte( Char( text ), len, '\n' ) );
+        ASSERT_EQ( 0U, FindLastByte( Char( text ), 16, '\n' ) );
+        ASSERT_EQ( len - 1, FindLastByte( Char( text ), len, 'v' ) );
+        ASSERT_EQ( len, FindLastByte( Char( text ), len, '\r' ) );
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,172 @@
+/**
+    BFSDL Tests Allocation Counter Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "BfsdlTests/AllocationCounter.hpp"
+
+// External Includes
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace BfsdlTests
+{
+
+    namespace AllocationCounterInternal
+    {
+
+        //! Allocations made through operator new since the program started
+        static std::atomic< size_t > sNumAllocations( 0U );
+
+        static void* Allocate
+            (
+            size_t const aSize
+            )
+        {
+            ++sNumAllocations;
+            // malloc( 0 ) may return NULL, but operator new may not
+            return std::malloc( ( aSize == 0U ) ? 1U : aSize );
+        }
+
+    } // namespace AllocationCounterInternal
+
+    using namespace AllocationCounterInternal;
+
+    AllocationCounter::AllocationCounter()
+        : mStart( sNumAllocations )
+    {
+    }
+
+    size_t AllocationCounter::GetNumAllocations() const
+    {
+        return sNumAllocations - mStart;
+    }
+
+    void AllocationCounter::Reset()
+    {
+        mStart = sNumAllocations;
+    }
+
+} // namespace BfsdlTests
+
+// Replacements for the global allocation functions; the rest of the family forwards to these.
+
+void* operator new
+    (
+    size_t aSize
+    )
+{
+    void* const ptr = BfsdlTests::AllocationCounterInternal::Allocate( aSize );
+    if( ptr == NULL )
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new
+    (
+    size_t aSize,
+    std::nothrow_t const&
+    ) noexcept
+{
+    return BfsdlTests::AllocationCounterInternal::Allocate( aSize );
+}
+
+void* operator new[]
+    (
+    size_t aSize
+    )
+{
+    return operator new( aSize );
+}
+
+void* operator new[]
+    (
+    size_t aSize,
+    std::nothrow_t const& aNoThrow
+    ) noexcept
+{
+    return operator new( aSize, aNoThrow );
+}
+
+void operator delete
+    (
+    void* aPtr
+    ) noexcept
+{
+    std::free( aPtr );
+}
+
+void operator delete
+    (
+    void* aPtr,
+    size_t
+    ) noexcept
+{
+    std::free( aPtr );
+}
+
+void operator delete
+    (
+    void* aPtr,
+    std::nothrow_t const&
+    ) noexcept
+{
+    std::free( aPtr );
+}
+
+void operator delete[]
+    (
+    void* aPtr
+    ) noexcept
+{
+    std::free( aPtr );
+}
+
+void operator delete[]
+    (
+    void* aPtr,
+    size_t
+    ) noexcept
+{
+    std::free( aPtr );
+}
+
+void operator delete[]
+    (
+    void* aPtr,
+    std::nothrow_t const&
+    ) noexcept
+{
+    std::free( aPtr );
+}
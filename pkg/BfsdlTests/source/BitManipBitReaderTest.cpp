@@ -0,0 +1,112 @@
+/**
+    BFDP Bit Manipulation Bit Reader Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/BitManip/BitReader.hpp"
+#include "Bfdp/BitManip/BitView.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+
+    class BitManipBitReaderTest
+        : public ::testing::Test
+    {
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( BitManipBitReaderTest, Empty )
+    {
+        BitManip::BitReader reader( ( BitManip::BitView() ) );
+        ASSERT_EQ( 0U, reader.GetBitsLeft() );
+        ASSERT_EQ( 0U, reader.Read( 0 ) );
+    }
+
+    TEST_F( BitManipBitReaderTest, PeekConsume )
+    {
+        static Byte const Data[] = { 0xA5, 0x3C, 0xF0 };
+        BitManip::BitReader reader( BitManip::BitView( Data, 0, 24 ) );
+
+        ASSERT_EQ( 0x05U, reader.Peek( 4 ) );
+        ASSERT_EQ( 0xA5U, reader.Peek( 8 ) );
+        reader.Consume( 4 );
+        ASSERT_EQ( 20U, reader.GetBitsLeft() );
+        ASSERT_EQ( 0xCAU, reader.Peek( 8 ) );
+        ASSERT_EQ( 0xF03CAU, reader.Read( 20 ) );
+        ASSERT_EQ( 0U, reader.GetBitsLeft() );
+    }
+
+    TEST_F( BitManipBitReaderTest, ReadMatchesView )
+    {
+        // Long enough for the fast refill path, with a tail for the slow one
+        Byte data[45];
+        for( size_t i = 0; i < sizeof( data ); ++i )
+        {
+            data[i] = static_cast< Byte >( ( i * 0x9DU ) ^ 0x5AU );
+        }
+
+        for( size_t offset = 0; offset < 8; ++offset )
+        {
+            for( size_t width = 1; width <= BitManip::BitReader::MaxReadBits; ++width )
+            {
+                SCOPED_TRACE( ::testing::Message( "offset=" ) << offset << " width=" << width );
+
+                // Vary the width from value to value to move the refill boundaries around
+                BitManip::BitView view( data, offset, ( sizeof( data ) * 8 ) - offset - ( width % 8 ) );
+                BitManip::BitReader reader( view );
+                size_t numBits = width;
+                while( view.GetSizeBits() >= numBits )
+                {
+                    ASSERT_EQ( view.GetSizeBits(), reader.GetBitsLeft() );
+
+                    uint64_t expected;
+                    ASSERT_TRUE( view.Peek( numBits, expected ) );
+                    ASSERT_EQ( expected, reader.Read( numBits ) );
+                    ASSERT_TRUE( view.Skip( numBits ) );
+
+                    numBits = ( numBits % BitManip::BitReader::MaxReadBits ) + 1;
+                }
+                ASSERT_EQ( view.GetSizeBits(), reader.GetBitsLeft() );
+            }
+        }
+    }
+
+} // namespace BfsdlTests
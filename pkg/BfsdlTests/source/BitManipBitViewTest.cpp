@@ -0,0 +1,187 @@
+/**
+    BFDP Bit Manipulation Bit View Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/BitManip/BitBuffer.hpp"
+#include "Bfdp/BitManip/BitView.hpp"
+#include "Bfdp/BitManip/GenericBitStream.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+
+    class BitManipBitViewTest
+        : public ::testing::Test
+    {
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( BitManipBitViewTest, Empty )
+    {
+        BitManip::BitView view;
+        ASSERT_TRUE( view.IsEmpty() );
+        ASSERT_EQ( 0U, view.GetSizeBits() );
+
+        uint8_t value;
+        ASSERT_TRUE( view.Peek( 0, value ) );
+        ASSERT_FALSE( view.Peek( 1, value ) );
+        ASSERT_TRUE( view.Skip( 0 ) );
+        ASSERT_FALSE( view.Skip( 1 ) );
+    }
+
+    TEST_F( BitManipBitViewTest, Peek )
+    {
+        static Byte const Data[] = { 0xA5, 0x3C, 0xF0, 0x0F, 0x81 };
+        BitManip::BitView const view( Data, 0, BFDP_COUNT_OF_ARRAY( Data ) * 8 );
+
+        struct TestDataType
+        {
+            size_t offset;
+            size_t numBits;
+            uint64_t value;
+        } TestData[] =
+        {
+            {  0,  1, 0x01 },
+            {  0,  4, 0x05 },
+            {  4,  4, 0x0A },
+            {  0,  8, 0xA5 },
+            {  4,  8, 0xCA },
+            {  0, 16, 0x3CA5 },
+            {  3, 11, 0x794 },
+            {  7, 33, 0x1021FE079ULL },
+            {  0, 40, 0x810FF03CA5ULL },
+            { 39,  1, 0x01 },
+        };
+        static size_t const TestCount = BFDP_COUNT_OF_ARRAY( TestData );
+
+        for( size_t i = 0; i < TestCount; ++i )
+        {
+            TestDataType& t = TestData[i];
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "] offset=" << t.offset << " bits=" << t.numBits );
+
+            BitManip::BitView sub;
+            ASSERT_TRUE( view.SubView( t.offset, t.numBits, sub ) );
+            ASSERT_EQ( t.numBits, sub.GetSizeBits() );
+
+            uint64_t value;
+            ASSERT_TRUE( sub.Peek( t.numBits, value ) );
+            ASSERT_EQ( t.value, value );
+            ASSERT_FALSE( sub.Peek( t.numBits + 1, value ) );
+        }
+
+        // Values wider than the output type are rejected
+        uint8_t narrow;
+        ASSERT_FALSE( view.Peek( 9, narrow ) );
+        ASSERT_TRUE( view.Peek( 8, narrow ) );
+        ASSERT_EQ( 0xA5, narrow );
+    }
+
+    TEST_F( BitManipBitViewTest, SkipAndSubView )
+    {
+        static Byte const Data[] = { 0x12, 0x34, 0x56, 0x78 };
+        BitManip::BitView view( Data, 0, 32 );
+
+        uint16_t value;
+        ASSERT_TRUE( view.Skip( 4 ) );
+        ASSERT_EQ( 28U, view.GetSizeBits() );
+        ASSERT_FALSE( view.IsByteAligned() );
+        ASSERT_TRUE( view.Peek( 12, value ) );
+        ASSERT_EQ( 0x341, value );
+
+        ASSERT_TRUE( view.Skip( 12 ) );
+        ASSERT_TRUE( view.IsByteAligned() );
+        ASSERT_EQ( &Data[2], view.GetDataPtr() );
+
+        // Sub-views are relative to the view and bounded by it
+        BitManip::BitView sub;
+        ASSERT_TRUE( view.SubView( 8, 8, sub ) );
+        ASSERT_TRUE( sub.Peek( 8, value ) );
+        ASSERT_EQ( 0x78, value );
+        ASSERT_TRUE( view.SubView( 16, 0, sub ) );
+        ASSERT_TRUE( sub.IsEmpty() );
+        ASSERT_FALSE( view.SubView( 8, 9, sub ) );
+        ASSERT_FALSE( view.SubView( 17, 0, sub ) );
+
+        ASSERT_FALSE( view.Skip( 17 ) );
+        ASSERT_TRUE( view.Skip( 16 ) );
+        ASSERT_TRUE( view.IsEmpty() );
+    }
+
+    TEST_F( BitManipBitViewTest, AlignedBytes )
+    {
+        static Byte const Data[] = { 0x01, 0x02, 0x03, 0x04 };
+        BitManip::BitView view( Data, 8, 20 );
+
+        Byte const* bytes = NULL;
+        size_t numBytes = 0;
+        ASSERT_TRUE( view.GetAlignedBytes( bytes, numBytes ) );
+        ASSERT_EQ( &Data[1], bytes );
+        ASSERT_EQ( 2U, numBytes );
+
+        ASSERT_TRUE( view.Skip( 1 ) );
+        ASSERT_FALSE( view.GetAlignedBytes( bytes, numBytes ) );
+    }
+
+    TEST_F( BitManipBitViewTest, StreamView )
+    {
+        BitManip::BitBuffer buffer;
+        ASSERT_TRUE( buffer.ResizeNoPreserve( 24 ) );
+        Byte* data = buffer.GetDataPtr();
+        data[0] = 0xEF;
+        data[1] = 0xBE;
+        data[2] = 0xAD;
+
+        BitManip::GenericBitStream stream( buffer );
+        ASSERT_TRUE( stream.SeekBits( 4 ) );
+
+        // The view covers the unread bits and shares the stream's memory
+        BitManip::BitView const view = stream.GetView();
+        ASSERT_EQ( 20U, view.GetSizeBits() );
+        ASSERT_EQ( buffer.GetDataPtr(), view.GetDataPtr() );
+        ASSERT_EQ( 4U, view.GetOffsetBits() );
+
+        uint32_t value;
+        ASSERT_TRUE( view.Peek( 20, value ) );
+        ASSERT_EQ( 0xADBEEU, value );
+        ASSERT_EQ( 4U, stream.GetPosBits() );
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,193 @@
+/**
+    BFDP BitManip Bit Writer Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <sstream>
+#include <string>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/BitManip/BitWriter.hpp"
+#include "Bfdp/BitManip/Conversion.hpp"
+#include "Bfdp/BitManip/EndianBitReader.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfsdlTests/MockErrorHandler.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+    using BitManip::BitWriter;
+    using BitManip::EndianBitReader;
+    using BitManip::Endianness;
+
+    class BitManipBitWriterTest
+        : public ::testing::Test
+    {
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( BitManipBitWriterTest, Layout )
+    {
+        static struct TestDataType
+        {
+            Endianness::Type bitOrder;
+            Endianness::Type byteOrder;
+            char const* output;
+        } const sTestData[] =
+        {
+            { Endianness::Little, Endianness::Little, "\x0B\xCD\xAB\x05" },
+            { Endianness::Little, Endianness::Big, "\x0B\xAB\xCD\x05" },
+            { Endianness::Big, Endianness::Little, "\xB0\xCD\xAB\xA0" },
+            { Endianness::Big, Endianness::Big, "\xB0\xAB\xCD\xA0" },
+        };
+        static size_t const sNumTests = BFDP_COUNT_OF_ARRAY( sTestData );
+
+        for( size_t i = 0; i < sNumTests; ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "]" );
+
+            std::stringbuf out;
+            BitWriter writer( out, sTestData[i].bitOrder, sTestData[i].byteOrder );
+            writer.Write( 0xBU, 4 );
+            writer.Write( 0x0U, 4 );
+            writer.Write( 0xABCDU, 16 );
+            writer.Write( 0x5U, 3 );
+            ASSERT_EQ( 27U, writer.GetPosBits() );
+
+            // Writing nothing is a no-op
+            writer.Write( 0xFFU, 0 );
+            ASSERT_EQ( 27U, writer.GetPosBits() );
+
+            // The partial byte is padded with zeros
+            ASSERT_TRUE( writer.Finish() );
+            ASSERT_EQ( 32U, writer.GetPosBits() );
+            ASSERT_EQ( std::string( sTestData[i].output, 4 ), out.str() );
+        }
+    }
+
+    TEST_F( BitManipBitWriterTest, RoundTrip )
+    {
+        static Endianness::Type const Orders[][2] =
+        {
+            { Endianness::Little, Endianness::Little },
+            { Endianness::Little, Endianness::Big },
+            { Endianness::Big, Endianness::Little },
+            { Endianness::Big, Endianness::Big },
+        };
+
+        for( size_t o = 0; o < BFDP_COUNT_OF_ARRAY( Orders ); ++o )
+        {
+            for( size_t lead = 0; lead < 8; ++lead )
+            {
+                SCOPED_TRACE( ::testing::Message( "order=" ) << o << " lead=" << lead );
+
+                // Values of every width, with bits above the width set to check masking
+                std::stringbuf out;
+                BitWriter writer( out, Orders[o][0], Orders[o][1] );
+                writer.Write( 0U, lead );
+                uint64_t seed = 0x9E3779B97F4A7C15ULL;
+                for( size_t bits = 1; bits <= BitWriter::MaxWriteBits; ++bits )
+                {
+                    seed = ( seed * 6364136223846793005ULL ) + 1442695040888963407ULL;
+                    writer.Write( seed, bits );
+                }
+                ASSERT_TRUE( writer.Finish() );
+
+                size_t const totalBits = lead + ( ( BitWriter::MaxWriteBits * ( BitWriter::MaxWriteBits + 1 ) ) / 2 );
+                std::string const data = out.str();
+                ASSERT_EQ( BitManip::BitsToBytes( totalBits ), data.size() );
+
+                Byte const* const bytes = reinterpret_cast< Byte const* >( data.data() );
+                EndianBitReader reader( Orders[o][0], Orders[o][1] );
+                seed = 0x9E3779B97F4A7C15ULL;
+                size_t pos = lead;
+                for( size_t bits = 1; bits <= BitWriter::MaxWriteBits; ++bits )
+                {
+                    seed = ( seed * 6364136223846793005ULL ) + 1442695040888963407ULL;
+                    ASSERT_EQ( seed & BitManip::CreateMask< uint64_t >( bits ), reader.Read( bytes, pos, bits ) ) << "bits=" << bits;
+                    pos += bits;
+                }
+            }
+        }
+    }
+
+    TEST_F( BitManipBitWriterTest, LargeOutput )
+    {
+        // More than one buffer's worth of output
+        size_t const count = ( BitWriter::DefaultBufferBytes / 3U ) + 17U;
+        std::stringbuf out;
+        BitWriter writer( out, Endianness::Little, Endianness::Big );
+        for( size_t i = 0; i < count; ++i )
+        {
+            writer.Write( i, 24 );
+        }
+        ASSERT_EQ( count * 24U, writer.GetPosBits() );
+        ASSERT_TRUE( writer.Finish() );
+
+        std::string const data = out.str();
+        ASSERT_EQ( count * 3U, data.size() );
+        Byte const* const bytes = reinterpret_cast< Byte const* >( data.data() );
+        for( size_t i = 0; i < count; ++i )
+        {
+            ASSERT_EQ( ( i >> 16 ) & 0xFFU, bytes[i * 3U] ) << "i=" << i;
+            ASSERT_EQ( ( i >> 8 ) & 0xFFU, bytes[( i * 3U ) + 1U] ) << "i=" << i;
+            ASSERT_EQ( i & 0xFFU, bytes[( i * 3U ) + 2U] ) << "i=" << i;
+        }
+    }
+
+    TEST_F( BitManipBitWriterTest, WriteFailure )
+    {
+        // A stream buffer that accepts nothing
+        class NullStreamBuf
+            : public std::streambuf
+        {
+        };
+
+        NullStreamBuf out;
+        BitWriter writer( out, Endianness::Little, Endianness::Little );
+        writer.Write( 0x1234U, 16 );
+        ASSERT_TRUE( writer.IsOk() );
+
+        SetMockErrorHandlers();
+        MockErrorHandler::Workspace wksp;
+        wksp.ExpectRunTimeError();
+        ASSERT_FALSE( writer.Finish() );
+        wksp.VerifyRunTimeError();
+        ASSERT_FALSE( writer.IsOk() );
+    }
+
+} // namespace BfsdlTests
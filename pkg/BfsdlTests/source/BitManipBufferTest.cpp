@@ -31,11 +31,15 @@
 */
 
 // External includes
+#include <cstring>
+#include <utility>
 #include "gtest/gtest.h"
 
 // Internal Includes
 #include "Bfdp/BitManip/BitBuffer.hpp"
 #include "Bfdp/BitManip/Conversion.hpp"
+#include "Bfdp/Data/ArenaAllocator.hpp"
+#include "BfsdlTests/MockAllocator.hpp"
 #include "BfsdlTests/TestUtil.hpp"
 
 namespace BfsdlTests
@@ -92,6 +96,39 @@ namespace BfsdlTests
         }
     };
 
+    TEST_F( BitManipBufferTest, Allocator )
+    {
+        static Byte const data[] = { 0x01, 0xC2, 0x3f };
+        // Large enough that the buffers are not held inline
+        static size_t const Size = Data::ByteBuffer::InlineSize + 1U;
+        static size_t const BlockSize = ( ( Size + 1U + Data::IAllocator::Alignment - 1U ) /
+            Data::IAllocator::Alignment ) * Data::IAllocator::Alignment;
+        MockAllocator upstream;
+        Data::ArenaAllocator arena( Data::ArenaAllocator::DefaultBlockSize, upstream );
+        {
+            BitManip::BitBuffer buf( BitManip::BytesToBits( Size ), arena );
+            ASSERT_EQ( &arena, &buf.GetAllocator() );
+            ASSERT_EQ( BitManip::BytesToBits( Size ), buf.GetCapacityBits() );
+            ASSERT_TRUE( buf.SetDataBytes( 2U ) );
+            std::memcpy( buf.GetDataPtr(), data, 2U );
+
+            // Growing draws from the same allocator
+            ASSERT_TRUE( buf.ResizePreserve( BitManip::BytesToBits( Size + 1U ) ) );
+            buf.GetDataPtr()[2] = data[2];
+            ASSERT_TRUE( ArraysMatch( buf.GetDataPtr(), data, BFDP_COUNT_OF_ARRAY( data ) ) );
+
+            // So does a copy
+            BitManip::BitBuffer copy( buf );
+            ASSERT_EQ( &arena, &copy.GetAllocator() );
+            ASSERT_TRUE( ArraysMatch( copy.GetDataPtr(), data, BFDP_COUNT_OF_ARRAY( data ) ) );
+            ASSERT_TRUE( VerifyGuarantees( copy ) );
+        }
+
+        // Buffers released their memory to the arena, which still holds it
+        ASSERT_EQ( 1U, upstream.GetNumOutstanding() );
+        ASSERT_EQ( 3U * BlockSize, arena.GetBytesAllocated() );
+    }
+
     TEST_F( BitManipBufferTest, CreateAlignedBuffer )
     {
         static Byte const data[] = { 0x01, 0xC2, 0x3f };
@@ -167,6 +204,53 @@ namespace BfsdlTests
         ASSERT_TRUE( VerifyGuarantees( buf ) );
     }
 
+    TEST_F( BitManipBufferTest, Move )
+    {
+        static Byte const data[] = { 0x01, 0xC2, 0x3f };
+        static size_t const dataSizeBits = BitManip::BytesToBits( BFDP_COUNT_OF_ARRAY( data ) );
+        MockAllocator allocator;
+        for( size_t numBytes = 1U; numBytes <= Data::ByteBuffer::InlineSize + 1U; numBytes += Data::ByteBuffer::InlineSize )
+        {
+            SCOPED_TRACE( ::testing::Message( "numBytes=" ) << numBytes );
+            BitManip::BitBuffer buf( BitManip::BytesToBits( numBytes ), allocator );
+            ASSERT_TRUE( buf.ResizePreserve( dataSizeBits + 1U ) );
+            std::memcpy( buf.GetDataPtr(), data, BFDP_COUNT_OF_ARRAY( data ) );
+            size_t const capacityBits = buf.GetCapacityBits();
+            size_t const numAllocations = allocator.GetNumAllocations();
+
+            BitManip::BitBuffer moved( std::move( buf ) );
+            ASSERT_TRUE( buf.IsEmpty() );
+            ASSERT_EQ( 0U, buf.GetCapacityBits() );
+            ASSERT_EQ( &allocator, &moved.GetAllocator() );
+            ASSERT_EQ( capacityBits, moved.GetCapacityBits() );
+            ASSERT_EQ( dataSizeBits + 1U, moved.GetDataBits() );
+            ASSERT_TRUE( ArraysMatch( moved.GetDataPtr(), data, BFDP_COUNT_OF_ARRAY( data ) ) );
+            ASSERT_TRUE( VerifyGuarantees( moved ) );
+
+            BitManip::BitBuffer assigned( data, dataSizeBits );
+            assigned = std::move( moved );
+            ASSERT_TRUE( moved.IsEmpty() );
+            ASSERT_EQ( 0U, moved.GetCapacityBits() );
+            ASSERT_EQ( &allocator, &assigned.GetAllocator() );
+            ASSERT_EQ( capacityBits, assigned.GetCapacityBits() );
+            ASSERT_EQ( dataSizeBits + 1U, assigned.GetDataBits() );
+            ASSERT_TRUE( ArraysMatch( assigned.GetDataPtr(), data, BFDP_COUNT_OF_ARRAY( data ) ) );
+            ASSERT_TRUE( VerifyGuarantees( assigned ) );
+
+            // Moves never draw more memory
+            ASSERT_EQ( numAllocations, allocator.GetNumAllocations() );
+        }
+        ASSERT_EQ( 0U, allocator.GetNumOutstanding() );
+
+        // Small buffers do not draw memory at all
+        {
+            BitManip::BitBuffer buf( dataSizeBits, allocator );
+            BitManip::BitBuffer copy( buf );
+            ASSERT_TRUE( copy.ResizePreserve( BitManip::BytesToBits( Data::ByteBuffer::InlineSize ) ) );
+        }
+        ASSERT_EQ( 1U, allocator.GetNumAllocations() );
+    }
+
     TEST_F( BitManipBufferTest, ResizeBufferNoPreserve )
     {
         static size_t const dataSizeBits = 12;
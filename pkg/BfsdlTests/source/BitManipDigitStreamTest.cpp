@@ -94,6 +94,11 @@ namespace BfsdlTests
             { "1", 16, true, 0x1ULL },
             { "FFFFFFFFFFFFFFFF", 16, true, UINT64_MAX },
             { "10000000000000000", 16, false, X },
+
+            // Leading zeros do not count towards the width
+            { "0000000000000000000000000000000000000000000000000000000000000000001", 2, true, 1ULL },
+            { "0000000000000000FFFFFFFFFFFFFFFF", 16, true, UINT64_MAX },
+            { "00000000000000000000018446744073709551615", 10, true, UINT64_MAX },
         };
         static size_t const testCount = BFDP_COUNT_OF_ARRAY( testData );
 
@@ -164,6 +169,47 @@ namespace BfsdlTests
         ASSERT_EQ( 0U, iter.ReadDigit() ); // Read beyond end of stream is safe
     }
 
+    TEST_F( BitManipDigitStreamTest, IterateLeadingZeros )
+    {
+        BitManip::DigitStream stream;
+
+        ASSERT_TRUE( stream.Set( "00907", 10 ) );
+        ASSERT_EQ( 5U, stream.GetNumDigits() );
+
+        static unsigned int const Expected[] = { 0U, 0U, 9U, 0U, 7U };
+        BitManip::Digiterator iter = stream.GetIterator();
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( Expected ); ++i )
+        {
+            ASSERT_FALSE( iter.IsDone() );
+            ASSERT_EQ( Expected[i], iter.ReadDigit() );
+        }
+        ASSERT_TRUE( iter.IsDone() );
+    }
+
+    TEST_F( BitManipDigitStreamTest, IterateWide )
+    {
+        BitManip::DigitStream stream;
+
+        // Too wide for 64 bits
+        std::string const digits = "123456789012345678901234567890";
+        ASSERT_TRUE( stream.Set( digits, 10 ) );
+        ASSERT_EQ( digits.size(), stream.GetNumDigits() );
+
+        uint64_t out64;
+        ASSERT_FALSE( stream.GetUint64( out64 ) );
+
+        BitManip::Digiterator iter = stream.GetIterator();
+        for( size_t i = 0; i < digits.size(); ++i )
+        {
+            ASSERT_FALSE( iter.IsDone() );
+            ASSERT_EQ( static_cast< unsigned int >( digits[i] - '0' ), iter.ReadDigit() );
+        }
+        ASSERT_TRUE( iter.IsDone() );
+
+        std::string outStr = stream.GetStr();
+        ASSERT_STREQ( digits.c_str(), outStr.c_str() );
+    }
+
     TEST_F( BitManipDigitStreamTest, SetDigits )
     {
         BitManip::DigitStream stream;
@@ -206,7 +252,15 @@ namespace BfsdlTests
             // Base-16
             { "126a", 16, true, "126a" },
             { "126A", 16, true, "126a" },
-            { "126G", 16, false, "" }
+            { "126G", 16, false, "" },
+
+            // Leading zeros are preserved
+            { "000", 10, true, "000" },
+            { "0070", 8, true, "0070" },
+            { "00000000000000000000000000000000000000000000000000000000000000000000001", 2, true, "00000000000000000000000000000000000000000000000000000000000000000000001" },
+
+            // Wider than 64 bits
+            { "fedcba9876543210fedcba9876543210", 16, true, "fedcba9876543210fedcba9876543210" }
         };
         static size_t const testCount = BFDP_COUNT_OF_ARRAY( testData );
 
@@ -0,0 +1,258 @@
+/**
+    BFDP BitManip Endian Bit Reader Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/BitManip/BitBuffer.hpp"
+#include "Bfdp/BitManip/EndianBitReader.hpp"
+#include "Bfdp/BitManip/GenericBitStream.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfsdlTests/MockErrorHandler.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+    using BitManip::EndianBitReader;
+    using BitManip::Endianness;
+
+    class BitManipEndianBitReaderTest
+        : public ::testing::Test
+    {
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    namespace
+    {
+        Byte const TestBytes[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x0F };
+    }
+
+    TEST_F( BitManipEndianBitReaderTest, Read )
+    {
+        static Endianness::Type const L = Endianness::Little;
+        static Endianness::Type const B = Endianness::Big;
+
+        struct TestDataType
+        {
+            Endianness::Type bitOrder;
+            Endianness::Type byteOrder;
+            size_t pos;
+            size_t bits;
+            uint64_t value;
+        } const TestData[] =
+        {
+            { L, L,  0,  4, 0x0000000000000002ULL },
+            { L, L,  4,  4, 0x0000000000000001ULL },
+            { L, L,  3,  3, 0x0000000000000002ULL },
+            { L, L,  0,  8, 0x0000000000000012ULL },
+            { L, L,  0, 16, 0x0000000000003412ULL },
+            { L, L,  0, 24, 0x0000000000563412ULL },
+            { L, L,  0, 32, 0x0000000078563412ULL },
+            { L, L,  0, 64, 0xF0DEBC9A78563412ULL },
+            { L, L,  8, 16, 0x0000000000005634ULL },
+            { L, L,  4,  8, 0x0000000000000041ULL },
+            { L, L,  4, 12, 0x0000000000000341ULL },
+            { L, L,  3, 16, 0x000000000000C682ULL },
+            { L, L,  1, 32, 0x000000003C2B1A09ULL },
+            { L, L,  4, 64, 0xFF0DEBC9A7856341ULL },
+            { L, L,  7, 64, 0x1FE1BD7934F0AC68ULL },
+            { L, L,  5,  7, 0x0000000000000020ULL },
+
+            { L, B,  0,  4, 0x0000000000000002ULL },
+            { L, B,  4,  4, 0x0000000000000001ULL },
+            { L, B,  3,  3, 0x0000000000000002ULL },
+            { L, B,  0,  8, 0x0000000000000012ULL },
+            { L, B,  0, 16, 0x0000000000001234ULL },
+            { L, B,  0, 24, 0x0000000000123456ULL },
+            { L, B,  0, 32, 0x0000000012345678ULL },
+            { L, B,  0, 64, 0x123456789ABCDEF0ULL },
+            { L, B,  8, 16, 0x0000000000003456ULL },
+            { L, B,  4,  8, 0x0000000000000041ULL },
+            { L, B,  4, 12, 0x0000000000000341ULL },
+            { L, B,  3, 16, 0x00000000000082C6ULL },
+            { L, B,  1, 32, 0x00000000091A2B3CULL },
+            { L, B,  4, 64, 0x416385A7C9EB0DFFULL },
+            { L, B,  7, 64, 0x68ACF03479BDE11FULL },
+            { L, B,  5,  7, 0x0000000000000020ULL },
+
+            { B, L,  0,  4, 0x0000000000000001ULL },
+            { B, L,  4,  4, 0x0000000000000002ULL },
+            { B, L,  3,  3, 0x0000000000000004ULL },
+            { B, L,  0,  8, 0x0000000000000012ULL },
+            { B, L,  0, 16, 0x0000000000003412ULL },
+            { B, L,  0, 24, 0x0000000000563412ULL },
+            { B, L,  0, 32, 0x0000000078563412ULL },
+            { B, L,  0, 64, 0xF0DEBC9A78563412ULL },
+            { B, L,  8, 16, 0x0000000000005634ULL },
+            { B, L,  4,  8, 0x0000000000000023ULL },
+            { B, L,  4, 12, 0x0000000000000234ULL },
+            { B, L,  3, 16, 0x000000000000A291ULL },
+            { B, L,  1, 32, 0x00000000F1AC6824ULL },
+            { B, L,  4, 64, 0x00EFCDAB89674523ULL },
+            { B, L,  7, 64, 0x07786F5E4D3C2B1AULL },
+            { B, L,  5,  7, 0x0000000000000023ULL },
+
+            { B, B,  0,  4, 0x0000000000000001ULL },
+            { B, B,  4,  4, 0x0000000000000002ULL },
+            { B, B,  3,  3, 0x0000000000000004ULL },
+            { B, B,  0,  8, 0x0000000000000012ULL },
+            { B, B,  0, 16, 0x0000000000001234ULL },
+            { B, B,  0, 24, 0x0000000000123456ULL },
+            { B, B,  0, 32, 0x0000000012345678ULL },
+            { B, B,  0, 64, 0x123456789ABCDEF0ULL },
+            { B, B,  8, 16, 0x0000000000003456ULL },
+            { B, B,  4,  8, 0x0000000000000023ULL },
+            { B, B,  4, 12, 0x0000000000000234ULL },
+            { B, B,  3, 16, 0x00000000000091A2ULL },
+            { B, B,  1, 32, 0x000000002468ACF1ULL },
+            { B, B,  4, 64, 0x23456789ABCDEF00ULL },
+            { B, B,  7, 64, 0x1A2B3C4D5E6F7807ULL },
+            { B, B,  5,  7, 0x0000000000000023ULL },
+        };
+
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( TestData ); ++i )
+        {
+            TestDataType const& t = TestData[i];
+            SCOPED_TRACE
+                (
+                ::testing::Message( "[" ) << i << "]"
+                << " bitOrder=" << t.bitOrder
+                << " byteOrder=" << t.byteOrder
+                << " pos=" << t.pos
+                << " bits=" << t.bits
+                );
+
+            EndianBitReader reader( t.bitOrder, t.byteOrder );
+            ASSERT_EQ( t.value, reader.Read( TestBytes, t.pos, t.bits ) );
+        }
+    }
+
+    TEST_F( BitManipEndianBitReaderTest, ReadLittleMatchesGeneric )
+    {
+        // Little bit and byte order is the layout GenericBitStream reads on a little-endian host
+        BitManip::BitBuffer buffer( TestBytes, BitManip::BytesToBits( sizeof( TestBytes ) ) );
+        EndianBitReader reader( Endianness::Little, Endianness::Little );
+
+        for( size_t pos = 0; pos < 8; ++pos )
+        {
+            for( size_t bits = 1; bits <= 64; ++bits )
+            {
+                SCOPED_TRACE( ::testing::Message( "pos=" ) << pos << " bits=" << bits );
+
+                BitManip::GenericBitStream stream( buffer );
+                ASSERT_TRUE( stream.SeekBits( pos ) );
+                uint64_t expected = 0U;
+                ASSERT_TRUE( stream.ReadBits( reinterpret_cast< Byte* >( &expected ), bits ) );
+                ASSERT_EQ( expected, reader.Read( TestBytes, pos, bits ) );
+            }
+        }
+    }
+
+    TEST_F( BitManipEndianBitReaderTest, ReadArrayMatchesRead )
+    {
+        static Endianness::Type const Orders[][2] =
+        {
+            { Endianness::Little, Endianness::Little },
+            { Endianness::Little, Endianness::Big },
+            { Endianness::Big, Endianness::Little },
+            { Endianness::Big, Endianness::Big },
+        };
+
+        // Enough data for the word and grouped kernels to run, plus a tail for Read()
+        Byte data[97];
+        for( size_t i = 0; i < sizeof( data ); ++i )
+        {
+            data[i] = static_cast< Byte >( ( i * 0x9DU ) ^ 0x5AU );
+        }
+
+        uint64_t values[sizeof( data ) * 8];
+        for( size_t o = 0; o < BFDP_COUNT_OF_ARRAY( Orders ); ++o )
+        {
+            EndianBitReader reader( Orders[o][0], Orders[o][1] );
+            for( size_t bits = 1; bits <= 64; ++bits )
+            {
+                for( size_t pos = 0; pos < 8; ++pos )
+                {
+                    size_t const count = ( BitManip::BytesToBits( sizeof( data ) ) - pos ) / bits;
+                    SCOPED_TRACE( ::testing::Message( "order=" ) << o << " bits=" << bits << " pos=" << pos << " count=" << count );
+
+                    reader.ReadArray( data, pos, bits, count, values );
+                    for( size_t i = 0; i < count; ++i )
+                    {
+                        ASSERT_EQ( reader.Read( data, pos + ( i * bits ), bits ), values[i] ) << "i=" << i;
+                    }
+                }
+            }
+        }
+
+        // Nothing is written for an empty array
+        values[0] = 0xA5U;
+        EndianBitReader( Endianness::Little, Endianness::Little ).ReadArray( data, 0, 12, 0, values );
+        ASSERT_EQ( 0xA5U, values[0] );
+    }
+
+    TEST_F( BitManipEndianBitReaderTest, ReadBits )
+    {
+        BitManip::BitBuffer buffer( TestBytes, 20 );
+        BitManip::GenericBitStream stream( buffer );
+        EndianBitReader reader( Endianness::Big, Endianness::Big );
+
+        uint64_t value;
+        ASSERT_TRUE( reader.ReadBits( stream, 12, value ) );
+        ASSERT_EQ( 0x123U, value );
+        ASSERT_EQ( 12U, stream.GetPosBits() );
+
+        // Not enough data; the position does not change
+        ASSERT_FALSE( reader.ReadBits( stream, 9, value ) );
+        ASSERT_EQ( 12U, stream.GetPosBits() );
+
+        ASSERT_TRUE( reader.ReadBits( stream, 8, value ) );
+        ASSERT_EQ( 0x45U, value );
+        ASSERT_EQ( 0U, stream.GetBitsTillEnd() );
+
+        SetMockErrorHandlers();
+        MockErrorHandler::Workspace wksp;
+        wksp.ExpectMisuseError();
+        ASSERT_FALSE( reader.ReadBits( stream, 0, value ) );
+        ASSERT_NO_FATAL_FAILURE( wksp.VerifyMisuseError() );
+        wksp.ExpectMisuseError();
+        ASSERT_FALSE( reader.ReadBits( stream, 65, value ) );
+        ASSERT_NO_FATAL_FAILURE( wksp.VerifyMisuseError() );
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,70 @@
+/**
+    BFDP BitManip Endian Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/BitManip/Endian.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+
+    class BitManipEndianTest
+        : public ::testing::Test
+    {
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( BitManipEndianTest, ByteSwap )
+    {
+        ASSERT_EQ( 0x3412U, BitManip::ByteSwap16( 0x1234U ) );
+        ASSERT_EQ( 0x78563412UL, BitManip::ByteSwap32( 0x12345678UL ) );
+        ASSERT_EQ( 0xF0DEBC9A78563412ULL, BitManip::ByteSwap64( 0x123456789ABCDEF0ULL ) );
+    }
+
+    TEST_F( BitManipEndianTest, ByteSwapN )
+    {
+        ASSERT_EQ( 0xABULL, BitManip::ByteSwapN( 0xABULL, 1 ) );
+        ASSERT_EQ( 0x3412ULL, BitManip::ByteSwapN( 0x1234ULL, 2 ) );
+        ASSERT_EQ( 0x563412ULL, BitManip::ByteSwapN( 0x123456ULL, 3 ) );
+        ASSERT_EQ( 0xBC9A78563412ULL, BitManip::ByteSwapN( 0x123456789ABCULL, 6 ) );
+        ASSERT_EQ( 0xF0DEBC9A78563412ULL, BitManip::ByteSwapN( 0x123456789ABCDEF0ULL, 8 ) );
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,601 @@
+/**
+    BFSDL Parse Command Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "App/Commands.hpp"
+#include "App/Context.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    namespace CmdParseTestInternal
+    {
+
+        //! Enough data to span several of the 1 MiB shards that bfdp parse --threads decodes
+        static size_t const ShardedDataBytes = 5U << 19;
+
+        //! Strings that end at a terminator or are prefixed with their length
+        static char const StringsSpec[] =
+            ":BFSDL_HEADER\n"
+            ":Version=#1#\n"
+            ":BitBase=\"Bit\"\n"
+            ":DefaultStringCode=\"UTF8\"\n"
+            ":END_HEADER\n"
+            "\n"
+            "u8 id;\n"
+            "cstring name;\n"
+            "string.plen(#8#) title;\n";
+
+        //! Records of a large array, which fail to decode from anywhere but their beginning
+        //! unless the array is empty
+        static char const BlobsSpec[] =
+            ":BFSDL_HEADER\n"
+            ":Version=#1#\n"
+            ":BitBase=\"Bit\"\n"
+            ":DefaultByteOrder=\"LE\"\n"
+            ":END_HEADER\n"
+            "\n"
+            "class Blob\n"
+            "{\n"
+            "    u16 n;\n"
+            "    u8[n] bytes;\n"
+            "};\n"
+            "\n"
+            "u8 type;\n"
+            "union(type) body\n"
+            "{\n"
+            "    #1#: Blob;\n"
+            "};\n";
+
+        //! Repeatable sequence of pseudo-random bytes
+        class Random
+        {
+        public:
+            Random()
+                : mState( 1U )
+            {
+            }
+
+            //! @return A number below aLimit (at most 256)
+            unsigned int Next
+                (
+                unsigned int const aLimit = 256U
+                )
+            {
+                mState = ( mState * 1664525U ) + 1013904223U;
+                return ( mState >> 24 ) % aLimit;
+            }
+
+            //! Append aCount bytes to aData
+            void Append
+                (
+                std::string& aData,
+                size_t const aCount
+                )
+            {
+                for( size_t i = 0; i < aCount; ++i )
+                {
+                    aData.push_back( static_cast< char >( Next() ) );
+                }
+            }
+
+        private:
+            uint32_t mState;
+        };
+
+    } // namespace CmdParseTestInternal
+
+    using namespace CmdParseTestInternal;
+
+    class CmdParseTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+
+        void TearDown()
+        {
+            std::remove( SpecFileName );
+            std::remove( DataFileName );
+            std::remove( IndexFileName );
+        }
+
+        //! A range of records to print, and the records expected
+        struct RangeCase
+        {
+            char const* range;
+            size_t first;
+            size_t end;
+        };
+
+        //! Check that bfdp parse --records prints the records of aCase
+        //!
+        //! @param[in] aArgs Arguments of bfdp parse other than the data, number of threads and
+        //!     range
+        //! @param[in] aRecords Output of each of the records, from SplitRecords()
+        static void CheckRecords
+            (
+            TestStringList const& aArgs,
+            std::vector< std::string > const& aRecords,
+            RangeCase const& aCase
+            )
+        {
+            SCOPED_TRACE( aCase.range );
+            ASSERT_LE( aCase.end, aRecords.size() );
+            std::string expected;
+            for( size_t i = aCase.first; i < aCase.end; ++i )
+            {
+                expected += aRecords[i];
+            }
+
+            TestStringList args = aArgs;
+            args.push_back( "--records" );
+            args.push_back( aCase.range );
+            std::string actual;
+            ASSERT_EQ( 0, RunParse( args, "1", actual ) );
+            ASSERT_TRUE( OutputsMatch( expected, actual ) );
+        }
+
+        //! Check that decoding the data in DataFileName across several threads prints the same as
+        //! decoding it on one thread
+        //!
+        //! @param[in] aArgs Arguments of bfdp parse other than the data and number of threads
+        static void CheckThreadsMatchSequential
+            (
+            TestStringList const& aArgs
+            )
+        {
+            std::string expected;
+            ASSERT_EQ( 0, RunParse( aArgs, "1", expected ) );
+            ASSERT_FALSE( expected.empty() );
+
+            char const* const threads[] = { "2", "4" };
+            for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( threads ); ++i )
+            {
+                std::string actual;
+                ASSERT_EQ( 0, RunParse( aArgs, threads[i], actual ) );
+                ASSERT_TRUE( OutputsMatch( expected, actual ) ) << "Threads: " << threads[i];
+            }
+        }
+
+        //! @return Whether aActual is the same as aExpected, or else the first line that differs
+        static ::testing::AssertionResult OutputsMatch
+            (
+            std::string const& aExpected,
+            std::string const& aActual
+            )
+        {
+            if( aActual == aExpected )
+            {
+                return ::testing::AssertionSuccess();
+            }
+
+            size_t mismatch = 0;
+            while( ( mismatch < aExpected.size() ) && ( mismatch < aActual.size() ) && ( aExpected[mismatch] == aActual[mismatch] ) )
+            {
+                ++mismatch;
+            }
+            // Show the line that differs
+            size_t const lineEnd = ( mismatch == 0 ) ? std::string::npos : aExpected.rfind( '\n', mismatch - 1U );
+            size_t const begin = ( lineEnd == std::string::npos ) ? 0U : lineEnd + 1U;
+            return ::testing::AssertionFailure()
+                << "Output differs at byte " << mismatch << " of " << aExpected.size() << "/" << aActual.size() << std::endl
+                << "  Expected: '" << aExpected.substr( begin, aExpected.find( '\n', mismatch ) - begin ) << "'" << std::endl
+                << "  Actual: '" << aActual.substr( begin, aActual.find( '\n', mismatch ) - begin ) << "'";
+        }
+
+        //! Run bfdp parse on DataFileName with aNumThreads threads
+        //!
+        //! @param[in] aArgs Other arguments
+        //! @param[out] aOutput Decoded fields
+        //! @return The result of the command.
+        static int RunParse
+            (
+            TestStringList const& aArgs,
+            char const* const aNumThreads,
+            std::string& aOutput
+            )
+        {
+            std::vector< char const* > argv;
+            argv.push_back( APP_CMD_PARSE_NAME );
+            for( TestStringList::const_iterator iter = aArgs.begin(); iter != aArgs.end(); ++iter )
+            {
+                argv.push_back( iter->c_str() );
+            }
+            argv.push_back( "--data" );
+            argv.push_back( DataFileName );
+            argv.push_back( "--threads" );
+            argv.push_back( aNumThreads );
+
+            // The decoder captures std::cout when it is created, so swap it before running
+            std::stringbuf output;
+            std::streambuf* const coutBuffer = std::cout.rdbuf( &output );
+            App::Context context;
+            context.Silence();
+
+            int const ret = App::CmdParse( context, static_cast< int >( argv.size() ), &argv[0] );
+
+            std::cout.rdbuf( coutBuffer );
+            aOutput = output.str();
+            return ret;
+        }
+
+        //! @return The output of each record in aOutput, where each record begins with a line for
+        //!     field aFirstField
+        static std::vector< std::string > SplitRecords
+            (
+            std::string const& aOutput,
+            std::string const& aFirstField
+            )
+        {
+            std::string const prefix = aFirstField + "=";
+            std::vector< std::string > records;
+            for( size_t pos = 0; pos < aOutput.size(); )
+            {
+                size_t lineEnd = aOutput.find( '\n', pos );
+                lineEnd = ( lineEnd == std::string::npos ) ? aOutput.size() : lineEnd + 1U;
+                if( records.empty() || ( aOutput.compare( pos, prefix.size(), prefix ) == 0 ) )
+                {
+                    records.push_back( std::string() );
+                }
+                records.back().append( aOutput, pos, lineEnd - pos );
+                pos = lineEnd;
+            }
+            return records;
+        }
+
+        //! Save aData to file aFileName
+        //!
+        //! @return true if successful, false otherwise.
+        static bool WriteFile
+            (
+            char const* const aFileName,
+            std::string const& aData
+            )
+        {
+            std::ofstream file( aFileName, std::ios::out | std::ios::binary | std::ios::trunc );
+            file.write( aData.data(), static_cast< std::streamsize >( aData.size() ) );
+            file.close();
+            return !file.fail();
+        }
+
+        //! Save records of 32 bits for test/specs/parse_bits.bfsdl to DataFileName, ending with a
+        //! partial record
+        //!
+        //! @return true if successful, false otherwise.
+        static bool WriteFixedSizeData()
+        {
+            Random random;
+            std::string data;
+            random.Append( data, ShardedDataBytes + 1U );
+            return WriteFile( DataFileName, data );
+        }
+
+        //! @return Arguments of bfdp parse that select the specification of test suite aName
+        //!     (e.g., parse_unions)
+        static TestStringList SuiteArgs
+            (
+            std::string const& aName
+            )
+        {
+            TestStringList args;
+            args.push_back( "--spec" );
+            args.push_back( GetSpecPath( aName + ".bfsdl" ) );
+            return args;
+        }
+
+        //! @return Arguments of bfdp parse that select the specification in SpecFileName
+        static TestStringList SpecArgs()
+        {
+            TestStringList args;
+            args.push_back( "--spec" );
+            args.push_back( SpecFileName );
+            return args;
+        }
+
+        //! Save Messages for test/specs/parse_unions.bfsdl to DataFileName
+        //!
+        //! @return true if successful, false otherwise.
+        static bool WriteUnionsData
+            (
+            size_t const aDataBytes
+            )
+        {
+            Random random;
+            std::string data;
+            while( data.size() < aDataBytes )
+            {
+                unsigned int const count = random.Next( 9U );
+                data.push_back( static_cast< char >( count ) );
+                for( unsigned int i = 0; i < count; ++i )
+                {
+                    unsigned int const type = random.Next( 3U );
+                    if( type == 0 )
+                    {
+                        // Ping
+                        data.push_back( '\x01' );
+                        random.Append( data, 1U );
+                    }
+                    else if( type == 1 )
+                    {
+                        // Position
+                        data.push_back( '\x02' );
+                        random.Append( data, 2U );
+                    }
+                    else
+                    {
+                        // Batch of Positions
+                        unsigned int const n = random.Next( 6U );
+                        data.push_back( '\xC8' );
+                        data.push_back( static_cast< char >( n ) );
+                        random.Append( data, 2U * n );
+                    }
+                }
+                random.Append( data, 2U );
+            }
+            return WriteFile( DataFileName, data );
+        }
+
+        static char const* const SpecFileName;
+        static char const* const DataFileName;
+        static char const* const IndexFileName;
+    };
+
+    char const* const CmdParseTest::SpecFileName = "CmdParseTest.bfsdl";
+    char const* const CmdParseTest::DataFileName = "CmdParseTest.bin";
+    char const* const CmdParseTest::IndexFileName = "CmdParseTest.idx";
+
+    TEST_F( CmdParseTest, FixedSizeThreads )
+    {
+        ASSERT_TRUE( WriteFixedSizeData() );
+
+        CheckThreadsMatchSequential( SuiteArgs( "parse_bits" ) );
+    }
+
+    TEST_F( CmdParseTest, FixedSizeThreadsRecords )
+    {
+        ASSERT_TRUE( WriteFixedSizeData() );
+
+        // Within a shard, across shards, up to the partial record at the end, and one record
+        char const* const ranges[] = { "1000:2000", "200000:600000", "-1000:", "600000" };
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( ranges ); ++i )
+        {
+            SCOPED_TRACE( ranges[i] );
+            TestStringList args = SuiteArgs( "parse_bits" );
+            args.push_back( "--records" );
+            args.push_back( ranges[i] );
+            CheckThreadsMatchSequential( args );
+        }
+    }
+
+    TEST_F( CmdParseTest, RecordsFixedSize )
+    {
+        // 1000 records, and a partial record
+        Random random;
+        std::string data;
+        random.Append( data, 4001U );
+        ASSERT_TRUE( WriteFile( DataFileName, data ) );
+
+        TestStringList const args = SuiteArgs( "parse_bits" );
+        std::string all;
+        ASSERT_EQ( 0, RunParse( args, "1", all ) );
+        std::vector< std::string > const records = SplitRecords( all, "data_u8" );
+        ASSERT_EQ( 1001U, records.size() );
+
+        // The partial record is not counted, but ranges that run to the end print it
+        RangeCase const cases[] =
+        {
+            { "0:10", 0, 10 },
+            { "250:750", 250, 750 },
+            { "-10:-5", 990, 995 },
+            { "990:", 990, 1001 },
+            { "500", 500, 501 },
+            { "-1", 999, 1001 }
+        };
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( cases ); ++i )
+        {
+            CheckRecords( args, records, cases[i] );
+        }
+    }
+
+    TEST_F( CmdParseTest, RecordsIndex )
+    {
+        ASSERT_TRUE( WriteUnionsData( 1U << 16 ) );
+
+        TestStringList args = SuiteArgs( "parse_unions" );
+        std::string all;
+        ASSERT_EQ( 0, RunParse( args, "1", all ) );
+        std::vector< std::string > const records = SplitRecords( all, "count" );
+        size_t const numRecords = records.size();
+
+        // Decoding every record builds the index in the same pass
+        args.push_back( "--index" );
+        args.push_back( IndexFileName );
+        args.push_back( "--index-interval" );
+        args.push_back( "16" );
+        std::string actual;
+        ASSERT_EQ( 0, RunParse( args, "1", actual ) );
+        ASSERT_TRUE( OutputsMatch( all, actual ) );
+        std::string index;
+        ASSERT_TRUE( ReadFile( IndexFileName, index ) );
+        ASSERT_FALSE( index.empty() );
+
+        // Ranges seek with the saved index, which is left as it is
+        RangeCase const cases[] =
+        {
+            { "0:10", 0, 10 },
+            { "100:117", 100, 117 },
+            { "-100:-50", numRecords - 100, numRecords - 50 },
+            { "-20:", numRecords - 20, numRecords },
+            { "1000", 1000, 1001 }
+        };
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( cases ); ++i )
+        {
+            CheckRecords( args, records, cases[i] );
+        }
+        std::string reused;
+        ASSERT_TRUE( ReadFile( IndexFileName, reused ) );
+        ASSERT_TRUE( reused == index );
+    }
+
+    TEST_F( CmdParseTest, RecordsIndexBuild )
+    {
+        ASSERT_TRUE( WriteUnionsData( 1U << 16 ) );
+
+        TestStringList args = SuiteArgs( "parse_unions" );
+        std::string all;
+        ASSERT_EQ( 0, RunParse( args, "1", all ) );
+        std::vector< std::string > records = SplitRecords( all, "count" );
+
+        // Without the index, then building it in a pass of its own, then with it
+        TestStringList indexArgs = args;
+        indexArgs.push_back( "--index" );
+        indexArgs.push_back( IndexFileName );
+        indexArgs.push_back( "--index-interval" );
+        indexArgs.push_back( "16" );
+        RangeCase const cases[] =
+        {
+            { "100:117", 100, 117 },
+            { "-20:", records.size() - 20, records.size() },
+            { "1000", 1000, 1001 }
+        };
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( cases ); ++i )
+        {
+            CheckRecords( args, records, cases[i] );
+            std::remove( IndexFileName );
+            CheckRecords( indexArgs, records, cases[i] );
+            CheckRecords( indexArgs, records, cases[i] );
+        }
+
+        // An index of other data is built again
+        ASSERT_TRUE( WriteUnionsData( 1U << 15 ) );
+        ASSERT_EQ( 0, RunParse( args, "1", all ) );
+        records = SplitRecords( all, "count" );
+        RangeCase const staleCase = { "1000", 1000, 1001 };
+        CheckRecords( indexArgs, records, staleCase );
+    }
+
+    TEST_F( CmdParseTest, SpeculativeArrays )
+    {
+        // Arrays of multiples of 8 elements keep the records byte-aligned, where shards are
+        // searched for them
+        Random random;
+        std::string data;
+        while( data.size() < ShardedDataBytes )
+        {
+            unsigned int const n = random.Next( 3U ) * 8U;
+            data.push_back( static_cast< char >( n ) );
+            random.Append( data, ( ( 432U + ( 23U * n ) ) / 8U ) - 1U );
+        }
+        ASSERT_TRUE( WriteFile( DataFileName, data ) );
+
+        CheckThreadsMatchSequential( SuiteArgs( "parse_arrays" ) );
+    }
+
+    TEST_F( CmdParseTest, SpeculativeEmptyData )
+    {
+        // Nothing to map, so this is decoded sequentially
+        ASSERT_TRUE( WriteFile( DataFileName, std::string() ) );
+
+        std::string output;
+        ASSERT_EQ( 0, RunParse( SuiteArgs( "parse_unions" ), "2", output ) );
+        ASSERT_TRUE( output.empty() );
+    }
+
+    TEST_F( CmdParseTest, SpeculativeNoSync )
+    {
+        // The first shard boundary falls 28525 bytes into a record of 60003 bytes, so that no
+        // record begins within the bytes searched for one, and the shard is decoded again
+        std::string data;
+        while( data.size() < ShardedDataBytes )
+        {
+            data.push_back( '\x01' );
+            data.push_back( '\x60' );
+            data.push_back( '\xEA' );
+            data.append( 60000U, '\0' );
+        }
+        ASSERT_TRUE( WriteFile( SpecFileName, BlobsSpec ) );
+        ASSERT_TRUE( WriteFile( DataFileName, data ) );
+
+        CheckThreadsMatchSequential( SpecArgs() );
+    }
+
+    TEST_F( CmdParseTest, SpeculativeStrings )
+    {
+        // Strings decode from most positions, so guesses are wrong, then resynchronized
+        Random random;
+        std::string data;
+        while( data.size() < ShardedDataBytes )
+        {
+            random.Append( data, 1U );
+            for( unsigned int i = random.Next( 20U ); i > 0; --i )
+            {
+                data.push_back( static_cast< char >( 'a' + random.Next( 8U ) ) );
+            }
+            data.push_back( '\0' );
+            unsigned int const titleSize = random.Next( 30U );
+            data.push_back( static_cast< char >( titleSize ) );
+            for( unsigned int i = 0; i < titleSize; ++i )
+            {
+                data.push_back( "xyz "[random.Next( 4U )] );
+            }
+        }
+        ASSERT_TRUE( WriteFile( SpecFileName, StringsSpec ) );
+        ASSERT_TRUE( WriteFile( DataFileName, data ) );
+
+        CheckThreadsMatchSequential( SpecArgs() );
+    }
+
+    TEST_F( CmdParseTest, SpeculativeUnions )
+    {
+        // Unknown message types fail to decode, so guesses are right
+        ASSERT_TRUE( WriteUnionsData( ShardedDataBytes ) );
+
+        CheckThreadsMatchSequential( SuiteArgs( "parse_unions" ) );
+    }
+
+} // namespace BfsdlTests
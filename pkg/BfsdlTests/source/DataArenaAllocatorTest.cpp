@@ -0,0 +1,153 @@
+/**
+    BFDP Data Arena Allocator Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <cstdint>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Data/ArenaAllocator.hpp"
+#include "BfsdlTests/MockAllocator.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+    using Bfdp::Data::ArenaAllocator;
+    using Bfdp::Data::IAllocator;
+
+    class DataArenaAllocatorTest
+        : public ::testing::Test
+    {
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( DataArenaAllocatorTest, Allocate )
+    {
+        MockAllocator upstream;
+        ArenaAllocator arena( 1024U, upstream );
+        ASSERT_EQ( 0U, arena.GetBytesReserved() );
+
+        Byte* prev = NULL;
+        for( size_t i = 0; i < 8; ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "]" );
+            Byte* const ptr = static_cast< Byte* >( arena.Allocate( i ) );
+            ASSERT_NE( static_cast< Byte* >( NULL ), ptr );
+            ASSERT_EQ( 0U, reinterpret_cast< uintptr_t >( ptr ) % IAllocator::Alignment );
+
+            // Even empty allocations are distinct
+            ASSERT_NE( prev, ptr );
+            prev = ptr;
+        }
+
+        // All from one block
+        ASSERT_EQ( 1U, upstream.GetNumAllocations() );
+        ASSERT_EQ( 1024U, arena.GetBytesReserved() );
+        ASSERT_EQ( 8U * IAllocator::Alignment, arena.GetBytesAllocated() );
+
+        // Free does nothing
+        arena.Free( prev, 7U );
+        ASSERT_EQ( 8U * IAllocator::Alignment, arena.GetBytesAllocated() );
+    }
+
+    TEST_F( DataArenaAllocatorTest, AllocateBlocks )
+    {
+        MockAllocator upstream;
+        {
+            ArenaAllocator arena( 1024U, upstream );
+
+            // Fill the first block, then spill into another
+            for( size_t i = 0; i < 1024U / 64U; ++i )
+            {
+                ASSERT_NE( static_cast< void* >( NULL ), arena.Allocate( 64U ) );
+            }
+            ASSERT_EQ( 2U, upstream.GetNumAllocations() );
+
+            // Larger than a block: gets a block of its own
+            ASSERT_NE( static_cast< void* >( NULL ), arena.Allocate( 4096U ) );
+            ASSERT_EQ( 3U, upstream.GetNumOutstanding() );
+            ASSERT_LT( 4096U, upstream.GetBytesOutstanding() - 2048U );
+            ASSERT_EQ( upstream.GetBytesOutstanding(), arena.GetBytesReserved() );
+        }
+
+        // Everything is returned on destruction
+        ASSERT_EQ( 0U, upstream.GetNumOutstanding() );
+    }
+
+    TEST_F( DataArenaAllocatorTest, AllocateFailure )
+    {
+        MockAllocator upstream;
+        ArenaAllocator arena( 1024U, upstream );
+
+        ASSERT_EQ( static_cast< void* >( NULL ), arena.Allocate( SIZE_MAX ) );
+
+        upstream.SetFail( true );
+        ASSERT_EQ( static_cast< void* >( NULL ), arena.Allocate( 1U ) );
+        ASSERT_EQ( 0U, arena.GetBytesAllocated() );
+        ASSERT_EQ( 0U, arena.GetBytesReserved() );
+
+        upstream.SetFail( false );
+        ASSERT_NE( static_cast< void* >( NULL ), arena.Allocate( 1U ) );
+    }
+
+    TEST_F( DataArenaAllocatorTest, Reset )
+    {
+        MockAllocator upstream;
+        ArenaAllocator arena( 1024U, upstream );
+
+        // Nothing to release yet
+        arena.Reset();
+        ASSERT_EQ( 0U, arena.GetBytesReserved() );
+
+        void* const first = arena.Allocate( 16U );
+        ASSERT_NE( static_cast< void* >( NULL ), first );
+        for( size_t i = 0; i < 4; ++i )
+        {
+            ASSERT_NE( static_cast< void* >( NULL ), arena.Allocate( 1000U ) );
+        }
+        ASSERT_EQ( 5U, upstream.GetNumOutstanding() );
+
+        // Only the first block is kept, and it is reused from the start
+        arena.Reset();
+        ASSERT_EQ( 0U, arena.GetBytesAllocated() );
+        ASSERT_EQ( 1024U, arena.GetBytesReserved() );
+        ASSERT_EQ( 1U, upstream.GetNumOutstanding() );
+        ASSERT_EQ( first, arena.Allocate( 8U ) );
+        ASSERT_EQ( 5U, upstream.GetNumAllocations() );
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,394 @@
+/**
+    BFDP Data Big Unsigned Integer Tests
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <string>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Data/BigUint.hpp"
+#include "Bfdp/Data/Radix.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfsdlTests/MockErrorHandler.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+    using Data::BigUint;
+
+    class DataBigUintTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+            mSeed = 1U;
+        }
+
+        //! @return A pseudo-random string of digits, without a leading zero
+        std::string MakeDigits
+            (
+            size_t const aNumDigits,
+            Data::RadixType const aRadix
+            )
+        {
+            std::string digits;
+            for( size_t i = 0; i < aNumDigits; ++i )
+            {
+                mSeed = ( mSeed * 6364136223846793005ULL ) + 1442695040888963407ULL;
+                uint8_t value = static_cast< uint8_t >( ( mSeed >> 33 ) % aRadix );
+                if( ( i == 0 ) && ( value == 0U ) )
+                {
+                    value = 1U;
+                }
+                char symbol;
+                Data::ConvertBase( aRadix, value, symbol );
+                digits += symbol;
+            }
+            return digits;
+        }
+
+        static ::testing::AssertionResult SetStr
+            (
+            BigUint& aOut,
+            std::string const& aDigits,
+            Data::RadixType const aRadix
+            )
+        {
+            std::string values( aDigits.size(), '\0' );
+            for( size_t i = 0; i < aDigits.size(); ++i )
+            {
+                uint8_t value;
+                if( !Data::ConvertBase( aRadix, aDigits[i], value ) )
+                {
+                    return ::testing::AssertionFailure() << "Bad digit at " << i;
+                }
+                values[i] = static_cast< char >( value );
+            }
+
+            if( !aOut.SetDigits( aRadix, reinterpret_cast< uint8_t const* >( values.data() ), values.size() ) )
+            {
+                return ::testing::AssertionFailure() << "SetDigits failed";
+            }
+            return ::testing::AssertionSuccess();
+        }
+
+        //! Set aOut to 2^aBits - 1
+        static void SetAllOnes
+            (
+            BigUint& aOut,
+            size_t const aBits
+            )
+        {
+            BigUint one;
+            ASSERT_TRUE( one.Set( 1U ) );
+            ASSERT_TRUE( aOut.Set( 1U ) );
+            ASSERT_TRUE( aOut.ShiftLeft( aBits ) );
+            ASSERT_TRUE( aOut.Subtract( one ) );
+        }
+
+        uint64_t mSeed;
+    };
+
+    TEST_F( DataBigUintTest, Initial )
+    {
+        BigUint value;
+
+        ASSERT_TRUE( value.IsZero() );
+        ASSERT_EQ( 0U, value.GetNumLimbs() );
+        ASSERT_EQ( 0U, value.GetBitWidth() );
+        ASSERT_EQ( "0", value.GetStr() );
+
+        uint64_t out64 = 1U;
+        ASSERT_TRUE( value.GetUint64( out64 ) );
+        ASSERT_EQ( 0U, out64 );
+    }
+
+    TEST_F( DataBigUintTest, SetSmall )
+    {
+        BigUint value;
+
+        ASSERT_TRUE( value.Set( UINT64_MAX ) );
+        ASSERT_FALSE( value.IsZero() );
+        ASSERT_EQ( 1U, value.GetNumLimbs() );
+        ASSERT_EQ( 64U, value.GetBitWidth() );
+        ASSERT_EQ( "18446744073709551615", value.GetStr() );
+        ASSERT_EQ( "ffffffffffffffff", value.GetStr( 16 ) );
+
+        uint64_t out64;
+        ASSERT_TRUE( value.GetUint64( out64 ) );
+        ASSERT_EQ( UINT64_MAX, out64 );
+
+        // One more no longer fits
+        ASSERT_TRUE( value.MulAddSmall( 1U, 1U ) );
+        ASSERT_EQ( 2U, value.GetNumLimbs() );
+        ASSERT_EQ( 65U, value.GetBitWidth() );
+        ASSERT_FALSE( value.GetUint64( out64 ) );
+        ASSERT_EQ( "18446744073709551616", value.GetStr() );
+        ASSERT_EQ( "10000000000000000", value.GetStr( 16 ) );
+    }
+
+    TEST_F( DataBigUintTest, SetDigits )
+    {
+        BigUint value;
+
+        // Invalid input
+        static uint8_t const BadDigits[] = { 1, 10 };
+        ASSERT_FALSE( value.SetDigits( 10, BadDigits, BFDP_COUNT_OF_ARRAY( BadDigits ) ) );
+        ASSERT_FALSE( value.SetDigits( 1, BadDigits, 1 ) );
+
+        // Empty and leading zeros
+        ASSERT_TRUE( value.SetDigits( 10, BadDigits, 0 ) );
+        ASSERT_TRUE( value.IsZero() );
+        ASSERT_TRUE( SetStr( value, "000000000000000000000000000000042", 10 ) );
+        ASSERT_EQ( "42", value.GetStr() );
+
+        // 2^128 in several radices
+        ASSERT_TRUE( SetStr( value, "340282366920938463463374607431768211456", 10 ) );
+        ASSERT_EQ( 129U, value.GetBitWidth() );
+        ASSERT_EQ( "100000000000000000000000000000000", value.GetStr( 16 ) );
+        ASSERT_EQ( "4000000000000000000000000000000000000000000", value.GetStr( 8 ) );
+        ASSERT_TRUE( SetStr( value, "4000000000000000000000000000000000000000000", 8 ) );
+        ASSERT_EQ( "340282366920938463463374607431768211456", value.GetStr() );
+        ASSERT_TRUE( SetStr( value, "f5lxx1zz5pnorynqglhzmsp34", 36 ) );
+        ASSERT_EQ( "340282366920938463463374607431768211456", value.GetStr() );
+    }
+
+    TEST_F( DataBigUintTest, RadixRoundTrip )
+    {
+        // Lengths cover linear conversion, divide-and-conquer, and Karatsuba-sized operands
+        static size_t const Lengths[] = { 1, 19, 20, 39, 300, 321, 1000, 2500 };
+        static Data::RadixType const Radices[] = { 3, 10, 16, 36 };
+
+        for( size_t r = 0; r < BFDP_COUNT_OF_ARRAY( Radices ); ++r )
+        {
+            for( size_t l = 0; l < BFDP_COUNT_OF_ARRAY( Lengths ); ++l )
+            {
+                SCOPED_TRACE
+                    (
+                    ::testing::Message( "radix=" ) << Radices[r] << " length=" << Lengths[l]
+                    );
+
+                std::string const digits = MakeDigits( Lengths[l], Radices[r] );
+                BigUint value;
+                ASSERT_TRUE( SetStr( value, digits, Radices[r] ) );
+                std::string outStr = value.GetStr( Radices[r] );
+                ASSERT_EQ( digits, outStr );
+
+                // Cross-check through a power-of-2 radix
+                BigUint other;
+                ASSERT_TRUE( SetStr( other, value.GetStr( 2 ), 2 ) );
+                ASSERT_EQ( 0, value.Compare( other ) );
+            }
+        }
+    }
+
+    TEST_F( DataBigUintTest, AddSubtract )
+    {
+        BigUint a;
+        BigUint b;
+        ASSERT_TRUE( SetStr( a, "ffffffffffffffffffffffffffffffff", 16 ) );
+        ASSERT_TRUE( b.Set( 1U ) );
+
+        ASSERT_TRUE( a.Add( b ) );
+        ASSERT_EQ( "100000000000000000000000000000000", a.GetStr( 16 ) );
+
+        ASSERT_TRUE( a.Subtract( b ) );
+        ASSERT_EQ( "ffffffffffffffffffffffffffffffff", a.GetStr( 16 ) );
+
+        // Cannot go negative
+        ASSERT_FALSE( b.Subtract( a ) );
+
+        ASSERT_TRUE( a.Add( a ) );
+        ASSERT_EQ( "1fffffffffffffffffffffffffffffffe", a.GetStr( 16 ) );
+        ASSERT_TRUE( a.Subtract( a ) );
+        ASSERT_TRUE( a.IsZero() );
+    }
+
+    TEST_F( DataBigUintTest, Shift )
+    {
+        BigUint value;
+        ASSERT_TRUE( value.Set( 0x5U ) );
+
+        ASSERT_EQ( 0U, value.GetTrailingZeroBits() );
+
+        ASSERT_TRUE( value.ShiftLeft( 130 ) );
+        ASSERT_EQ( 133U, value.GetBitWidth() );
+        ASSERT_EQ( 130U, value.GetTrailingZeroBits() );
+        ASSERT_EQ( "1400000000000000000000000000000000", value.GetStr( 16 ) );
+
+        value.ShiftRight( 129 );
+        ASSERT_EQ( "a", value.GetStr( 16 ) );
+        ASSERT_EQ( 1U, value.GetTrailingZeroBits() );
+
+        value.ShiftRight( 4 );
+        ASSERT_TRUE( value.IsZero() );
+        ASSERT_EQ( 0U, value.GetTrailingZeroBits() );
+    }
+
+    TEST_F( DataBigUintTest, MultiplyAllOnes )
+    {
+        // (2^n - 1)^2 = 2^2n - 2^(n+1) + 1, which exercises every carry path
+        static size_t const Widths[] = { 64, 1000, 2048, 8000, 20000 };
+
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( Widths ); ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "bits=" ) << Widths[i] );
+            size_t const n = Widths[i];
+
+            BigUint value;
+            SetAllOnes( value, n );
+            ASSERT_TRUE( value.Multiply( value ) );
+
+            BigUint expected;
+            BigUint term;
+            BigUint one;
+            ASSERT_TRUE( one.Set( 1U ) );
+            ASSERT_TRUE( expected.Set( 1U ) );
+            ASSERT_TRUE( expected.ShiftLeft( 2 * n ) );
+            ASSERT_TRUE( term.Set( 1U ) );
+            ASSERT_TRUE( term.ShiftLeft( n + 1 ) );
+            ASSERT_TRUE( expected.Subtract( term ) );
+            ASSERT_TRUE( expected.Add( one ) );
+
+            ASSERT_EQ( 0, value.Compare( expected ) );
+        }
+    }
+
+    TEST_F( DataBigUintTest, MultiplyDivide )
+    {
+        // Unbalanced and balanced operand sizes, above and below the Karatsuba threshold
+        static size_t const Lengths[][2] =
+        {
+            { 5, 7 },
+            { 400, 20 },
+            { 700, 650 },
+            { 3000, 900 },
+        };
+
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( Lengths ); ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "]" );
+
+            BigUint a;
+            BigUint b;
+            BigUint c;
+            ASSERT_TRUE( SetStr( a, MakeDigits( Lengths[i][0], 10 ), 10 ) );
+            ASSERT_TRUE( SetStr( b, MakeDigits( Lengths[i][1], 10 ), 10 ) );
+            ASSERT_TRUE( SetStr( c, MakeDigits( Lengths[i][1] - 1, 10 ), 10 ) );
+
+            // Multiplication commutes
+            BigUint ab;
+            BigUint ba;
+            ASSERT_TRUE( ab.CopyFrom( a ) );
+            ASSERT_TRUE( ab.Multiply( b ) );
+            ASSERT_TRUE( ba.CopyFrom( b ) );
+            ASSERT_TRUE( ba.Multiply( a ) );
+            ASSERT_EQ( 0, ab.Compare( ba ) );
+
+            // Multiplication distributes: a * (b + c) = a * b + a * c
+            BigUint lhs;
+            BigUint rhs;
+            ASSERT_TRUE( lhs.CopyFrom( b ) );
+            ASSERT_TRUE( lhs.Add( c ) );
+            ASSERT_TRUE( lhs.Multiply( a ) );
+            ASSERT_TRUE( rhs.CopyFrom( a ) );
+            ASSERT_TRUE( rhs.Multiply( c ) );
+            ASSERT_TRUE( rhs.Add( ab ) );
+            ASSERT_EQ( 0, lhs.Compare( rhs ) );
+
+            // (a * b + c) / b = a, remainder c (since c < b)
+            BigUint quotient;
+            BigUint remainder;
+            ASSERT_TRUE( ab.Add( c ) );
+            ASSERT_TRUE( ab.Divide( b, quotient, remainder ) );
+            ASSERT_EQ( 0, quotient.Compare( a ) );
+            ASSERT_EQ( 0, remainder.Compare( c ) );
+        }
+    }
+
+    TEST_F( DataBigUintTest, Divide )
+    {
+        BigUint a;
+        BigUint b;
+        BigUint quotient;
+        BigUint remainder;
+
+        // Smaller dividend
+        ASSERT_TRUE( a.Set( 5U ) );
+        ASSERT_TRUE( b.Set( 7U ) );
+        ASSERT_TRUE( a.Divide( b, quotient, remainder ) );
+        ASSERT_TRUE( quotient.IsZero() );
+        ASSERT_EQ( "5", remainder.GetStr() );
+
+        // Single-digit divisor
+        ASSERT_TRUE( SetStr( a, "340282366920938463463374607431768211457", 10 ) );
+        ASSERT_TRUE( a.Divide( b, quotient, remainder ) );
+        ASSERT_EQ( "48611766702991209066196372490252601636", quotient.GetStr() );
+        ASSERT_EQ( "5", remainder.GetStr() );
+
+        // Divisor with a top digit that needs no normalization
+        ASSERT_TRUE( SetStr( b, "ffffffffffffffff", 16 ) );
+        ASSERT_TRUE( a.Divide( b, quotient, remainder ) );
+        ASSERT_EQ( "10000000000000001", quotient.GetStr( 16 ) );
+        ASSERT_EQ( "2", remainder.GetStr( 16 ) );
+
+        // Division by zero is misuse
+        SetMockErrorHandlers();
+        MockErrorHandler::Workspace errWorkspace;
+        ASSERT_TRUE( b.Set( 0U ) );
+        errWorkspace.ExpectMisuseError();
+        ASSERT_FALSE( a.Divide( b, quotient, remainder ) );
+        ASSERT_NO_FATAL_FAILURE( errWorkspace.VerifyMisuseError() );
+    }
+
+    TEST_F( DataBigUintTest, Power )
+    {
+        BigUint value;
+
+        ASSERT_TRUE( value.Set( 10U ) );
+        ASSERT_TRUE( value.Power( 0 ) );
+        ASSERT_EQ( "1", value.GetStr() );
+
+        ASSERT_TRUE( value.Set( 10U ) );
+        ASSERT_TRUE( value.Power( 40 ) );
+        ASSERT_EQ( "10000000000000000000000000000000000000000", value.GetStr() );
+
+        ASSERT_TRUE( value.Set( 3U ) );
+        ASSERT_TRUE( value.Power( 81 ) );
+        ASSERT_EQ( "443426488243037769948249630619149892803", value.GetStr() );
+    }
+
+} // namespace BfsdlTests
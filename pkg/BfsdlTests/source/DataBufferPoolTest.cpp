@@ -0,0 +1,169 @@
+/**
+    BFDP Data Buffer Pool Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Data/BufferPool.hpp"
+#include "Bfdp/Stream/RawStream.hpp"
+#include "BfsdlTests/MockStreamObserver.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Data::BufferPool;
+
+    class DataBufferPoolTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( DataBufferPoolTest, Reuse )
+    {
+        BufferPool pool( 2U );
+
+        void* a = pool.Allocate( 100U );
+        ASSERT_TRUE( a != NULL );
+        ASSERT_EQ( 0U, reinterpret_cast< uintptr_t >( a ) % BufferPool::PageSize );
+        ASSERT_EQ( 0U, pool.GetHits() );
+        ASSERT_EQ( 1U, pool.GetMisses() );
+
+        // The whole page is usable
+        std::memset( a, 0x5A, BufferPool::PageSize );
+        pool.Free( a, 100U );
+        ASSERT_EQ( 1U, pool.GetNumCached() );
+
+        // Sizes that round to the same number of pages reuse the buffer
+        void* b = pool.Allocate( BufferPool::PageSize );
+        ASSERT_EQ( a, b );
+        ASSERT_EQ( 1U, pool.GetHits() );
+        ASSERT_EQ( 0U, pool.GetNumCached() );
+
+        // Other sizes do not
+        void* c = pool.Allocate( BufferPool::PageSize + 1U );
+        ASSERT_TRUE( c != NULL );
+        ASSERT_NE( b, c );
+        ASSERT_EQ( 1U, pool.GetHits() );
+        ASSERT_EQ( 2U, pool.GetMisses() );
+
+        // Only up to the limit is kept
+        void* d = pool.Allocate( 1U );
+        pool.Free( b, BufferPool::PageSize );
+        pool.Free( c, BufferPool::PageSize + 1U );
+        pool.Free( d, 1U );
+        pool.Free( NULL, 1U );
+        ASSERT_EQ( 2U, pool.GetNumCached() );
+
+        pool.Trim();
+        ASSERT_EQ( 0U, pool.GetNumCached() );
+    }
+
+    TEST_F( DataBufferPoolTest, HugeBuffer )
+    {
+        BufferPool pool( 1U );
+
+        void* a = pool.Allocate( BufferPool::HugePageSize + 1U );
+        ASSERT_TRUE( a != NULL );
+        std::memset( a, 0x5A, 2U * BufferPool::HugePageSize );
+        pool.Free( a, BufferPool::HugePageSize + 1U );
+
+        ASSERT_EQ( a, pool.Allocate( 2U * BufferPool::HugePageSize ) );
+        pool.Free( a, 2U * BufferPool::HugePageSize );
+    }
+
+    TEST_F( DataBufferPoolTest, Threads )
+    {
+        static size_t const NumThreads = 4U;
+        static size_t const NumIterations = 1000U;
+        BufferPool pool( NumThreads );
+
+        std::vector< std::thread > threads;
+        for( size_t i = 0; i < NumThreads; ++i )
+        {
+            threads.push_back( std::thread( [&pool]()
+            {
+                for( size_t j = 0; j < NumIterations; ++j )
+                {
+                    void* ptr = pool.Allocate( 8192U );
+                    ASSERT_TRUE( ptr != NULL );
+                    static_cast< Bfdp::Byte* >( ptr )[j % 8192U] = 1U;
+                    pool.Free( ptr, 8192U );
+                }
+            } ) );
+        }
+        for( size_t i = 0; i < NumThreads; ++i )
+        {
+            threads[i].join();
+        }
+
+        // No more buffers were made than could be in use at once
+        ASSERT_EQ( NumThreads * NumIterations, pool.GetHits() + pool.GetMisses() );
+        ASSERT_LE( pool.GetMisses(), NumThreads );
+        ASSERT_EQ( pool.GetMisses(), pool.GetNumCached() );
+    }
+
+    TEST_F( DataBufferPoolTest, StreamBuffers )
+    {
+        // Streams borrow their read buffers from the shared pool
+        BufferPool& pool = BufferPool::GetShared();
+        size_t const initialMisses = pool.GetMisses();
+        for( size_t i = 0; i < 3U; ++i )
+        {
+            std::stringstream in( std::string( "\xab\xcd" ) );
+            MockStreamObserver observer;
+            Bfdp::Stream::RawStream stream( "PoolTest", in, observer );
+            observer.DoReadUint( 16 );
+            observer.DoEndOfStream();
+            ASSERT_TRUE( stream.ReadStream() );
+            ASSERT_FALSE( stream.HasError() );
+            ASSERT_TRUE( observer.VerifyNext( "Read U16: 0xcdab" ) );
+            ASSERT_TRUE( observer.VerifyNext( "EndOfStream" ) );
+        }
+
+        // At most the first stream needed a new buffer
+        ASSERT_LE( pool.GetMisses(), initialMisses + 1U );
+        ASSERT_LT( 0U, pool.GetNumCached() );
+    }
+
+} // namespace BfsdlTests
@@ -32,7 +32,12 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
+#include <utility>
+
 #include "Bfdp/Data/ByteBuffer.hpp"
+#include "Bfdp/Data/HeapAllocator.hpp"
+#include "BfsdlTests/MockAllocator.hpp"
 #include "BfsdlTests/TestUtil.hpp"
 
 namespace BfsdlTests
@@ -61,6 +66,37 @@ namespace BfsdlTests
         }
     };
 
+    TEST_F( DataByteBufferTest, Allocator )
+    {
+        static size_t const LargeSize = ByteBuffer::InlineSize + 5U;
+        MockAllocator allocator;
+        ByteBuffer buffer( allocator );
+        ByteBuffer heapBuffer;
+        ASSERT_EQ( &allocator, &buffer.GetAllocator() );
+        ASSERT_EQ( &Data::HeapAllocator::GetInstance(), &heapBuffer.GetAllocator() );
+
+        ASSERT_TRUE( buffer.Allocate( LargeSize ) );
+        ASSERT_FALSE( buffer.IsInline() );
+        ASSERT_EQ( 1U, allocator.GetNumOutstanding() );
+        ASSERT_EQ( LargeSize, allocator.GetBytesOutstanding() );
+
+        // Reallocation releases the old memory
+        ASSERT_TRUE( buffer.Allocate( LargeSize + 2U ) );
+        ASSERT_EQ( 1U, allocator.GetNumOutstanding() );
+        ASSERT_EQ( LargeSize + 2U, allocator.GetBytesOutstanding() );
+
+        // The allocator moves with the memory
+        buffer.Swap( heapBuffer );
+        ASSERT_EQ( &allocator, &heapBuffer.GetAllocator() );
+        ASSERT_EQ( &Data::HeapAllocator::GetInstance(), &buffer.GetAllocator() );
+        heapBuffer.Delete();
+        ASSERT_EQ( 0U, allocator.GetNumOutstanding() );
+
+        allocator.SetFail( true );
+        ASSERT_FALSE( heapBuffer.Allocate( LargeSize ) );
+        ASSERT_EQ( 0U, heapBuffer.GetSize() );
+    }
+
     TEST_F( DataByteBufferTest, CreateEmpty )
     {
         ByteBuffer buffer;
@@ -155,4 +191,74 @@ namespace BfsdlTests
         ASSERT_STREQ( "12", buffer.GetString( allocSize * 2 ).c_str() );
     }
 
+    TEST_F( DataByteBufferTest, Inline )
+    {
+        MockAllocator allocator;
+        ByteBuffer buffer( allocator );
+
+        // Small buffers never touch the allocator
+        ASSERT_TRUE( buffer.Allocate( ByteBuffer::InlineSize ) );
+        ASSERT_TRUE( buffer.IsInline() );
+        ASSERT_EQ( ByteBuffer::InlineSize, buffer.GetSize() );
+        ASSERT_EQ( 0U, reinterpret_cast< uintptr_t >( buffer.GetPtr() ) % Data::IAllocator::Alignment );
+        ASSERT_EQ( 0U, allocator.GetNumAllocations() );
+
+        // Larger ones do, and going back to inline releases them
+        ASSERT_TRUE( buffer.Allocate( ByteBuffer::InlineSize + 1U ) );
+        ASSERT_FALSE( buffer.IsInline() );
+        ASSERT_EQ( 1U, allocator.GetNumOutstanding() );
+        ASSERT_TRUE( buffer.Allocate( 1U ) );
+        ASSERT_TRUE( buffer.IsInline() );
+        ASSERT_EQ( 0U, allocator.GetNumOutstanding() );
+
+        // Allocation failure does not matter for inline buffers
+        allocator.SetFail( true );
+        ASSERT_TRUE( buffer.Allocate( 2U ) );
+        ASSERT_FALSE( buffer.Allocate( ByteBuffer::InlineSize + 1U ) );
+        ASSERT_EQ( 2U, buffer.GetSize() );
+    }
+
+    TEST_F( DataByteBufferTest, Move )
+    {
+        MockAllocator allocator;
+        for( size_t size = sTestDataSz; size <= ByteBuffer::InlineSize + sTestDataSz; size += ByteBuffer::InlineSize )
+        {
+            SCOPED_TRACE( ::testing::Message( "size=" ) << size );
+            ByteBuffer source( allocator );
+            ASSERT_TRUE( source.Allocate( size ) );
+            source.CopyFrom( sTestData, sTestDataSz );
+            Byte const* const ptr = source.GetConstPtr();
+            size_t const numAllocations = allocator.GetNumAllocations();
+
+            // Moving never copies memory drawn from the allocator
+            ByteBuffer moved( std::move( source ) );
+            ASSERT_EQ( 0U, source.GetSize() );
+            ASSERT_EQ( sConstNullPtr, source.GetConstPtr() );
+            ASSERT_EQ( &allocator, &moved.GetAllocator() );
+            ASSERT_EQ( size, moved.GetSize() );
+            ASSERT_EQ( size > ByteBuffer::InlineSize, moved.GetConstPtr() == ptr );
+            ASSERT_STREQ( "123", moved.GetString( sTestDataSz ).c_str() );
+
+            ByteBuffer assigned;
+            ASSERT_TRUE( assigned.Allocate( ByteBuffer::InlineSize * 2U ) );
+            assigned = std::move( moved );
+            ASSERT_EQ( 0U, moved.GetSize() );
+            ASSERT_EQ( &allocator, &assigned.GetAllocator() );
+            ASSERT_EQ( size, assigned.GetSize() );
+            ASSERT_STREQ( "123", assigned.GetString( sTestDataSz ).c_str() );
+            ASSERT_EQ( numAllocations, allocator.GetNumAllocations() );
+
+            // Swap works whether either side is inline
+            ByteBuffer small;
+            ASSERT_TRUE( small.Allocate( 1U ) );
+            small[0] = 'x';
+            small.Swap( assigned );
+            ASSERT_EQ( size, small.GetSize() );
+            ASSERT_STREQ( "123", small.GetString( sTestDataSz ).c_str() );
+            ASSERT_EQ( &allocator, &small.GetAllocator() );
+            ASSERT_STREQ( "x", assigned.GetString().c_str() );
+        }
+        ASSERT_EQ( 0U, allocator.GetNumOutstanding() );
+    }
+
 } // namespace BfsdlTests
@@ -202,4 +202,36 @@ namespace BfsdlTests
         ASSERT_EQ( 0U, window.GetByte(1) );
     }
 
+    TEST_F( DataByteWindowTest, SkipData )
+    {
+        ByteWindow window;
+        ASSERT_TRUE( window.Init( 3U ) );
+
+        Byte const testData12[] = { 0x01, 0x02 };
+        window.PushData( testData12, BFDP_COUNT_OF_ARRAY( testData12 ) );
+
+        // Skipping nothing has no effect
+        window.SkipData( 0U );
+        ASSERT_EQ( 0U, window.GetBeginCounter() );
+        ASSERT_EQ( 2U, window.GetEndCounter() );
+        ASSERT_EQ( 2U, window.GetSize() );
+
+        // Skipping empties the window, but counts the bytes
+        window.SkipData( 5U );
+        ASSERT_EQ( 7U, window.GetBeginCounter() );
+        ASSERT_EQ( 7U, window.GetEndCounter() );
+        ASSERT_EQ( 0U, window.GetSize() );
+        ASSERT_EQ( 0U, window.GetByte(0) );
+
+        // Data pushed afterwards is added normally
+        Byte const testData345[] = { 0x03, 0x04, 0x05 };
+        window.PushData( testData345, BFDP_COUNT_OF_ARRAY( testData345 ) );
+        ASSERT_EQ( 7U, window.GetBeginCounter() );
+        ASSERT_EQ( 10U, window.GetEndCounter() );
+        ASSERT_EQ( 3U, window.GetSize() );
+        ASSERT_EQ( 0x03, window.GetByte(0) );
+        ASSERT_EQ( 0x04, window.GetByte(1) );
+        ASSERT_EQ( 0x05, window.GetByte(2) );
+    }
+
 } // namespace BfsdlTests
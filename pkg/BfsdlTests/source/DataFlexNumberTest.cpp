@@ -242,6 +242,85 @@ namespace BfsdlTests
         }
     }
 
+    TEST_F( DataFlexNumberTest, Evaluate )
+    {
+        struct TestDataComponentType
+        {
+            Data::Sign::Value sign;
+            char const* integral;
+            char const* fractional;
+
+            ::testing::AssertionResult Set
+                (
+                FlexNumber::Component& aComponent
+                ) const
+            {
+                aComponent.sign = sign;
+                if( ( integral != NULL ) && !aComponent.integral.Set( integral, 10 ) )
+                {
+                    return ::testing::AssertionFailure() << "Bad integral";
+                }
+                if( ( fractional != NULL ) && !aComponent.fractional.Set( fractional, 10 ) )
+                {
+                    return ::testing::AssertionFailure() << "Bad fractional";
+                }
+                return ::testing::AssertionSuccess();
+            }
+        };
+
+        struct TestDataType
+        {
+            TestDataComponentType significand;
+            TestDataComponentType base;
+            TestDataComponentType exp;
+            bool result;
+            char const* rational;
+            char const* fixed; // 8 fractional bits
+        } testData[] =
+        {
+            { { Sign::Positive,    "1",   "5"  }, { Sign::Unspecified, NULL, NULL }, { Sign::Unspecified, NULL, NULL }, true, "3/2", "384" },
+            { { Sign::Negative,    "0",   "75" }, { Sign::Unspecified, NULL, NULL }, { Sign::Unspecified, NULL, NULL }, true, "-3/4", "192" },
+            { { Sign::Positive,    "0",   "0"  }, { Sign::Unspecified, NULL, NULL }, { Sign::Unspecified, NULL, NULL }, true, "0/1", "0" },
+            { { Sign::Positive,    "3",   NULL }, { Sign::Positive, "10", NULL }, { Sign::Negative, "2",  NULL }, true, "3/100", "7" },
+            { { Sign::Positive,    "2",   NULL }, { Sign::Positive, "2",  NULL }, { Sign::Positive, "10", NULL }, true, "2048/1", "524288" },
+            { { Sign::Unspecified, NULL,  NULL }, { Sign::Positive, "10", NULL }, { Sign::Positive, "3",  NULL }, true, "1000/1", "256000" },
+            { { Sign::Positive,    "0",   "1"  }, { Sign::Positive, "2",  NULL }, { Sign::Negative, "1",  NULL }, true, "1/20", "12" },
+            { { Sign::Negative,    "1",   NULL }, { Sign::Negative, "0",  "5"  }, { Sign::Positive, "3",  NULL }, true, "1/8", "32" },
+
+            // Fractional exponents are not evaluated
+            { { Sign::Positive,    "2",   NULL }, { Sign::Positive, "2",  NULL }, { Sign::Positive, "0",  "5"  }, false, NULL, NULL },
+
+            // Zero cannot be raised to a negative power
+            { { Sign::Positive,    "1",   NULL }, { Sign::Positive, "0",  NULL }, { Sign::Negative, "1",  NULL }, false, NULL, NULL },
+
+            // Results are bounded
+            { { Sign::Positive,    "1",   NULL }, { Sign::Positive, "10", NULL }, { Sign::Positive, "1000000", NULL }, false, NULL, NULL },
+        };
+
+        for( size_t i = 0; i < BFDP_COUNT_OF_ARRAY( testData ); ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "]" );
+
+            FlexNumber number;
+            ASSERT_TRUE( testData[i].significand.Set( number.significand ) );
+            ASSERT_TRUE( testData[i].base.Set( number.base ) );
+            ASSERT_TRUE( testData[i].exp.Set( number.exponent ) );
+
+            Data::BigRational rational;
+            ASSERT_EQ( testData[i].result, number.GetRational( rational ) );
+
+            Sign sign;
+            Data::BigUint fixed;
+            ASSERT_EQ( testData[i].result, number.GetFixedPoint( 8, sign, fixed ) );
+            if( testData[i].result )
+            {
+                ASSERT_STREQ( testData[i].rational, rational.GetStr().c_str() );
+                ASSERT_STREQ( testData[i].fixed, fixed.GetStr().c_str() );
+                ASSERT_EQ( rational.sign, sign );
+            }
+        }
+    }
+
     TEST_F( DataFlexNumberTest, Reset )
     {
         FlexNumber number;
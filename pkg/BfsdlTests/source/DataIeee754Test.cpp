@@ -0,0 +1,280 @@
+/**
+    BFDP Data IEEE 754 Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <cmath>
+#include <limits>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Data/Ieee754.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+
+    class DataIeee754Test
+        : public ::testing::Test
+    {
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+
+    protected:
+        //! Straightforward binary16 decode to compare against
+        static double ReferenceBinary16
+            (
+            uint16_t const aBits
+            )
+        {
+            int const exp = ( aBits >> 10 ) & 0x1F;
+            int const frac = aBits & 0x3FF;
+            double value;
+            if( exp == 0 )
+            {
+                value = std::ldexp( static_cast< double >( frac ), -24 );
+            }
+            else if( exp == 0x1F )
+            {
+                value = ( frac == 0 )
+                    ? std::numeric_limits< double >::infinity()
+                    : std::numeric_limits< double >::quiet_NaN();
+            }
+            else
+            {
+                value = std::ldexp( static_cast< double >( frac + 0x400 ), exp - 25 );
+            }
+            return ( ( aBits & 0x8000U ) != 0 ) ? -value : value;
+        }
+
+        static ::testing::AssertionResult SameValue
+            (
+            double const aExpected,
+            double const aActual
+            )
+        {
+            if( std::isnan( aExpected ) && std::isnan( aActual ) )
+            {
+                return ::testing::AssertionSuccess();
+            }
+            if( ( aExpected == aActual ) && ( std::signbit( aExpected ) == std::signbit( aActual ) ) )
+            {
+                return ::testing::AssertionSuccess();
+            }
+            return ::testing::AssertionFailure() << "expected " << aExpected << ", got " << aActual;
+        }
+    };
+
+    TEST_F( DataIeee754Test, Binary16AllValues )
+    {
+        for( uint32_t i = 0; i <= 0xFFFFU; ++i )
+        {
+            uint16_t const bits = static_cast< uint16_t >( i );
+            SCOPED_TRACE( ::testing::Message( "bits=0x" ) << std::hex << i );
+
+            double const expected = ReferenceBinary16( bits );
+            ASSERT_TRUE( SameValue( expected, Data::Ieee754::DecodeBinary16Software( bits ) ) );
+            ASSERT_TRUE( SameValue( expected, Data::Ieee754::DecodeBinary16( bits ) ) );
+        }
+    }
+
+    TEST_F( DataIeee754Test, Binary32And64 )
+    {
+        ASSERT_TRUE( SameValue( 1.0, Data::Ieee754::DecodeBinary32( 0x3F800000U ) ) );
+        ASSERT_TRUE( SameValue( -0.0, Data::Ieee754::DecodeBinary32( 0x80000000U ) ) );
+        ASSERT_TRUE( SameValue( std::ldexp( 1.0, -149 ), Data::Ieee754::DecodeBinary32( 0x00000001U ) ) );
+        ASSERT_TRUE( std::isnan( Data::Ieee754::DecodeBinary32( 0x7FC00000U ) ) );
+
+        ASSERT_TRUE( SameValue( 1.0, Data::Ieee754::DecodeBinary64( 0x3FF0000000000000ULL ) ) );
+        ASSERT_TRUE( SameValue( -2.5, Data::Ieee754::DecodeBinary64( 0xC004000000000000ULL ) ) );
+        ASSERT_TRUE( SameValue( std::ldexp( 1.0, -1074 ), Data::Ieee754::DecodeBinary64( 0x0000000000000001ULL ) ) );
+        ASSERT_TRUE( SameValue( -std::numeric_limits< double >::infinity(), Data::Ieee754::DecodeBinary64( 0xFFF0000000000000ULL ) ) );
+    }
+
+    TEST_F( DataIeee754Test, Binary128 )
+    {
+        static double const Inf = std::numeric_limits< double >::infinity();
+        static double const NaN = std::numeric_limits< double >::quiet_NaN();
+
+        static struct TestDataType
+        {
+            uint64_t inHigh;
+            uint64_t inLow;
+            double outValue;
+        } const sTestData[] =
+        {
+            // Zeros, and values that are exact in binary64
+            { 0x0000000000000000ULL, 0x0000000000000000ULL, 0.0 },
+            { 0x8000000000000000ULL, 0x0000000000000000ULL, -0.0 },
+            { 0x3FFF000000000000ULL, 0x0000000000000000ULL, 1.0 },
+            { 0xC000400000000000ULL, 0x0000000000000000ULL, -2.5 },
+            { 0x4000921FB54442D1ULL, 0x8000000000000000ULL, 3.14159265358979311600 },
+
+            // Rounding: below half, above half, and ties to even
+            { 0x3FFF000000000000ULL, 0x07FFFFFFFFFFFFFFULL, 1.0 },
+            { 0x3FFF000000000000ULL, 0x0800000000000001ULL, 1.0 + std::ldexp( 1.0, -52 ) },
+            { 0x3FFF000000000000ULL, 0x0800000000000000ULL, 1.0 },
+            { 0x3FFF000000000000ULL, 0x1800000000000000ULL, 1.0 + std::ldexp( 2.0, -52 ) },
+            { 0x3FFFFFFFFFFFFFFFULL, 0xF800000000000000ULL, 2.0 },
+
+            // Infinity, NaN, and overflow
+            { 0x7FFF000000000000ULL, 0x0000000000000000ULL, Inf },
+            { 0xFFFF000000000000ULL, 0x0000000000000000ULL, -Inf },
+            { 0x7FFF800000000000ULL, 0x0000000000000000ULL, NaN },
+            { 0x7FFF000000000000ULL, 0x0000000000000001ULL, NaN },
+            { 0x43FF000000000000ULL, 0x0000000000000000ULL, Inf },
+            { 0x43FEFFFFFFFFFFFFULL, 0xF000000000000000ULL, std::numeric_limits< double >::max() },
+            { 0x43FEFFFFFFFFFFFFULL, 0xF800000000000000ULL, Inf },
+
+            // Binary64 subnormals and underflow
+            { 0x3C00000000000000ULL, 0x0000000000000000ULL, std::ldexp( 1.0, -1023 ) },
+            { 0x3BCD000000000000ULL, 0x0000000000000000ULL, std::ldexp( 1.0, -1074 ) },
+            { 0x3BCC000000000000ULL, 0x0000000000000000ULL, 0.0 },
+            { 0x3BCC000000000000ULL, 0x0000000000000001ULL, std::ldexp( 1.0, -1074 ) },
+            { 0x3BCB000000000000ULL, 0x0000000000000000ULL, 0.0 },
+            { 0x0000000000000001ULL, 0x0000000000000000ULL, 0.0 },
+        };
+        static size_t const sNumTests = BFDP_COUNT_OF_ARRAY( sTestData );
+
+        for( size_t i = 0; i < sNumTests; ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "] high=0x" << std::hex << sTestData[i].inHigh << " low=0x" << sTestData[i].inLow );
+            ASSERT_TRUE( SameValue( sTestData[i].outValue, Data::Ieee754::DecodeBinary128( sTestData[i].inHigh, sTestData[i].inLow ) ) );
+        }
+    }
+
+    TEST_F( DataIeee754Test, EncodeBinary16AllValues )
+    {
+        for( uint32_t i = 0; i <= 0xFFFFU; ++i )
+        {
+            uint16_t const bits = static_cast< uint16_t >( i );
+            SCOPED_TRACE( ::testing::Message( "bits=0x" ) << std::hex << i );
+
+            uint16_t const encoded = Data::Ieee754::EncodeBinary16( ReferenceBinary16( bits ) );
+            if( ( ( bits & 0x7C00U ) == 0x7C00U ) && ( ( bits & 0x03FFU ) != 0 ) )
+            {
+                // NaN keeps its sign and stays NaN (quiet)
+                ASSERT_EQ( bits & 0xFC00U, encoded & 0xFC00U );
+                ASSERT_NE( 0U, encoded & 0x0200U );
+            }
+            else
+            {
+                ASSERT_EQ( bits, encoded );
+            }
+        }
+    }
+
+    TEST_F( DataIeee754Test, EncodeBinary16Rounding )
+    {
+        static struct TestDataType
+        {
+            double inValue;
+            uint16_t outBits;
+        } const sTestData[] =
+        {
+            // Below half, above half, and ties to even
+            { 1.0 + std::ldexp( 1.0, -12 ), 0x3C00U },
+            { 1.0 + std::ldexp( 3.0, -12 ), 0x3C01U },
+            { 1.0 + std::ldexp( 1.0, -11 ), 0x3C00U },
+            { 1.0 + std::ldexp( 3.0, -11 ), 0x3C02U },
+            { 2.0 - std::ldexp( 1.0, -12 ), 0x4000U },
+
+            // Overflow
+            { 65504.0, 0x7BFFU },
+            { 65519.0, 0x7BFFU },
+            { 65520.0, 0x7C00U },
+            { -1.0e10, 0xFC00U },
+
+            // Subnormals and underflow
+            { std::ldexp( 1.0, -24 ), 0x0001U },
+            { std::ldexp( 1.0, -25 ), 0x0000U },
+            { std::ldexp( 3.0, -26 ), 0x0001U },
+            { -std::ldexp( 1.0, -14 ) + std::ldexp( 1.0, -25 ), 0x8400U },
+            { std::ldexp( 1.0, -60 ), 0x0000U },
+            { std::ldexp( 1.0, -1074 ), 0x0000U },
+        };
+        static size_t const sNumTests = BFDP_COUNT_OF_ARRAY( sTestData );
+
+        for( size_t i = 0; i < sNumTests; ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "] value=" << sTestData[i].inValue );
+            ASSERT_EQ( sTestData[i].outBits, Data::Ieee754::EncodeBinary16( sTestData[i].inValue ) );
+        }
+    }
+
+    TEST_F( DataIeee754Test, EncodeBinary128 )
+    {
+        static double const Inf = std::numeric_limits< double >::infinity();
+
+        static struct TestDataType
+        {
+            double inValue;
+            uint64_t outHigh;
+            uint64_t outLow;
+        } const sTestData[] =
+        {
+            { 0.0, 0x0000000000000000ULL, 0x0000000000000000ULL },
+            { -0.0, 0x8000000000000000ULL, 0x0000000000000000ULL },
+            { 1.0, 0x3FFF000000000000ULL, 0x0000000000000000ULL },
+            { -2.5, 0xC000400000000000ULL, 0x0000000000000000ULL },
+            { 3.14159265358979311600, 0x4000921FB54442D1ULL, 0x8000000000000000ULL },
+            { Inf, 0x7FFF000000000000ULL, 0x0000000000000000ULL },
+            { -Inf, 0xFFFF000000000000ULL, 0x0000000000000000ULL },
+            { std::numeric_limits< double >::max(), 0x43FEFFFFFFFFFFFFULL, 0xF000000000000000ULL },
+            { std::ldexp( 1.0, -1023 ), 0x3C00000000000000ULL, 0x0000000000000000ULL },
+            { std::ldexp( 1.0, -1074 ), 0x3BCD000000000000ULL, 0x0000000000000000ULL },
+        };
+        static size_t const sNumTests = BFDP_COUNT_OF_ARRAY( sTestData );
+
+        for( size_t i = 0; i < sNumTests; ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "] value=" << sTestData[i].inValue );
+            uint64_t high = 0;
+            uint64_t low = 0;
+            Data::Ieee754::EncodeBinary128( sTestData[i].inValue, high, low );
+            ASSERT_EQ( sTestData[i].outHigh, high );
+            ASSERT_EQ( sTestData[i].outLow, low );
+            ASSERT_TRUE( SameValue( sTestData[i].inValue, Data::Ieee754::DecodeBinary128( high, low ) ) );
+        }
+
+        // NaN stays NaN
+        uint64_t high = 0;
+        uint64_t low = 0;
+        Data::Ieee754::EncodeBinary128( std::numeric_limits< double >::quiet_NaN(), high, low );
+        ASSERT_TRUE( std::isnan( Data::Ieee754::DecodeBinary128( high, low ) ) );
+    }
+
+} // namespace BfsdlTests
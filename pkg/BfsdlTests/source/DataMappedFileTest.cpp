@@ -0,0 +1,138 @@
+/**
+    BFDP Data Mapped File Tests
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "Bfdp/Data/MappedFile.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Data::MappedFile;
+
+    class DataMappedFileTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+
+        void TearDown()
+        {
+            std::remove( FileName );
+        }
+
+        static void WriteFile
+            (
+            char const* const aData,
+            size_t const aSize
+            )
+        {
+            std::ofstream out( FileName, std::ios::out | std::ios::binary | std::ios::trunc );
+            out.write( aData, static_cast< std::streamsize >( aSize ) );
+        }
+
+        static char const* const FileName;
+    };
+
+    char const* const DataMappedFileTest::FileName = "DataMappedFileTest.tmp";
+
+    TEST_F( DataMappedFileTest, Initial )
+    {
+        MappedFile file;
+
+        ASSERT_FALSE( file.IsOpen() );
+        ASSERT_TRUE( file.GetConstPtr() == NULL );
+        ASSERT_EQ( 0U, file.GetSize() );
+    }
+
+    TEST_F( DataMappedFileTest, MissingFile )
+    {
+        MappedFile file;
+
+        ASSERT_FALSE( file.Open( "DataMappedFileTest.missing" ) );
+        ASSERT_FALSE( file.IsOpen() );
+        ASSERT_TRUE( file.GetConstPtr() == NULL );
+    }
+
+    TEST_F( DataMappedFileTest, EmptyFile )
+    {
+        WriteFile( "", 0 );
+
+        MappedFile file;
+        ASSERT_TRUE( file.Open( FileName ) );
+        ASSERT_TRUE( file.IsOpen() );
+        ASSERT_EQ( 0U, file.GetSize() );
+        ASSERT_TRUE( file.GetConstPtr() == NULL );
+    }
+
+    TEST_F( DataMappedFileTest, NonRegularFile )
+    {
+        // Devices (like pipes) must be streamed; they are not mistaken for empty files
+#if defined( _WIN32 )
+        static char const* const DeviceName = "NUL";
+#else
+        static char const* const DeviceName = "/dev/null";
+#endif
+
+        MappedFile file;
+        ASSERT_FALSE( file.Open( DeviceName ) );
+        ASSERT_FALSE( file.IsOpen() );
+        ASSERT_TRUE( file.GetConstPtr() == NULL );
+        ASSERT_EQ( 0U, file.GetSize() );
+    }
+
+    TEST_F( DataMappedFileTest, ReadContents )
+    {
+        static char const TestData[] = "Mapped\0File\n";
+        WriteFile( TestData, sizeof( TestData ) );
+
+        MappedFile file;
+        ASSERT_TRUE( file.Open( FileName ) );
+        ASSERT_TRUE( file.IsOpen() );
+        ASSERT_EQ( sizeof( TestData ), file.GetSize() );
+        ASSERT_EQ( 0, std::memcmp( TestData, file.GetConstPtr(), sizeof( TestData ) ) );
+
+        file.Close();
+        ASSERT_FALSE( file.IsOpen() );
+        ASSERT_TRUE( file.GetConstPtr() == NULL );
+        ASSERT_EQ( 0U, file.GetSize() );
+    }
+
+} // namespace BfsdlTests
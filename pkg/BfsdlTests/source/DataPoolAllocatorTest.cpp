@@ -0,0 +1,136 @@
+/**
+    BFDP Data Pool Allocator Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External Includes
+#include <cstdint>
+#include <set>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Data/PoolAllocator.hpp"
+#include "BfsdlTests/MockAllocator.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using namespace Bfdp;
+    using Bfdp::Data::IAllocator;
+    using Bfdp::Data::PoolAllocator;
+
+    class DataPoolAllocatorTest
+        : public ::testing::Test
+    {
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( DataPoolAllocatorTest, Allocate )
+    {
+        MockAllocator upstream;
+        {
+            PoolAllocator pool( upstream );
+            std::set< void* > ptrs;
+
+            // Two sizes of each class; one slab per class
+            for( size_t classSize = PoolAllocator::MinClassSize; classSize <= PoolAllocator::MaxClassSize; classSize <<= 1 )
+            {
+                for( size_t size = classSize / 2U + 1U; size <= classSize; size += classSize / 2U - 1U )
+                {
+                    SCOPED_TRACE( ::testing::Message( "size=" ) << size );
+                    void* const ptr = pool.Allocate( size );
+                    ASSERT_NE( static_cast< void* >( NULL ), ptr );
+                    ASSERT_EQ( 0U, reinterpret_cast< uintptr_t >( ptr ) % IAllocator::Alignment );
+                    ASSERT_TRUE( ptrs.insert( ptr ).second );
+                }
+            }
+            ASSERT_EQ( 18U, ptrs.size() );
+            ASSERT_EQ( 9U, upstream.GetNumAllocations() );
+            ASSERT_EQ( 9U * PoolAllocator::SlabSize, pool.GetBytesReserved() );
+        }
+
+        // Slabs are returned on destruction
+        ASSERT_EQ( 0U, upstream.GetNumOutstanding() );
+    }
+
+    TEST_F( DataPoolAllocatorTest, AllocateFailure )
+    {
+        MockAllocator upstream;
+        PoolAllocator pool( upstream );
+
+        upstream.SetFail( true );
+        ASSERT_EQ( static_cast< void* >( NULL ), pool.Allocate( 1U ) );
+        ASSERT_EQ( static_cast< void* >( NULL ), pool.Allocate( PoolAllocator::MaxClassSize + 1U ) );
+        ASSERT_EQ( 0U, pool.GetBytesReserved() );
+
+        upstream.SetFail( false );
+        ASSERT_EQ( static_cast< void* >( NULL ), pool.Allocate( SIZE_MAX ) );
+    }
+
+    TEST_F( DataPoolAllocatorTest, AllocateLarge )
+    {
+        MockAllocator upstream;
+        PoolAllocator pool( upstream );
+
+        // Passed on to the upstream allocator
+        size_t const size = PoolAllocator::MaxClassSize + 1U;
+        void* const ptr = pool.Allocate( size );
+        ASSERT_NE( static_cast< void* >( NULL ), ptr );
+        ASSERT_EQ( size, upstream.GetBytesOutstanding() );
+        ASSERT_EQ( 0U, pool.GetBytesReserved() );
+
+        pool.Free( ptr, size );
+        ASSERT_EQ( 0U, upstream.GetNumOutstanding() );
+    }
+
+    TEST_F( DataPoolAllocatorTest, Reuse )
+    {
+        MockAllocator upstream;
+        PoolAllocator pool( upstream );
+
+        void* const ptr = pool.Allocate( 100U );
+        ASSERT_NE( static_cast< void* >( NULL ), ptr );
+        pool.Free( ptr, 100U );
+        pool.Free( NULL, 100U );
+
+        // Sizes of the same class get the freed chunk; others do not
+        ASSERT_EQ( ptr, pool.Allocate( 65U ) );
+        void* const other = pool.Allocate( 64U );
+        ASSERT_NE( ptr, other );
+        pool.Free( other, 64U );
+        ASSERT_EQ( other, pool.Allocate( 33U ) );
+        ASSERT_EQ( 2U, upstream.GetNumAllocations() );
+    }
+
+} // namespace BfsdlTests
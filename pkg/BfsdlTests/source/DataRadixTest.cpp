@@ -32,6 +32,7 @@
 
 // External includes
 #include <cctype>
+#include <string>
 #include "gtest/gtest.h"
 
 // Internal Includes
@@ -134,6 +135,78 @@ namespace BfsdlTests
         }
     }
 
+    TEST_F( DataRadixTest, ConvertDigits )
+    {
+        struct TestDataType
+        {
+            Data::RadixType radix;
+            char const* digits;
+            bool result;
+            uint64_t value;
+        } TestData[] =
+        {
+            { 1, "0", false, 0ULL },
+            { 2, "", true, 0ULL },
+
+            // Base-2
+            { 2, "1011", true, 0xBULL },
+            { 2, "0000000000000000000000000000000000000000000000000000000000000000001", true, 1ULL },
+            { 2, "10000000000000000000000000000000000000000000000000000000000000000", false, 0ULL },
+            { 2, "12", false, 0ULL },
+
+            // Base-10: less than, equal to, and more than 8 digits
+            { 10, "1234567", true, 1234567ULL },
+            { 10, "12345678", true, 12345678ULL },
+            { 10, "123456789", true, 123456789ULL },
+            { 10, "0012345678901234567890", true, 12345678901234567890ULL },
+            { 10, "18446744073709551615", true, UINT64_MAX },
+            { 10, "18446744073709551616", false, 0ULL },
+            { 10, "99999999999999999999", false, 0ULL },
+            { 10, "0000000018446744073709551615", true, UINT64_MAX },
+            { 10, "1234567a", false, 0ULL },
+            { 10, "12345/78", false, 0ULL },
+            { 10, "12345:78", false, 0ULL },
+            { 10, "1234567\x80", false, 0ULL },
+            { 10, "123456789012345\x10", false, 0ULL },
+
+            // Base-16: less than, equal to, and more than 8 digits
+            { 16, "09afAF", true, 0x09AFAFULL },
+            { 16, "0123abcd", true, 0x0123ABCDULL },
+            { 16, "DEADbeef01", true, 0xDEADBEEF01ULL },
+            { 16, "FFFFFFFFFFFFFFFF", true, UINT64_MAX },
+            { 16, "00000000FFFFFFFFFFFFFFFF", true, UINT64_MAX },
+            { 16, "10000000000000000", false, 0ULL },
+            { 16, "0123abcg", false, 0ULL },
+            { 16, "0123@bcd", false, 0ULL },
+            { 16, "0123`bcd", false, 0ULL },
+            { 16, "0123GBCD", false, 0ULL },
+            { 16, "\x10\x11\x12\x13\x14\x15\x16\x17", false, 0ULL },
+
+            // Base-36
+            { 36, "zz", true, 1295ULL },
+        };
+        static size_t const TestCount = BFDP_COUNT_OF_ARRAY( TestData );
+
+        for( size_t i = 0; i < TestCount; ++i )
+        {
+            TestDataType& t = TestData[i];
+            SCOPED_TRACE
+                (
+                ::testing::Message( "[" ) << i << "]"
+                << " radix=" << t.radix
+                << " digits=" << t.digits
+                );
+
+            std::string const digits( t.digits );
+            uint64_t outValue;
+            ASSERT_EQ( t.result, Data::ConvertDigits( t.radix, digits.data(), digits.size(), outValue ) );
+            if( t.result )
+            {
+                ASSERT_EQ( t.value, outValue );
+            }
+        }
+    }
+
     TEST_F( DataRadixTest, RadixProperties )
     {
         struct TestDataType
@@ -148,4 +148,58 @@ namespace BfsdlTests
         ASSERT_FALSE( machine.GetString( ascii, strVal ) );
     }
 
+    TEST_F( DataStringMachineTest, HexAllBytes )
+    {
+        // Cover every byte value, and lengths which are not a multiple of the block size
+        for( size_t length = 250; length <= 256; ++length )
+        {
+            SCOPED_TRACE( ::testing::Message( "length=" ) << length );
+
+            StringMachine machine;
+            std::string expected;
+            for( size_t i = 0; i < length; ++i )
+            {
+                static char const HexDigits[] = "0123456789abcdef";
+                unsigned char const value = static_cast< unsigned char >( 255U - i );
+                machine.AppendUtf8( std::string( 1, static_cast< char >( value ) ) );
+                expected += HexDigits[value >> 4];
+                expected += HexDigits[value & 0xF];
+            }
+
+            ASSERT_EQ( expected, machine.GetUtf8HexString() );
+        }
+    }
+
+    TEST_F( DataStringMachineTest, InterleavedAppend )
+    {
+        StringMachine machine;
+        std::string expected;
+
+        for( size_t i = 0; i < 1000; ++i )
+        {
+            std::string const part( 1 + ( i % 7 ), static_cast< char >( 'a' + ( i % 26 ) ) );
+            machine.AppendUtf8( part );
+            expected += part;
+            ASSERT_EQ( expected.size(), machine.GetUtf8String().size() );
+        }
+        ASSERT_EQ( expected, machine.GetUtf8String() );
+    }
+
+    TEST_F( DataStringMachineTest, Reset )
+    {
+        StringMachine machine;
+
+        machine.AppendUtf8( "abc" );
+        ASSERT_STREQ( "abc", machine.GetUtf8String().c_str() );
+        machine.AppendUtf8( "def" );
+
+        machine.Reset();
+        ASSERT_FALSE( machine.IsDefined() );
+        ASSERT_TRUE( machine.IsEmpty() );
+        ASSERT_TRUE( machine.GetUtf8String().empty() );
+
+        machine.AppendUtf8( "x" );
+        ASSERT_STREQ( "x", machine.GetUtf8String().c_str() );
+    }
+
 } // namespace BfsdlTests
@@ -0,0 +1,274 @@
+/**
+    BFSDL Steady-State Decode Allocation Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "App/Commands.hpp"
+#include "App/Context.hpp"
+#include "Bfdp/Macros.hpp"
+#include "BfsdlTests/AllocationCounter.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Byte;
+
+    namespace DecodeAllocationTestInternal
+    {
+
+        //! Enough records to refill the stream buffer many times over
+        static size_t const NumRecords = 20000U;
+
+        //! Consecutive strings in different codings
+        static char const StringsSpec[] =
+            ":BFSDL_HEADER\n"
+            ":Version=#1#\n"
+            ":BitBase=\"Bit\"\n"
+            ":DefaultStringCode=\"UTF8\"\n"
+            ":END_HEADER\n"
+            "\n"
+            "u8 id;\n"
+            "cstring name;\n"
+            "string.plen(#8#).code(\"MS-1252\") title;\n";
+
+        static Byte const StringsRecord[] = { 0x01U, 'h', 'i', 0x00U, 0x02U, 'c', 0xE9U };
+
+        static char const FloatsSpec[] =
+            ":BFSDL_HEADER\n"
+            ":Version=#1#\n"
+            ":IEEE754Version=#2008#\n"
+            ":DefaultFloatFormat=\"binary32\"\n"
+            ":DefaultByteOrder=\"LE\"\n"
+            ":CustomExtension=\"ieee754\"\n"
+            ":END_HEADER\n"
+            "\n"
+            "f single;\n"
+            "f.(\"double\") dbl;\n";
+
+        //! 1.5 and -0.25
+        static Byte const FloatsRecord[] =
+        {
+            0x00U, 0x00U, 0xC0U, 0x3FU,
+            0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xD0U, 0xBFU
+        };
+
+        //! Discards everything written to it
+        class NullBuffer BFDP_FINAL
+            : public std::streambuf
+        {
+        protected:
+            BFDP_OVERRIDE( int_type overflow
+                (
+                int_type aChar
+                ) )
+            {
+                return traits_type::not_eof( aChar );
+            }
+
+            BFDP_OVERRIDE( std::streamsize xsputn
+                (
+                char_type const* aData,
+                std::streamsize aCount
+                ) )
+            {
+                BFDP_UNUSED_PARAMETER( aData );
+                return aCount;
+            }
+        };
+
+    } // namespace DecodeAllocationTestInternal
+
+    using namespace DecodeAllocationTestInternal;
+
+    class DecodeAllocationTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+
+        void TearDown()
+        {
+            std::remove( SpecFileName );
+            std::remove( DataFileName );
+        }
+
+        //! Decode aNumRecords copies of aRecord with bfdp parse and the specification in file
+        //! aSpecFileName
+        //!
+        //! @return The number of allocations made by the command, or (size_t)-1 on failure
+        static size_t CountParseAllocations
+            (
+            std::string const& aSpecFileName,
+            Byte const* const aRecord,
+            size_t const aRecordSize,
+            size_t const aNumRecords
+            )
+        {
+            std::ofstream data( DataFileName, std::ios::out | std::ios::binary | std::ios::trunc );
+            for( size_t i = 0; i < aNumRecords; ++i )
+            {
+                data.write( reinterpret_cast< char const* >( aRecord ), static_cast< std::streamsize >( aRecordSize ) );
+            }
+            data.close();
+            if( !data )
+            {
+                return static_cast< size_t >( -1 );
+            }
+
+            char const* const argv[] =
+            {
+                APP_CMD_PARSE_NAME,
+                "--spec", aSpecFileName.c_str(),
+                "--data", DataFileName
+            };
+
+            // The decoder captures std::cout when it is created, so swap it before running
+            NullBuffer nullBuffer;
+            std::streambuf* const coutBuffer = std::cout.rdbuf( &nullBuffer );
+            App::Context context;
+            context.Silence();
+
+            AllocationCounter counter;
+            int const ret = App::CmdParse( context, static_cast< int >( BFDP_COUNT_OF_ARRAY( argv ) ), argv );
+            size_t const numAllocations = counter.GetNumAllocations();
+
+            std::cout.rdbuf( coutBuffer );
+            return ( ret == 0 ) ? numAllocations : static_cast< size_t >( -1 );
+        }
+
+        //! Check that decoding more records with bfdp parse makes no more allocations
+        //!
+        //! Both runs refill the stream buffer many times, so they differ only in the number of
+        //! records decoded once the loop is warmed up.
+        static void CheckSteadyState
+            (
+            std::string const& aSpecFileName,
+            Byte const* const aRecord,
+            size_t const aRecordSize
+            )
+        {
+            // Warm up anything kept between runs (e.g., the stream buffer pool)
+            ASSERT_NE( static_cast< size_t >( -1 ), CountParseAllocations( aSpecFileName, aRecord, aRecordSize, NumRecords ) );
+
+            size_t const baseAllocations = CountParseAllocations( aSpecFileName, aRecord, aRecordSize, NumRecords );
+            ASSERT_NE( static_cast< size_t >( -1 ), baseAllocations );
+            size_t const doubleAllocations = CountParseAllocations( aSpecFileName, aRecord, aRecordSize, NumRecords * 2U );
+            ASSERT_NE( static_cast< size_t >( -1 ), doubleAllocations );
+            ASSERT_EQ( baseAllocations, doubleAllocations );
+        }
+
+        //! Check the steady state of decoding copies of the first aRecordSize bytes of the data of
+        //! test suite aName (e.g., parse_bits)
+        static void CheckSuiteSteadyState
+            (
+            std::string const& aName,
+            size_t const aRecordSize
+            )
+        {
+            std::string data;
+            ASSERT_TRUE( ReadFile( GetSpecPath( aName + "_raw.bin" ), data ) );
+            ASSERT_LE( aRecordSize, data.size() );
+            CheckSteadyState( GetSpecPath( aName + ".bfsdl" ), reinterpret_cast< Byte const* >( data.data() ), aRecordSize );
+        }
+
+        //! Save specification aSpec to SpecFileName
+        //!
+        //! @return true if successful, false otherwise.
+        static bool WriteSpec
+            (
+            char const* const aSpec
+            )
+        {
+            std::ofstream spec( SpecFileName, std::ios::out | std::ios::binary | std::ios::trunc );
+            spec.write( aSpec, static_cast< std::streamsize >( std::strlen( aSpec ) ) );
+            spec.close();
+            return !spec.fail();
+        }
+
+        static char const* const SpecFileName;
+        static char const* const DataFileName;
+    };
+
+    char const* const DecodeAllocationTest::SpecFileName = "DecodeAllocationTest.bfsdl";
+    char const* const DecodeAllocationTest::DataFileName = "DecodeAllocationTest.bin";
+
+    TEST_F( DecodeAllocationTest, Counter )
+    {
+        AllocationCounter counter;
+        ASSERT_EQ( 0U, counter.GetNumAllocations() );
+
+        std::vector< int >* const list = new std::vector< int >( 10U );
+        ASSERT_EQ( 2U, counter.GetNumAllocations() );
+        delete list;
+
+        counter.Reset();
+        ASSERT_EQ( 0U, counter.GetNumAllocations() );
+    }
+
+    TEST_F( DecodeAllocationTest, SteadyStateBits )
+    {
+        // The data ends with a partial record after the first
+        CheckSuiteSteadyState( "parse_bits", 4U );
+    }
+
+    TEST_F( DecodeAllocationTest, SteadyStateFloats )
+    {
+        ASSERT_TRUE( WriteSpec( FloatsSpec ) );
+        CheckSteadyState( SpecFileName, FloatsRecord, sizeof( FloatsRecord ) );
+    }
+
+    TEST_F( DecodeAllocationTest, SteadyStateStrings )
+    {
+        ASSERT_TRUE( WriteSpec( StringsSpec ) );
+        CheckSteadyState( SpecFileName, StringsRecord, sizeof( StringsRecord ) );
+    }
+
+    TEST_F( DecodeAllocationTest, SteadyStateUnions )
+    {
+        // Both records of the data
+        CheckSuiteSteadyState( "parse_unions", 22U );
+    }
+
+} // namespace BfsdlTests
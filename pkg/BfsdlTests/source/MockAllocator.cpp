@@ -0,0 +1,119 @@
+/**
+    BFSDL Tests Mock Allocator Definitions
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Base Includes
+#include "BfsdlTests/MockAllocator.hpp"
+
+// External Includes
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Data/HeapAllocator.hpp"
+
+namespace BfsdlTests
+{
+
+    MockAllocator::MockAllocator()
+        : mBytesOutstanding( 0U )
+        , mFail( false )
+        , mNumAllocations( 0U )
+        , mNumOutstanding( 0U )
+    {
+    }
+
+    MockAllocator::~MockAllocator()
+    {
+        EXPECT_EQ( 0U, mNumOutstanding ) << "Memory leaked";
+    }
+
+    void* MockAllocator::Allocate
+        (
+        size_t const aSize
+        )
+    {
+        if( mFail )
+        {
+            return NULL;
+        }
+
+        void* const ptr = Bfdp::Data::HeapAllocator::GetInstance().Allocate( aSize );
+        if( ptr != NULL )
+        {
+            ++mNumAllocations;
+            ++mNumOutstanding;
+            mBytesOutstanding += aSize;
+        }
+        return ptr;
+    }
+
+    void MockAllocator::Free
+        (
+        void* const aPtr,
+        size_t const aSize
+        )
+    {
+        if( aPtr == NULL )
+        {
+            return;
+        }
+
+        EXPECT_LT( 0U, mNumOutstanding ) << "Free without Allocate";
+        EXPECT_LE( aSize, mBytesOutstanding ) << "Free size mismatch";
+        --mNumOutstanding;
+        mBytesOutstanding -= aSize;
+        Bfdp::Data::HeapAllocator::GetInstance().Free( aPtr, aSize );
+    }
+
+    void MockAllocator::SetFail
+        (
+        bool const aFail
+        )
+    {
+        mFail = aFail;
+    }
+
+    size_t MockAllocator::GetNumAllocations() const
+    {
+        return mNumAllocations;
+    }
+
+    size_t MockAllocator::GetBytesOutstanding() const
+    {
+        return mBytesOutstanding;
+    }
+
+    size_t MockAllocator::GetNumOutstanding() const
+    {
+        return mNumOutstanding;
+    }
+
+} // namespace BfsdlTests
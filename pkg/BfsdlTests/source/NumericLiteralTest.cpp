@@ -149,12 +149,13 @@ namespace BfsdlTests
             // 64 bit max => uint64
             {  2, POS, "1111111111111111111111111111111111111111111111111111111111111111", 64, true, UINT64_MAX },
             {  8, POS, "777777777777777777777", 63, true, 0x7fffffffffffffffULL }, // NOTE: 63 bits since octal...
+            {  8, POS, "1777777777777777777777", 64, true, UINT64_MAX },
             { 10, POS, "18446744073709551615", 64, true, UINT64_MAX },
             { 16, POS, "ffffffffffffffff", 64, true, UINT64_MAX },
 
             // (64 bit max + 1) => uint64
             {  2, POS, "10000000000000000000000000000000000000000000000000000000000000000", 64, false, X },
-            {  8, POS, "1777777777777777777777", 64, false, X }, // 66 bits
+            {  8, POS, "2000000000000000000000", 64, false, X },
             { 10, POS, "18446744073709551616", 64, false, X },
             { 16, POS, "10000000000000000", 64, false, X },
         };
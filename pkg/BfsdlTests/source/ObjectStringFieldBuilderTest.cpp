@@ -163,6 +163,79 @@ namespace BfsdlTests
         }
     }
 
+    TEST_F( ObjectStringFieldBuilderTest, ParseNumericAttributes )
+    {
+        static struct TestDataType
+        {
+            char const* inIdent;
+            BitBase::Type inBitBase;
+            char const* inAttrName;
+            char const* inAttrValue;
+            APR::Type outAttrResult;
+            char const* outStr;
+        } const sTestData[] =
+        {
+            // Identifier   BitBase         Attribute   Value       Result                  Output
+            { "string",     BitBase::Byte,  "len",      "0",        APR::InvalidArgument,   NULL },
+            { "string",     BitBase::Byte,  "len",      "16",       APR::Success,           "string:f16:t0;ascii" },
+            { "cstring",    BitBase::Byte,  "len",      "4",        APR::Success,           "string:f4:t0;ascii" },
+            { "pstring",    BitBase::Byte,  "len",      "4",        APR::Redefinition,      NULL },
+
+            // Identifier   BitBase         Attribute   Value       Result                  Output
+            { "string",     BitBase::Byte,  "plen",     "0",        APR::InvalidArgument,   NULL },
+            { "string",     BitBase::Byte,  "plen",     "2",        APR::Success,           "string:p16:t0;ascii" },
+            { "string",     BitBase::Byte,  "plen",     "8",        APR::Success,           "string:p64:t0;ascii" },
+            { "string",     BitBase::Byte,  "plen",     "9",        APR::InvalidArgument,   NULL },
+            { "string",     BitBase::Bit,   "plen",     "12",       APR::Success,           "string:p12:t0;ascii" },
+            { "string",     BitBase::Bit,   "plen",     "65",       APR::InvalidArgument,   NULL },
+            { "pstring",    BitBase::Byte,  "plen",     "2",        APR::Redefinition,      NULL },
+
+            // Identifier   BitBase         Attribute   Value       Result                  Output
+            { "string",     BitBase::Byte,  "term",     "10",       APR::Success,           "string:b:t10;ascii" },
+            { "string",     BitBase::Byte,  "term",     "64976",    APR::InvalidArgument,   NULL },
+            { "cstring",    BitBase::Byte,  "term",     "10",       APR::Redefinition,      NULL },
+            { "pstring",    BitBase::Byte,  "term",     "59",       APR::Success,           "string:p8:t59:tu;ascii" },
+
+            // Identifier   BitBase         Attribute   Value       Result                  Output
+            { "string",     BitBase::Byte,  "code",     "1",        APR::Unsupported,       NULL },
+            { "string",     BitBase::Byte,  "unterm",   "1",        APR::Unsupported,       NULL },
+        };
+        static size_t const sNumTests = BFDP_COUNT_OF_ARRAY( sTestData );
+
+        StringFieldBuilder builder;
+        for( size_t i = 0; i < sNumTests; ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "value=" ) << sTestData[i].inAttrValue );
+            SCOPED_TRACE( ::testing::Message( "attr=" ) << sTestData[i].inAttrName );
+            SCOPED_TRACE( ::testing::Message( "ident=" ) << sTestData[i].inIdent );
+
+            NumericLiteral literal;
+            literal.SetRadix( 10 );
+            literal.SetSignificandSign( Bfdp::Data::Sign::Positive );
+            ASSERT_TRUE( literal.SetSignificandIntegralDigits( sTestData[i].inAttrValue ) );
+            ASSERT_TRUE( literal.SetDefaultBase() );
+
+            // Reset between iterations
+            builder.Reset();
+            builder.SetBitBase( sTestData[i].inBitBase );
+
+            bool expectedResult = ( sTestData[i].outStr != NULL );
+            ASSERT_TRUE( VerifyIdent( builder, true, sTestData[i].inIdent ) );
+            ASSERT_EQ( sTestData[i].outAttrResult, builder.ParseNumericAttribute( sTestData[i].inAttrName, literal ) );
+            if( !expectedResult )
+            {
+                // The builder refuses to finalize after an attribute error
+                SetMockErrorHandlers();
+                MockErrorHandler::Workspace errWksp;
+                errWksp.ExpectInternalError();
+                ASSERT_FALSE( builder.Finalize() );
+                ASSERT_NO_FATAL_FAILURE( errWksp.VerifyInternalError() );
+                SetDefaultErrorHandlers();
+            }
+            ASSERT_TRUE( VerifyFinalize( builder, expectedResult, sTestData[i].outStr ) );
+        }
+    }
+
     TEST_F( ObjectStringFieldBuilderTest, ParseStringAttributes )
     {
         static struct TestDataType
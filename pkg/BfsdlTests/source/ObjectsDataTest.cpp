@@ -32,12 +32,16 @@
 
 #include "gtest/gtest.h"
 
+#include "BfsdlParser/Objects/ArrayField.hpp"
+#include "BfsdlParser/Objects/ClassField.hpp"
+#include "BfsdlParser/Objects/FloatField.hpp"
 #include "BfsdlParser/Objects/FStringField.hpp"
 #include "BfsdlParser/Objects/NumericField.hpp"
 #include "BfsdlParser/Objects/Property.hpp"
 #include "BfsdlParser/Objects/PStringField.hpp"
 #include "BfsdlParser/Objects/StringField.hpp"
 #include "BfsdlParser/Objects/Tree.hpp"
+#include "BfsdlParser/Objects/UnionField.hpp"
 #include "BfsdlTests/TestUtil.hpp"
 
 namespace BfsdlTests
@@ -45,9 +49,16 @@ namespace BfsdlTests
 
     using Bfdp::Unicode::GetCodingId;
 
+    using BfsdlParser::Objects::ArrayField;
+    using BfsdlParser::Objects::ArrayFieldPtr;
+    using BfsdlParser::Objects::ClassField;
+    using BfsdlParser::Objects::ClassFieldPtr;
     using BfsdlParser::Objects::Field;
     using BfsdlParser::Objects::FieldPtr;
     using BfsdlParser::Objects::FieldType;
+    using BfsdlParser::Objects::FloatField;
+    using BfsdlParser::Objects::FloatFieldPtr;
+    using BfsdlParser::Objects::FloatFormat;
     using BfsdlParser::Objects::FStringField;
     using BfsdlParser::Objects::IObject;
     using BfsdlParser::Objects::IObjectPtr;
@@ -61,6 +72,9 @@ namespace BfsdlTests
     using BfsdlParser::Objects::StringField;
     using BfsdlParser::Objects::StringFieldPtr;
     using BfsdlParser::Objects::Tree;
+    using BfsdlParser::Objects::TreePtr;
+    using BfsdlParser::Objects::UnionField;
+    using BfsdlParser::Objects::UnionFieldPtr;
 
     class ObjectsDataTest
         : public ::testing::Test
@@ -72,6 +86,99 @@ namespace BfsdlTests
         }
     };
 
+    TEST_F( ObjectsDataTest, ArrayField )
+    {
+        static NumericFieldProperties const sElementProps = { true, 12, 0 };
+        static NumericFieldProperties const sCountProps = { false, 8, 0 };
+
+        FieldPtr element = std::make_shared< NumericField >( "test", sElementProps );
+        IObjectPtr op = std::make_shared< ArrayField >( "test", element, 1000U );
+
+        ASSERT_TRUE( op != NULL );
+        ASSERT_EQ( ObjectType::Field, op->GetType() );
+        ASSERT_STREQ( "test", op->GetName().c_str() );
+
+        ASSERT_TRUE( NumericField::StaticCast( op ) == NULL );
+
+        FieldPtr fp = Field::StaticCast( op );
+        ASSERT_TRUE( fp != NULL );
+        ASSERT_STREQ( "s12[1000]", fp->GetTypeStr().c_str() );
+        ASSERT_EQ( FieldType::Array, fp->GetFieldType() );
+
+        ArrayFieldPtr afp = ArrayField::StaticCast( op );
+        ASSERT_TRUE( afp != NULL );
+        ASSERT_EQ( 1000U, afp->GetCount() );
+        ASSERT_TRUE( afp->GetCountField() == NULL );
+        ASSERT_TRUE( afp->GetElement() == element );
+
+        // Count from another field
+        NumericFieldPtr countField = std::make_shared< NumericField >( "count", sCountProps );
+        afp = std::make_shared< ArrayField >( "test", element, countField );
+        ASSERT_STREQ( "s12[count]", afp->GetTypeStr().c_str() );
+        ASSERT_TRUE( afp->GetCountField() == countField );
+    }
+
+    TEST_F( ObjectsDataTest, ClassField )
+    {
+        static NumericFieldProperties const sNumericProps = { true, 16, 0 };
+
+        TreePtr point = std::make_shared< Tree >( "Point" );
+        ASSERT_TRUE( point->Add( std::make_shared< NumericField >( "x", sNumericProps ) ) != NULL );
+        ASSERT_TRUE( point->Add( std::make_shared< NumericField >( "y", sNumericProps ) ) != NULL );
+        ASSERT_EQ( 2U, point->GetNumFields() );
+
+        IObjectPtr op = std::make_shared< ClassField >( "origin", point );
+
+        ASSERT_TRUE( op != NULL );
+        ASSERT_EQ( ObjectType::Field, op->GetType() );
+        ASSERT_STREQ( "origin", op->GetName().c_str() );
+
+        ASSERT_TRUE( NumericField::StaticCast( op ) == NULL );
+
+        FieldPtr fp = Field::StaticCast( op );
+        ASSERT_TRUE( fp != NULL );
+        ASSERT_STREQ( "Point", fp->GetTypeStr().c_str() );
+        ASSERT_EQ( FieldType::Class, fp->GetFieldType() );
+
+        ClassFieldPtr cfp = ClassField::StaticCast( op );
+        ASSERT_TRUE( cfp != NULL );
+        ASSERT_TRUE( cfp->GetClass() == point );
+
+        // Array of class records
+        ArrayFieldPtr afp = std::make_shared< ArrayField >( "corners", fp, 4U );
+        ASSERT_STREQ( "Point[4]", afp->GetTypeStr().c_str() );
+    }
+
+    TEST_F( ObjectsDataTest, FloatField )
+    {
+        IObjectPtr op = std::make_shared< FloatField >( "test", FloatFormat::Binary16 );
+
+        ASSERT_TRUE( op != NULL );
+        ASSERT_EQ( ObjectType::Field, op->GetType() );
+        ASSERT_STREQ( "test", op->GetName().c_str() );
+
+        ASSERT_TRUE( NumericField::StaticCast( op ) == NULL );
+
+        FieldPtr fp = Field::StaticCast( op );
+        ASSERT_TRUE( fp != NULL );
+        ASSERT_STREQ( "f:binary16", fp->GetTypeStr().c_str() );
+        ASSERT_EQ( FieldType::Float, fp->GetFieldType() );
+
+        FloatFieldPtr ffp = FloatField::StaticCast( op );
+        ASSERT_TRUE( ffp != NULL );
+        ASSERT_EQ( FloatFormat::Binary16, ffp->GetFormat() );
+        ASSERT_EQ( 16U, ffp->GetBits() );
+
+        // Names and aliases from Appendix C.1
+        ASSERT_EQ( FloatFormat::Binary32, FloatField::GetFormatId( "single" ) );
+        ASSERT_EQ( FloatFormat::Binary64, FloatField::GetFormatId( "double" ) );
+        ASSERT_EQ( FloatFormat::Binary128, FloatField::GetFormatId( "binary128" ) );
+        ASSERT_EQ( FloatFormat::Unknown, FloatField::GetFormatId( "decimal32" ) );
+        ASSERT_EQ( 1985U, FloatField::GetMinIeee754Version( FloatFormat::Binary32 ) );
+        ASSERT_EQ( 2008U, FloatField::GetMinIeee754Version( FloatFormat::Binary128 ) );
+        ASSERT_EQ( 128U, std::make_shared< FloatField >( "quad", FloatFormat::Binary128 )->GetBits() );
+    }
+
     TEST_F( ObjectsDataTest, FStringField )
     {
         IObjectPtr op = std::make_shared< FStringField >( "test", 0U, false, GetCodingId( "UTF8" ), 30U );
@@ -254,6 +361,12 @@ namespace BfsdlTests
         op = tree.FindProperty( "FieldOne" );
         ASSERT_TRUE( op == NULL );
 
+        // Find a field, but not a property
+        op = tree.FindField( "FieldOne" );
+        ASSERT_TRUE( op != NULL );
+        ASSERT_STREQ( "FieldOne", op->GetName().c_str() );
+        ASSERT_TRUE( tree.FindField( "PropOne" ) == NULL );
+
         // FindProperty returns NULL for a non-existent property
         op = tree.FindProperty( "doesNotExist" );
         ASSERT_TRUE( op == NULL );
@@ -271,6 +384,64 @@ namespace BfsdlTests
         ASSERT_STREQ( "PropOne", op->GetName().c_str() );
         ASSERT_EQ( ObjectType::Property, op->GetType() );
         ASSERT_TRUE( Property::StaticCast( op ) == op );
+
+        // Classes are found by name, but are not fields
+        ASSERT_EQ( 2U, tree.GetNumFields() );
+        TreePtr point = std::make_shared< Tree >( "Point" );
+        ASSERT_TRUE( tree.Add( point ) == point );
+        ASSERT_TRUE( tree.FindTree( "Point" ) == point );
+        ASSERT_TRUE( tree.FindField( "Point" ) == NULL );
+        ASSERT_TRUE( tree.FindTree( "FieldOne" ) == NULL );
+        ASSERT_EQ( 2U, tree.GetNumFields() );
+
+        // Classes must be named, and unique
+        ASSERT_TRUE( tree.Add( std::make_shared< Tree >( "Point" ) ) == NULL );
+        ASSERT_TRUE( tree.Add( std::make_shared< Tree >() ) == NULL );
+    }
+
+    TEST_F( ObjectsDataTest, UnionField )
+    {
+        static NumericFieldProperties const sTagProps = { false, 8, 0 };
+
+        NumericFieldPtr tag = std::make_shared< NumericField >( "type", sTagProps );
+        TreePtr ping = std::make_shared< Tree >( "Ping" );
+        TreePtr data = std::make_shared< Tree >( "Data" );
+
+        IObjectPtr op = std::make_shared< UnionField >( "body", tag );
+
+        ASSERT_TRUE( op != NULL );
+        ASSERT_EQ( ObjectType::Field, op->GetType() );
+        ASSERT_STREQ( "body", op->GetName().c_str() );
+
+        ASSERT_TRUE( NumericField::StaticCast( op ) == NULL );
+
+        FieldPtr fp = Field::StaticCast( op );
+        ASSERT_TRUE( fp != NULL );
+        ASSERT_STREQ( "union(type)", fp->GetTypeStr().c_str() );
+        ASSERT_EQ( FieldType::Union, fp->GetFieldType() );
+
+        UnionFieldPtr ufp = UnionField::StaticCast( op );
+        ASSERT_TRUE( ufp != NULL );
+        ASSERT_TRUE( ufp->GetTagField() == tag );
+
+        // Cases need at least one tag
+        ASSERT_FALSE( ufp->CompleteCases() );
+
+        ASSERT_TRUE( ufp->AddCase( 7U, ping ) );
+        ASSERT_TRUE( ufp->AddCase( 3U, data ) );
+        ASSERT_FALSE( ufp->AddCase( 7U, data ) );
+        ASSERT_TRUE( ufp->HasCase( 3U ) );
+        ASSERT_FALSE( ufp->HasCase( 4U ) );
+        ASSERT_EQ( 2U, ufp->GetNumCases() );
+        ASSERT_EQ( 7U, ufp->GetCaseTag( 0 ) );
+        ASSERT_TRUE( ufp->GetCaseClass( 1 ) == data );
+
+        // Once complete, cases are found by tag value
+        ASSERT_TRUE( ufp->CompleteCases() );
+        ASSERT_FALSE( ufp->AddCase( 9U, ping ) );
+        ASSERT_EQ( 0U, ufp->FindCase( 7U ) );
+        ASSERT_EQ( 1U, ufp->FindCase( 3U ) );
+        ASSERT_TRUE( ufp->FindCase( 4U ) == UnionField::NoCase );
     }
 
 } // namespace BfsdlTests
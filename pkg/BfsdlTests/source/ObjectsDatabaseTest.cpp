@@ -41,11 +41,13 @@
 #include "BfsdlParser/Objects/Database.hpp"
 #include "BfsdlParser/Objects/NumericField.hpp"
 #include "BfsdlParser/Objects/Property.hpp"
+#include "BfsdlTests/MockAllocator.hpp"
 #include "BfsdlTests/TestUtil.hpp"
 
 namespace BfsdlTests
 {
 
+    using BfsdlParser::Objects::CreateObject;
     using BfsdlParser::Objects::Database;
     using BfsdlParser::Objects::DatabasePtr;
     using BfsdlParser::Objects::Field;
@@ -98,6 +100,55 @@ namespace BfsdlTests
     }
     using namespace BfsdlTestsInternal;
 
+    TEST_F( ObjectsDatabaseTest, Allocator )
+    {
+        std::shared_ptr< MockAllocator > allocator = std::make_shared< MockAllocator >();
+        std::weak_ptr< MockAllocator > weakAllocator = allocator;
+
+        DatabasePtr db = Database::Create( allocator );
+        ASSERT_TRUE( db != NULL );
+        ASSERT_EQ( allocator, db->GetRoot()->GetAllocator() );
+        size_t const rootAllocations = allocator->GetNumAllocations();
+        ASSERT_LT( 0U, rootAllocations );
+
+        IObjectPtr fp = CreateObject< NumericField >( db->GetRoot()->GetAllocator(), "f1", NumericFieldProperties( false, 8, 0 ) );
+        ASSERT_TRUE( db->GetRoot()->Add( fp ) );
+        IObjectPtr pp = CreateObject< Property >( db->GetRoot()->GetAllocator(), "p1" );
+        ASSERT_TRUE( db->GetRoot()->Add( pp ) );
+        ASSERT_LT( rootAllocations, allocator->GetNumAllocations() );
+
+        // Objects keep the allocator alive; the last one to go releases it (and the mock checks
+        // that everything was freed)
+        allocator.reset();
+        db.reset();
+        ASSERT_FALSE( weakAllocator.expired() );
+        pp.reset();
+        fp.reset();
+        ASSERT_TRUE( weakAllocator.expired() );
+    }
+
+    TEST_F( ObjectsDatabaseTest, CreateArena )
+    {
+        DatabasePtr db = Database::CreateArena();
+        ASSERT_TRUE( db != NULL );
+        ASSERT_TRUE( db->GetRoot()->GetAllocator() != NULL );
+
+        IObjectPtr pp = CreateObject< Property >( db->GetRoot()->GetAllocator(), "p1" );
+        Property::StaticCast( pp )->SetString( "abc" );
+        ASSERT_TRUE( db->GetRoot()->Add( pp ) );
+
+        PropertyPtr found = db->GetRoot()->FindProperty( "p1" );
+        ASSERT_TRUE( found != NULL );
+        ASSERT_EQ( "abc", found->GetString() );
+    }
+
+    TEST_F( ObjectsDatabaseTest, HeapByDefault )
+    {
+        DatabasePtr db = Database::Create();
+        ASSERT_TRUE( db != NULL );
+        ASSERT_TRUE( db->GetRoot()->GetAllocator() == NULL );
+    }
+
     TEST_F( ObjectsDatabaseTest, Iterate )
     {
         char const* ExpectedData[] =
@@ -0,0 +1,147 @@
+/**
+    BFSDL Parser Parse Position Tests
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "BfsdlParser/ParsePosition.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Char;
+    using BfsdlParser::ParsePosition;
+
+    class ParsePositionTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+
+        static void Process
+            (
+            ParsePosition& aPos,
+            char const* const aText
+            )
+        {
+            aPos.ProcessNewData( Char( aText ), std::strlen( aText ) );
+        }
+    };
+
+    TEST_F( ParsePositionTest, Initial )
+    {
+        ParsePosition pos( "test", 10, 6 );
+
+        BFDP_ASSERT_STREQ( "test", pos.GetName() );
+        ASSERT_EQ( 1U, pos.GetCurLineNumber() );
+        ASSERT_EQ( 1U, pos.GetCurColNumber() );
+        ASSERT_EQ( 0U, pos.GetContextBeginColumn() );
+        ASSERT_EQ( 0U, pos.GetContextPositionOffset() );
+        BFDP_ASSERT_STREQ( "", pos.GetPrintableContext() );
+    }
+
+    TEST_F( ParsePositionTest, SingleLine )
+    {
+        ParsePosition pos( "test", 10, 6 );
+
+        char const* text = "abcdefghijklmn";
+        pos.ProcessNewData( Char( text ), 3 );
+        ASSERT_EQ( 1U, pos.GetCurLineNumber() );
+        ASSERT_EQ( 4U, pos.GetCurColNumber() );
+        ASSERT_EQ( 0U, pos.GetContextBeginColumn() );
+        ASSERT_EQ( 3U, pos.GetContextPositionOffset() );
+        BFDP_ASSERT_STREQ( "abc", pos.GetPrintableContext() );
+
+        // Data after a query continues the same line
+        pos.ProcessNewData( Char( &text[3] ), 11 );
+        ASSERT_EQ( 1U, pos.GetCurLineNumber() );
+        ASSERT_EQ( 15U, pos.GetCurColNumber() );
+        ASSERT_EQ( 4U, pos.GetContextBeginColumn() );
+        ASSERT_EQ( 10U, pos.GetContextPositionOffset() );
+        BFDP_ASSERT_STREQ( "efghijklmn", pos.GetPrintableContext() );
+    }
+
+    TEST_F( ParsePositionTest, MultiLine )
+    {
+        ParsePosition pos( "test", 10, 6 );
+
+        // The first newline character encountered is the one counted
+        char const* text = "line1\r\nline2\r\n\r\nthe fourth line";
+        pos.ProcessNewData( Char( text ), 10 );
+        pos.ProcessNewData( Char( &text[10] ), std::strlen( text ) - 10 );
+        ASSERT_EQ( 4U, pos.GetCurLineNumber() );
+        ASSERT_EQ( 16U, pos.GetCurColNumber() );
+        ASSERT_EQ( 5U, pos.GetContextBeginColumn() );
+        ASSERT_EQ( 10U, pos.GetContextPositionOffset() );
+        BFDP_ASSERT_STREQ( "ourth line", pos.GetPrintableContext() );
+
+        // Other newline characters are not counted or printed
+        pos.Checkpoint();
+        Process( pos, "\nX\n" );
+        ASSERT_EQ( 4U, pos.GetCurLineNumber() );
+        ASSERT_EQ( 17U, pos.GetCurColNumber() );
+        BFDP_ASSERT_STREQ( "urth lineX", pos.GetPrintableContext() );
+    }
+
+    TEST_F( ParsePositionTest, Checkpoint )
+    {
+        ParsePosition pos( "test", 4, 6 );
+
+        // Data is folded in before the buffer is reused
+        char buf[8];
+        std::memcpy( buf, "ab\ncdefg", 8 );
+        pos.ProcessNewData( Char( buf ), 8 );
+        pos.Checkpoint();
+        std::memcpy( buf, "hi\rjk\nlm", 8 );
+        pos.ProcessNewData( Char( buf ), 3 );
+        pos.ProcessNewData( Char( &buf[3] ), 2 );
+        ASSERT_EQ( 2U, pos.GetCurLineNumber() );
+        ASSERT_EQ( 10U, pos.GetCurColNumber() );
+        ASSERT_EQ( 5U, pos.GetContextBeginColumn() );
+        BFDP_ASSERT_STREQ( "hijk", pos.GetPrintableContext() );
+
+        pos.Checkpoint();
+        std::memcpy( buf, "zzzzzzzz", 8 );
+        ASSERT_EQ( 10U, pos.GetCurColNumber() );
+        BFDP_ASSERT_STREQ( "hijk", pos.GetPrintableContext() );
+
+        // Remainder is printed up to the first newline
+        pos.ProcessRemainderData( Char( "l\nm" ), 3 );
+        BFDP_ASSERT_STREQ( "hijkl", pos.GetPrintableContext() );
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,223 @@
+/**
+    BFSDL Parser Spec Cache Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "BfsdlParser/Objects/Database.hpp"
+#include "BfsdlParser/Objects/Property.hpp"
+#include "BfsdlParser/SpecCache.hpp"
+#include "BfsdlParser/StreamParser.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Byte;
+    using BfsdlParser::Objects::Database;
+    using BfsdlParser::Objects::DatabasePtr;
+    using BfsdlParser::Objects::Property;
+    using BfsdlParser::Objects::PropertyPtr;
+    using BfsdlParser::SpecCache;
+
+    class SpecCacheTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+            SpecCache::Get().Clear();
+        }
+
+        void TearDown()
+        {
+            std::remove( CommonFileName );
+            std::remove( LibraryFileName );
+            std::remove( CycleFileName );
+        }
+
+        //! Parse a spec as if read from a file named SpecFileName
+        //!
+        //! @return The parsed spec, or NULL on error.
+        static DatabasePtr ParseSpec
+            (
+            char const* const aText
+            )
+        {
+            DatabasePtr db = Database::Create();
+            PropertyPtr fileName = std::make_shared< Property >( "Filename" );
+            if( !fileName->SetString( SpecFileName ) || !db->GetRoot()->Add( fileName ) )
+            {
+                return NULL;
+            }
+
+            int result = BfsdlParser::ParseBuffer
+                (
+                db->GetRoot(),
+                reinterpret_cast< Byte const* >( aText ),
+                std::strlen( aText )
+                );
+            return ( result == 0 ) ? db : NULL;
+        }
+
+        static void WriteFile
+            (
+            char const* const aFileName,
+            char const* const aText
+            )
+        {
+            std::ofstream out( aFileName, std::ios::out | std::ios::binary | std::ios::trunc );
+            out << aText;
+        }
+
+        static char const* const CommonFileName;
+        static char const* const CycleFileName;
+        static char const* const LibraryFileName;
+        static char const* const SpecFileName;
+        static char const* const SpecText;
+    };
+
+    char const* const SpecCacheTest::CommonFileName = "SpecCacheTest_common.tmp";
+    char const* const SpecCacheTest::CycleFileName = "SpecCacheTest_cycle.tmp";
+    char const* const SpecCacheTest::LibraryFileName = "SpecCacheTest_library.tmp";
+    char const* const SpecCacheTest::SpecFileName = "SpecCacheTest.bfsdl";
+
+    char const* const SpecCacheTest::SpecText =
+        ":BFSDL_HEADER\n"
+        ":Version=#1#\n"
+        ":BitBase=\"Bit\"\n"
+        ":END_HEADER\n"
+        "library geo(\"SpecCacheTest_library.tmp\");\n"
+        "importfile \"SpecCacheTest_common.tmp\";\n"
+        "geo.Point origin;\n"
+        "Header header;\n";
+
+    TEST_F( SpecCacheTest, SharedAcrossSpecs )
+    {
+        static size_t const NumSpecs = 200;
+
+        WriteFile
+            (
+            LibraryFileName,
+            ":BFSDL_HEADER\n:Version=#1#\n:BitBase=\"Bit\"\n:END_HEADER\n"
+            "class Point { s16 x; s16 y; };\n"
+            );
+        WriteFile( CommonFileName, "class Header { u8 kind; u16 length; };\n" );
+
+        // Each stream is parsed once, and shared by every spec which refers to it
+        for( size_t i = 0; i < NumSpecs; ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "spec " ) << i );
+
+            DatabasePtr db = ParseSpec( SpecText );
+            ASSERT_TRUE( db != NULL );
+            ASSERT_TRUE( db->GetRoot()->FindTree( "Header" ) != NULL );
+            ASSERT_TRUE( db->GetRoot()->FindTree( "geo" ) != NULL );
+            ASSERT_TRUE( db->GetRoot()->FindTree( "geo" )->FindTree( "Point" ) != NULL );
+            ASSERT_EQ( 2U, db->GetRoot()->GetNumFields() );
+        }
+        ASSERT_EQ( 2U, SpecCache::Get().GetNumParsed() );
+        ASSERT_EQ( 2U * ( NumSpecs - 1 ), SpecCache::Get().GetNumHits() );
+
+        // New content is parsed again
+        WriteFile( CommonFileName, "class Header { u8 kind; u32 length; };\n" );
+        ASSERT_TRUE( ParseSpec( SpecText ) != NULL );
+        ASSERT_EQ( 3U, SpecCache::Get().GetNumParsed() );
+    }
+
+    TEST_F( SpecCacheTest, ImportKeyedByHeader )
+    {
+        WriteFile( CommonFileName, "u8 value;\n" );
+
+        std::string error;
+        DatabasePtr bitHeader = ParseSpec( ":BFSDL_HEADER\n:BitBase=\"Bit\"\n:END_HEADER\n" );
+        DatabasePtr byteHeader = ParseSpec( ":BFSDL_HEADER\n:BitBase=\"Byte\"\n:END_HEADER\n" );
+        ASSERT_TRUE( ( bitHeader != NULL ) && ( byteHeader != NULL ) );
+
+        // The same stream is parsed separately for each importing header
+        DatabasePtr bitImport = SpecCache::Get().Finish
+            (
+            SpecCache::Get().StartImport( CommonFileName, SpecFileName, bitHeader->GetRoot() ),
+            error
+            );
+        DatabasePtr byteImport = SpecCache::Get().Finish
+            (
+            SpecCache::Get().StartImport( CommonFileName, SpecFileName, byteHeader->GetRoot() ),
+            error
+            );
+        ASSERT_TRUE( ( bitImport != NULL ) && ( byteImport != NULL ) );
+        ASSERT_TRUE( bitImport != byteImport );
+        ASSERT_EQ( 2U, SpecCache::Get().GetNumParsed() );
+        BFDP_ASSERT_STREQ( "u8", bitImport->GetRoot()->FindField( "value" )->GetTypeStr() );
+        BFDP_ASSERT_STREQ( "u64", byteImport->GetRoot()->FindField( "value" )->GetTypeStr() );
+    }
+
+    TEST_F( SpecCacheTest, Cycle )
+    {
+        WriteFile
+            (
+            CycleFileName,
+            ":BFSDL_HEADER\n:END_HEADER\n"
+            "library self(\"SpecCacheTest_cycle.tmp\");\n"
+            "u8 value;\n"
+            );
+
+        // A stream which loads itself cannot complete
+        ClearErrorHandlers();
+        std::string error;
+        DatabasePtr db = SpecCache::Get().Finish( SpecCache::Get().StartLibrary( CycleFileName, SpecFileName ), error );
+        ASSERT_TRUE( db == NULL );
+        ASSERT_FALSE( error.empty() );
+
+        // Once the loads are done, the stream is no longer waiting on itself
+        error.clear();
+        db = SpecCache::Get().Finish( SpecCache::Get().StartLibrary( CycleFileName, SpecFileName ), error );
+        ASSERT_TRUE( db == NULL );
+        ASSERT_EQ( 1U, SpecCache::Get().GetNumHits() );
+    }
+
+    TEST_F( SpecCacheTest, Missing )
+    {
+        std::string error;
+        DatabasePtr db = SpecCache::Get().Finish( SpecCache::Get().StartLibrary( "SpecCacheTest.missing", SpecFileName ), error );
+        ASSERT_TRUE( db == NULL );
+        BFDP_ASSERT_STREQ( "Cannot find 'SpecCacheTest.missing'", error );
+        ASSERT_EQ( 0U, SpecCache::Get().GetNumParsed() );
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,113 @@
+/**
+    BFDP Stream MemoryStreamBuf Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <istream>
+#include <string>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Stream/MemoryStreamBuf.hpp"
+#include "Bfdp/Stream/RawStream.hpp"
+#include "BfsdlTests/MockStreamObserver.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Stream::MemoryStreamBuf;
+
+    class StreamMemoryStreamBufTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+    };
+
+    TEST_F( StreamMemoryStreamBufTest, Read )
+    {
+        static Bfdp::Byte const TestData[] = { 'a', 'b', 'c', 'd' };
+        MemoryStreamBuf buffer( TestData, sizeof( TestData ) );
+        std::istream in( &buffer );
+
+        char text[8];
+        in.read( text, sizeof( text ) );
+        ASSERT_EQ( 4, in.gcount() );
+        ASSERT_EQ( "abcd", std::string( text, 4 ) );
+        ASSERT_TRUE( in.eof() );
+    }
+
+    TEST_F( StreamMemoryStreamBufTest, Seek )
+    {
+        static Bfdp::Byte const TestData[] = { 'a', 'b', 'c', 'd' };
+        MemoryStreamBuf buffer( TestData, sizeof( TestData ) );
+        std::istream in( &buffer );
+
+        in.seekg( 0, std::ios::end );
+        ASSERT_EQ( 4, in.tellg() );
+
+        in.seekg( 2, std::ios::beg );
+        ASSERT_EQ( 'c', in.get() );
+        in.seekg( -2, std::ios::cur );
+        ASSERT_EQ( 'b', in.get() );
+
+        // Cannot seek outside of the memory
+        in.seekg( 5, std::ios::beg );
+        ASSERT_TRUE( in.fail() );
+        in.clear();
+        in.seekg( -1, std::ios::beg );
+        ASSERT_TRUE( in.fail() );
+    }
+
+    TEST_F( StreamMemoryStreamBufTest, ReadStream )
+    {
+        static Bfdp::Byte const TestData[] = { 0xab, 0xcd };
+        MemoryStreamBuf buffer( TestData, sizeof( TestData ) );
+        std::istream in( &buffer );
+        MockStreamObserver output;
+        Bfdp::Stream::RawStream stream( "MemoryTest", in, output );
+
+        ASSERT_TRUE( stream.Seek( 4U ) );
+        output.DoReadUint( 12 );
+        output.DoEndOfStream();
+        ASSERT_TRUE( stream.ReadStream() );
+
+        ASSERT_TRUE( output.VerifyNext( "Read U12: 0xcda" ) );
+        ASSERT_TRUE( output.VerifyNext( "EndOfStream" ) );
+        ASSERT_TRUE( output.VerifyNone() );
+        ASSERT_FALSE( stream.HasError() );
+    }
+
+} // namespace BfsdlTests
@@ -0,0 +1,171 @@
+/**
+    BFSDL Stream Parser Tests
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "Bfdp/Unicode/Common.hpp"
+#include "BfsdlParser/Objects/Common.hpp"
+#include "BfsdlParser/Objects/Database.hpp"
+#include "BfsdlParser/StreamParser.hpp"
+#include "Bfdp/ErrorReporter/Functions.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Byte;
+    using BfsdlParser::Objects::Database;
+    using BfsdlParser::Objects::DatabasePtr;
+    using BfsdlParser::Objects::Endianness;
+    using BfsdlParser::StreamParser;
+
+    class StreamParserTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+
+        //! Verify the properties set by HeaderText
+        static void CheckHeader
+            (
+            DatabasePtr const aDb
+            )
+        {
+            Endianness::Type order = Endianness::Default;
+            ASSERT_TRUE( aDb->GetRoot()->GetNumericProperty( "DefaultByteOrder", order ) );
+            ASSERT_EQ( Endianness::Big, order );
+
+            Bfdp::Unicode::CodePoint term = 0;
+            ASSERT_TRUE( aDb->GetRoot()->GetNumericProperty( "DefaultStringTerm", term ) );
+            ASSERT_EQ( 32U, term );
+
+            BFDP_ASSERT_STREQ( "UTF8", aDb->GetRoot()->GetStringProperty( "DefaultStringCode" ) );
+        }
+
+        //! Count run time errors, since a parse error is reported by each layer of the parser
+        static void CountRunTimeError
+            (
+            char const* const /* aModuleName */,
+            unsigned int const /* aLine */,
+            char const* const /* aErrorText */
+            )
+        {
+            ++sRunTimeErrors;
+        }
+
+        static Byte const* HeaderPtr()
+        {
+            return reinterpret_cast< Byte const* >( HeaderText );
+        }
+
+        static char const* const HeaderText;
+        static size_t sRunTimeErrors;
+    };
+
+    size_t StreamParserTest::sRunTimeErrors = 0;
+
+    char const* const StreamParserTest::HeaderText =
+        ":BFSDL_HEADER\n"
+        ":Version=#0#\n"
+        ":DefaultByteOrder=\"BE\"\n"
+        ":DefaultStringTerm=#32#\n"
+        ":DefaultStringCode=\"UTF8\"\n"
+        ":END_HEADER\n"
+        "// Comment\n";
+
+    TEST_F( StreamParserTest, ParseBuffer )
+    {
+        DatabasePtr db = Database::Create();
+        ASSERT_TRUE( db != NULL );
+
+        ASSERT_EQ( 0, BfsdlParser::ParseBuffer( db->GetRoot(), HeaderPtr(), std::strlen( HeaderText ) ) );
+        CheckHeader( db );
+    }
+
+    TEST_F( StreamParserTest, FeedBytes )
+    {
+        DatabasePtr db = Database::Create();
+        ASSERT_TRUE( db != NULL );
+
+        // Every token is split across calls to Feed()
+        StreamParser parser( db->GetRoot() );
+        ASSERT_TRUE( parser.IsInitOk() );
+        size_t const size = std::strlen( HeaderText );
+        for( size_t i = 0; i < size; ++i )
+        {
+            ASSERT_TRUE( parser.Feed( &HeaderPtr()[i], 1 ) );
+        }
+        ASSERT_EQ( 0, parser.Finish() );
+        CheckHeader( db );
+    }
+
+    TEST_F( StreamParserTest, FeedEmpty )
+    {
+        DatabasePtr db = Database::Create();
+        ASSERT_TRUE( db != NULL );
+
+        StreamParser parser( db->GetRoot() );
+        ASSERT_TRUE( parser.IsInitOk() );
+        ASSERT_TRUE( parser.Feed( HeaderPtr(), 0 ) );
+        ASSERT_EQ( 0, parser.Finish() );
+    }
+
+    TEST_F( StreamParserTest, ParseError )
+    {
+        sRunTimeErrors = 0;
+        Bfdp::ErrorReporter::SetRunTimeErrorHandler( CountRunTimeError );
+
+        DatabasePtr db = Database::Create();
+        ASSERT_TRUE( db != NULL );
+
+        static char const BadText[] = ":BFSDL_HEADER\n:Version=#0#\n:Bogus=#1#\n:END_HEADER\n";
+        Byte const* const badPtr = reinterpret_cast< Byte const* >( BadText );
+
+        StreamParser parser( db->GetRoot() );
+        ASSERT_TRUE( parser.IsInitOk() );
+
+        ASSERT_FALSE( parser.Feed( badPtr, sizeof( BadText ) - 1 ) );
+        ASSERT_LT( 0U, sRunTimeErrors );
+
+        // Data is rejected without further errors once an error has been reported
+        size_t const numErrors = sRunTimeErrors;
+        ASSERT_FALSE( parser.Feed( badPtr, sizeof( BadText ) - 1 ) );
+        ASSERT_EQ( 1, parser.Finish() );
+        ASSERT_EQ( numErrors, sRunTimeErrors );
+    }
+
+} // namespace BfsdlTests
@@ -331,4 +331,49 @@ namespace BfsdlTests
 
     }
 
+    TEST_F( StreamRawStreamTest, Seek )
+    {
+        SetMockErrorHandlers();
+        MockErrorHandler::Workspace errWorkspace;
+
+        ASSERT_TRUE( CreateRawStream( "\xab\xcd\xef" ) );
+
+        // Begin in the middle of the second byte
+        ASSERT_TRUE( mStream->Seek( 12U ) );
+
+        mOutput.DoReadUint( 4 );
+        mOutput.DoReadUint( 8 );
+        mOutput.DoEndOfStream();
+
+        ASSERT_TRUE( mStream->ReadStream() );
+
+        // See comments in ParseData2 for the position of each bit
+        ASSERT_TRUE( mOutput.VerifyNext( "Read U4: 0xc" ) );
+        ASSERT_TRUE( mOutput.VerifyNext( "Read U8: 0xef" ) );
+        ASSERT_TRUE( mOutput.VerifyNext( "EndOfStream" ) );
+        ASSERT_TRUE( mOutput.VerifyNone() );
+
+        // Totals count from the seek position
+        ASSERT_FALSE( mStream->HasError() );
+        ASSERT_EQ( 4U, mStream->GetTotalProcessedBits() );
+        ASSERT_EQ( 1U, mStream->GetTotalProcessedBytes() );
+    }
+
+    TEST_F( StreamRawStreamTest, SeekAfterRead )
+    {
+        SetMockErrorHandlers();
+        MockErrorHandler::Workspace errWorkspace;
+
+        ASSERT_TRUE( CreateRawStream( "\xab\xcd\xef" ) );
+
+        mOutput.DoReadUint( 8 );
+        mOutput.DoReturn( Control::Stop );
+        ASSERT_TRUE( mStream->ReadStream() );
+        ASSERT_TRUE( mOutput.VerifyNext( "Read U8: 0xab" ) );
+        ASSERT_TRUE( mOutput.VerifyNext( "Return Stop" ) );
+
+        errWorkspace.ExpectInternalError();
+        ASSERT_FALSE( mStream->Seek( 0U ) );
+    }
+
 } // namespace BfsdlTests
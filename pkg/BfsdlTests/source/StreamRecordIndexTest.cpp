@@ -0,0 +1,219 @@
+/**
+    BFDP Stream RecordIndex Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <cstdio>
+#include <fstream>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Macros.hpp"
+#include "Bfdp/Stream/RecordIndex.hpp"
+#include "BfsdlTests/MockErrorHandler.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Stream::RecordIndex;
+
+    class StreamRecordIndexTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+
+        void TearDown()
+        {
+            std::remove( FileName );
+        }
+
+        //! Index 25 records of 10 bits each, every 10 records
+        static void BuildIndex
+            (
+            RecordIndex& aIndex
+            )
+        {
+            aIndex.Reset( 10U, 32U, 0x1234U );
+            for( uint64_t record = 0; record <= 25U; record += 10U )
+            {
+                ASSERT_TRUE( aIndex.Add( record, record * 10U ) );
+            }
+            aIndex.Complete( 25U );
+        }
+
+        static char const* const FileName;
+    };
+
+    char const* const StreamRecordIndexTest::FileName = "StreamRecordIndexTest.tmp";
+
+    TEST_F( StreamRecordIndexTest, Initial )
+    {
+        RecordIndex index;
+        uint64_t record = 0;
+        uint64_t posBits = 0;
+
+        ASSERT_FALSE( index.IsComplete() );
+        ASSERT_TRUE( index.GetInterval() == RecordIndex::DefaultInterval );
+        ASSERT_FALSE( index.Find( 0U, record, posBits ) );
+    }
+
+    TEST_F( StreamRecordIndexTest, AddAndFind )
+    {
+        RecordIndex index;
+        BuildIndex( index );
+        ASSERT_TRUE( index.IsComplete() );
+        ASSERT_EQ( 25U, index.GetNumRecords() );
+
+        struct TestDataType
+        {
+            uint64_t record;
+            uint64_t foundRecord;
+            uint64_t foundPosBits;
+        } TestData[] =
+        {
+            { 0U, 0U, 0U },
+            { 9U, 0U, 0U },
+            { 10U, 10U, 100U },
+            { 19U, 10U, 100U },
+            { 24U, 20U, 200U },
+            // Past the end, the last indexed record is closest
+            { 1000U, 20U, 200U },
+        };
+        static size_t const TestCount = BFDP_COUNT_OF_ARRAY( TestData );
+
+        for( size_t i = 0; i < TestCount; ++i )
+        {
+            TestDataType& t = TestData[i];
+            SCOPED_TRACE( ::testing::Message( "record=" ) << t.record );
+
+            uint64_t record = 0;
+            uint64_t posBits = 0;
+            ASSERT_TRUE( index.Find( t.record, record, posBits ) );
+            ASSERT_EQ( t.foundRecord, record );
+            ASSERT_EQ( t.foundPosBits, posBits );
+        }
+    }
+
+    TEST_F( StreamRecordIndexTest, AddOutOfOrder )
+    {
+        RecordIndex index;
+        index.Reset( 10U, 0U, 0U );
+
+        // Records must be added at each interval, moving forward through the data
+        ASSERT_FALSE( index.Add( 10U, 0U ) );
+        ASSERT_TRUE( index.Add( 0U, 50U ) );
+        ASSERT_FALSE( index.Add( 0U, 50U ) );
+        ASSERT_FALSE( index.Add( 10U, 40U ) );
+        ASSERT_TRUE( index.Add( 10U, 50U ) );
+
+        index.Complete( 10U );
+        ASSERT_FALSE( index.Add( 20U, 60U ) );
+    }
+
+    TEST_F( StreamRecordIndexTest, SaveAndLoad )
+    {
+        RecordIndex index;
+        BuildIndex( index );
+        ASSERT_TRUE( index.Save( FileName ) );
+
+        RecordIndex loaded;
+        ASSERT_TRUE( loaded.Load( FileName ) );
+        ASSERT_TRUE( loaded.IsComplete() );
+        ASSERT_EQ( 10U, loaded.GetInterval() );
+        ASSERT_EQ( 25U, loaded.GetNumRecords() );
+        ASSERT_TRUE( loaded.IsMatch( 32U, 0x1234U ) );
+
+        // A different data size or layout makes the index stale
+        ASSERT_FALSE( loaded.IsMatch( 33U, 0x1234U ) );
+        ASSERT_FALSE( loaded.IsMatch( 32U, 0x1235U ) );
+
+        uint64_t record = 0;
+        uint64_t posBits = 0;
+        ASSERT_TRUE( loaded.Find( 15U, record, posBits ) );
+        ASSERT_EQ( 10U, record );
+        ASSERT_EQ( 100U, posBits );
+    }
+
+    TEST_F( StreamRecordIndexTest, SaveIncomplete )
+    {
+        SetMockErrorHandlers();
+        MockErrorHandler::Workspace errWorkspace;
+
+        RecordIndex index;
+        index.Reset( 10U, 0U, 0U );
+        ASSERT_TRUE( index.Add( 0U, 0U ) );
+
+        errWorkspace.ExpectRunTimeError();
+        ASSERT_FALSE( index.Save( FileName ) );
+    }
+
+    TEST_F( StreamRecordIndexTest, LoadInvalid )
+    {
+        SetMockErrorHandlers();
+        MockErrorHandler::Workspace errWorkspace;
+
+        RecordIndex index;
+
+        // A missing file is not an error; the index is simply not there yet
+        ASSERT_FALSE( index.Load( FileName ) );
+
+        char const* const TestData[] =
+        {
+            "garbage\n",
+            "BFDP-RECORD-INDEX 1\ninterval 0\ndata-bytes 1\nkey 1\nrecords 0\n0\n",
+            // One entry too few for the number of records
+            "BFDP-RECORD-INDEX 1\ninterval 10\ndata-bytes 1\nkey 1\nrecords 10\n0\n",
+            "BFDP-RECORD-INDEX 1\ninterval 10\ndata-bytes 1\nkey 1\nrecords 5\n0\nx\n",
+            "BFDP-RECORD-INDEX 1\ninterval 10\ndata-bytes 1\nkey 1\nrecords 15\n50\n40\n",
+        };
+        static size_t const TestCount = BFDP_COUNT_OF_ARRAY( TestData );
+
+        for( size_t i = 0; i < TestCount; ++i )
+        {
+            SCOPED_TRACE( ::testing::Message( "[" ) << i << "]" );
+            {
+                std::ofstream out( FileName, std::ios::out | std::ios::trunc );
+                out << TestData[i];
+            }
+
+            errWorkspace.ExpectRunTimeError();
+            ASSERT_FALSE( index.Load( FileName ) );
+            errWorkspace.VerifyRunTimeError();
+            ASSERT_FALSE( index.IsComplete() );
+        }
+    }
+
+} // namespace BfsdlTests
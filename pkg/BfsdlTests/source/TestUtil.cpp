@@ -35,6 +35,13 @@
 
 // External Includes
 #include <cstring>
+#include <fstream>
+#include <sstream>
+
+// Location of the test specifications, normally set by the build
+#if !defined( BFSDL_TESTS_SPEC_DIR )
+    #define BFSDL_TESTS_SPEC_DIR "test/specs"
+#endif
 
 namespace BfsdlTests
 {
@@ -68,6 +75,14 @@ namespace BfsdlTests
         ErrorReporter::SetRunTimeErrorHandler( NULL );
     }
 
+    std::string GetSpecPath
+        (
+        std::string const& aFileName
+        )
+    {
+        return std::string( BFSDL_TESTS_SPEC_DIR "/" ) + aFileName;
+    }
+
     static void InternalErrorHandler
         (
         char const * const aModuleName,
@@ -98,6 +113,24 @@ namespace BfsdlTests
         FAIL() << "Run Time Error in " << aModuleName << "@" << aLine << ": " << aErrorText;
     }
 
+    bool ReadFile
+        (
+        std::string const& aFileName,
+        std::string& aOutData
+        )
+    {
+        std::ifstream file( aFileName.c_str(), std::ios::in | std::ios::binary );
+        if( !file )
+        {
+            return false;
+        }
+
+        std::ostringstream data;
+        data << file.rdbuf();
+        aOutData = data.str();
+        return true;
+    }
+
     void SetDefaultErrorHandlers()
     {
         ErrorReporter::SetInternalErrorHandler( InternalErrorHandler );
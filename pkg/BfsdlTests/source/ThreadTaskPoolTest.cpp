@@ -0,0 +1,140 @@
+/**
+    BFDP Thread Task Pool Test
+
+    Copyright 2026, Daniel Kristensen, Garmin Ltd, or its subsidiaries.
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this
+      list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+    OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+    OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// External includes
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+// Internal Includes
+#include "Bfdp/Thread/TaskPool.hpp"
+#include "BfsdlTests/TestUtil.hpp"
+
+namespace BfsdlTests
+{
+
+    using Bfdp::Thread::TaskPool;
+
+    class ThreadTaskPoolTest
+        : public ::testing::Test
+    {
+    public:
+        void SetUp()
+        {
+            SetDefaultErrorHandlers();
+        }
+
+        static void Increment
+            (
+            std::atomic< size_t >* const aCount
+            )
+        {
+            ++( *aCount );
+        }
+    };
+
+    TEST_F( ThreadTaskPoolTest, RunAll )
+    {
+        static size_t const NumTasks = 1000;
+        std::atomic< size_t > count( 0U );
+
+        TaskPool pool( 4 );
+        ASSERT_EQ( 4U, pool.GetNumThreads() );
+
+        std::vector< TaskPool::TaskPtr > tasks;
+        for( size_t i = 0; i < NumTasks; ++i )
+        {
+            tasks.push_back( pool.Submit( std::bind( Increment, &count ) ) );
+        }
+        for( size_t i = 0; i < NumTasks; ++i )
+        {
+            pool.Wait( tasks[i] );
+            ASSERT_TRUE( tasks[i]->IsDone() );
+        }
+        ASSERT_TRUE( count == NumTasks );
+    }
+
+    TEST_F( ThreadTaskPoolTest, WaitRunsInline )
+    {
+        // Without workers, the task runs in the thread which waits for it
+        TaskPool pool( 0 );
+        std::thread::id runId;
+        TaskPool::TaskPtr task = pool.Submit( [&runId]() { runId = std::this_thread::get_id(); } );
+        ASSERT_FALSE( task->IsDone() );
+
+        pool.Wait( task );
+        ASSERT_TRUE( task->IsDone() );
+        ASSERT_TRUE( runId == std::this_thread::get_id() );
+
+        // Waiting again does not run the task again
+        runId = std::thread::id();
+        pool.Wait( task );
+        ASSERT_TRUE( runId == std::thread::id() );
+    }
+
+    TEST_F( ThreadTaskPoolTest, NestedWait )
+    {
+        // A task which waits on another cannot starve a single worker
+        std::atomic< size_t > count( 0U );
+        TaskPool pool( 1 );
+        TaskPool::TaskPtr outer = pool.Submit
+            (
+            [&pool, &count]()
+            {
+                TaskPool::TaskPtr inner = pool.Submit( std::bind( Increment, &count ) );
+                pool.Wait( inner );
+                ++count;
+            }
+            );
+
+        pool.Wait( outer );
+        ASSERT_TRUE( count == 2U );
+    }
+
+    TEST_F( ThreadTaskPoolTest, DestroyRunsQueued )
+    {
+        std::atomic< size_t > count( 0U );
+        {
+            TaskPool pool( 0 );
+            pool.Submit( std::bind( Increment, &count ) );
+            pool.Submit( std::bind( Increment, &count ) );
+        }
+        ASSERT_TRUE( count == 2U );
+    }
+
+    TEST_F( ThreadTaskPoolTest, DefaultNumThreads )
+    {
+        ASSERT_LE( 1U, TaskPool::GetDefaultNumThreads() );
+    }
+
+} // namespace BfsdlTests
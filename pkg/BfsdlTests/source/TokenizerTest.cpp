@@ -172,7 +172,7 @@ namespace BfsdlTests
         MockErrorHandler::Workspace errWorkspace;
 
         // Test control characters in pairs to ensure they are not concatenated
-        char const * testData = "]]::[[;;";
+        char const * testData = "]]::[[;;}}{{(())";
 
         size_t bytesRead = 0;
         size_t dataLen = std::strlen( testData );
@@ -188,6 +188,14 @@ namespace BfsdlTests
         ASSERT_TRUE( observer.VerifyNext( "Control: [" ) );
         ASSERT_TRUE( observer.VerifyNext( "Control: ;" ) );
         ASSERT_TRUE( observer.VerifyNext( "Control: ;" ) );
+        ASSERT_TRUE( observer.VerifyNext( "Control: }" ) );
+        ASSERT_TRUE( observer.VerifyNext( "Control: }" ) );
+        ASSERT_TRUE( observer.VerifyNext( "Control: {" ) );
+        ASSERT_TRUE( observer.VerifyNext( "Control: {" ) );
+        ASSERT_TRUE( observer.VerifyNext( "Control: (" ) );
+        ASSERT_TRUE( observer.VerifyNext( "Control: (" ) );
+        ASSERT_TRUE( observer.VerifyNext( "Control: )" ) );
+        ASSERT_TRUE( observer.VerifyNext( "Control: )" ) );
         ASSERT_TRUE( observer.VerifyNone() );
     }
 